@@ -89,38 +89,52 @@
 #define UME_FUNC_ATTRIB UME_FORCE_INLINE UME_ENV_FUNC_ATTRIB
 
 
-namespace UME {
-namespace SIMD {
-    // Eache plugin should define this with a 'value' field
-    // specialized depending on the architecture used.
-    // Sugested values are not guaranteed to give optimal results
-    // on any platform, but they could be used as a baseline for
-    // specific derived software.
-    template<typename SCALAR_T> struct SuggestedVecLen{/*const int value = ? */};
-}
-}
+// Each plugin branch defines UME_SIMD_PLUGIN_NAMESPACE, the name of an inline
+// namespace that holds all of the library code in UME::SIMD. Code compiled for
+// different instruction sets is then mangled differently, so translation units
+// built with different flags can be linked into a single binary without the
+// linker merging their copies of the same template instantiation. Kernels can
+// use it in the same way. See UMESimdDispatch.h for details.
+#define UME_SIMD_BEGIN_PLUGIN_NAMESPACE inline namespace UME_SIMD_PLUGIN_NAMESPACE {
+#define UME_SIMD_END_PLUGIN_NAMESPACE }
 
 #if defined FORCE_SCALAR
     #define USING_EMULATED_TYPES 1
+    #define UME_SIMD_PLUGIN_NAMESPACE scalar
     #include "plugins/UMESimdPluginScalarEmulation.h"
 #elif defined FORCE_OPENMP
+    #define UME_SIMD_PLUGIN_NAMESPACE openmp
     #include "plugins/UMESimdPluginOpenMP.h"
 #else
     #if defined __AVX512F__
+        #define UME_SIMD_PLUGIN_NAMESPACE avx512
         #include "plugins/UMESimdPluginAVX512.h"
     #elif defined (__MIC__)
+        #define UME_SIMD_PLUGIN_NAMESPACE knc
         #include "plugins/UMESimdPluginKNC.h"
     #elif defined __AVX2__
+        #define UME_SIMD_PLUGIN_NAMESPACE avx2
         #include "plugins/UMESimdPluginAVX2.h"
     #elif defined __AVX__
+        #define UME_SIMD_PLUGIN_NAMESPACE avx
         #include "plugins/UMESimdPluginAVX.h"
     #elif defined (__aarch64__) || defined (__arm__)
+        #define UME_SIMD_PLUGIN_NAMESPACE arm
         #include "plugins/UMESimdPluginARM.h"
     #elif defined (__ALTIVEC__)
+        #define UME_SIMD_PLUGIN_NAMESPACE altivec
         #include "plugins/UMESimdPluginAltivec.h"
+    #elif defined __SSE2__
+        #if defined __SSE4_2__
+            #define UME_SIMD_PLUGIN_NAMESPACE sse42
+        #else
+            #define UME_SIMD_PLUGIN_NAMESPACE sse2
+        #endif
+        #include "plugins/UMESimdPluginSSE.h"
     #else
         // Use scalar emulation if not specializing
         #define USING_EMULATED_TYPES 1
+        #define UME_SIMD_PLUGIN_NAMESPACE scalar
         #include "plugins/UMESimdPluginScalarEmulation.h"
     #endif // INSTRUCTION SET
 #endif
@@ -132,6 +146,7 @@ namespace SIMD {
 
 namespace UME {
     namespace SIMD {
+    UME_SIMD_BEGIN_PLUGIN_NAMESPACE
         template<typename SCALAR_T, uint32_t VEC_LEN>
         struct BaseVectorType {
         };
@@ -188,6 +203,7 @@ namespace UME {
 
         template<typename SCALAR_T, uint32_t VEC_LEN>
         using SIMDVec = typename BaseVectorType<SCALAR_T, VEC_LEN>::BASE_T;
+    UME_SIMD_END_PLUGIN_NAMESPACE
     }
 }
 
@@ -0,0 +1,200 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_DISPATCH_H_
+#define UME_SIMD_DISPATCH_H_
+
+#include <cstdint>
+#include <utility>
+
+#include "UMEInline.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Runtime selection of kernels compiled for different instruction sets.
+//
+// The plugin is chosen at compile time, so a single translation unit can only
+// use one of them. To run a kernel at the best available speed from a single
+// binary, compile the same kernel once per plugin, in separate translation
+// units built with matching compiler flags (e.g. -msse4.2, -mavx2 -mfma,
+// -march=skylake-avx512). Each plugin defines UME_SIMD_PLUGIN_NAMESPACE, an
+// inline namespace in UME::SIMD, which should also wrap the kernel so that
+// every variant gets a distinct symbol:
+//
+//   // kernel.h, included by kernel_avx2.cpp, kernel_avx512.cpp...
+//   namespace UME { namespace SIMD { UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+//       void saxpy(float a, float const * x, float * y, int n) { ... }
+//   UME_SIMD_END_PLUGIN_NAMESPACE }}
+//
+// The binary itself is built for the baseline ISA and forms a dispatch table:
+//
+//   static UME::SIMD::Dispatcher<void(*)(float, float const *, float *, int)>
+//       saxpy(UME::SIMD::sse2::saxpy,    // baseline, built without extra flags
+//             nullptr,                   // no SSE4.2 variant, use the baseline
+//             UME::SIMD::avx::saxpy,
+//             UME::SIMD::avx2::saxpy,
+//             UME::SIMD::avx512::saxpy);
+//   ...
+//   saxpy(a, x, y, n);
+//
+// Not every library function is inlined into the kernel: template functions
+// and class members that the compiler keeps out of line are emitted as weak
+// symbols in each translation unit. The library itself lives in the same
+// inline namespace, so these get distinct names per ISA as well, and the
+// linker cannot resolve a call from the AVX2 variant to a copy compiled for
+// AVX512.
+
+namespace UME {
+namespace SIMD {
+
+    // Instruction set levels that can be selected at runtime. Each level
+    // implies availability of all levels below it.
+    enum DispatchISA {
+        DISPATCH_SCALAR = 0,    // Baseline, no extra requirements
+        DISPATCH_SSE    = 1,    // SSE4.2
+        DISPATCH_AVX    = 2,    // AVX
+        DISPATCH_AVX2   = 3,    // AVX2 + FMA
+        DISPATCH_AVX512 = 4,    // AVX512 F/CD/VL/BW/DQ (Skylake-SP and newer)
+        DISPATCH_ISA_COUNT = 5
+    };
+
+    namespace DISPATCH
+    {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        UME_FORCE_INLINE void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+            int t0[4];
+            __cpuidex(t0, int(leaf), int(subleaf));
+            for (int i = 0; i < 4; i++) regs[i] = uint32_t(t0[i]);
+#else
+            __asm__ __volatile__ ("cpuid"
+                : "=a"(regs[0]), "=b"(regs[1]), "=c"(regs[2]), "=d"(regs[3])
+                : "a"(leaf), "c"(subleaf));
+#endif
+        }
+
+        // Register state enabled by the OS (XCR0). Only valid if OSXSAVE is set.
+        UME_FORCE_INLINE uint64_t xgetbv() {
+#if defined(_MSC_VER)
+            return uint64_t(_xgetbv(0));
+#else
+            uint32_t t0, t1;
+            __asm__ __volatile__ ("xgetbv" : "=a"(t0), "=d"(t1) : "c"(0));
+            return (uint64_t(t1) << 32) | t0;
+#endif
+        }
+
+        inline DispatchISA detect() {
+            uint32_t leaf0[4], leaf1[4], leaf7[4] = { 0, 0, 0, 0 };
+            cpuid(0, 0, leaf0);
+            if (leaf0[0] < 1) return DISPATCH_SCALAR;
+            cpuid(1, 0, leaf1);
+            if (leaf0[0] >= 7) cpuid(7, 0, leaf7);
+
+            bool sse42   = (leaf1[2] & (1u << 20)) != 0;
+            bool osxsave = (leaf1[2] & (1u << 27)) != 0;
+            bool avx     = (leaf1[2] & (1u << 28)) != 0;
+            bool fma     = (leaf1[2] & (1u << 12)) != 0;
+            bool avx2    = (leaf7[1] & (1u << 5)) != 0;
+            // F, DQ, CD, BW, VL
+            uint32_t avx512mask = (1u << 16) | (1u << 17) | (1u << 28) | (1u << 30) | (1u << 31);
+            bool avx512  = (leaf7[1] & avx512mask) == avx512mask;
+
+            // The OS has to preserve the wide registers on context switches:
+            // XMM/YMM for AVX, and additionally opmask/ZMM state for AVX512.
+            uint64_t xcr0 = osxsave ? xgetbv() : 0;
+            bool ymmState = (xcr0 & 0x06) == 0x06;
+            bool zmmState = (xcr0 & 0xE6) == 0xE6;
+
+            if (avx512 && avx2 && fma && zmmState) return DISPATCH_AVX512;
+            if (avx2 && fma && avx && ymmState)    return DISPATCH_AVX2;
+            if (avx && ymmState)                   return DISPATCH_AVX;
+            if (sse42)                             return DISPATCH_SSE;
+            return DISPATCH_SCALAR;
+        }
+#else
+        // No runtime selection outside of x86: only the baseline is available.
+        inline DispatchISA detect() {
+            return DISPATCH_SCALAR;
+        }
+#endif
+    }
+
+    // Best instruction set supported by the host. Detection runs once and
+    // the result is cached for the lifetime of the program.
+    inline DispatchISA hostISA() {
+        static const DispatchISA isa = DISPATCH::detect();
+        return isa;
+    }
+
+    // Table of kernel variants, one per DispatchISA level. The best variant
+    // supported by the host is resolved once, on construction, so calling
+    // through the dispatcher costs a single indirect call. Levels without a
+    // dedicated variant can be passed as 'nullptr' and will fall back to the
+    // next lower level. The baseline variant is mandatory.
+    template<typename FUNC_PTR_T>
+    class Dispatcher {
+    private:
+        FUNC_PTR_T mFunc;
+        DispatchISA mISA;
+
+    public:
+        Dispatcher(
+            FUNC_PTR_T scalarFunc,
+            FUNC_PTR_T sseFunc,
+            FUNC_PTR_T avxFunc,
+            FUNC_PTR_T avx2Func,
+            FUNC_PTR_T avx512Func)
+        {
+            FUNC_PTR_T table[DISPATCH_ISA_COUNT] = {
+                scalarFunc, sseFunc, avxFunc, avx2Func, avx512Func };
+            int isa = int(hostISA());
+            while (isa > DISPATCH_SCALAR && table[isa] == nullptr) isa--;
+            mFunc = table[isa];
+            mISA = DispatchISA(isa);
+        }
+
+        template<typename... ARGS>
+        UME_FORCE_INLINE auto operator() (ARGS && ... args) const
+            -> decltype(mFunc(std::forward<ARGS>(args)...))
+        {
+            return mFunc(std::forward<ARGS>(args)...);
+        }
+
+        // Selected variant and its level
+        UME_FORCE_INLINE FUNC_PTR_T get() const { return mFunc; }
+        UME_FORCE_INLINE DispatchISA isa() const { return mISA; }
+    };
+}
+}
+
+#endif
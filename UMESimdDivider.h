@@ -0,0 +1,165 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+#ifndef UME_SIMD_DIVIDER_H_
+#define UME_SIMD_DIVIDER_H_
+
+#include <type_traits>
+
+#include "UMEBasicTypes.h"
+#include "UMEInline.h"
+#include "UMESimdScalarEmulation.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    // Integer division by a divisor that stays the same for many divisions.
+    //
+    //   SIMDDivider<uint32_t> d(n);   // precomputed once, n != 0
+    //   SIMD8_32u q = x / d;          // same as x / n, without a division
+    //
+    // The quotient is computed with a multiplication by a precomputed 'magic'
+    // number, keeping the high half of the product, and shifts (Granlund and
+    // Montgomery, "Division by invariant integers using multiplication").
+    // Signed division truncates towards zero, as the C++ '/' operator.
+    //
+    // Unsigned divisor 'd', W-bit elements, l = ceil(log2(d)):
+    //   magic  = floor(2^W * (2^l - d) / d) + 1
+    //   q = mulhi(x, magic)
+    //   x / d = (((x - q) >> shift1) + q) >> shift2
+    // with shift1 = min(l, 1) and shift2 = max(l, 1) - 1.
+    //
+    // Signed divisor 'd', l = max(ceil(log2(|d|)), 1):
+    //   magic  = floor(2^(W - 1 + l) / |d|) + 1 - 2^W
+    //   q = (x + mulhi(x, magic)) >> shift2                (arithmetic shift)
+    //   q = q - (x >> (W - 1))                             (+1 for negative x)
+    //   x / d = (q ^ sign) - sign
+    // with shift2 = l - 1, and 'sign' all ones for negative 'd', zero otherwise.
+    // The additions wrap around, as the vector additions do.
+    template<typename SCALAR_TYPE>
+    class SIMDDivider {
+        static_assert(std::is_integral<SCALAR_TYPE>::value && !std::is_same<SCALAR_TYPE, bool>::value,
+            "SIMDDivider requires an integer element type.");
+
+        typedef typename std::make_unsigned<SCALAR_TYPE>::type UINT_TYPE;
+        static const int WIDTH = 8 * sizeof(SCALAR_TYPE);
+
+        SCALAR_TYPE mDivisor;
+        SCALAR_TYPE mMagic;
+        uint32_t    mShift1;
+        uint32_t    mShift2;
+        SCALAR_TYPE mSign;
+
+        // floor((hi * 2^WIDTH) / d), for hi < d.
+        static UINT_TYPE divideWide(UINT_TYPE hi, UINT_TYPE d) {
+            UINT_TYPE q = 0;
+            UINT_TYPE r = hi;
+            for (int i = 0; i < WIDTH; i++) {
+                bool carry = (r >> (WIDTH - 1)) != 0;
+                r = UINT_TYPE(r << 1);
+                q = UINT_TYPE(q << 1);
+                if (carry || r >= d) {
+                    r = UINT_TYPE(r - d);
+                    q = UINT_TYPE(q | 1);
+                }
+            }
+            return q;
+        }
+
+        // ceil(log2(d)), for d > 0.
+        static uint32_t ceilLog2(UINT_TYPE d) {
+            uint32_t l = 0;
+            while (l < uint32_t(WIDTH) && (UINT_TYPE(UINT_TYPE(1) << l) < d)) l++;
+            return l;
+        }
+
+        void init(std::false_type) {
+            UINT_TYPE d = UINT_TYPE(mDivisor);
+            uint32_t l = ceilLog2(d);
+            // 2^l - d, computed modulo 2^WIDTH
+            UINT_TYPE t0 = UINT_TYPE((l < uint32_t(WIDTH) ? UINT_TYPE(UINT_TYPE(1) << l) : UINT_TYPE(0)) - d);
+            mMagic = SCALAR_TYPE(divideWide(t0, d) + 1);
+            mShift1 = l < 1 ? l : 1;
+            mShift2 = (l > 1 ? l : 1) - 1;
+            mSign = 0;
+        }
+
+        void init(std::true_type) {
+            UINT_TYPE d = mDivisor < 0 ? UINT_TYPE(UINT_TYPE(0) - UINT_TYPE(mDivisor)) : UINT_TYPE(mDivisor);
+            uint32_t l = ceilLog2(d);
+            if (l < 1) l = 1;
+            // floor(2^(WIDTH - 1 + l) / d) + 1 - 2^WIDTH, modulo 2^WIDTH.
+            // For |d| == 1 the quotient is exactly 2^WIDTH.
+            UINT_TYPE t0 = d == 1 ? UINT_TYPE(0) : divideWide(UINT_TYPE(UINT_TYPE(1) << (l - 1)), d);
+            mMagic = SCALAR_TYPE(UINT_TYPE(t0 + 1));
+            mShift1 = 0;
+            mShift2 = l - 1;
+            mSign = mDivisor < 0 ? SCALAR_TYPE(-1) : SCALAR_TYPE(0);
+        }
+
+        UME_FORCE_INLINE SCALAR_TYPE divideImpl(SCALAR_TYPE x, std::false_type) const {
+            UINT_TYPE t0 = SCALAR_EMULATION::mulHighScalar<UINT_TYPE>(UINT_TYPE(x), UINT_TYPE(mMagic));
+            UINT_TYPE t1 = UINT_TYPE(UINT_TYPE(UINT_TYPE(x) - t0) >> mShift1);
+            return SCALAR_TYPE(UINT_TYPE(t1 + t0) >> mShift2);
+        }
+
+        UME_FORCE_INLINE SCALAR_TYPE divideImpl(SCALAR_TYPE x, std::true_type) const {
+            UINT_TYPE t0 = UINT_TYPE(UINT_TYPE(x) + UINT_TYPE(SCALAR_EMULATION::mulHighScalar<SCALAR_TYPE>(x, mMagic)));
+            // Arithmetic shift of the wrapped sum.
+            SCALAR_TYPE t1 = SCALAR_TYPE(SCALAR_TYPE(t0) >> mShift2);
+            UINT_TYPE t2 = UINT_TYPE(UINT_TYPE(t1) + UINT_TYPE(x < 0 ? 1 : 0));
+            return SCALAR_TYPE(UINT_TYPE(UINT_TYPE(t2 ^ UINT_TYPE(mSign)) - UINT_TYPE(mSign)));
+        }
+
+    public:
+        // The divisor must not be zero.
+        explicit SIMDDivider(SCALAR_TYPE divisor) : mDivisor(divisor) {
+            init(std::is_signed<SCALAR_TYPE>());
+        }
+
+        UME_FORCE_INLINE SCALAR_TYPE divisor() const { return mDivisor; }
+        UME_FORCE_INLINE SCALAR_TYPE magic() const { return mMagic; }
+        UME_FORCE_INLINE uint32_t shift1() const { return mShift1; }
+        UME_FORCE_INLINE uint32_t shift2() const { return mShift2; }
+        UME_FORCE_INLINE SCALAR_TYPE sign() const { return mSign; }
+
+        // Scalar quotient computed the same way as the vector one.
+        UME_FORCE_INLINE SCALAR_TYPE divide(SCALAR_TYPE x) const {
+            return divideImpl(x, std::is_signed<SCALAR_TYPE>());
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
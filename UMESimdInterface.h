@@ -35,6 +35,7 @@
 #include <limits>
 
 #include "UMEBasicTypes.h"
+#include "UMESimdDivider.h"
 #include "UMESimdScalarEmulation.h"
 #include "UMESimdVectorEmulation.h"
 
@@ -42,6 +43,14 @@ namespace UME
 {
 namespace SIMD
 {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+    // Eache plugin should define this with a 'value' field
+    // specialized depending on the architecture used.
+    // Sugested values are not guaranteed to give optimal results
+    // on any platform, but they could be used as a baseline for
+    // specific derived software.
+    template<typename SCALAR_T> struct SuggestedVecLen{/*const int value = ? */};
+
     // **********************************************************************
     // *
     // *  Declaration of IndexVectorInterface class
@@ -159,6 +168,49 @@ namespace SIMD
         uint64_t m1;
     };
     
+    // Forward iterator over the indices of active (true) lanes of a mask.
+    // Lanes are visited in ascending order. Masks of up to 128 lanes are
+    // supported, the lanes above 63 are kept in the second word.
+    class MaskLaneIterator {
+    private:
+        uint64_t mLo;
+        uint64_t mHi;
+    public:
+        UME_FORCE_INLINE MaskLaneIterator(uint64_t lo, uint64_t hi) : mLo(lo), mHi(hi) {}
+
+        UME_FORCE_INLINE uint32_t operator* () const {
+            return mLo != 0 ? SCALAR_EMULATION::trailingZeros64(mLo) :
+                              64 + SCALAR_EMULATION::trailingZeros64(mHi);
+        }
+        UME_FORCE_INLINE MaskLaneIterator & operator++ () {
+            // Clear the lowest set bit.
+            if (mLo != 0) mLo &= mLo - 1;
+            else mHi &= mHi - 1;
+            return *this;
+        }
+        UME_FORCE_INLINE bool operator== (MaskLaneIterator const & b) const {
+            return mLo == b.mLo && mHi == b.mHi;
+        }
+        UME_FORCE_INLINE bool operator!= (MaskLaneIterator const & b) const {
+            return mLo != b.mLo || mHi != b.mHi;
+        }
+    };
+
+    // Range returned by 'activeLanes()' so that active lanes can be visited
+    // with a range-based for loop:
+    //
+    //      for (uint32_t i : mask.activeLanes()) { ... }
+    class MaskLaneRange {
+    private:
+        uint64_t mLo;
+        uint64_t mHi;
+    public:
+        UME_FORCE_INLINE MaskLaneRange(uint64_t lo, uint64_t hi) : mLo(lo), mHi(hi) {}
+
+        UME_FORCE_INLINE MaskLaneIterator begin() const { return MaskLaneIterator(mLo, mHi); }
+        UME_FORCE_INLINE MaskLaneIterator end() const { return MaskLaneIterator(0, 0); }
+    };
+
     // **********************************************************************
     // *
     // *  Declaration of SIMDMaskBaseInterface class 
@@ -497,6 +549,74 @@ namespace SIMD
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::isExact<DERIVED_MASK_TYPE>(static_cast<DERIVED_MASK_TYPE const &>(*this), DERIVED_MASK_TYPE(b));
         }
+
+        // FIRSTN
+        // Mask with the first 'count' elements set. Useful for processing loop
+        // remainders with masked operations instead of a scalar epilogue.
+        static UME_FUNC_ATTRIB DERIVED_MASK_TYPE firstN(uint32_t count) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::firstN<DERIVED_MASK_TYPE>(count);
+        }
+
+        // TOBITMASK
+        // Bit 'i' of the result is set if lane 'i' is active. For masks
+        // longer than 64 lanes only the first 64 lanes are represented.
+        UME_FUNC_ATTRIB uint64_t toBitmask() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::toBitmask<DERIVED_MASK_TYPE>(static_cast<DERIVED_MASK_TYPE const &>(*this));
+        }
+
+        // FROMBITMASK
+        // Inverse of 'toBitmask()'. Bits above the mask length are ignored.
+        static UME_FUNC_ATTRIB DERIVED_MASK_TYPE fromBitmask(uint64_t bits) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::fromBitmask<DERIVED_MASK_TYPE>(bits);
+        }
+
+        // COUNT, FIRSTSET, LASTSET and the active lane iterator are built on
+        // top of 'toBitmask()', so they become native as soon as the derived
+        // class provides a native 'toBitmask()'.
+
+        // COUNT
+        // Number of active lanes.
+        UME_FUNC_ATTRIB uint32_t count() const {
+            uint64_t t0 = static_cast<DERIVED_MASK_TYPE const &>(*this).toBitmask();
+            return SCALAR_EMULATION::bitCount64(t0) + SCALAR_EMULATION::bitCount64(upperBitmask());
+        }
+
+        // FIRSTSET
+        // Index of the lowest active lane, or 'length()' if no lane is active.
+        UME_FUNC_ATTRIB uint32_t firstSet() const {
+            uint64_t t0 = static_cast<DERIVED_MASK_TYPE const &>(*this).toBitmask();
+            if (t0 != 0) return SCALAR_EMULATION::trailingZeros64(t0);
+            uint64_t t1 = upperBitmask();
+            if (t1 != 0) return 64 + SCALAR_EMULATION::trailingZeros64(t1);
+            return MASK_LEN;
+        }
+
+        // LASTSET
+        // Index of the highest active lane, or 'length()' if no lane is active.
+        UME_FUNC_ATTRIB uint32_t lastSet() const {
+            uint64_t t1 = upperBitmask();
+            if (t1 != 0) return 127 - SCALAR_EMULATION::leadingZeros64(t1);
+            uint64_t t0 = static_cast<DERIVED_MASK_TYPE const &>(*this).toBitmask();
+            if (t0 != 0) return 63 - SCALAR_EMULATION::leadingZeros64(t0);
+            return MASK_LEN;
+        }
+
+        // ACTIVELANES
+        // Range of indices of the active lanes, in ascending order.
+        UME_FUNC_ATTRIB MaskLaneRange activeLanes() const {
+            uint64_t t0 = static_cast<DERIVED_MASK_TYPE const &>(*this).toBitmask();
+            return MaskLaneRange(t0, upperBitmask());
+        }
+
+    private:
+        // Lanes 64..127 of the longest masks, zero for all other masks.
+        UME_FUNC_ATTRIB uint64_t upperBitmask() const {
+            if (MASK_LEN <= 64) return 0;
+            return SCALAR_EMULATION::toBitmask<DERIVED_MASK_TYPE>(static_cast<DERIVED_MASK_TYPE const &>(*this), 64);
+        }
     };
 
     // **********************************************************************
@@ -852,26 +972,24 @@ namespace SIMD
         // ONE-VEC
         static DERIVED_VEC_TYPE one() { return DERIVED_VEC_TYPE(SCALAR_TYPE(1)); }
 
-#include "utilities/ignore_warnings_push.h"
-#include "utilities/ignore_warnings_unused_parameter.h"
-
         // PREFETCH0
+        // Prefetch the memory covered by a vector load from 'p' into all cache levels.
         static UME_FUNC_ATTRIB void prefetch0(SCALAR_TYPE const *p) {
-            // DO NOTHING!
+            SCALAR_EMULATION::prefetch<DERIVED_VEC_TYPE, SCALAR_TYPE, 3>(p);
         }
 
         // PREFETCH1
+        // As PREFETCH0, but the data is not brought into L1.
         static UME_FUNC_ATTRIB void prefetch1(SCALAR_TYPE const *p) {
-            // DO NOTHING!
+            SCALAR_EMULATION::prefetch<DERIVED_VEC_TYPE, SCALAR_TYPE, 2>(p);
         }
 
         // PREFETCH2
+        // As PREFETCH0, but the data is only brought into the outermost cache level.
         static UME_FUNC_ATTRIB void prefetch2(SCALAR_TYPE const *p) {
-            // DO NOTHING!
+            SCALAR_EMULATION::prefetch<DERIVED_VEC_TYPE, SCALAR_TYPE, 1>(p);
         }
 
-#include "utilities/ignore_warnings_pop.h"
-
         // ASSIGNV
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE & assign (DERIVED_VEC_TYPE const & src) {
             UME_EMULATION_WARNING();
@@ -963,17 +1081,53 @@ namespace SIMD
         }
 
         // SSTORE
+        // Non-temporal store bypassing the cache hierarchy. 'p' has to be aligned to
+        // alignment(). Use it for write-once output and finish with streamFence().
         UME_FUNC_ATTRIB SCALAR_TYPE* sstore(SCALAR_TYPE *p) const {
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::store<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), p);
         }
 
         // MSSTORE
+        // Masked variant of SSTORE. Inactive elements in memory are left untouched, so
+        // plugins without a non-temporal masked store use a regular masked store.
         UME_FUNC_ATTRIB SCALAR_TYPE* sstore(MASK_TYPE const & mask, SCALAR_TYPE *p) const {
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::store<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this), p);
         }
 
+        // SFENCE
+        // Order all preceding SSTORE/MSSTORE operations before any subsequent store.
+        // Required before data written with streaming stores is handed to another thread.
+        static UME_FUNC_ATTRIB void streamFence() {
+            SCALAR_EMULATION::streamFence();
+        }
+
+        // COMPRESS
+        // Moves the elements selected by 'mask' to the lowest elements, keeping
+        // their order. Remaining elements are set to zero.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE compress(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::compress<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // COMPRESSSTORE
+        // Stores the elements selected by 'mask' contiguously to unaligned memory.
+        // Only as many elements as are written are touched. Returns their number.
+        UME_FUNC_ATTRIB uint32_t compressStore(MASK_TYPE const & mask, SCALAR_TYPE *p) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::compressStore<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this), p);
+        }
+
+        // EXPANDLOAD
+        // Loads contiguous elements from unaligned memory into the elements selected
+        // by 'mask'; other elements are left unchanged. Returns the number of
+        // elements read.
+        UME_FUNC_ATTRIB uint32_t expandLoad(MASK_TYPE const & mask, SCALAR_TYPE const *p) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::expandLoad<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE &>(*this), p);
+        }
+
         // EXTRACT
         // This method should be provided for all derived classes and cannot be defined
         // as generic.
@@ -1117,17 +1271,64 @@ namespace SIMD
         }
 
         // SORTA
-        UME_FUNC_ATTRIB DERIVED_VEC_TYPE sorta() {
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE sorta() const {
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::sortAscending<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
         }
 
         // SORTD
-        UME_FUNC_ATTRIB DERIVED_VEC_TYPE sortd() {
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE sortd() const {
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::sortDescending<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
         }
 
+        // SORTA (key-value)
+        // Sorts the keys in ascending order and applies the same permutation
+        // to 'payload', an unsigned integer vector of the same length
+        // (e.g. element indices). The order of equal keys is unspecified.
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE sorta(PAYLOAD_VEC_TYPE & payload) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::sortAscending<DERIVED_VEC_TYPE, SCALAR_TYPE, PAYLOAD_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), payload);
+        }
+
+        // SORTD (key-value)
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE sortd(PAYLOAD_VEC_TYPE & payload) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::sortDescending<DERIVED_VEC_TYPE, SCALAR_TYPE, PAYLOAD_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), payload);
+        }
+
+        // BSORTA
+        // Sorts a bitonic vector (ascending then descending, or descending
+        // then ascending) in ascending order. Native implementations only
+        // run the merging stages of the sorting network, so the result is
+        // unspecified for other inputs.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE bsorta() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::sortAscending<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // BSORTD
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE bsortd() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::sortDescending<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // BSORTA (key-value)
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE bsorta(PAYLOAD_VEC_TYPE & payload) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::sortAscending<DERIVED_VEC_TYPE, SCALAR_TYPE, PAYLOAD_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), payload);
+        }
+
+        // BSORTD (key-value)
+        template<typename PAYLOAD_VEC_TYPE>
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE bsortd(PAYLOAD_VEC_TYPE & payload) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::sortDescending<DERIVED_VEC_TYPE, SCALAR_TYPE, PAYLOAD_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), payload);
+        }
+
         // ADDV
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE add (DERIVED_VEC_TYPE const & b) const {
             UME_EMULATION_WARNING();
@@ -2314,6 +2515,43 @@ namespace SIMD
             return SCALAR_EMULATION::binaryNotAssign<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE &>(*this));
         }
 
+        // POPCNT
+        // Number of set bits in each lane.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE popcnt () const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::populationCount<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // LZCNT
+        // Number of leading zero bits in each lane. Zero lanes give the lane width.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE lzcnt () const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::leadingZeroCount<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // TZCNT
+        // Number of trailing zero bits in each lane. Zero lanes give the lane width.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE tzcnt () const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::trailingZeroCount<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // BITREV
+        // Reverse the order of bits in each lane.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE bitrev () const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::bitReverse<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // LOOKUP16
+        // Treat each lane as an index into a 16-entry table. Lanes with
+        // index 16 or above (or negative) yield 0. Only for 8-bit lanes.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE lookup16 (SCALAR_TYPE const * table) const {
+            static_assert(sizeof(SCALAR_TYPE) == 1, "LOOKUP16 is only defined for 8-bit elements.");
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::lookup16<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), table);
+        }
+
         // HBAND
         UME_FUNC_ATTRIB SCALAR_TYPE hband ()const  {
             UME_EMULATION_WARNING();
@@ -2470,6 +2708,36 @@ namespace SIMD
             return SCALAR_EMULATION::reminderAssign<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
         }
 
+        // DIVINV
+        // Division by a divisor precomputed in a SIMDDivider, also available
+        // as 'a / divider'. Much faster than DIVS when the same divisor is
+        // used for many vectors.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE divide(SIMDDivider<SCALAR_TYPE> const & divider) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::divideInvariant<DERIVED_VEC_TYPE, SIMDDivider<SCALAR_TYPE>>(static_cast<DERIVED_VEC_TYPE const &>(*this), divider);
+        }
+
+        // MULHIV
+        // High half of the double width product of each pair of elements.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE mulhi(DERIVED_VEC_TYPE const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::mulHigh<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
+
+        // MULLOV
+        // Low half of the double width product, the same as MULV.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE mullo(DERIVED_VEC_TYPE const & b) const {
+            return static_cast<DERIVED_VEC_TYPE const &>(*this).mul(b);
+        }
+
+        // MULWIDEV
+        // Double width product of each pair of elements, as its low and
+        // high halves.
+        UME_FUNC_ATTRIB void mulWide(DERIVED_VEC_TYPE const & b, DERIVED_VEC_TYPE & lo, DERIVED_VEC_TYPE & hi) const {
+            lo = static_cast<DERIVED_VEC_TYPE const &>(*this).mul(b);
+            hi = static_cast<DERIVED_VEC_TYPE const &>(*this).mulhi(b);
+        }
+
         // LANDV
         UME_FUNC_ATTRIB MASK_TYPE land(DERIVED_VEC_TYPE const & b) const {
             UME_EMULATION_WARNING();
@@ -2530,6 +2798,14 @@ namespace SIMD
         UME_FUNC_ATTRIB MASK_TYPE operator|| (bool b) const {
             return lor(b);
         }
+
+        // CONFLICT
+        // Bit j of element i is set if element j (j < i) holds the same value
+        // as element i. Bits above the width of SCALAR_TYPE are dropped.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE conflict() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::conflict<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
     };
 
     // ***************************************************************************
@@ -2591,6 +2867,23 @@ namespace SIMD
             return SCALAR_EMULATION::gather<DERIVED_VEC_TYPE, SCALAR_TYPE, DERIVED_UINT_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE &>(*this), baseAddr, indices);
         }
 
+        // PREFETCHGATHER0
+        // Prefetch the elements a subsequent GATHERV with the same arguments would
+        // read. Cache hints follow PREFETCH0, PREFETCH1 and PREFETCH2.
+        static UME_FUNC_ATTRIB void prefetchgather0 (SCALAR_TYPE const * baseAddr, DERIVED_UINT_VEC_TYPE const & indices) {
+            SCALAR_EMULATION::prefetchgather<DERIVED_VEC_TYPE, SCALAR_TYPE, DERIVED_UINT_VEC_TYPE, 3> (baseAddr, indices);
+        }
+
+        // PREFETCHGATHER1
+        static UME_FUNC_ATTRIB void prefetchgather1 (SCALAR_TYPE const * baseAddr, DERIVED_UINT_VEC_TYPE const & indices) {
+            SCALAR_EMULATION::prefetchgather<DERIVED_VEC_TYPE, SCALAR_TYPE, DERIVED_UINT_VEC_TYPE, 2> (baseAddr, indices);
+        }
+
+        // PREFETCHGATHER2
+        static UME_FUNC_ATTRIB void prefetchgather2 (SCALAR_TYPE const * baseAddr, DERIVED_UINT_VEC_TYPE const & indices) {
+            SCALAR_EMULATION::prefetchgather<DERIVED_VEC_TYPE, SCALAR_TYPE, DERIVED_UINT_VEC_TYPE, 1> (baseAddr, indices);
+        }
+
         // SCATTERU
         UME_FUNC_ATTRIB SCALAR_TYPE* scatteru (SCALAR_TYPE * baseAddr, uint32_t stride) {
             UME_EMULATION_WARNING();
@@ -2626,6 +2919,23 @@ namespace SIMD
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::scatter<DERIVED_VEC_TYPE, SCALAR_TYPE, DERIVED_UINT_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE &>(*this), baseAddr, indices);
         }       
+
+        // PERMUTEV
+        // Register-level gather: element i of the result is element
+        // (indices[i] % length()) of this vector.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE permute (DERIVED_UINT_VEC_TYPE const & indices) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::permute<DERIVED_VEC_TYPE, DERIVED_UINT_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), indices);
+        }
+
+        // PERMUTE2V
+        // Two-source permute over the concatenation of this vector and 'b':
+        // index j = indices[i] % (2 * length()) selects this[j] when
+        // j < length(), and b[j - length()] otherwise.
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE permute2 (DERIVED_VEC_TYPE const & b, DERIVED_UINT_VEC_TYPE const & indices) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::permute2<DERIVED_VEC_TYPE, DERIVED_UINT_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b, indices);
+        }
     };
     
     // ***************************************************************************
@@ -3303,28 +3613,47 @@ namespace SIMD
         }
         
         // POWV
-        // Disabled, see Issue #10
-        //UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (DERIVED_VEC_TYPE const & b) const {
-        //    return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        // }
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (DERIVED_VEC_TYPE const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
 
-        // MPOWV    
-        // Disabled, see Issue #10    
-        //UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, DERIVED_VEC_TYPE const & b) const {
-        //    return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        //}
+        // MPOWV
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, DERIVED_VEC_TYPE const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
 
         // POWS
-        // Disabled, see Issue #10
-        //UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (SCALAR_FLOAT_TYPE b) const {
-        //    return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        //}
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (SCALAR_FLOAT_TYPE b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
 
         // MPOWS
-        // Disabled, see Issue #10
-        //UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, SCALAR_FLOAT_TYPE b) const {
-        //    return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        //}
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, SCALAR_FLOAT_TYPE b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
+
+        // POWI
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE powi (int n) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::powi<DERIVED_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), n);
+        }
+
+        // MPOWI
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE powi (MASK_TYPE const & mask, int n) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::powi<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), n);
+        }
+
+        // POWN
+        template<int N>
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE pow () const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::powi<DERIVED_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), N);
+        }
 
         // ROUND
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE round () const {
@@ -3440,18 +3769,156 @@ namespace SIMD
             return SCALAR_EMULATION::MATH::log<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
         }
 
+        // MLOG
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE log(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::log<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
         // LOG10
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE log10() const {
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::MATH::log10<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
         }
 
+        // MLOG10
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE log10(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::log10<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
         // LOG2
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE log2() const {
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::MATH::log2<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
         }
 
+        // MLOG2
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE log2(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::log2<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // EXP2
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE exp2() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::exp2<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MEXP2
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE exp2(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::exp2<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // EXPM1
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE expm1() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::expm1<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MEXPM1
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE expm1(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::expm1<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // LOG1P
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE log1p() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::log1p<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MLOG1P
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE log1p(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::log1p<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // SINH
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE sinh() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::sinh<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MSINH
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE sinh(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::sinh<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // COSH
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE cosh() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::cosh<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MCOSH
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE cosh(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::cosh<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // TANH
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE tanh() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::tanh<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MTANH
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE tanh(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::tanh<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // ERF
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE erf() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::erf<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MERF
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE erf(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::erf<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // ERFC
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE erfc() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::erfc<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MERFC
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE erfc(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::erfc<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // NORMCDF
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE normcdf() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::normcdf<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MNORMCDF
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE normcdf(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::normcdf<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // NORMINV
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE norminv() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::norminv<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MNORMINV
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE norminv(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::norminv<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
         // SIN
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE sin () const {
             UME_EMULATION_WARNING();
@@ -3520,14 +3987,51 @@ namespace SIMD
             return SCALAR_EMULATION::MATH::atan<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
         }
 
+        // MATAN
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE atan(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::atan<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
         // ATAN2
         UME_FUNC_ATTRIB DERIVED_VEC_TYPE atan2(DERIVED_VEC_TYPE const & b) const {
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::MATH::atan2<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), b);
         }
 
+        // MATAN2
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE atan2(MASK_TYPE const & mask, DERIVED_VEC_TYPE const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::atan2<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
+
+        // ASIN
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE asin() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::asin<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MASIN
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE asin(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::asin<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // ACOS
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE acos() const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::acos<DERIVED_VEC_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
+        // MACOS
+        UME_FUNC_ATTRIB DERIVED_VEC_TYPE acos(MASK_TYPE const & mask) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::acos<DERIVED_VEC_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this));
+        }
+
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 } // namespace UME::SIMD
 } // namespace UME
 
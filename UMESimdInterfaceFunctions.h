@@ -7,6 +7,7 @@ namespace UME
 {
 namespace SIMD
 {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 namespace FUNCTIONS
 {
     // ADDV
@@ -132,6 +133,16 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T mul(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const & src1, VEC_T const & src2) { return VEC_T(src1).mul(mask, src2); }
 
+    // MULHIV
+    template<typename VEC_T>
+    inline VEC_T mulhi(VEC_T const & src1, VEC_T const & src2) { return src1.mulhi(src2); }
+    // MULLOV
+    template<typename VEC_T>
+    inline VEC_T mullo(VEC_T const & src1, VEC_T const & src2) { return src1.mullo(src2); }
+    // MULWIDEV
+    template<typename VEC_T>
+    inline void mulWide(VEC_T const & src1, VEC_T const & src2, VEC_T & lo, VEC_T & hi) { src1.mulWide(src2, lo, hi); }
+
     // DIVV
     template<typename VEC_T>
     inline VEC_T div(VEC_T const & src1, VEC_T const & src2) { return src1.div(src2); }
@@ -151,6 +162,10 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T div(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const & src1, VEC_T const & src2) { return src2.rcp(mask, src1); }
 
+    // DIVINV
+    template<typename VEC_T, typename SCALAR_T>
+    inline VEC_T div(VEC_T const & src1, UME::SIMD::SIMDDivider<SCALAR_T> const & src2) { return src1.divide(src2); }
+
     // REMV
     template<typename VEC_T>
     inline VEC_T rem(VEC_T const & src1, VEC_T const & src2) { return src1.rem(src2); }
@@ -258,6 +273,10 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline bool unique(VEC_T const & src1) { return src1.unique(); }
 
+    // CONFLICT
+    template<typename VEC_T>
+    inline VEC_T conflict(VEC_T const & src1) { return src1.conflict(); }
+
     // HADD
     template<typename VEC_T>
     inline typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T hadd(VEC_T const & src1) { return src1.hadd(); }
@@ -466,6 +485,22 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T bandnot(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T src1, VEC_T const & src2) { return (VEC_T(src1).bnot(mask)).band(mask, src2); }
 
+    // POPCNT
+    template<typename VEC_T>
+    inline VEC_T popcnt(VEC_T const & src1) { return src1.popcnt(); }
+    // LZCNT
+    template<typename VEC_T>
+    inline VEC_T lzcnt(VEC_T const & src1) { return src1.lzcnt(); }
+    // TZCNT
+    template<typename VEC_T>
+    inline VEC_T tzcnt(VEC_T const & src1) { return src1.tzcnt(); }
+    // BITREV
+    template<typename VEC_T>
+    inline VEC_T bitrev(VEC_T const & src1) { return src1.bitrev(); }
+    // LOOKUP16
+    template<typename VEC_T>
+    inline VEC_T lookup16(VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const * table) { return src1.lookup16(table); }
+
     // HBAND
     template<typename VEC_T>
     inline typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T hband(VEC_T const & src1) { return src1.hband(); }
@@ -568,6 +603,13 @@ namespace FUNCTIONS
         return src1.scatter(mask, baseAddr, indices);
     }
 
+    // PERMUTEV
+    template<typename VEC_T>
+    inline VEC_T permute(VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T const & indices) { return src1.permute(indices); }
+    // PERMUTE2V
+    template<typename VEC_T>
+    inline VEC_T permute2(VEC_T const & src1, VEC_T const & src2, typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T const & indices) { return src1.permute2(src2, indices); }
+
     // LSHV
     template<typename VEC_T>
     VEC_T lsh(VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T const & src2) { return src1.lsh(src2); }
@@ -773,12 +815,63 @@ namespace FUNCTIONS
     template<typename VEC_T>
     typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T iszerosub(VEC_T const & src1) { return src1.iszerosub(); }
 
+    namespace details
+    {
+        // Emulated kernels behind the accuracy tier selecting overloads,
+        // e.g. exp<PRECISION_FAST>(x), chosen by the scalar type of VEC_T.
+        template<UME::SIMD::Precision P, typename VEC_T,
+                 typename SCALAR_T = typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T>
+        struct PrecisionKernels;
+
+        template<UME::SIMD::Precision P, typename VEC_T>
+        struct PrecisionKernels<P, VEC_T, float> {
+            typedef typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T UINT_VEC_T;
+            typedef typename UME::SIMD::SIMDTraits<VEC_T>::INT_VEC_T  INT_VEC_T;
+            typedef typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T     MASK_T;
+
+            static inline VEC_T exp(VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::expf<VEC_T, UINT_VEC_T, P>(x); }
+            static inline VEC_T exp(MASK_T const & mask, VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::expf<VEC_T, UINT_VEC_T, MASK_T, P>(mask, x); }
+            static inline VEC_T log(VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::logf<VEC_T, UINT_VEC_T, P>(x); }
+            static inline VEC_T log(MASK_T const & mask, VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::logf<VEC_T, UINT_VEC_T, MASK_T, P>(mask, x); }
+            static inline VEC_T sin(VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::sinf<VEC_T, INT_VEC_T, MASK_T, P>(x); }
+            static inline VEC_T sin(MASK_T const & mask, VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::sinf<VEC_T, INT_VEC_T, MASK_T, P>(mask, x); }
+            static inline VEC_T cos(VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::cosf<VEC_T, INT_VEC_T, MASK_T, P>(x); }
+            static inline VEC_T cos(MASK_T const & mask, VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::cosf<VEC_T, INT_VEC_T, MASK_T, P>(mask, x); }
+            static inline VEC_T pow(VEC_T const & x, VEC_T const & y) { return UME::SIMD::VECTOR_EMULATION::powf<VEC_T, UINT_VEC_T, MASK_T, P>(x, y); }
+            static inline VEC_T pow(MASK_T const & mask, VEC_T const & x, VEC_T const & y) { return UME::SIMD::VECTOR_EMULATION::powf<VEC_T, UINT_VEC_T, MASK_T, P>(mask, x, y); }
+        };
+
+        template<UME::SIMD::Precision P, typename VEC_T>
+        struct PrecisionKernels<P, VEC_T, double> {
+            typedef typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T UINT_VEC_T;
+            typedef typename UME::SIMD::SIMDTraits<VEC_T>::INT_VEC_T  INT_VEC_T;
+            typedef typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T     MASK_T;
+
+            static inline VEC_T exp(VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::expd<VEC_T, UINT_VEC_T, P>(x); }
+            static inline VEC_T exp(MASK_T const & mask, VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::expd<VEC_T, UINT_VEC_T, MASK_T, P>(mask, x); }
+            static inline VEC_T log(VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::logd<VEC_T, UINT_VEC_T, P>(x); }
+            static inline VEC_T log(MASK_T const & mask, VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::logd<VEC_T, UINT_VEC_T, MASK_T, P>(mask, x); }
+            static inline VEC_T sin(VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::sind<VEC_T, INT_VEC_T, MASK_T, P>(x); }
+            static inline VEC_T sin(MASK_T const & mask, VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::sind<VEC_T, INT_VEC_T, MASK_T, P>(mask, x); }
+            static inline VEC_T cos(VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::cosd<VEC_T, INT_VEC_T, MASK_T, P>(x); }
+            static inline VEC_T cos(MASK_T const & mask, VEC_T const & x) { return UME::SIMD::VECTOR_EMULATION::cosd<VEC_T, INT_VEC_T, MASK_T, P>(mask, x); }
+            static inline VEC_T pow(VEC_T const & x, VEC_T const & y) { return UME::SIMD::VECTOR_EMULATION::powd<VEC_T, UINT_VEC_T, MASK_T, P>(x, y); }
+            static inline VEC_T pow(MASK_T const & mask, VEC_T const & x, VEC_T const & y) { return UME::SIMD::VECTOR_EMULATION::powd<VEC_T, UINT_VEC_T, MASK_T, P>(mask, x, y); }
+        };
+    }
+
     // EXP
     template<typename VEC_T>
     inline VEC_T exp(VEC_T const & src1) { return src1.exp(); }
     // MEXP
     template<typename VEC_T>
     inline VEC_T exp(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.exp(mask); }
+    // EXP, explicit accuracy tier: exp<PRECISION_FAST>(x)
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T exp(VEC_T const & src1) { return details::PrecisionKernels<P, VEC_T>::exp(src1); }
+    // MEXP, explicit accuracy tier
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T exp(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return details::PrecisionKernels<P, VEC_T>::exp(mask, src1); }
 
     // LOG
     template<typename VEC_T>
@@ -786,6 +879,12 @@ namespace FUNCTIONS
     // MLOG
     template<typename VEC_T>
     inline VEC_T log(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.log(mask); }
+    // LOG, explicit accuracy tier: log<PRECISION_FAST>(x)
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T log(VEC_T const & src1) { return details::PrecisionKernels<P, VEC_T>::log(src1); }
+    // MLOG, explicit accuracy tier
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T log(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return details::PrecisionKernels<P, VEC_T>::log(mask, src1); }
 
     // LOG10
     template<typename VEC_T>
@@ -801,12 +900,116 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T log2(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.log2(mask); }
 
+    // EXP2
+    template<typename VEC_T>
+    inline VEC_T exp2(VEC_T const & src1) { return src1.exp2(); }
+    // MEXP2
+    template<typename VEC_T>
+    inline VEC_T exp2(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.exp2(mask); }
+
+    // EXPM1
+    template<typename VEC_T>
+    inline VEC_T expm1(VEC_T const & src1) { return src1.expm1(); }
+    // MEXPM1
+    template<typename VEC_T>
+    inline VEC_T expm1(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.expm1(mask); }
+
+    // LOG1P
+    template<typename VEC_T>
+    inline VEC_T log1p(VEC_T const & src1) { return src1.log1p(); }
+    // MLOG1P
+    template<typename VEC_T>
+    inline VEC_T log1p(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.log1p(mask); }
+
+    // SINH
+    template<typename VEC_T>
+    inline VEC_T sinh(VEC_T const & src1) { return src1.sinh(); }
+    // MSINH
+    template<typename VEC_T>
+    inline VEC_T sinh(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.sinh(mask); }
+
+    // COSH
+    template<typename VEC_T>
+    inline VEC_T cosh(VEC_T const & src1) { return src1.cosh(); }
+    // MCOSH
+    template<typename VEC_T>
+    inline VEC_T cosh(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.cosh(mask); }
+
+    // TANH
+    template<typename VEC_T>
+    inline VEC_T tanh(VEC_T const & src1) { return src1.tanh(); }
+    // MTANH
+    template<typename VEC_T>
+    inline VEC_T tanh(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.tanh(mask); }
+
+    // POWV
+    template<typename VEC_T>
+    inline VEC_T pow(VEC_T const & src1, VEC_T const & src2) { return src1.pow(src2); }
+    // MPOWV
+    template<typename VEC_T>
+    inline VEC_T pow(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, VEC_T const & src2) { return src1.pow(mask, src2); }
+    // POWS
+    template<typename VEC_T>
+    inline VEC_T pow(VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const & src2) { return src1.pow(src2); }
+    // MPOWS
+    template<typename VEC_T>
+    inline VEC_T pow(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const & src2) { return src1.pow(mask, src2); }
+    // POWV, explicit accuracy tier: pow<PRECISION_FAST>(x, y)
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T pow(VEC_T const & src1, VEC_T const & src2) { return details::PrecisionKernels<P, VEC_T>::pow(src1, src2); }
+    // MPOWV, explicit accuracy tier
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T pow(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, VEC_T const & src2) { return details::PrecisionKernels<P, VEC_T>::pow(mask, src1, src2); }
+    // POWI
+    template<typename VEC_T>
+    inline VEC_T powi(VEC_T const & src1, int n) { return src1.powi(n); }
+    // MPOWI
+    template<typename VEC_T>
+    inline VEC_T powi(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, int n) { return src1.powi(mask, n); }
+    // POWN: pow<N>(x), compile time exponent
+    template<int N, typename VEC_T>
+    inline VEC_T pow(VEC_T const & src1) { return src1.template pow<N>(); }
+
+    // ERF
+    template<typename VEC_T>
+    inline VEC_T erf(VEC_T const & src1) { return src1.erf(); }
+    // MERF
+    template<typename VEC_T>
+    inline VEC_T erf(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.erf(mask); }
+
+    // ERFC
+    template<typename VEC_T>
+    inline VEC_T erfc(VEC_T const & src1) { return src1.erfc(); }
+    // MERFC
+    template<typename VEC_T>
+    inline VEC_T erfc(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.erfc(mask); }
+
+    // NORMCDF
+    template<typename VEC_T>
+    inline VEC_T normcdf(VEC_T const & src1) { return src1.normcdf(); }
+    // MNORMCDF
+    template<typename VEC_T>
+    inline VEC_T normcdf(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.normcdf(mask); }
+
+    // NORMINV
+    template<typename VEC_T>
+    inline VEC_T norminv(VEC_T const & src1) { return src1.norminv(); }
+    // MNORMINV
+    template<typename VEC_T>
+    inline VEC_T norminv(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.norminv(mask); }
+
     // SIN
     template<typename VEC_T>
     inline VEC_T sin(VEC_T const & src1) { return src1.sin(); }
     // MSIN
     template<typename VEC_T>
     inline VEC_T sin(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.sin(mask); }
+    // SIN, explicit accuracy tier: sin<PRECISION_FAST>(x)
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T sin(VEC_T const & src1) { return details::PrecisionKernels<P, VEC_T>::sin(src1); }
+    // MSIN, explicit accuracy tier
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T sin(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return details::PrecisionKernels<P, VEC_T>::sin(mask, src1); }
 
     // COS
     template<typename VEC_T>
@@ -814,6 +1017,12 @@ namespace FUNCTIONS
     // MCOS
     template<typename VEC_T>
     inline VEC_T cos(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.cos(mask); }
+    // COS, explicit accuracy tier: cos<PRECISION_FAST>(x)
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T cos(VEC_T const & src1) { return details::PrecisionKernels<P, VEC_T>::cos(src1); }
+    // MCOS, explicit accuracy tier
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T cos(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return details::PrecisionKernels<P, VEC_T>::cos(mask, src1); }
 
     // SINCOS
     template<typename VEC_T>
@@ -843,7 +1052,29 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T atan(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.atan(mask); }
 
+    // ATAN2
+    template<typename VEC_T>
+    inline VEC_T atan2(VEC_T const & src1, VEC_T const & src2) { return src1.atan2(src2); }
+    // MATAN2
+    template<typename VEC_T>
+    inline VEC_T atan2(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, VEC_T const & src2) { return src1.atan2(mask, src2); }
+
+    // ASIN
+    template<typename VEC_T>
+    inline VEC_T asin(VEC_T const & src1) { return src1.asin(); }
+    // MASIN
+    template<typename VEC_T>
+    inline VEC_T asin(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.asin(mask); }
+
+    // ACOS
+    template<typename VEC_T>
+    inline VEC_T acos(VEC_T const & src1) { return src1.acos(); }
+    // MACOS
+    template<typename VEC_T>
+    inline VEC_T acos(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.acos(mask); }
+
 }
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -36,12 +36,19 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <type_traits>
+
+#if defined(__SSE__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#include <xmmintrin.h>
+#endif
 //#define UME_SIMD_SHOW_EMULATION_WARNINGS
 #ifdef UME_SIMD_SHOW_EMULATION_WARNINGS
 namespace UME
 {
     namespace SIMD
     {
+    UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 #if defined(__GNUC__) || defined(__ICC__)
 #define DEPRECATE(ret_type, msg) ret_type __attribute__((deprecated(msg)))
 #elif defined(_MSC_VER)
@@ -82,6 +89,7 @@ namespace UME
 #define UME_UNIMPLEMENTED_WARNING() UME_SIMD_DYNAMIC_WARN(false, "This function is not implemented!");
 
 #define UME_ALIGNMENT_CHECK(ptr, alignment) UME_SIMD_DYNAMIC_WARN(  (( ((uint64_t)ptr) % alignment) == 0), "Warning: unaligned memory used!\n")
+    UME_SIMD_END_PLUGIN_NAMESPACE
     }
 }
 #else
@@ -97,6 +105,7 @@ namespace UME
 {
 namespace SIMD
 {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 //   All functions in this namespace will have one purpose: emulation of single function in different backends.
 //   Scalar emulation plugin has to emulate all of these features using scalar values either way. Spliting
 //   Functionality implementation from class implementation will allow re-use of the operator functions for 
@@ -139,6 +148,38 @@ namespace SCALAR_EMULATION
         return dst;
     }
 
+    // Prefetch a single cache line. LOCALITY follows the __builtin_prefetch
+    // convention: 3 keeps the line in all cache levels (T0), 2 skips L1 (T1)
+    // and 1 brings it only to the outermost level (T2).
+    template<int LOCALITY>
+    UME_FUNC_ATTRIB void prefetchLine(void const * p) {
+#if defined(__GNUC__)
+        __builtin_prefetch(p, 0, LOCALITY);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch((char const *)p, LOCALITY == 3 ? _MM_HINT_T0 : (LOCALITY == 2 ? _MM_HINT_T1 : _MM_HINT_T2));
+#else
+        (void)p;
+#endif
+    }
+
+    // PREFETCH0, PREFETCH1, PREFETCH2
+    template<typename VEC_TYPE, typename SCALAR_TYPE, int LOCALITY>
+    UME_FUNC_ATTRIB void prefetch(SCALAR_TYPE const * p) {
+        // Vectors wider than a 64B cache line need one prefetch per line.
+        char const * t0 = (char const *)p;
+        for (uint32_t i = 0; i < VEC_TYPE::length() * sizeof(SCALAR_TYPE); i += 64) {
+            prefetchLine<LOCALITY>(t0 + i);
+        }
+    }
+
+    // PREFETCHGATHER0, PREFETCHGATHER1, PREFETCHGATHER2
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, int LOCALITY>
+    UME_FUNC_ATTRIB void prefetchgather(SCALAR_TYPE const * base, UINT_VEC_TYPE const & indices) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            prefetchLine<LOCALITY>(base + indices[i]);
+        }
+    }
+
     // LOAD
     template<typename VEC_TYPE, typename SCALAR_TYPE>
     UME_FUNC_ATTRIB VEC_TYPE & load(VEC_TYPE & dst, SCALAR_TYPE const * p) {
@@ -206,6 +247,46 @@ namespace SCALAR_EMULATION
         return store<MASK_TYPE, VEC_TYPE, SCALAR_TYPE>(mask, src, p);
     }
     
+    // SFENCE
+    UME_FUNC_ATTRIB void streamFence() {
+#if defined(__SSE__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+        _mm_sfence();
+#else
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    // COMPRESS
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE compress(MASK_TYPE const & mask, VEC_TYPE const & a) {
+        VEC_TYPE retval(SCALAR_TYPE(0));
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            if (mask[i] == true) retval.insert(count++, a[i]);
+        }
+        return retval;
+    }
+
+    // COMPRESSSTORE
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+    UME_FUNC_ATTRIB uint32_t compressStore(MASK_TYPE const & mask, VEC_TYPE const & a, SCALAR_TYPE * p) {
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            if (mask[i] == true) p[count++] = a[i];
+        }
+        return count;
+    }
+
+    // EXPANDLOAD
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+    UME_FUNC_ATTRIB uint32_t expandLoad(MASK_TYPE const & mask, VEC_TYPE & dst, SCALAR_TYPE const * p) {
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            if (mask[i] == true) dst.insert(i, p[count++]);
+        }
+        return count;
+    }
+
     // GATHERU
     template<typename VEC_TYPE, typename SCALAR_TYPE>
     UME_FUNC_ATTRIB VEC_TYPE & gatheru(VEC_TYPE & dst, SCALAR_TYPE const * base, uint32_t stride) {
@@ -1019,6 +1100,41 @@ namespace SCALAR_EMULATION
         return retval;
     }
 
+    // High half of the 128-bit product of two 64-bit unsigned integers,
+    // assembled from 32x32-bit partial products.
+    UME_FUNC_ATTRIB uint64_t mulHigh64(uint64_t a, uint64_t b) {
+        uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32;
+        uint64_t bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+        uint64_t t0 = aHi * bLo + ((aLo * bLo) >> 32);
+        uint64_t t1 = (t0 & 0xFFFFFFFF) + aLo * bHi;
+        return aHi * bHi + (t0 >> 32) + (t1 >> 32);
+    }
+
+    // High half of the double width product of two integers. Shifting 'a'
+    // to the top of a 64-bit word makes the high half of the 64-bit product
+    // the wanted one. Signed products are corrected from the unsigned one.
+    template<typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB SCALAR_TYPE mulHighScalar(SCALAR_TYPE a, SCALAR_TYPE b) {
+        typedef typename std::make_unsigned<SCALAR_TYPE>::type UINT_T;
+        const uint32_t WIDTH = 8 * sizeof(SCALAR_TYPE);
+        UINT_T t0 = UINT_T(mulHigh64(uint64_t(UINT_T(a)) << (64 - WIDTH), uint64_t(UINT_T(b))));
+        if (std::is_signed<SCALAR_TYPE>::value) {
+            if ((UINT_T(a) >> (WIDTH - 1)) != 0) t0 = UINT_T(t0 - UINT_T(b));
+            if ((UINT_T(b) >> (WIDTH - 1)) != 0) t0 = UINT_T(t0 - UINT_T(a));
+        }
+        return SCALAR_TYPE(t0);
+    }
+
+    // MULHIV
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE mulHigh(VEC_TYPE const & a, VEC_TYPE const & b) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, mulHighScalar<SCALAR_TYPE>(a[i], b[i]));
+        }
+        return retval;
+    }
+
     // MULVA
     template<typename VEC_TYPE>
     UME_FUNC_ATTRIB VEC_TYPE & multAssign(VEC_TYPE & dst, VEC_TYPE const & b) {
@@ -1095,6 +1211,16 @@ namespace SCALAR_EMULATION
         return retval;
     }
 
+    // DIVINV
+    template<typename VEC_TYPE, typename DIVIDER_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE divideInvariant(VEC_TYPE const & a, DIVIDER_TYPE const & divider) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, divider.divide(a[i]));
+        }
+        return retval;
+    }
+
     // REMV
     template<typename VEC_TYPE>
     UME_FUNC_ATTRIB VEC_TYPE reminder(VEC_TYPE const & a, VEC_TYPE const & b) {
@@ -2077,6 +2203,23 @@ namespace SCALAR_EMULATION
         return retval;
     }
 
+    // CONFLICT
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE conflict(VEC_TYPE const & a) {
+        VEC_TYPE retval;
+        // Bits above the width of SCALAR_TYPE are dropped.
+        const uint32_t BIT_COUNT = (VEC_TYPE::length() < 8*sizeof(SCALAR_TYPE)) ? VEC_TYPE::length() : uint32_t(8*sizeof(SCALAR_TYPE));
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            uint64_t bits = 0;
+            uint32_t j_end = (i < BIT_COUNT) ? i : BIT_COUNT;
+            for (uint32_t j = 0; j < j_end; j++) {
+                bits |= uint64_t(a[i] == a[j]) << j;
+            }
+            retval.insert(i, SCALAR_TYPE(bits));
+        }
+        return retval;
+    }
+
     // ANDV
     template<typename VEC_TYPE>
     UME_FUNC_ATTRIB VEC_TYPE binaryAnd(VEC_TYPE const & a, VEC_TYPE const & b) {
@@ -2527,6 +2670,38 @@ namespace SCALAR_EMULATION
         return retval;
     }
 
+    // PERMUTEV
+    template<typename VEC_TYPE, typename UINT_VEC_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE permute(VEC_TYPE const & a, UINT_VEC_TYPE const & indices) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, a[uint32_t(indices[i] % VEC_TYPE::length())]);
+        }
+        return retval;
+    }
+
+    // PERMUTE2V
+    template<typename VEC_TYPE, typename UINT_VEC_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE permute2(VEC_TYPE const & a, VEC_TYPE const & b, UINT_VEC_TYPE const & indices) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            uint32_t j = uint32_t(indices[i] % (2 * VEC_TYPE::length()));
+            retval.insert(i, j < VEC_TYPE::length() ? a[j] : b[j - VEC_TYPE::length()]);
+        }
+        return retval;
+    }
+
+    // LOOKUP16
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE lookup16(VEC_TYPE const & a, SCALAR_TYPE const * table) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            uint8_t j = uint8_t(a[i]);
+            retval.insert(i, j < 16 ? table[j] : SCALAR_TYPE(0));
+        }
+        return retval;
+    }
+
     // SWIZZLEA
     template<typename VEC_TYPE, typename SWIZZLE_MASK_TYPE>
     UME_FUNC_ATTRIB VEC_TYPE & swizzleAssign(SWIZZLE_MASK_TYPE const & sMask, VEC_TYPE & a) {
@@ -2575,6 +2750,50 @@ namespace SCALAR_EMULATION
         return retval;
     }
 
+    // SORTA (key-value)
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename PAYLOAD_VEC_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE sortAscending(VEC_TYPE const & a, PAYLOAD_VEC_TYPE & payload) {
+        const uint32_t VEC_LEN = VEC_TYPE::length();
+        std::array<uint32_t, VEC_LEN> index;
+        VEC_TYPE retval;
+        PAYLOAD_VEC_TYPE temp(payload);
+
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            index[i] = i;
+        }
+
+        std::stable_sort(index.begin(), index.end(),
+            [&a](uint32_t x, uint32_t y) { return a[x] < a[y]; });
+
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, a[index[i]]);
+            payload.insert(i, temp[index[i]]);
+        }
+        return retval;
+    }
+
+    // SORTD (key-value)
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename PAYLOAD_VEC_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE sortDescending(VEC_TYPE const & a, PAYLOAD_VEC_TYPE & payload) {
+        const uint32_t VEC_LEN = VEC_TYPE::length();
+        std::array<uint32_t, VEC_LEN> index;
+        VEC_TYPE retval;
+        PAYLOAD_VEC_TYPE temp(payload);
+
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            index[i] = i;
+        }
+
+        std::stable_sort(index.begin(), index.end(),
+            [&a](uint32_t x, uint32_t y) { return a[y] < a[x]; });
+
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, a[index[i]]);
+            payload.insert(i, temp[index[i]]);
+        }
+        return retval;
+    }
+
     // HADD
     template<typename SCALAR_TYPE, typename VEC_TYPE>
     UME_FUNC_ATTRIB SCALAR_TYPE reduceAdd(VEC_TYPE const & a) {
@@ -2685,6 +2904,130 @@ namespace SCALAR_EMULATION
         return retval;
     }
 
+    // FIRSTN
+    template<typename MASK_TYPE>
+    UME_FUNC_ATTRIB MASK_TYPE firstN(uint32_t count) {
+        MASK_TYPE retval(false);
+        for (uint32_t i = 0; i < MASK_TYPE::length() && i < count; i++) {
+            retval.insert(i, true);
+        }
+        return retval;
+    }
+
+    // Bit scanning helpers used by the mask bitmask operations. 'x' must be
+    // non-zero for trailingZeros64 and leadingZeros64.
+    UME_FUNC_ATTRIB uint32_t bitCount64(uint64_t x) {
+#if defined(__GNUC__)
+        return uint32_t(__builtin_popcountll(x));
+#else
+        x = x - ((x >> 1) & 0x5555555555555555ULL);
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return uint32_t((x * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    UME_FUNC_ATTRIB uint32_t trailingZeros64(uint64_t x) {
+#if defined(__GNUC__)
+        return uint32_t(__builtin_ctzll(x));
+#else
+        uint32_t retval = 0;
+        while ((x & 1) == 0) { x >>= 1; retval++; }
+        return retval;
+#endif
+    }
+
+    UME_FUNC_ATTRIB uint32_t leadingZeros64(uint64_t x) {
+#if defined(__GNUC__)
+        return uint32_t(__builtin_clzll(x));
+#else
+        uint32_t retval = 0;
+        while ((x & 0x8000000000000000ULL) == 0) { x <<= 1; retval++; }
+        return retval;
+#endif
+    }
+
+    // TOBITMASK
+    // Bit 'i' of the result holds lane 'firstLane + i'.
+    template<typename MASK_TYPE>
+    UME_FUNC_ATTRIB uint64_t toBitmask(MASK_TYPE const & mask, uint32_t firstLane = 0) {
+        uint64_t retval = 0;
+        for (uint32_t i = firstLane; i < MASK_TYPE::length() && i < firstLane + 64; i++) {
+            if (mask[i] == true) retval |= 1ULL << (i - firstLane);
+        }
+        return retval;
+    }
+
+    // FROMBITMASK
+    template<typename MASK_TYPE>
+    UME_FUNC_ATTRIB MASK_TYPE fromBitmask(uint64_t bits) {
+        MASK_TYPE retval(false);
+        for (uint32_t i = 0; i < MASK_TYPE::length() && i < 64; i++) {
+            retval.insert(i, ((bits >> i) & 1) != 0);
+        }
+        return retval;
+    }
+
+    // POPCNT
+    // Lanes of signed vectors are reinterpreted as unsigned integers of the
+    // same width by all of the per-lane bit counting operations.
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE populationCount(VEC_TYPE const & a) {
+        typedef typename std::make_unsigned<SCALAR_TYPE>::type UINT_T;
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, SCALAR_TYPE(bitCount64(uint64_t(UINT_T(a[i])))));
+        }
+        return retval;
+    }
+
+    // LZCNT
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE leadingZeroCount(VEC_TYPE const & a) {
+        typedef typename std::make_unsigned<SCALAR_TYPE>::type UINT_T;
+        const uint32_t WIDTH = 8 * sizeof(SCALAR_TYPE);
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            uint64_t t0 = uint64_t(UINT_T(a[i]));
+            uint32_t t1 = (t0 == 0) ? WIDTH : leadingZeros64(t0) - (64 - WIDTH);
+            retval.insert(i, SCALAR_TYPE(t1));
+        }
+        return retval;
+    }
+
+    // TZCNT
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE trailingZeroCount(VEC_TYPE const & a) {
+        typedef typename std::make_unsigned<SCALAR_TYPE>::type UINT_T;
+        const uint32_t WIDTH = 8 * sizeof(SCALAR_TYPE);
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            uint64_t t0 = uint64_t(UINT_T(a[i]));
+            uint32_t t1 = (t0 == 0) ? WIDTH : trailingZeros64(t0);
+            retval.insert(i, SCALAR_TYPE(t1));
+        }
+        return retval;
+    }
+
+    // BITREV
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FUNC_ATTRIB VEC_TYPE bitReverse(VEC_TYPE const & a) {
+        typedef typename std::make_unsigned<SCALAR_TYPE>::type UINT_T;
+        const uint32_t WIDTH = 8 * sizeof(SCALAR_TYPE);
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            uint64_t t0 = uint64_t(UINT_T(a[i]));
+            t0 = ((t0 >> 1) & 0x5555555555555555ULL) | ((t0 & 0x5555555555555555ULL) << 1);
+            t0 = ((t0 >> 2) & 0x3333333333333333ULL) | ((t0 & 0x3333333333333333ULL) << 2);
+            t0 = ((t0 >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((t0 & 0x0F0F0F0F0F0F0F0FULL) << 4);
+            t0 = ((t0 >> 8) & 0x00FF00FF00FF00FFULL) | ((t0 & 0x00FF00FF00FF00FFULL) << 8);
+            t0 = ((t0 >> 16) & 0x0000FFFF0000FFFFULL) | ((t0 & 0x0000FFFF0000FFFFULL) << 16);
+            t0 = (t0 >> 32) | (t0 << 32);
+            retval.insert(i, SCALAR_TYPE(UINT_T(t0 >> (64 - WIDTH))));
+        }
+        return retval;
+    }
+
     // HBAND
     template<typename SCALAR_TYPE, typename VEC_TYPE>
     UME_FUNC_ATTRIB SCALAR_TYPE reduceBinaryAnd(VEC_TYPE const & a) {
@@ -3331,6 +3674,27 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // POWI
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE powi(VEC_TYPE const & a, int n) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::pow(a[i], n));
+            }
+            return retval;
+        }
+
+        // MPOWI
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE powi(MASK_TYPE const & mask, VEC_TYPE const & a, int n) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                if (mask[i] == true) retval.insert(i, std::pow(a[i], n));
+                else retval.insert(i, a[i]);
+            }
+            return retval;
+        }
+
         // ROUND
         template<typename VEC_TYPE>
         UME_FUNC_ATTRIB VEC_TYPE round(VEC_TYPE const & a) {
@@ -3700,6 +4064,16 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // MATAN
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE atan(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::atan(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
         // ATAN2
         template<typename VEC_TYPE>
         UME_FUNC_ATTRIB VEC_TYPE atan2(VEC_TYPE const & a, VEC_TYPE const & b) {
@@ -3710,6 +4084,56 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // MATAN2
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE atan2(MASK_TYPE const & mask, VEC_TYPE const & a, VEC_TYPE const & b) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::atan2(a[i], b[i]) : a[i]);
+            }
+            return retval;
+        }
+
+        // ASIN
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE asin(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::asin(a[i]));
+            }
+            return retval;
+        }
+
+        // MASIN
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE asin(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::asin(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
+        // ACOS
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE acos(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::acos(a[i]));
+            }
+            return retval;
+        }
+
+        // MACOS
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE acos(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::acos(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
         // LOG
         template<typename VEC_TYPE>
         UME_FUNC_ATTRIB VEC_TYPE log(VEC_TYPE const & a) {
@@ -3720,6 +4144,16 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // MLOG
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE log(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::log(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
         // LOG10
         template<typename VEC_TYPE>
         UME_FUNC_ATTRIB VEC_TYPE log10(VEC_TYPE const & a) {
@@ -3730,6 +4164,16 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // MLOG10
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE log10(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::log10(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
         // LOG2
         template<typename VEC_TYPE>
         UME_FUNC_ATTRIB VEC_TYPE log2(VEC_TYPE const & a) {
@@ -3740,9 +4184,264 @@ namespace SCALAR_EMULATION
             return retval;
         }
 
+        // MLOG2
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE log2(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::log2(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
+        // EXP2
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE exp2(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::exp2(a[i]));
+            }
+            return retval;
+        }
+
+        // MEXP2
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE exp2(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::exp2(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
+        // EXPM1
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE expm1(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::expm1(a[i]));
+            }
+            return retval;
+        }
+
+        // MEXPM1
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE expm1(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::expm1(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
+        // LOG1P
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE log1p(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::log1p(a[i]));
+            }
+            return retval;
+        }
+
+        // MLOG1P
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE log1p(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::log1p(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
+        // SINH
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE sinh(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::sinh(a[i]));
+            }
+            return retval;
+        }
+
+        // MSINH
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE sinh(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::sinh(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
+        // COSH
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE cosh(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::cosh(a[i]));
+            }
+            return retval;
+        }
+
+        // MCOSH
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE cosh(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::cosh(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
+        // TANH
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE tanh(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::tanh(a[i]));
+            }
+            return retval;
+        }
+
+        // MTANH
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE tanh(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::tanh(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
+        // ERF
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE erf(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::erf(a[i]));
+            }
+            return retval;
+        }
+
+        // MERF
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE erf(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::erf(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
+        // ERFC
+        template<typename VEC_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE erfc(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, std::erfc(a[i]));
+            }
+            return retval;
+        }
+
+        // MERFC
+        template<typename VEC_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE erfc(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? std::erfc(a[i]) : a[i]);
+            }
+            return retval;
+        }
+
+        // NORMCDF
+        template<typename VEC_TYPE, typename SCALAR_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE normcdf(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, SCALAR_TYPE(0.5) * std::erfc(a[i] * SCALAR_TYPE(-0.70710678118654752440)));
+            }
+            return retval;
+        }
+
+        // MNORMCDF
+        template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE normcdf(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? SCALAR_TYPE(0.5) * std::erfc(a[i] * SCALAR_TYPE(-0.70710678118654752440)) : a[i]);
+            }
+            return retval;
+        }
+
+        // Inverse of the standard normal CDF: rational approximation by P. J. Acklam,
+        // refined with one step of Halley's method.
+        UME_FUNC_ATTRIB double norminvScalar(double p) {
+            const double SQRTH = 0.70710678118654752440;
+            const double SQRT2PI = 2.50662827463100050242;
+
+            if (p == 0.0) return -std::numeric_limits<double>::infinity();
+            if (p == 1.0) return std::numeric_limits<double>::infinity();
+            if (!(p > 0.0 && p < 1.0)) return std::numeric_limits<double>::quiet_NaN();
+
+            const double q = p - 0.5;
+            const double p_low = std::min(p, 1.0 - p);
+            double y;
+            if (p_low >= 0.02425) {
+                const double r = q * q;
+                y = (((((-3.969683028665376e+01 * r + 2.209460984245205e+02) * r - 2.759285104469687e+02) * r
+                    + 1.383577518672690e+02) * r - 3.066479806614716e+01) * r + 2.506628277459239e+00) * q
+                    / (((((-5.447609879822406e+01 * r + 1.615858368580409e+02) * r - 1.556989798598866e+02) * r
+                    + 6.680131188771972e+01) * r - 1.328068155288572e+01) * r + 1.0);
+            }
+            else {
+                const double t = std::sqrt(-2.0 * std::log(p_low));
+                y = (((((-7.784894002430293e-03 * t - 3.223964580411365e-01) * t - 2.400758277161838e+00) * t
+                    - 2.549732539343734e+00) * t + 4.374664141464968e+00) * t + 2.938163982698783e+00)
+                    / ((((7.784695709041462e-03 * t + 3.224671290700398e-01) * t + 2.445134137142996e+00) * t
+                    + 3.754408661907416e+00) * t + 1.0);
+                if (p > 0.5) y = -y;
+            }
+
+            // The residual Phi(y) - p is formed so that it does not cancel, neither
+            // close to the median nor in the upper tail.
+            double e;
+            if (std::abs(y) < 1.4) e = 0.5 * std::erf(y * SQRTH) - q;
+            else {
+                e = 0.5 * std::erfc(std::abs(y) * SQRTH) - p_low;
+                if (p > 0.5) e = -e;
+            }
+            if (std::abs(y) < 37.5) {
+                const double u = e * SQRT2PI * std::exp(0.5 * y * y);
+                y = y - u / (1.0 + 0.5 * y * u);
+            }
+            return y;
+        }
+
+        // NORMINV
+        template<typename VEC_TYPE, typename SCALAR_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE norminv(VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, SCALAR_TYPE(norminvScalar(a[i])));
+            }
+            return retval;
+        }
+
+        // MNORMINV
+        template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+        UME_FUNC_ATTRIB VEC_TYPE norminv(MASK_TYPE const & mask, VEC_TYPE const & a) {
+            VEC_TYPE retval;
+            for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+                retval.insert(i, (mask[i] == true) ? SCALAR_TYPE(norminvScalar(a[i])) : a[i]);
+            }
+            return retval;
+        }
+
     } // UME::SIMD::SCALAR_EMULATION::MATH
 } // namespace UME::SIMD::SCALAR_EMULATION
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 } // UME::SIMD
 } // UME
 
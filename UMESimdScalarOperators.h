@@ -6,6 +6,7 @@
 // requires explicit declaration of operators for every scalar type.
 namespace UME {
     namespace SIMD {
+    UME_SIMD_BEGIN_PLUGIN_NAMESPACE
         // LANDS
         UME_FUNC_ATTRIB SIMDMask1 operator& (bool a, SIMDMask1 const &b) { return b.land(a); }
         UME_FUNC_ATTRIB SIMDMask2 operator& (bool a, SIMDMask2 const &b) { return b.land(a); }
@@ -1122,6 +1123,129 @@ namespace UME {
         UME_FUNC_ATTRIB SIMDMask4 operator<= (double a, SIMD4_64f const & b) { return b.cmpge(a); }
         UME_FUNC_ATTRIB SIMDMask8 operator<= (double a, SIMD8_64f const & b) { return b.cmpge(a); }
         UME_FUNC_ATTRIB SIMDMask16 operator<= (double a, SIMD16_64f const & b) { return b.cmpge(a); }
+
+        // DIVINV, division by a precomputed SIMDDivider
+        UME_FUNC_ATTRIB SIMD1_8u operator/ (SIMD1_8u const & a, SIMDDivider<uint8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD2_8u operator/ (SIMD2_8u const & a, SIMDDivider<uint8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD4_8u operator/ (SIMD4_8u const & a, SIMDDivider<uint8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD8_8u operator/ (SIMD8_8u const & a, SIMDDivider<uint8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD16_8u operator/ (SIMD16_8u const & a, SIMDDivider<uint8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD32_8u operator/ (SIMD32_8u const & a, SIMDDivider<uint8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD64_8u operator/ (SIMD64_8u const & a, SIMDDivider<uint8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD128_8u operator/ (SIMD128_8u const & a, SIMDDivider<uint8_t> const & b) { return a.divide(b); }
+
+        UME_FUNC_ATTRIB SIMD1_16u operator/ (SIMD1_16u const & a, SIMDDivider<uint16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD2_16u operator/ (SIMD2_16u const & a, SIMDDivider<uint16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD4_16u operator/ (SIMD4_16u const & a, SIMDDivider<uint16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD8_16u operator/ (SIMD8_16u const & a, SIMDDivider<uint16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD16_16u operator/ (SIMD16_16u const & a, SIMDDivider<uint16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD32_16u operator/ (SIMD32_16u const & a, SIMDDivider<uint16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD64_16u operator/ (SIMD64_16u const & a, SIMDDivider<uint16_t> const & b) { return a.divide(b); }
+
+        UME_FUNC_ATTRIB SIMD1_32u operator/ (SIMD1_32u const & a, SIMDDivider<uint32_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD2_32u operator/ (SIMD2_32u const & a, SIMDDivider<uint32_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD4_32u operator/ (SIMD4_32u const & a, SIMDDivider<uint32_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD8_32u operator/ (SIMD8_32u const & a, SIMDDivider<uint32_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD16_32u operator/ (SIMD16_32u const & a, SIMDDivider<uint32_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD32_32u operator/ (SIMD32_32u const & a, SIMDDivider<uint32_t> const & b) { return a.divide(b); }
+
+        UME_FUNC_ATTRIB SIMD1_64u operator/ (SIMD1_64u const & a, SIMDDivider<uint64_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD2_64u operator/ (SIMD2_64u const & a, SIMDDivider<uint64_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD4_64u operator/ (SIMD4_64u const & a, SIMDDivider<uint64_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD8_64u operator/ (SIMD8_64u const & a, SIMDDivider<uint64_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD16_64u operator/ (SIMD16_64u const & a, SIMDDivider<uint64_t> const & b) { return a.divide(b); }
+
+        UME_FUNC_ATTRIB SIMD1_8i operator/ (SIMD1_8i const & a, SIMDDivider<int8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD2_8i operator/ (SIMD2_8i const & a, SIMDDivider<int8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD4_8i operator/ (SIMD4_8i const & a, SIMDDivider<int8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD8_8i operator/ (SIMD8_8i const & a, SIMDDivider<int8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD16_8i operator/ (SIMD16_8i const & a, SIMDDivider<int8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD32_8i operator/ (SIMD32_8i const & a, SIMDDivider<int8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD64_8i operator/ (SIMD64_8i const & a, SIMDDivider<int8_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD128_8i operator/ (SIMD128_8i const & a, SIMDDivider<int8_t> const & b) { return a.divide(b); }
+
+        UME_FUNC_ATTRIB SIMD1_16i operator/ (SIMD1_16i const & a, SIMDDivider<int16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD2_16i operator/ (SIMD2_16i const & a, SIMDDivider<int16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD4_16i operator/ (SIMD4_16i const & a, SIMDDivider<int16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD8_16i operator/ (SIMD8_16i const & a, SIMDDivider<int16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD16_16i operator/ (SIMD16_16i const & a, SIMDDivider<int16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD32_16i operator/ (SIMD32_16i const & a, SIMDDivider<int16_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD64_16i operator/ (SIMD64_16i const & a, SIMDDivider<int16_t> const & b) { return a.divide(b); }
+
+        UME_FUNC_ATTRIB SIMD1_32i operator/ (SIMD1_32i const & a, SIMDDivider<int32_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD2_32i operator/ (SIMD2_32i const & a, SIMDDivider<int32_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD4_32i operator/ (SIMD4_32i const & a, SIMDDivider<int32_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD8_32i operator/ (SIMD8_32i const & a, SIMDDivider<int32_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD16_32i operator/ (SIMD16_32i const & a, SIMDDivider<int32_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD32_32i operator/ (SIMD32_32i const & a, SIMDDivider<int32_t> const & b) { return a.divide(b); }
+
+        UME_FUNC_ATTRIB SIMD1_64i operator/ (SIMD1_64i const & a, SIMDDivider<int64_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD2_64i operator/ (SIMD2_64i const & a, SIMDDivider<int64_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD4_64i operator/ (SIMD4_64i const & a, SIMDDivider<int64_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD8_64i operator/ (SIMD8_64i const & a, SIMDDivider<int64_t> const & b) { return a.divide(b); }
+        UME_FUNC_ATTRIB SIMD16_64i operator/ (SIMD16_64i const & a, SIMDDivider<int64_t> const & b) { return a.divide(b); }
+
+        // DIVINVA
+        UME_FUNC_ATTRIB SIMD1_8u & operator/= (SIMD1_8u & a, SIMDDivider<uint8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD2_8u & operator/= (SIMD2_8u & a, SIMDDivider<uint8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD4_8u & operator/= (SIMD4_8u & a, SIMDDivider<uint8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD8_8u & operator/= (SIMD8_8u & a, SIMDDivider<uint8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD16_8u & operator/= (SIMD16_8u & a, SIMDDivider<uint8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD32_8u & operator/= (SIMD32_8u & a, SIMDDivider<uint8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD64_8u & operator/= (SIMD64_8u & a, SIMDDivider<uint8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD128_8u & operator/= (SIMD128_8u & a, SIMDDivider<uint8_t> const & b) { a = a.divide(b); return a; }
+
+        UME_FUNC_ATTRIB SIMD1_16u & operator/= (SIMD1_16u & a, SIMDDivider<uint16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD2_16u & operator/= (SIMD2_16u & a, SIMDDivider<uint16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD4_16u & operator/= (SIMD4_16u & a, SIMDDivider<uint16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD8_16u & operator/= (SIMD8_16u & a, SIMDDivider<uint16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD16_16u & operator/= (SIMD16_16u & a, SIMDDivider<uint16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD32_16u & operator/= (SIMD32_16u & a, SIMDDivider<uint16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD64_16u & operator/= (SIMD64_16u & a, SIMDDivider<uint16_t> const & b) { a = a.divide(b); return a; }
+
+        UME_FUNC_ATTRIB SIMD1_32u & operator/= (SIMD1_32u & a, SIMDDivider<uint32_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD2_32u & operator/= (SIMD2_32u & a, SIMDDivider<uint32_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD4_32u & operator/= (SIMD4_32u & a, SIMDDivider<uint32_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD8_32u & operator/= (SIMD8_32u & a, SIMDDivider<uint32_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD16_32u & operator/= (SIMD16_32u & a, SIMDDivider<uint32_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD32_32u & operator/= (SIMD32_32u & a, SIMDDivider<uint32_t> const & b) { a = a.divide(b); return a; }
+
+        UME_FUNC_ATTRIB SIMD1_64u & operator/= (SIMD1_64u & a, SIMDDivider<uint64_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD2_64u & operator/= (SIMD2_64u & a, SIMDDivider<uint64_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD4_64u & operator/= (SIMD4_64u & a, SIMDDivider<uint64_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD8_64u & operator/= (SIMD8_64u & a, SIMDDivider<uint64_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD16_64u & operator/= (SIMD16_64u & a, SIMDDivider<uint64_t> const & b) { a = a.divide(b); return a; }
+
+        UME_FUNC_ATTRIB SIMD1_8i & operator/= (SIMD1_8i & a, SIMDDivider<int8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD2_8i & operator/= (SIMD2_8i & a, SIMDDivider<int8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD4_8i & operator/= (SIMD4_8i & a, SIMDDivider<int8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD8_8i & operator/= (SIMD8_8i & a, SIMDDivider<int8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD16_8i & operator/= (SIMD16_8i & a, SIMDDivider<int8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD32_8i & operator/= (SIMD32_8i & a, SIMDDivider<int8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD64_8i & operator/= (SIMD64_8i & a, SIMDDivider<int8_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD128_8i & operator/= (SIMD128_8i & a, SIMDDivider<int8_t> const & b) { a = a.divide(b); return a; }
+
+        UME_FUNC_ATTRIB SIMD1_16i & operator/= (SIMD1_16i & a, SIMDDivider<int16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD2_16i & operator/= (SIMD2_16i & a, SIMDDivider<int16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD4_16i & operator/= (SIMD4_16i & a, SIMDDivider<int16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD8_16i & operator/= (SIMD8_16i & a, SIMDDivider<int16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD16_16i & operator/= (SIMD16_16i & a, SIMDDivider<int16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD32_16i & operator/= (SIMD32_16i & a, SIMDDivider<int16_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD64_16i & operator/= (SIMD64_16i & a, SIMDDivider<int16_t> const & b) { a = a.divide(b); return a; }
+
+        UME_FUNC_ATTRIB SIMD1_32i & operator/= (SIMD1_32i & a, SIMDDivider<int32_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD2_32i & operator/= (SIMD2_32i & a, SIMDDivider<int32_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD4_32i & operator/= (SIMD4_32i & a, SIMDDivider<int32_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD8_32i & operator/= (SIMD8_32i & a, SIMDDivider<int32_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD16_32i & operator/= (SIMD16_32i & a, SIMDDivider<int32_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD32_32i & operator/= (SIMD32_32i & a, SIMDDivider<int32_t> const & b) { a = a.divide(b); return a; }
+
+        UME_FUNC_ATTRIB SIMD1_64i & operator/= (SIMD1_64i & a, SIMDDivider<int64_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD2_64i & operator/= (SIMD2_64i & a, SIMDDivider<int64_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD4_64i & operator/= (SIMD4_64i & a, SIMDDivider<int64_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD8_64i & operator/= (SIMD8_64i & a, SIMDDivider<int64_t> const & b) { a = a.divide(b); return a; }
+        UME_FUNC_ATTRIB SIMD16_64i & operator/= (SIMD16_64i & a, SIMDDivider<int64_t> const & b) { a = a.divide(b); return a; }
+    UME_SIMD_END_PLUGIN_NAMESPACE
     }
 }
 #endif
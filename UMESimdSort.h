@@ -0,0 +1,484 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_SORT_H_
+#define UME_SIMD_SORT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "UMESimd.h"
+
+// Sorting of large arrays.
+//
+//   UME::SIMD::sort(keys, keys + n);
+//   UME::SIMD::sort(keys, keys + n, payload);
+//
+// Keys can be 32 or 64-bit integers or floating point values. The optional
+// payload is an array of unsigned integers of the same width as the keys
+// (typically element indices) and is permuted together with the keys. The
+// sort is not stable and the result is unspecified if the keys contain NaNs.
+//
+// The array is sorted in three steps:
+//   1. every register-sized block is sorted with the in-register sorting
+//      network (SORTA),
+//   2. sorted blocks are merged pairwise inside cache-sized chunks,
+//   3. sorted chunks are merged 4 at a time until the array is sorted.
+//
+// Merging keeps a descending register of pending elements. The next register
+// comes from the input whose head is smaller, and a bitonic split (MIN/MAX)
+// of both registers separates the smallest elements, which are written out,
+// from the largest ones, which become the new pending register. Both halves
+// are bitonic and are ordered with BSORTA/BSORTD, the merging stages of the
+// in-register sorting network. The 4-way merge chains such merges through
+// per-merger lookahead registers, so that the data crosses main memory once
+// for every two levels of the merge tree.
+//
+// Element types without a native sorting network in the selected plugin are
+// sorted with std::sort.
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    namespace SORT
+    {
+        // Register length used for sorting. 0 if the plugin has no native
+        // sorting network for the type.
+        template<typename SCALAR_T>
+        struct SortVecLen { static const int value = 0; };
+
+#if defined(FORCE_SCALAR) || defined(FORCE_OPENMP) || defined(__MIC__) || defined(__ALTIVEC__)
+#elif defined(__AVX512F__)
+        template<> struct SortVecLen<uint32_t> { static const int value = 16; };
+        template<> struct SortVecLen<int32_t>  { static const int value = 16; };
+        template<> struct SortVecLen<float>    { static const int value = 16; };
+        template<> struct SortVecLen<uint64_t> { static const int value = 8; };
+        template<> struct SortVecLen<int64_t>  { static const int value = 8; };
+        template<> struct SortVecLen<double>   { static const int value = 8; };
+#elif defined(__AVX2__)
+        template<> struct SortVecLen<uint32_t> { static const int value = 8; };
+        template<> struct SortVecLen<int32_t>  { static const int value = 8; };
+        template<> struct SortVecLen<float>    { static const int value = 8; };
+        template<> struct SortVecLen<uint64_t> { static const int value = 4; };
+        template<> struct SortVecLen<int64_t>  { static const int value = 4; };
+        template<> struct SortVecLen<double>   { static const int value = 4; };
+#elif defined(__aarch64__) || defined(__arm__)
+        template<> struct SortVecLen<uint32_t> { static const int value = 4; };
+        template<> struct SortVecLen<int32_t>  { static const int value = 4; };
+        template<> struct SortVecLen<float>    { static const int value = 4; };
+#elif defined(__AVX__) || defined(__SSE2__)
+        template<> struct SortVecLen<int32_t>  { static const int value = 4; };
+#endif
+
+        // Number of elements merged pairwise before switching to the 4-way
+        // merge. Keys, payload and scratch space of a chunk should fit in L2.
+        static const std::size_t CHUNK_LEN = 8192;
+
+        // Payload placeholder for sorting keys only.
+        struct NoPayload {};
+
+        template<typename PAYLOAD_T, int VEC_LEN>
+        struct PayloadVec { typedef SIMDVec<PAYLOAD_T, VEC_LEN> type; };
+
+        template<int VEC_LEN>
+        struct PayloadVec<NoPayload, VEC_LEN> { typedef NoPayload type; };
+
+        // Scalar access to the payload array that compiles to nothing when
+        // there is no payload.
+        template<typename PAYLOAD_T>
+        struct PayloadArray {
+            PAYLOAD_T* mPtr;
+            UME_FORCE_INLINE PAYLOAD_T & operator[] (std::size_t i) { return mPtr[i]; }
+        };
+
+        template<>
+        struct PayloadArray<NoPayload> {
+            NoPayload* mPtr;
+            NoPayload mDummy;
+            UME_FORCE_INLINE NoPayload & operator[] (std::size_t) { return mDummy; }
+        };
+
+        // One register of keys and the matching register of payload.
+        template<typename VEC_T, typename PAYLOAD_VEC_T>
+        struct Block {
+            typedef typename SIMDTraits<VEC_T>::SCALAR_T         KEY_T;
+            typedef typename SIMDTraits<PAYLOAD_VEC_T>::SCALAR_T PAYLOAD_T;
+            typedef typename SIMDTraits<VEC_T>::MASK_T           MASK_T;
+
+            VEC_T key;
+            PAYLOAD_VEC_T payload;
+
+            UME_FORCE_INLINE static std::size_t length() { return VEC_T::length(); }
+
+            UME_FORCE_INLINE void load(KEY_T const * k, PAYLOAD_T const * p, std::size_t i) {
+                key.load(k + i);
+                payload.load(p + i);
+            }
+            UME_FORCE_INLINE void store(KEY_T * k, PAYLOAD_T * p, std::size_t i) {
+                key.store(k + i);
+                payload.store(p + i);
+            }
+            UME_FORCE_INLINE void sortAscending() { key = key.sorta(payload); }
+            UME_FORCE_INLINE void mergeAscending() { key = key.bsorta(payload); }
+            UME_FORCE_INLINE void mergeDescending() { key = key.bsortd(payload); }
+
+            // Bitonic split of a descending 'a' and an ascending 'b': 'a'
+            // receives the smaller and 'b' the larger half of all elements.
+            UME_FORCE_INLINE static void split(Block & a, Block & b) {
+                MASK_T m = b.key.cmplt(a.key);
+                VEC_T t0 = a.key.blend(m, b.key);
+                PAYLOAD_VEC_T t1 = a.payload.blend(m, b.payload);
+                b.key = b.key.blend(m, a.key);
+                b.payload = b.payload.blend(m, a.payload);
+                a.key = t0;
+                a.payload = t1;
+            }
+        };
+
+        template<typename VEC_T>
+        struct Block<VEC_T, NoPayload> {
+            typedef typename SIMDTraits<VEC_T>::SCALAR_T KEY_T;
+            typedef NoPayload                            PAYLOAD_T;
+
+            VEC_T key;
+
+            UME_FORCE_INLINE static std::size_t length() { return VEC_T::length(); }
+            UME_FORCE_INLINE void load(KEY_T const * k, PAYLOAD_T const *, std::size_t i) {
+                key.load(k + i);
+            }
+            UME_FORCE_INLINE void store(KEY_T * k, PAYLOAD_T *, std::size_t i) {
+                key.store(k + i);
+            }
+            UME_FORCE_INLINE void sortAscending() { key = key.sorta(); }
+            UME_FORCE_INLINE void mergeAscending() { key = key.bsorta(); }
+            UME_FORCE_INLINE void mergeDescending() { key = key.bsortd(); }
+
+            UME_FORCE_INLINE static void split(Block & a, Block & b) {
+                VEC_T t0 = a.key.min(b.key);
+                b.key = a.key.max(b.key);
+                a.key = t0;
+            }
+        };
+
+        // Sorted run in memory, consumed one register at a time.
+        template<typename BLOCK_T>
+        class Run {
+        public:
+            typedef typename BLOCK_T::KEY_T     KEY_T;
+            typedef typename BLOCK_T::PAYLOAD_T PAYLOAD_T;
+
+        private:
+            KEY_T const * mKey;
+            PAYLOAD_T const * mPayload;
+            std::size_t mPos;
+            std::size_t mEnd;
+
+        public:
+            UME_FORCE_INLINE Run() : mKey(nullptr), mPayload(nullptr), mPos(0), mEnd(0) {}
+            UME_FORCE_INLINE Run(KEY_T const * k, PAYLOAD_T const * p, std::size_t begin, std::size_t end) :
+                mKey(k), mPayload(p), mPos(begin), mEnd(end) {}
+
+            UME_FORCE_INLINE bool empty() const { return mPos == mEnd; }
+            UME_FORCE_INLINE KEY_T head() const { return mKey[mPos]; }
+            UME_FORCE_INLINE void pop(BLOCK_T & b) {
+                b.load(mKey, mPayload, mPos);
+                mPos += BLOCK_T::length();
+            }
+        };
+
+        // Merge of two sorted sources (runs or other mergers), producing one
+        // sorted register at a time. The next output register is computed
+        // ahead, so that a merger can itself be used as a source.
+        template<typename BLOCK_T, typename SOURCE_T>
+        class Merger {
+        public:
+            typedef typename BLOCK_T::KEY_T KEY_T;
+
+        private:
+            SOURCE_T mX;
+            SOURCE_T mY;
+            BLOCK_T mPending;   // Largest elements seen so far, descending
+            BLOCK_T mNext;      // Next output register, ascending
+            KEY_T mHead;
+            bool mHasPending;
+            bool mHasNext;
+
+            UME_FORCE_INLINE void popSmaller(BLOCK_T & b) {
+                if (mY.empty() || (!mX.empty() && !(mY.head() < mX.head()))) mX.pop(b);
+                else mY.pop(b);
+            }
+
+            UME_FORCE_INLINE void advance() {
+                if (!mHasPending) {
+                    if (mX.empty() && mY.empty()) {
+                        mHasNext = false;
+                        return;
+                    }
+                    // A sorted register is also bitonic, so reversing it
+                    // only takes the merging stages.
+                    popSmaller(mPending);
+                    mPending.mergeDescending();
+                    mHasPending = true;
+                }
+                if (mX.empty() && mY.empty()) {
+                    mNext = mPending;
+                    mNext.mergeAscending();
+                    mHasPending = false;
+                }
+                else {
+                    popSmaller(mNext);
+                    BLOCK_T::split(mPending, mNext);
+                    std::swap(mPending, mNext);
+                    mNext.mergeAscending();
+                    mPending.mergeDescending();
+                }
+                mHead = mNext.key[0];
+                mHasNext = true;
+            }
+
+        public:
+            UME_FORCE_INLINE Merger(SOURCE_T const & x, SOURCE_T const & y) :
+                mX(x), mY(y), mHasPending(false), mHasNext(false)
+            {
+                advance();
+            }
+
+            UME_FORCE_INLINE bool empty() const { return !mHasNext; }
+            UME_FORCE_INLINE KEY_T head() const { return mHead; }
+            UME_FORCE_INLINE void pop(BLOCK_T & b) {
+                b = mNext;
+                advance();
+            }
+        };
+
+        // Binary tree of mergers over WAYS runs.
+        template<typename BLOCK_T, int WAYS>
+        struct MergeTree {
+            typedef MergeTree<BLOCK_T, WAYS / 2> HALF_T;
+            typedef Merger<BLOCK_T, typename HALF_T::TREE_T> TREE_T;
+
+            UME_FORCE_INLINE static TREE_T make(Run<BLOCK_T> const * runs) {
+                return TREE_T(HALF_T::make(runs), HALF_T::make(runs + WAYS / 2));
+            }
+        };
+
+        template<typename BLOCK_T>
+        struct MergeTree<BLOCK_T, 1> {
+            typedef Run<BLOCK_T> TREE_T;
+
+            UME_FORCE_INLINE static TREE_T make(Run<BLOCK_T> const * runs) {
+                return runs[0];
+            }
+        };
+
+        // Merge groups of WAYS consecutive runs of length 'run' from 'src'
+        // into 'dst'. All lengths are multiples of the register length.
+        template<typename BLOCK_T, int WAYS>
+        void mergePass(
+            typename BLOCK_T::KEY_T const * srcKey, typename BLOCK_T::PAYLOAD_T const * srcPayload,
+            typename BLOCK_T::KEY_T * dstKey, typename BLOCK_T::PAYLOAD_T * dstPayload,
+            std::size_t begin, std::size_t end, std::size_t run)
+        {
+            const bool HAS_PAYLOAD = !std::is_same<typename BLOCK_T::PAYLOAD_T, NoPayload>::value;
+            for (std::size_t start = begin; start < end; start += WAYS * run) {
+                if (start + run >= end) {
+                    // Single run left, nothing to merge with.
+                    std::copy(srcKey + start, srcKey + end, dstKey + start);
+                    if (HAS_PAYLOAD) std::copy(srcPayload + start, srcPayload + end, dstPayload + start);
+                    break;
+                }
+                Run<BLOCK_T> runs[WAYS];
+                for (int i = 0; i < WAYS; i++) {
+                    std::size_t b = std::min(start + i * run, end);
+                    std::size_t e = std::min(b + run, end);
+                    runs[i] = Run<BLOCK_T>(srcKey, srcPayload, b, e);
+                }
+                typename MergeTree<BLOCK_T, WAYS>::TREE_T tree = MergeTree<BLOCK_T, WAYS>::make(runs);
+                BLOCK_T t0;
+                for (std::size_t pos = start; !tree.empty(); pos += BLOCK_T::length()) {
+                    tree.pop(t0);
+                    t0.store(dstKey, dstPayload, pos);
+                }
+            }
+        }
+
+        // Insert the unsorted elements [len, count) into the sorted
+        // range [0, len).
+        template<typename KEY_T, typename PAYLOAD_T>
+        void mergeTail(KEY_T * key, PAYLOAD_T * payload, std::size_t len, std::size_t count) {
+            PayloadArray<PAYLOAD_T> pay = { payload };
+            // The tail is shorter than a register, sort it by insertion.
+            for (std::size_t i = len + 1; i < count; i++) {
+                KEY_T k = key[i];
+                PAYLOAD_T p = pay[i];
+                std::size_t j = i;
+                for (; j > len && k < key[j - 1]; j--) {
+                    key[j] = key[j - 1];
+                    pay[j] = pay[j - 1];
+                }
+                key[j] = k;
+                pay[j] = p;
+            }
+            std::vector<KEY_T> tailKey(key + len, key + count);
+            std::vector<PAYLOAD_T> tailPayload;
+            for (std::size_t i = len; i < count; i++) tailPayload.push_back(pay[i]);
+            // Merge from the back, so that no extra space is needed for the
+            // sorted part.
+            std::size_t i = len, j = count - len, k = count;
+            while (j > 0) {
+                k--;
+                if (i > 0 && tailKey[j - 1] < key[i - 1]) {
+                    i--;
+                    key[k] = key[i];
+                    pay[k] = pay[i];
+                }
+                else {
+                    j--;
+                    key[k] = tailKey[j];
+                    pay[k] = tailPayload[j];
+                }
+            }
+        }
+
+        template<typename KEY_T, typename PAYLOAD_T, int VEC_LEN>
+        struct Sorter {
+            typedef SIMDVec<KEY_T, VEC_LEN> VEC_T;
+            typedef typename PayloadVec<PAYLOAD_T, VEC_LEN>::type PAYLOAD_VEC_T;
+            typedef Block<VEC_T, PAYLOAD_VEC_T> BLOCK_T;
+
+            static void sort(KEY_T * key, PAYLOAD_T * payload, std::size_t count) {
+                const bool HAS_PAYLOAD = !std::is_same<PAYLOAD_T, NoPayload>::value;
+                if (count < 4 * VEC_LEN) {
+                    Sorter<KEY_T, PAYLOAD_T, 0>::sort(key, payload, count);
+                    return;
+                }
+                std::size_t len = count - count % VEC_LEN;
+                std::vector<KEY_T> tmpKey(len);
+                std::vector<PAYLOAD_T> tmpPayload(HAS_PAYLOAD ? len : 0);
+
+                // Sort every register.
+                BLOCK_T t0;
+                for (std::size_t i = 0; i < len; i += VEC_LEN) {
+                    t0.load(key, payload, i);
+                    t0.sortAscending();
+                    t0.store(key, payload, i);
+                }
+
+                // Merge pairwise inside chunks that stay in cache.
+                for (std::size_t begin = 0; begin < len; begin += CHUNK_LEN) {
+                    std::size_t end = std::min(begin + CHUNK_LEN, len);
+                    KEY_T * srcKey = key;
+                    PAYLOAD_T * srcPayload = payload;
+                    KEY_T * dstKey = tmpKey.data();
+                    PAYLOAD_T * dstPayload = tmpPayload.data();
+                    for (std::size_t run = VEC_LEN; run < end - begin; run *= 2) {
+                        mergePass<BLOCK_T, 2>(srcKey, srcPayload, dstKey, dstPayload, begin, end, run);
+                        std::swap(srcKey, dstKey);
+                        std::swap(srcPayload, dstPayload);
+                    }
+                    if (srcKey != key) {
+                        std::copy(srcKey + begin, srcKey + end, key + begin);
+                        if (HAS_PAYLOAD) std::copy(srcPayload + begin, srcPayload + end, payload + begin);
+                    }
+                }
+
+                // Merge the chunks 4 at a time.
+                if (len > CHUNK_LEN) {
+                    KEY_T * srcKey = key;
+                    PAYLOAD_T * srcPayload = payload;
+                    KEY_T * dstKey = tmpKey.data();
+                    PAYLOAD_T * dstPayload = tmpPayload.data();
+                    for (std::size_t run = CHUNK_LEN; run < len; run *= 4) {
+                        mergePass<BLOCK_T, 4>(srcKey, srcPayload, dstKey, dstPayload, 0, len, run);
+                        std::swap(srcKey, dstKey);
+                        std::swap(srcPayload, dstPayload);
+                    }
+                    if (srcKey != key) {
+                        std::copy(srcKey, srcKey + len, key);
+                        if (HAS_PAYLOAD) std::copy(srcPayload, srcPayload + len, payload);
+                    }
+                }
+
+                if (len < count) mergeTail(key, payload, len, count);
+            }
+        };
+
+        // No native sorting network: sort with the standard library.
+        template<typename KEY_T, typename PAYLOAD_T>
+        struct Sorter<KEY_T, PAYLOAD_T, 0> {
+            static void sort(KEY_T * key, PAYLOAD_T * payload, std::size_t count) {
+                std::vector<std::pair<KEY_T, PAYLOAD_T>> t0(count);
+                for (std::size_t i = 0; i < count; i++) t0[i] = std::make_pair(key[i], payload[i]);
+                std::sort(t0.begin(), t0.end(),
+                    [](std::pair<KEY_T, PAYLOAD_T> const & a, std::pair<KEY_T, PAYLOAD_T> const & b) {
+                        return a.first < b.first; });
+                for (std::size_t i = 0; i < count; i++) {
+                    key[i] = t0[i].first;
+                    payload[i] = t0[i].second;
+                }
+            }
+        };
+
+        template<typename KEY_T>
+        struct Sorter<KEY_T, NoPayload, 0> {
+            static void sort(KEY_T * key, NoPayload *, std::size_t count) {
+                std::sort(key, key + count);
+            }
+        };
+    }
+
+    // Sort [begin, end) in ascending order.
+    template<typename SCALAR_T>
+    void sort(SCALAR_T * begin, SCALAR_T * end) {
+        static_assert(std::is_arithmetic<SCALAR_T>::value, "UME::SIMD::sort: keys have to be arithmetic");
+        SORT::Sorter<SCALAR_T, SORT::NoPayload, SORT::SortVecLen<SCALAR_T>::value>::sort(
+            begin, nullptr, std::size_t(end - begin));
+    }
+
+    // Sort [begin, end) in ascending order, applying the same permutation to
+    // 'payload'. The payload has to be an unsigned integer array of the same
+    // element width as the keys.
+    template<typename SCALAR_T, typename PAYLOAD_T>
+    void sort(SCALAR_T * begin, SCALAR_T * end, PAYLOAD_T * payload) {
+        static_assert(std::is_arithmetic<SCALAR_T>::value, "UME::SIMD::sort: keys have to be arithmetic");
+        static_assert(std::is_unsigned<PAYLOAD_T>::value && sizeof(PAYLOAD_T) == sizeof(SCALAR_T),
+            "UME::SIMD::sort: payload has to be an unsigned integer of the same width as the keys");
+        SORT::Sorter<SCALAR_T, PAYLOAD_T, SORT::SortVecLen<SCALAR_T>::value>::sort(
+            begin, payload, std::size_t(end - begin));
+    }
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
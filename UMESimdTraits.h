@@ -33,6 +33,7 @@
 
 namespace UME {
     namespace SIMD {
+    UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
         /*******************************************************
         * SIMDTraits class gathers all types related to given SIMD_TYPE
@@ -1118,6 +1119,7 @@ namespace UME {
             return PluginTraits::NativeLength<SCALAR_TYPE>();
         }
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
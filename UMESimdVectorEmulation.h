@@ -33,11 +33,33 @@
 
 #include "UMEInline.h"
 #include "UMEBasicTypes.h"
+#include "UMESimdScalarEmulation.h"
 
 namespace UME
 {
 namespace SIMD
 {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+    // Accuracy tiers of the vectorized exponential, logarithm and trigonometric
+    // kernels. PRECISION_ACCURATE is the default. PRECISION_FAST uses shorter
+    // polynomials and simpler argument reduction, at the cost of a few ULP and
+    // of subnormal results being flushed to zero. The measured error of both
+    // tiers is listed in doc/quick_start.txt.
+    enum Precision {
+        PRECISION_FAST,
+        PRECISION_ACCURATE
+    };
+
+    // Tier used by the member functions (exp(), log(), sin(), cos()) of the plugins
+    // that rely on VECTOR_EMULATION kernels. Define UME_DEFAULT_PRECISION_FAST
+    // before including UMESimd.h to switch them to the fast tier. A single call site
+    // can select the tier explicitly using FUNCTIONS::exp<PRECISION_FAST>(x).
+#if defined(UME_DEFAULT_PRECISION_FAST)
+    const Precision DEFAULT_PRECISION = PRECISION_FAST;
+#else
+    const Precision DEFAULT_PRECISION = PRECISION_ACCURATE;
+#endif
+
     //   All functions in this namespace will have one purpose: emulation of single function in different backends.
     //   While scalar emulation is already handling primitive cases, there exists a need for emulation of more
     //   complex functions, and still benefit from vectorization. Functions present in this namespace are non-specialized
@@ -46,15 +68,47 @@ namespace SIMD
     //   performance comparison with pure scalar version, none of these functions should be called directly in the interface.
     namespace VECTOR_EMULATION
     {
-        // EXP - single precision version
+        // 2^n for integer valued 'n' in [-126, 127], built directly in the exponent field.
         template<typename FLOAT_VEC_T, typename UINT_VEC_T>
-        inline FLOAT_VEC_T expf(FLOAT_VEC_T const & initial_x) {
-            const float MAXLOGF = 88.72283905206835f;
-            const float MINLOGF = -88.f;
-
-            const float C1F =   0.693359375f;
-            const float C2F =  -2.12194440e-4f;
-
+        UME_FORCE_INLINE FLOAT_VEC_T pow2if(FLOAT_VEC_T const & n) {
+            // The biased exponent is moved into place in floating point, where
+            // (n + 127) * 2^23 is exact: the conversion then gives the bit pattern
+            // directly, without a vector shift that some plugins only emulate.
+            const UINT_VEC_T e = UINT_VEC_T(n * 8388608.0f + 1065353216.0f);
+            alignas(FLOAT_VEC_T::alignment()) float raw[FLOAT_VEC_T::length()];
+            e.store((uint32_t*)&raw[0]);
+            return FLOAT_VEC_T(raw);
+        }
+        // 2^n for integer valued 'n' in [-1022, 1023], built directly in the exponent field.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T pow2id(FLOAT_VEC_T const & n) {
+            // Adding 2^52 places the biased exponent n + 1023 in the low bits of the
+            // significand, from where it is shifted into the exponent field. This
+            // avoids a double to integer conversion, which most plugins emulate.
+            const FLOAT_VEC_T t = n + 4503599627371519.0;
+            alignas(FLOAT_VEC_T::alignment()) double raw[FLOAT_VEC_T::length()];
+            t.storea(raw);
+            UINT_VEC_T e;
+            e.loada((uint64_t*)&raw[0]);
+            (e << 52).storea((uint64_t*)&raw[0]);
+            return FLOAT_VEC_T(raw);
+        }
+        // x * 2^n for integer valued 'n'. The scaling is split in two steps so that
+        // results close to overflow, or in the subnormal range, are still exact.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ldexpf(FLOAT_VEC_T const & x, FLOAT_VEC_T const & n) {
+            const FLOAT_VEC_T h = (0.5f * n).floor();
+            return x * pow2if<FLOAT_VEC_T, UINT_VEC_T>(h) * pow2if<FLOAT_VEC_T, UINT_VEC_T>(n - h);
+        }
+        // Double precision counterpart of ldexpf().
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ldexpd(FLOAT_VEC_T const & x, FLOAT_VEC_T const & n) {
+            const FLOAT_VEC_T h = (0.5 * n).floor();
+            return x * pow2id<FLOAT_VEC_T, UINT_VEC_T>(h) * pow2id<FLOAT_VEC_T, UINT_VEC_T>(n - h);
+        }
+        // exp(x) - 1 for |x| <= ln(2)/2. Shared by exp and expm1.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T expf_poly(FLOAT_VEC_T const & x) {
             const float PX1expf = 1.9875691500E-4f;
             const float PX2expf =1.3981999507E-3f;
             const float PX3expf =8.3334519073E-3f;
@@ -62,18 +116,9 @@ namespace SIMD
             const float PX5expf =1.6666665459E-1f;
             const float PX6expf =5.0000001201E-1f;
 
-            const float LOG2EF = 1.44269504088896341f;
-
-            FLOAT_VEC_T x = initial_x;
-            FLOAT_VEC_T z = (LOG2EF * x +0.5f ).floor(); /* floor() truncates toward -infinity. */
-
-            x -= z * C1F;
-            x -= z * C2F;
-            const UINT_VEC_T n = UINT_VEC_T ( z );
-
             const FLOAT_VEC_T x2 = x * x;
 
-            z = x*PX1expf;
+            FLOAT_VEC_T z = x*PX1expf;
             z += PX2expf;
             z *= x;
             z += PX3expf;
@@ -84,25 +129,86 @@ namespace SIMD
             z *= x;
             z += PX6expf;
             z *= x2;
-            z += x + 1.0f;
+            z += x;
+            return z;
+        }
+        // EXP - single precision version, fast tier (max. 1.1 ULP)
+        // Results below FLT_MIN are flushed to zero, arguments above 88.376 overflow.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T expf_fast(FLOAT_VEC_T const & initial_x) {
+            const float MAXLOGF_FAST = 88.3762626647949f; // log(2^127.5)
+            const float MINLOGF_FAST = -87.3365447505531f; // log(FLT_MIN)
 
-            /* multiply by power of 2 */
-            alignas(FLOAT_VEC_T::alignment()) float raw[FLOAT_VEC_T::length()];
-            ((n + 0x7f) << 23).store((uint32_t*)&raw[0]);
-            FLOAT_VEC_T z_0(raw);
-            z *= z_0;
+            const float C1F =   0.693359375f;
+            const float C2F =  -2.12194440e-4f;
+
+            const float LOG2EF = 1.44269504088896341f;
 
-            z[initial_x > MAXLOGF] = std::numeric_limits<float>::infinity();
-            z[initial_x < MINLOGF] = 0.0f;
+            const float PX1expf = 1.3926176120E-3f;
+            const float PX2expf = 8.3631730745E-3f;
+            const float PX3expf = 4.1666554662E-2f;
+            const float PX4expf = 1.6666577026E-1f;
+            const float PX5expf = 5.0000000000E-1f;
 
-            return z;
+            FLOAT_VEC_T z = (LOG2EF * initial_x + 0.5f).floor();
+            FLOAT_VEC_T x = initial_x - z * C1F;
+            x -= z * C2F;
+
+            // exp(x) = 1 + x + x^2 * P(x)
+            FLOAT_VEC_T y = x * PX1expf;
+            y += PX2expf;
+            y *= x;
+            y += PX3expf;
+            y *= x;
+            y += PX4expf;
+            y *= x;
+            y += PX5expf;
+            y *= x * x;
+            y += x;
+            y += 1.0f;
+
+            y *= pow2if<FLOAT_VEC_T, UINT_VEC_T>(z);
+
+            y[initial_x > MAXLOGF_FAST] = std::numeric_limits<float>::infinity();
+            y[initial_x < MINLOGF_FAST] = 0.0f;
+
+            return y;
         }
-        // EXP - double precision version
+        // EXP - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, Precision P = PRECISION_ACCURATE>
+        inline FLOAT_VEC_T expf(FLOAT_VEC_T const & initial_x) {
+            if (P == PRECISION_FAST) {
+                return expf_fast<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            }
 
-        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
-        inline FLOAT_VEC_T expd(FLOAT_VEC_T const & initial_x) {
-            const double EXP_LIMIT = 708;
+            const float MAXLOGF = 88.72283905206835f;
+            const float MINLOGF = -103.278929903431851103f;
+
+            const float C1F =   0.693359375f;
+            const float C2F =  -2.12194440e-4f;
+
+            const float LOG2EF = 1.44269504088896341f;
+
+            FLOAT_VEC_T x = initial_x;
+            FLOAT_VEC_T z = (LOG2EF * x +0.5f ).floor(); /* floor() truncates toward -infinity. */
+
+            x -= z * C1F;
+            x -= z * C2F;
+
+            FLOAT_VEC_T y = expf_poly(x);
+            y += 1.0f;
 
+            /* multiply by power of 2 */
+            y = ldexpf<FLOAT_VEC_T, UINT_VEC_T>(y, z);
+
+            y[initial_x > MAXLOGF] = std::numeric_limits<float>::infinity();
+            y[initial_x < MINLOGF] = 0.0f;
+
+            return y;
+        }
+        // exp(x) - 1 for |x| <= 0.5. Shared by exp and expm1.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T expd_poly(FLOAT_VEC_T const & x) {
             const double PX1exp = 1.26177193074810590878E-4;
             const double PX2exp = 3.02994407707441961300E-2;
             const double PX3exp = 9.99999999999999999910E-1;
@@ -111,20 +217,10 @@ namespace SIMD
             const double QX3exp = 2.27265548208155028766E-1;
             const double QX4exp = 2.00000000000000000009E0;
 
-            const double LOG2E = 1.4426950408889634073599; // 1/log(2)
-
-            FLOAT_VEC_T x = initial_x;
-            FLOAT_VEC_T px = ( LOG2E * x +0.5 ).floor();
-
-            x -= px * 6.93145751953125E-1;
-            x -= px * 1.42860682030941723212E-6;
-
-            const UINT_VEC_T n = UINT_VEC_T ( x );
-
             const FLOAT_VEC_T xx = x * x;
 
             // px = x * P(x**2).
-            px = PX1exp;
+            FLOAT_VEC_T px(PX1exp);
             px *= xx;
             px += PX2exp;
             px *= xx;
@@ -140,64 +236,136 @@ namespace SIMD
             qx *= xx;
             qx += QX4exp;
 
-            // e**x = 1 + 2x P(x**2)/( Q(x**2) - P(x**2) )
-            x = px / (qx - px);
-            x = 1.0 + 2.0 * x;
+            // e**x - 1 = 2x P(x**2)/( Q(x**2) - P(x**2) )
+            FLOAT_VEC_T y = px / (qx - px);
+            return y + y;
+        }
+        // EXP - double precision version, fast tier (max. 1.1 ULP)
+        // Uses a polynomial instead of the rational approximation. Results below
+        // DBL_MIN are flushed to zero, arguments above 709.436 overflow.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T expd_fast(FLOAT_VEC_T const & initial_x) {
+            const double MAXLOG_FAST = 7.094361393031063E2; // log(2^1023.5)
+            const double MINLOG_FAST = -7.083964185322641E2; // log(DBL_MIN)
 
-            /* multiply by power of 2 */
-            alignas(FLOAT_VEC_T::alignment()) double raw[FLOAT_VEC_T::length()];
-            ((n + 1023) << 52).store((uint64_t*)&raw[0]);
-            UINT_VEC_T x_0((uint64_t*)raw);
+            const double LOG2E = 1.4426950408889634073599; // 1/log(2)
+
+            const double PX1exp = 2.5100456401626563E-8;
+            const double PX2exp = 2.7620075659303147E-7;
+            const double PX3exp = 2.7557268178527447E-6;
+            const double PX4exp = 2.4801521324096258E-5;
+            const double PX5exp = 1.9841269863430720E-4;
+            const double PX6exp = 1.3888888917193899E-3;
+            const double PX7exp = 8.3333333333298664E-3;
+            const double PX8exp = 4.1666666666624177E-2;
+            const double PX9exp = 1.6666666666666668E-1;
+            const double PX10exp = 5.0000000000000010E-1;
+
+            FLOAT_VEC_T px = (LOG2E * initial_x + 0.5).floor();
+            FLOAT_VEC_T x = initial_x - px * 6.93145751953125E-1;
+            x -= px * 1.42860682030941723212E-6;
 
-            x *= x_0;
+            // exp(x) = 1 + x + x^2 * P(x)
+            FLOAT_VEC_T y = x * PX1exp;
+            y += PX2exp;
+            y *= x;
+            y += PX3exp;
+            y *= x;
+            y += PX4exp;
+            y *= x;
+            y += PX5exp;
+            y *= x;
+            y += PX6exp;
+            y *= x;
+            y += PX7exp;
+            y *= x;
+            y += PX8exp;
+            y *= x;
+            y += PX9exp;
+            y *= x;
+            y += PX10exp;
+            y *= x * x;
+            y += x;
+            y += 1.0;
+
+            y *= pow2id<FLOAT_VEC_T, UINT_VEC_T>(px);
+
+            y[initial_x > MAXLOG_FAST] = std::numeric_limits<double>::infinity();
+            y[initial_x < MINLOG_FAST] = 0.0;
+
+            return y;
+        }
+        // EXP - double precision version
 
-            x[initial_x > EXP_LIMIT] = std::numeric_limits<double>::infinity();
-            x[initial_x < -EXP_LIMIT] =0.;
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, Precision P = PRECISION_ACCURATE>
+        inline FLOAT_VEC_T expd(FLOAT_VEC_T const & initial_x) {
+            if (P == PRECISION_FAST) {
+                return expd_fast<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            }
 
-            return x;
+            const double MAXLOG = 7.09782712893383996843E2;
+            const double MINLOG = -7.451332191019412076235E2;
+
+            const double LOG2E = 1.4426950408889634073599; // 1/log(2)
+
+            FLOAT_VEC_T x = initial_x;
+            FLOAT_VEC_T px = ( LOG2E * x +0.5 ).floor();
+
+            x -= px * 6.93145751953125E-1;
+            x -= px * 1.42860682030941723212E-6;
+
+            FLOAT_VEC_T y = expd_poly(x);
+            y += 1.0;
+
+            /* multiply by power of 2 */
+            y = ldexpd<FLOAT_VEC_T, UINT_VEC_T>(y, px);
+
+            y[initial_x > MAXLOG] = std::numeric_limits<double>::infinity();
+            y[initial_x < MINLOG] = 0.0;
+
+            return y;
         }
         // MEXP - single precision version
-        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
         UME_FORCE_INLINE FLOAT_VEC_T expf(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
             FLOAT_VEC_T t0 = initial_x;
-            FLOAT_VEC_T t1 = expf<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            FLOAT_VEC_T t1 = expf<FLOAT_VEC_T, UINT_VEC_T, P>(initial_x);
             t0.assign(mask, t1);
             return t0;
         }
         // MEXP - double precision version
-        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
         UME_FORCE_INLINE FLOAT_VEC_T expd(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
             FLOAT_VEC_T t0 = initial_x;
-            FLOAT_VEC_T t1 = expd<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            FLOAT_VEC_T t1 = expd<FLOAT_VEC_T, UINT_VEC_T, P>(initial_x);
             t0.assign(mask, t1);
             return t0;
         }
-        // LOG - single precision
+        // Split 'initial_x' into 'x' and 'fe', such that initial_x = (1 + x) * 2^fe
+        // with x in [sqrt(0.5) - 1, sqrt(2) - 1). Shared by all single precision logarithms.
         template<typename FLOAT_VEC_T, typename UINT_VEC_T>
-        inline FLOAT_VEC_T logf(FLOAT_VEC_T const & initial_x) {
-            const float MAXNUMF = 3.4028234663852885981170418348451692544e38f;
-            const float LOGF_UPPER_LIMIT = MAXNUMF;
-            const float LOGF_LOWER_LIMIT = 0;
-            const float PX1logf = 7.0376836292E-2f;
-            const float PX2logf	= -1.1514610310E-1f;
-            const float PX3logf	= 1.1676998740E-1f;
-            const float PX4logf	= -1.2420140846E-1f;
-            const float PX5logf	= 1.4249322787E-1f;
-            const float PX6logf	= -1.6668057665E-1f;
-            const float PX7logf	= 2.0000714765E-1f;
-            const float PX8logf	= -2.4999993993E-1f;
-            const float PX9logf	= 3.3333331174E-1f;
+        UME_FORCE_INLINE void logf_reduce(FLOAT_VEC_T const & initial_x, FLOAT_VEC_T & x, FLOAT_VEC_T & fe) {
             const float SQRTHF = 0.707106781186547524f;
 
-            FLOAT_VEC_T fe;
+            // Subnormal arguments have no implicit leading bit: scale them into
+            // the normal range by 2^25 and take that back out of the exponent.
+            FLOAT_VEC_T x0 = initial_x;
+            x0.mula(initial_x < std::numeric_limits<float>::min(), 33554432.0f);
+
             //x = details::getMantExponentf( x, fe);
             ///////////////
             alignas(FLOAT_VEC_T::alignment()) float raw[FLOAT_VEC_T::length()];
-            initial_x.storea(raw);
+            x0.storea(raw);
             UINT_VEC_T n;
             n.loada((uint32_t*)&raw[0]);
-            UINT_VEC_T e = (n >> 23)-127;
-            fe = FLOAT_VEC_T(e);
+            // Remove the exponent bias after conversion: unsigned subtraction
+            // would wrap around for arguments smaller than 1. The exponent field
+            // is scaled down in floating point rather than shifted: the conversion
+            // is exact, and some plugins only emulate the vector shift.
+            UINT_VEC_T e = n & 0x7f800000;
+            fe = FLOAT_VEC_T(e) * 1.1920928955078125e-7f;
+            fe -= 127.0f;
+            fe.suba(initial_x < std::numeric_limits<float>::min(), 25.0f);
 
             // fractional part
             const uint32_t p05f = 0x3f000000; // //sp2uint32(0.5);
@@ -205,15 +373,25 @@ namespace SIMD
             n |= p05f;
 
             n.storea((uint32_t*)&raw[0]);
-            FLOAT_VEC_T x;
             x.loada(raw);
             //////////////
 
             fe.postinc(x > SQRTHF);
             x.adda(x <= SQRTHF, x);
             x -= 1.0f;
-
-            const FLOAT_VEC_T x2 = x*x;
+        }
+        // x^3 * P(x) term of the single precision log(1 + x) approximation.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T logf_poly(FLOAT_VEC_T const & x, FLOAT_VEC_T const & x2) {
+            const float PX1logf = 7.0376836292E-2f;
+            const float PX2logf	= -1.1514610310E-1f;
+            const float PX3logf	= 1.1676998740E-1f;
+            const float PX4logf	= -1.2420140846E-1f;
+            const float PX5logf	= 1.4249322787E-1f;
+            const float PX6logf	= -1.6668057665E-1f;
+            const float PX7logf	= 2.0000714765E-1f;
+            const float PX8logf	= -2.4999993993E-1f;
+            const float PX9logf	= 3.3333331174E-1f;
 
             //FLOAT_VEC_T res = details::get_log_poly(x);
             FLOAT_VEC_T res = x*PX1logf;
@@ -234,6 +412,61 @@ namespace SIMD
             res += PX9logf;
 
             res *= x2*x;
+            return res;
+        }
+        // LOG - single precision, fast tier (max. 1 ULP)
+        // log(1 + x) = 2 atanh(s) with s = x / (2 + x): one division and a degree 2
+        // polynomial in s^2 replace the nine term polynomial of logf().
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T logf_fast(FLOAT_VEC_T const & initial_x) {
+            const float MAXNUMF = 3.4028234663852885981170418348451692544e38f;
+
+            // Coefficients of 2 * P(s^2), where atanh(s) = s + s^3 * P(s^2)
+            const float PX1logf = 2.9579949392E-1f;
+            const float PX2logf = 3.9988780566E-1f;
+            const float PX3logf = 6.6666685040E-1f;
+
+            FLOAT_VEC_T x, fe;
+            logf_reduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T s = x / (x + 2.0f);
+            const FLOAT_VEC_T z = s * s;
+
+            FLOAT_VEC_T px = z * PX1logf;
+            px += PX2logf;
+            px *= z;
+            px += PX3logf;
+            px *= z;
+
+            // 2 atanh(s) = 2s + 2s * z * P(z) = x - s * (x - 2 * z * P(z)), which
+            // keeps the rounding error of 's' out of the leading term.
+            FLOAT_VEC_T res = fe * 2.12194440e-4f + s * (x - px);
+            res = x - res;
+            res += fe * 0.693359375f;
+
+            res[initial_x > MAXNUMF] = std::numeric_limits<float>::infinity();
+            res[initial_x == 0.0f] = -std::numeric_limits<float>::infinity();
+            res[initial_x < 0.0f] = -std::numeric_limits<float>::quiet_NaN();
+            res[initial_x.isnan()] = initial_x;
+
+            return res;
+        }
+        // LOG - single precision
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, Precision P = PRECISION_ACCURATE>
+        inline FLOAT_VEC_T logf(FLOAT_VEC_T const & initial_x) {
+            if (P == PRECISION_FAST) {
+                return logf_fast<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            }
+
+            const float MAXNUMF = 3.4028234663852885981170418348451692544e38f;
+            const float LOGF_UPPER_LIMIT = MAXNUMF;
+            const float LOGF_LOWER_LIMIT = 0;
+
+            FLOAT_VEC_T x, fe;
+            logf_reduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            FLOAT_VEC_T res = logf_poly(x, x2);
 
             res += -2.12194440e-4f * fe;
             res +=  -0.5f * x2;
@@ -243,24 +476,25 @@ namespace SIMD
             res += 0.693359375f * fe;
 
             res[initial_x > LOGF_UPPER_LIMIT] = std::numeric_limits<float>::infinity();
+            res[initial_x == 0.0f] = -std::numeric_limits<float>::infinity();
             res[initial_x < LOGF_LOWER_LIMIT] = -std::numeric_limits<float>::quiet_NaN();
+            res[initial_x.isnan()] = initial_x;
 
             return res;
         }
-        // LOG - double precision
+        // Double precision counterpart of logf_reduce().
         template<typename FLOAT_VEC_T, typename UINT_VEC_T>
-        inline FLOAT_VEC_T logd(FLOAT_VEC_T const & initial_x) {
-            const double LOG_UPPER_LIMIT = 1e307;
-            const double LOG_LOWER_LIMIT = 0;
-
+        UME_FORCE_INLINE void logd_reduce(FLOAT_VEC_T const & initial_x, FLOAT_VEC_T & x, FLOAT_VEC_T & fe) {
             const double SQRTH = 0.70710678118654752440;
 
+            FLOAT_VEC_T x0 = initial_x;
+            x0.mula(initial_x < std::numeric_limits<double>::min(), 18014398509481984.0);
+
             /* separate mantissa from exponent */
-            FLOAT_VEC_T fe;
             //x = details::getMantExponent(x,fe);
             ///////
             alignas(FLOAT_VEC_T::alignment()) double raw[FLOAT_VEC_T::length()];
-            initial_x.storea(raw);
+            x0.storea(raw);
             UINT_VEC_T n;
             n.loada((uint64_t*)&raw[0]);
 
@@ -268,9 +502,15 @@ namespace SIMD
             // Then with a mask, cut off the sign bit
             UINT_VEC_T le = (n >> 52);
 
-            // chop the head of the number: an int contains more than 11 bits (32)
-            UINT_VEC_T e = le;
-            fe = e-1023;
+            // Convert the exponent with the 2^52 trick: as the low bits of a double
+            // with exponent 52 it reads 2^52 + e, which avoids the integer to double
+            // conversion that most plugins emulate.
+            UINT_VEC_T e = le | 0x4330000000000000ULL;
+            alignas(FLOAT_VEC_T::alignment()) uint64_t raw_e[FLOAT_VEC_T::length()];
+            e.storea(raw_e);
+            fe.loada((double*)&raw_e[0]);
+            fe -= 4503599627371519.0;
+            fe.suba(initial_x < std::numeric_limits<double>::min(), 54.0);
 
             // This puts to 11 zeroes the exponent
             n.banda(0x800FFFFFFFFFFFFFULL);
@@ -280,7 +520,6 @@ namespace SIMD
             n |= p05;
 
             n.storea((uint64_t*)&raw[0]);
-            FLOAT_VEC_T x;
             x.loada(&raw[0]);
 
             ///////
@@ -288,7 +527,10 @@ namespace SIMD
             fe.postinc(x > SQRTH);
             x.adda(x <= SQRTH, x);
             x -= 1.0;
-
+        }
+        // x^3 * P(x) / Q(x) term of the double precision log(1 + x) approximation.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T logd_poly(FLOAT_VEC_T const & x, FLOAT_VEC_T const & x2) {
             /* rational form */
             //FLOAT_VEC_T px =  details::get_log_px(x);
             //////
@@ -314,7 +556,6 @@ namespace SIMD
             /////
 
             //for the final formula
-            const FLOAT_VEC_T x2 = x*x;
             px *= x;
             px *= x2;
 
@@ -327,76 +568,1862 @@ namespace SIMD
             const double QX4log = 7.11544750618563894466E1;
             const double QX5log = 2.31251620126765340583E1;
 
-            FLOAT_VEC_T qx = x;
-            qx += QX1log;
-            qx *=x;
-            qx += QX2log;
-            qx *=x;
-            qx += QX3log;
-            qx *=x;
-            qx += QX4log;
-            qx *=x;
-            qx += QX5log;
-            /////
+            FLOAT_VEC_T qx = x;
+            qx += QX1log;
+            qx *=x;
+            qx += QX2log;
+            qx *=x;
+            qx += QX3log;
+            qx *=x;
+            qx += QX4log;
+            qx *=x;
+            qx += QX5log;
+            /////
+
+            return px / qx;
+        }
+        // LOG - double precision, fast tier (max. 1 ULP)
+        // log(1 + x) = 2 atanh(s) with s = x / (2 + x), using a polynomial in s^2
+        // instead of the rational approximation of logd().
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T logd_fast(FLOAT_VEC_T const & initial_x) {
+            // Coefficients of 2 * P(s^2), where atanh(s) = s + s^3 * P(s^2)
+            const double PX1log = 1.4622700987904231E-1;
+            const double PX2log = 1.5331097732030536E-1;
+            const double PX3log = 1.8182913515921680E-1;
+            const double PX4log = 2.2222210662887084E-1;
+            const double PX5log = 2.8571428630655597E-1;
+            const double PX6log = 3.9999999999877513E-1;
+            const double PX7log = 6.6666666666666735E-1;
+
+            FLOAT_VEC_T x, fe;
+            logd_reduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T s = x / (x + 2.0);
+            const FLOAT_VEC_T z = s * s;
+
+            FLOAT_VEC_T px = z * PX1log;
+            px += PX2log;
+            px *= z;
+            px += PX3log;
+            px *= z;
+            px += PX4log;
+            px *= z;
+            px += PX5log;
+            px *= z;
+            px += PX6log;
+            px *= z;
+            px += PX7log;
+            px *= z;
+
+            // 2 atanh(s) = 2s + 2s * z * P(z) = x - s * (x - 2 * z * P(z)), which
+            // keeps the rounding error of 's' out of the leading term.
+            FLOAT_VEC_T res = fe * 2.121944400546905827679e-4 + s * (x - px);
+            res = x - res;
+            res += fe * 0.693359375;
+
+            res[initial_x > std::numeric_limits<double>::max()] = std::numeric_limits<double>::infinity();
+            res[initial_x == 0.0] = -std::numeric_limits<double>::infinity();
+            res[initial_x < 0.0] = -std::numeric_limits<double>::quiet_NaN();
+            res[initial_x.isnan()] = initial_x;
+
+            return res;
+        }
+        // LOG - double precision
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, Precision P = PRECISION_ACCURATE>
+        inline FLOAT_VEC_T logd(FLOAT_VEC_T const & initial_x) {
+            if (P == PRECISION_FAST) {
+                return logd_fast<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            }
+
+            const double LOG_UPPER_LIMIT = std::numeric_limits<double>::max();
+            const double LOG_LOWER_LIMIT = 0;
+
+            FLOAT_VEC_T x, fe;
+            logd_reduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            FLOAT_VEC_T res = logd_poly(x, x2);
+
+            res -= fe * 2.121944400546905827679e-4;
+            res -= 0.5 * x2  ;
+
+            res = x + res;
+            res += fe * 0.693359375;
+
+            res[initial_x > LOG_UPPER_LIMIT] = std::numeric_limits<double>::infinity();
+            res[initial_x == 0.0] = -std::numeric_limits<double>::infinity();
+            res[initial_x < LOG_LOWER_LIMIT] = -std::numeric_limits<double>::quiet_NaN();
+            res[initial_x.isnan()] = initial_x;
+
+            return res;
+
+        }
+        // MLOG - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
+        UME_FORCE_INLINE FLOAT_VEC_T logf(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = logf<FLOAT_VEC_T, UINT_VEC_T, P>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MLOG - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
+        UME_FORCE_INLINE FLOAT_VEC_T logd(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = logd<FLOAT_VEC_T, UINT_VEC_T, P>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+    
+        // LOG2 - single precision
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T log2f(FLOAT_VEC_T const & initial_x) {
+            const float UPPER_LIMIT = std::numeric_limits<float>::max();
+            // log2(e) - 1; splitting off the 1 keeps the low bits of x and y.
+            const float LOG2EA = 0.44269504088896340736f;
+
+            FLOAT_VEC_T x, fe;
+            logf_reduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            // y = log(1 + x) - x
+            FLOAT_VEC_T y = logf_poly(x, x2);
+            y -= 0.5f * x2;
+
+            FLOAT_VEC_T res = y * LOG2EA;
+            res += x * LOG2EA;
+            res += y;
+            res += x;
+            res += fe;
+
+            res[initial_x > UPPER_LIMIT] = std::numeric_limits<float>::infinity();
+            res[initial_x == 0.0f] = -std::numeric_limits<float>::infinity();
+            res[initial_x < 0.0f] = -std::numeric_limits<float>::quiet_NaN();
+            res[initial_x.isnan()] = initial_x;
+
+            return res;
+        }
+        // LOG2 - double precision
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T log2d(FLOAT_VEC_T const & initial_x) {
+            const double UPPER_LIMIT = std::numeric_limits<double>::max();
+            // log2(e) - 1; splitting off the 1 keeps the low bits of x and y.
+            const double LOG2EA = 0.44269504088896340735992;
+
+            FLOAT_VEC_T x, fe;
+            logd_reduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            // y = log(1 + x) - x
+            FLOAT_VEC_T y = logd_poly(x, x2);
+            y -= 0.5 * x2;
+
+            FLOAT_VEC_T res = y * LOG2EA;
+            res += x * LOG2EA;
+            res += y;
+            res += x;
+            res += fe;
+
+            res[initial_x > UPPER_LIMIT] = std::numeric_limits<double>::infinity();
+            res[initial_x == 0.0] = -std::numeric_limits<double>::infinity();
+            res[initial_x < 0.0] = -std::numeric_limits<double>::quiet_NaN();
+            res[initial_x.isnan()] = initial_x;
+
+            return res;
+        }
+        // MLOG2 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log2f(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log2f<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MLOG2 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log2d(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log2d<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // LOG10 - single precision
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T log10f(FLOAT_VEC_T const & initial_x) {
+            const float UPPER_LIMIT = std::numeric_limits<float>::max();
+            // log10(e) and log10(2) split into a short head and a correction term.
+            const float L10EA = 4.3359375E-1f;
+            const float L10EB = 7.00731903251827651129E-4f;
+            const float L102A = 3.0078125E-1f;
+            const float L102B = 2.48745663981195213739E-4f;
+
+            FLOAT_VEC_T x, fe;
+            logf_reduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            // y = log(1 + x) - x
+            FLOAT_VEC_T y = logf_poly(x, x2);
+            y -= 0.5f * x2;
+
+            FLOAT_VEC_T res = y * L10EB;
+            res += x * L10EB;
+            res += fe * L102B;
+            res += y * L10EA;
+            res += x * L10EA;
+            res += fe * L102A;
+
+            res[initial_x > UPPER_LIMIT] = std::numeric_limits<float>::infinity();
+            res[initial_x == 0.0f] = -std::numeric_limits<float>::infinity();
+            res[initial_x < 0.0f] = -std::numeric_limits<float>::quiet_NaN();
+            res[initial_x.isnan()] = initial_x;
+
+            return res;
+        }
+        // LOG10 - double precision
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T log10d(FLOAT_VEC_T const & initial_x) {
+            const double UPPER_LIMIT = std::numeric_limits<double>::max();
+            // log10(e) and log10(2) split into a short head and a correction term.
+            const double L10EA = 4.3359375E-1;
+            const double L10EB = 7.00731903251827651129E-4;
+            const double L102A = 3.0078125E-1;
+            const double L102B = 2.48745663981195213739E-4;
+
+            FLOAT_VEC_T x, fe;
+            logd_reduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, x, fe);
+
+            const FLOAT_VEC_T x2 = x*x;
+            // y = log(1 + x) - x
+            FLOAT_VEC_T y = logd_poly(x, x2);
+            y -= 0.5 * x2;
+
+            FLOAT_VEC_T res = y * L10EB;
+            res += x * L10EB;
+            res += fe * L102B;
+            res += y * L10EA;
+            res += x * L10EA;
+            res += fe * L102A;
+
+            res[initial_x > UPPER_LIMIT] = std::numeric_limits<double>::infinity();
+            res[initial_x == 0.0] = -std::numeric_limits<double>::infinity();
+            res[initial_x < 0.0] = -std::numeric_limits<double>::quiet_NaN();
+            res[initial_x.isnan()] = initial_x;
+
+            return res;
+        }
+        // MLOG10 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log10f(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log10f<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MLOG10 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log10d(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log10d<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // EXP2 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T exp2f(FLOAT_VEC_T const & initial_x) {
+            const float MAXL2F = 128.0f;
+            const float MINL2F = -150.0f;
+
+            const float PX1exp2f = 1.535336188319500E-4f;
+            const float PX2exp2f = 1.339887440266574E-3f;
+            const float PX3exp2f = 9.618437357674640E-3f;
+            const float PX4exp2f = 5.550332471162809E-2f;
+            const float PX5exp2f = 2.402264791363012E-1f;
+            const float PX6exp2f = 6.931472028550421E-1f;
+
+            // 2^x = 2^n * 2^r, with integer n and |r| <= 0.5
+            const FLOAT_VEC_T n = (initial_x + 0.5f).floor();
+            const FLOAT_VEC_T x = initial_x - n;
+
+            FLOAT_VEC_T y = x*PX1exp2f;
+            y += PX2exp2f;
+            y *= x;
+            y += PX3exp2f;
+            y *= x;
+            y += PX4exp2f;
+            y *= x;
+            y += PX5exp2f;
+            y *= x;
+            y += PX6exp2f;
+            y *= x;
+            y += 1.0f;
+
+            y = ldexpf<FLOAT_VEC_T, UINT_VEC_T>(y, n);
+
+            y[initial_x >= MAXL2F] = std::numeric_limits<float>::infinity();
+            y[initial_x < MINL2F] = 0.0f;
+            return y;
+        }
+        // EXP2 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T exp2d(FLOAT_VEC_T const & initial_x) {
+            const double MAXL2 = 1024.0;
+            const double MINL2 = -1075.0;
+
+            const double PX1exp2 = 2.30933477057345225087E-2;
+            const double PX2exp2 = 2.02020656693165307700E1;
+            const double PX3exp2 = 1.51390680115615096133E3;
+            const double QX1exp2 = 2.33184211722314911771E2;
+            const double QX2exp2 = 4.36821166879210612817E3;
+
+            // 2^x = 2^n * 2^r, with integer n and |r| <= 0.5
+            const FLOAT_VEC_T n = (initial_x + 0.5).floor();
+            const FLOAT_VEC_T x = initial_x - n;
+            const FLOAT_VEC_T xx = x * x;
+
+            FLOAT_VEC_T px(PX1exp2);
+            px *= xx;
+            px += PX2exp2;
+            px *= xx;
+            px += PX3exp2;
+            px *= x;
+
+            FLOAT_VEC_T qx = xx + QX1exp2;
+            qx *= xx;
+            qx += QX2exp2;
+
+            // 2**x = 1 + 2x P(x**2)/( Q(x**2) - P(x**2) )
+            FLOAT_VEC_T y = px / (qx - px);
+            y = 1.0 + 2.0 * y;
+
+            y = ldexpd<FLOAT_VEC_T, UINT_VEC_T>(y, n);
+
+            y[initial_x >= MAXL2] = std::numeric_limits<double>::infinity();
+            y[initial_x < MINL2] = 0.0;
+            return y;
+        }
+        // MEXP2 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T exp2f(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = exp2f<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MEXP2 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T exp2d(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = exp2d<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // EXPM1 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T expm1f(FLOAT_VEC_T const & initial_x) {
+            const float LN2O2F = 0.346573590279972654709f;
+
+            FLOAT_VEC_T y = expf<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            y -= 1.0f;
+            // exp(x) - 1 cancels for small arguments: evaluate the polynomial directly.
+            y[initial_x.abs() <= LN2O2F] = expf_poly(initial_x);
+            return y;
+        }
+        // EXPM1 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        inline FLOAT_VEC_T expm1d(FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T y = expd<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            y -= 1.0;
+            // exp(x) - 1 cancels for small arguments: evaluate the rational form directly.
+            y[initial_x.abs() <= 0.5] = expd_poly(initial_x);
+            return y;
+        }
+        // MEXPM1 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T expm1f(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = expm1f<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MEXPM1 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T expm1d(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = expm1d<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // LOG1P - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T log1pf(FLOAT_VEC_T const & initial_x) {
+            const float SQRTHF = 0.707106781186547524f;
+            const float SQRT2F = 1.41421356237309504880f;
+
+            const FLOAT_VEC_T u = initial_x + 1.0f;
+            FLOAT_VEC_T res = logf<FLOAT_VEC_T, UINT_VEC_T>(u);
+
+            // Close to zero the rounding of 1 + x would dominate the error: 'x' is
+            // already in the range of the logarithm polynomial, so use it directly.
+            const MASK_T mask_small = (u > SQRTHF) && (u < SQRT2F);
+            const FLOAT_VEC_T x2 = initial_x * initial_x;
+            FLOAT_VEC_T t = logf_poly(initial_x, x2);
+            t += -0.5f * x2;
+            t = initial_x + t;
+            res.assign(mask_small, t);
+
+            res[initial_x == -1.0f] = -std::numeric_limits<float>::infinity();
+            res[initial_x.isnan()] = initial_x;
+            return res;
+        }
+        // LOG1P - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T log1pd(FLOAT_VEC_T const & initial_x) {
+            const double SQRTH = 0.70710678118654752440;
+            const double SQRT2 = 1.41421356237309504880;
+
+            const FLOAT_VEC_T u = initial_x + 1.0;
+            FLOAT_VEC_T res = logd<FLOAT_VEC_T, UINT_VEC_T>(u);
+
+            const MASK_T mask_small = (u > SQRTH) && (u < SQRT2);
+            const FLOAT_VEC_T x2 = initial_x * initial_x;
+            FLOAT_VEC_T t = logd_poly(initial_x, x2);
+            t -= 0.5 * x2;
+            t = initial_x + t;
+            res.assign(mask_small, t);
+
+            res[initial_x == -1.0] = -std::numeric_limits<double>::infinity();
+            res[initial_x.isnan()] = initial_x;
+            return res;
+        }
+        // MLOG1P - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log1pf(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log1pf<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MLOG1P - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log1pd(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log1pd<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // SINH - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T sinhf(FLOAT_VEC_T const & xx) {
+            const float MAXLOGF = 88.72283905206835f;
+            const float LOGE2F = 0.693147180559945309f;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            // sinh(x) = (E + E/(E + 1))/2 with E = expm1(x). Unlike (exp(x) - exp(-x))/2
+            // this does not cancel for small arguments.
+            const FLOAT_VEC_T e = expm1f<FLOAT_VEC_T, UINT_VEC_T>(x_pos);
+            FLOAT_VEC_T y = 0.5f * (e + e / (e + 1.0f));
+
+            // exp(x) overflows before sinh(x) does.
+            MASK_T mask_big = x_pos > (MAXLOGF - LOGE2F);
+            if (mask_big.hlor()) {
+                const FLOAT_VEC_T t = expf<FLOAT_VEC_T, UINT_VEC_T>(0.5f * x_pos);
+                y.assign(mask_big, (0.5f * t) * t);
+            }
+
+            y.nega(xx < 0.0f);
+            return y;
+        }
+        // SINH - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T sinhd(FLOAT_VEC_T const & xx) {
+            const double MAXLOG = 7.09782712893383996843E2;
+            const double LOGE2 = 6.93147180559945309417E-1;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            const FLOAT_VEC_T e = expm1d<FLOAT_VEC_T, UINT_VEC_T>(x_pos);
+            FLOAT_VEC_T y = 0.5 * (e + e / (e + 1.0));
+
+            MASK_T mask_big = x_pos > (MAXLOG - LOGE2);
+            if (mask_big.hlor()) {
+                const FLOAT_VEC_T t = expd<FLOAT_VEC_T, UINT_VEC_T>(0.5 * x_pos);
+                y.assign(mask_big, (0.5 * t) * t);
+            }
+
+            y.nega(xx < 0.0);
+            return y;
+        }
+        // MSINH - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T sinhf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = sinhf<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MSINH - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T sinhd(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = sinhd<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // COSH - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T coshf(FLOAT_VEC_T const & xx) {
+            const float MAXLOGF = 88.72283905206835f;
+            const float LOGE2F = 0.693147180559945309f;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            // cosh(x) = (exp(x) + 1/exp(x))/2, no cancellation here.
+            const FLOAT_VEC_T e = expf<FLOAT_VEC_T, UINT_VEC_T>(x_pos);
+            FLOAT_VEC_T y = 0.5f * (e + FLOAT_VEC_T(1.0f) / e);
+
+            // exp(x) overflows before cosh(x) does.
+            MASK_T mask_big = x_pos > (MAXLOGF - LOGE2F);
+            if (mask_big.hlor()) {
+                const FLOAT_VEC_T t = expf<FLOAT_VEC_T, UINT_VEC_T>(0.5f * x_pos);
+                y.assign(mask_big, (0.5f * t) * t);
+            }
+            return y;
+        }
+        // COSH - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T coshd(FLOAT_VEC_T const & xx) {
+            const double MAXLOG = 7.09782712893383996843E2;
+            const double LOGE2 = 6.93147180559945309417E-1;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            const FLOAT_VEC_T e = expd<FLOAT_VEC_T, UINT_VEC_T>(x_pos);
+            FLOAT_VEC_T y = 0.5 * (e + FLOAT_VEC_T(1.0) / e);
+
+            MASK_T mask_big = x_pos > (MAXLOG - LOGE2);
+            if (mask_big.hlor()) {
+                const FLOAT_VEC_T t = expd<FLOAT_VEC_T, UINT_VEC_T>(0.5 * x_pos);
+                y.assign(mask_big, (0.5 * t) * t);
+            }
+            return y;
+        }
+        // MCOSH - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T coshf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = coshf<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MCOSH - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T coshd(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = coshd<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // TANH - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T tanhf(FLOAT_VEC_T const & xx) {
+            const float MAXLOGF = 88.72283905206835f;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            // tanh(x) = E/(E + 2) with E = expm1(2x): accurate for small arguments
+            // and free of the 1 - 2/(exp(2x) + 1) cancellation.
+            const FLOAT_VEC_T e = expm1f<FLOAT_VEC_T, UINT_VEC_T>(x_pos + x_pos);
+            FLOAT_VEC_T y = e / (e + 2.0f);
+
+            // Saturate before expm1() overflows to infinity.
+            y[x_pos > (0.5f * MAXLOGF)] = 1.0f;
+
+            y.nega(xx < 0.0f);
+            return y;
+        }
+        // TANH - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T tanhd(FLOAT_VEC_T const & xx) {
+            const double MAXLOG = 7.09782712893383996843E2;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            const FLOAT_VEC_T e = expm1d<FLOAT_VEC_T, UINT_VEC_T>(x_pos + x_pos);
+            FLOAT_VEC_T y = e / (e + 2.0);
+
+            y[x_pos > (0.5 * MAXLOG)] = 1.0;
+
+            y.nega(xx < 0.0);
+            return y;
+        }
+        // MTANH - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tanhf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = tanhf<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MTANH - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tanhd(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = tanhd<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // Upper half (12 bits) of the significand of 'x'. The product of two such
+        // halves, or of a half and a remainder x - splitf_hi(x), is exact. The low
+        // bits are cleared explicitly: Veltkamp's splitting gives wrong results once
+        // the compiler contracts its multiplications and additions into FMAs.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T splitf_hi(FLOAT_VEC_T const & x) {
+            alignas(FLOAT_VEC_T::alignment()) float raw[FLOAT_VEC_T::length()];
+            x.storea(raw);
+            UINT_VEC_T n;
+            n.loada((uint32_t*)&raw[0]);
+            n.banda(0xFFFFF000);
+            n.storea((uint32_t*)&raw[0]);
+            return FLOAT_VEC_T(raw);
+        }
+        // Double precision counterpart of splitf_hi(), keeping the upper 26 bits.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T splitd_hi(FLOAT_VEC_T const & x) {
+            alignas(FLOAT_VEC_T::alignment()) double raw[FLOAT_VEC_T::length()];
+            x.storea(raw);
+            UINT_VEC_T n;
+            n.loada((uint64_t*)&raw[0]);
+            n.banda(0xFFFFFFFFF8000000ULL);
+            n.storea((uint64_t*)&raw[0]);
+            return FLOAT_VEC_T(raw);
+        }
+        // (ah + al) * (bh + bl) as the unevaluated sum hi + lo, for operands split
+        // with splitf_hi() or splitd_hi(). All partial products are exact, except
+        // al * bl in double precision, which only affects the last bits of 'lo'.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE void mul_ext(FLOAT_VEC_T const & ah, FLOAT_VEC_T const & al,
+                                      FLOAT_VEC_T const & bh, FLOAT_VEC_T const & bl,
+                                      FLOAT_VEC_T & hi, FLOAT_VEC_T & lo) {
+            const FLOAT_VEC_T p1 = ah * bh;
+            const FLOAT_VEC_T p2 = ah * bl + al * bh;
+            hi = p1 + p2;
+            lo = (p2 - (hi - p1)) + al * bl;
+        }
+        // log(x) as the unevaluated sum hi + lo, about 8 bits more accurate than logf().
+        // Used by powf(), where the error of log(x) gets multiplied by y. 'initial_x'
+        // must be positive and finite.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE void logf_ext(FLOAT_VEC_T const & initial_x, FLOAT_VEC_T & hi, FLOAT_VEC_T & lo) {
+            FLOAT_VEC_T m, fe;
+            logf_reduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, m, fe);
+
+            // log(1 + m) = 2 atanh(s) with s = m / (2 + m) = sh + sl. The remainder
+            // m - sh * (2 + m) is evaluated exactly, using split halves for sh * m.
+            const FLOAT_VEC_T d = m + 2.0f;
+            const FLOAT_VEC_T sh = m / d;
+            const FLOAT_VEC_T shh = splitf_hi<FLOAT_VEC_T, UINT_VEC_T>(sh);
+            const FLOAT_VEC_T shl = sh - shh;
+            const FLOAT_VEC_T mh = splitf_hi<FLOAT_VEC_T, UINT_VEC_T>(m);
+            const FLOAT_VEC_T ml = m - mh;
+            FLOAT_VEC_T r = m - 2.0f * sh;
+            r -= shh * mh;
+            r -= shh * ml;
+            r -= shl * mh;
+            r -= shl * ml;
+            const FLOAT_VEC_T sl = r / d;
+
+            // s^3 in two parts
+            FLOAT_VEC_T zh, zl, s3h, s3l;
+            mul_ext(shh, shl, shh, shl, zh, zl);
+            const FLOAT_VEC_T zhh = splitf_hi<FLOAT_VEC_T, UINT_VEC_T>(zh);
+            mul_ext(zhh, zh - zhh, shh, shl, s3h, s3l);
+            s3l += zl * sh + 3.0f * zh * sl;
+
+            // 2/3 * s^3 in two parts: the remainder 2 * s3h - 3 * qh is exact.
+            const FLOAT_VEC_T qh = s3h * 0.666666666666666667f;
+            FLOAT_VEC_T ql = (2.0f * s3h - 2.0f * qh) - qh;
+            ql = (ql + 2.0f * s3l) * 0.333333333333333333f;
+
+            // 2 atanh(s) - 2s - 2/3 s^3 = s^5 * P(s^2), Taylor coefficients 2 / (2k + 1)
+            FLOAT_VEC_T p = zh * 1.8181818181818182E-1f;
+            p += 2.2222222222222222E-1f;
+            p *= zh;
+            p += 2.8571428571428571E-1f;
+            p *= zh;
+            p += 4.0000000000000000E-1f;
+            p *= zh * s3h;
+
+            // fe * log(2) + 2 sh + 2/3 sh^3, summed exactly. fe * 0.693359375 is exact
+            // and at least as large as 2 sh, unless fe is 0.
+            const FLOAT_VEC_T a = fe * 0.693359375f;
+            const FLOAT_VEC_T b = 2.0f * sh;
+            const FLOAT_VEC_T h1 = a + b;
+            FLOAT_VEC_T l = b - (h1 - a);
+            const FLOAT_VEC_T h2 = h1 + qh;
+            l += qh - (h2 - h1);
+            l += fe * -2.12194440e-4f + (2.0f * sl + (ql + p));
+            hi = h2 + l;
+            lo = l - (hi - h2);
+        }
+        // Double precision counterpart of logf_ext().
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE void logd_ext(FLOAT_VEC_T const & initial_x, FLOAT_VEC_T & hi, FLOAT_VEC_T & lo) {
+            FLOAT_VEC_T m, fe;
+            logd_reduce<FLOAT_VEC_T, UINT_VEC_T>(initial_x, m, fe);
+
+            const FLOAT_VEC_T d = m + 2.0;
+            const FLOAT_VEC_T sh = m / d;
+            const FLOAT_VEC_T shh = splitd_hi<FLOAT_VEC_T, UINT_VEC_T>(sh);
+            const FLOAT_VEC_T shl = sh - shh;
+            const FLOAT_VEC_T mh = splitd_hi<FLOAT_VEC_T, UINT_VEC_T>(m);
+            const FLOAT_VEC_T ml = m - mh;
+            FLOAT_VEC_T r = m - 2.0 * sh;
+            r -= shh * mh;
+            r -= shh * ml;
+            r -= shl * mh;
+            r -= shl * ml;
+            const FLOAT_VEC_T sl = r / d;
+
+            FLOAT_VEC_T zh, zl, s3h, s3l;
+            mul_ext(shh, shl, shh, shl, zh, zl);
+            const FLOAT_VEC_T zhh = splitd_hi<FLOAT_VEC_T, UINT_VEC_T>(zh);
+            mul_ext(zhh, zh - zhh, shh, shl, s3h, s3l);
+            s3l += zl * sh + 3.0 * zh * sl;
+
+            const FLOAT_VEC_T qh = s3h * 0.666666666666666667;
+            FLOAT_VEC_T ql = (2.0 * s3h - 2.0 * qh) - qh;
+            ql = (ql + 2.0 * s3l) * 0.333333333333333333;
+
+            FLOAT_VEC_T p = zh * 8.6956521739130435E-2;
+            p += 9.5238095238095238E-2;
+            p *= zh;
+            p += 1.0526315789473684E-1;
+            p *= zh;
+            p += 1.1764705882352941E-1;
+            p *= zh;
+            p += 1.3333333333333333E-1;
+            p *= zh;
+            p += 1.5384615384615385E-1;
+            p *= zh;
+            p += 1.8181818181818182E-1;
+            p *= zh;
+            p += 2.2222222222222222E-1;
+            p *= zh;
+            p += 2.8571428571428571E-1;
+            p *= zh;
+            p += 4.0000000000000000E-1;
+            p *= zh * s3h;
+
+            const FLOAT_VEC_T a = fe * 0.693359375;
+            const FLOAT_VEC_T b = 2.0 * sh;
+            const FLOAT_VEC_T h1 = a + b;
+            FLOAT_VEC_T l = b - (h1 - a);
+            const FLOAT_VEC_T h2 = h1 + qh;
+            l += qh - (h2 - h1);
+            l += fe * -2.121944400546905827679e-4 + (2.0 * sl + (ql + p));
+            hi = h2 + l;
+            lo = l - (hi - h2);
+        }
+        // Special cases of pow(x, y), as in C99 Annex F, applied over 'res', the value
+        // of exp(y * log(|x|)). With 'flush' set, subnormal 'x' is treated as zero.
+        template<typename FLOAT_VEC_T, typename MASK_T, typename SCALAR_T>
+        UME_FORCE_INLINE FLOAT_VEC_T pow_special(FLOAT_VEC_T const & x, FLOAT_VEC_T const & y,
+                                                 FLOAT_VEC_T const & res, bool flush) {
+            const SCALAR_T INF = std::numeric_limits<SCALAR_T>::infinity();
+            const SCALAR_T QNAN = std::numeric_limits<SCALAR_T>::quiet_NaN();
+
+            FLOAT_VEC_T t0 = res;
+            const FLOAT_VEC_T ax = x.abs();
+            const FLOAT_VEC_T half_y = SCALAR_T(0.5) * y;
+            const MASK_T y_neg = y < SCALAR_T(0);
+            const MASK_T y_int = y.floor() == y;
+            const MASK_T y_odd = y_int && (half_y.floor() != half_y);
+
+            // |x| is 0 or inf: the result is 0 or inf, depending on the sign of y
+            const MASK_T x_zero = flush ? (ax < std::numeric_limits<SCALAR_T>::min()) : (ax == SCALAR_T(0));
+            const MASK_T x_inf = ax == INF;
+            FLOAT_VEC_T t1(SCALAR_T(0));
+            t1.assign((x_zero && y_neg) || (x_inf && !y_neg), INF);
+            t0.assign(x_zero || x_inf, t1);
+
+            // y is +/-inf: the result is 0, 1 or inf, depending on |x| compared to 1
+            FLOAT_VEC_T t2(SCALAR_T(0));
+            t2.assign((ax > SCALAR_T(1) && !y_neg) || (ax < SCALAR_T(1) && y_neg), INF);
+            t2.assign(ax == SCALAR_T(1), SCALAR_T(1));
+            t0.assign(y.abs() == INF, t2);
+
+            // Negative x: finite x requires an integer y, and odd y keep the sign of x.
+            // 1/x catches x == -0. The sign is flipped with a multiplication, as negation
+            // may be implemented as 0 - t0, which loses the sign of zero.
+            t0.assign((x < SCALAR_T(0)) && !x_inf && !y_int, QNAN);
+            const MASK_T x_neg = (x < SCALAR_T(0)) || (FLOAT_VEC_T(SCALAR_T(1)) / x < SCALAR_T(0));
+            t0.assign(y_odd && x_neg, t0 * SCALAR_T(-1));
+
+            t0.assign(!(x == x) || !(y == y), QNAN);
+            t0.assign((y == SCALAR_T(0)) || (x == SCALAR_T(1)), SCALAR_T(1));
+            return t0;
+        }
+        // POW - single precision version (max. 2 ULP)
+        // exp(y * log(x)), with log(x) and the product evaluated in extended precision.
+        // The fast tier uses the fast exp and log directly: its error grows to about
+        // 2 * |y * log(x)| ULP, and it overflows where expf_fast() does.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
+        inline FLOAT_VEC_T powf(FLOAT_VEC_T const & x, FLOAT_VEC_T const & y) {
+            const float MAXLOGF = 88.72283905206835f;
+            const float MINLOGF = -103.278929903431851103f;
+
+            const FLOAT_VEC_T ax = x.abs();
+            FLOAT_VEC_T res;
+            if (P == PRECISION_FAST) {
+                res = expf_fast<FLOAT_VEC_T, UINT_VEC_T>(y * logf_fast<FLOAT_VEC_T, UINT_VEC_T>(ax));
+                return pow_special<FLOAT_VEC_T, MASK_T, float>(x, y, res, true);
+            }
+
+            FLOAT_VEC_T lh, ll, th, tl;
+            logf_ext<FLOAT_VEC_T, UINT_VEC_T>(ax, lh, ll);
+
+            // y * log(x) = t + tl
+            const FLOAT_VEC_T yh = splitf_hi<FLOAT_VEC_T, UINT_VEC_T>(y);
+            const FLOAT_VEC_T lhh = splitf_hi<FLOAT_VEC_T, UINT_VEC_T>(lh);
+            mul_ext(yh, y - yh, lhh, lh - lhh, th, tl);
+            tl += y * ll;
+            const FLOAT_VEC_T t = th + tl;
+            tl -= t - th;
+
+            // exp(t + tl) = exp(t) * (1 + tl)
+            const FLOAT_VEC_T e = expf<FLOAT_VEC_T, UINT_VEC_T>(t);
+            res = e + e * tl;
+            res.assign(e == std::numeric_limits<float>::infinity(), e);
+            res[th > MAXLOGF] = std::numeric_limits<float>::infinity();
+            res[th < MINLOGF] = 0.0f;
+
+            return pow_special<FLOAT_VEC_T, MASK_T, float>(x, y, res, false);
+        }
+        // POW - double precision version (max. 3 ULP)
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
+        inline FLOAT_VEC_T powd(FLOAT_VEC_T const & x, FLOAT_VEC_T const & y) {
+            const double MAXLOG = 7.09782712893383996843E2;
+            const double MINLOG = -7.451332191019412076235E2;
+
+            const FLOAT_VEC_T ax = x.abs();
+            FLOAT_VEC_T res;
+            if (P == PRECISION_FAST) {
+                res = expd_fast<FLOAT_VEC_T, UINT_VEC_T>(y * logd_fast<FLOAT_VEC_T, UINT_VEC_T>(ax));
+                return pow_special<FLOAT_VEC_T, MASK_T, double>(x, y, res, true);
+            }
+
+            FLOAT_VEC_T lh, ll, th, tl;
+            logd_ext<FLOAT_VEC_T, UINT_VEC_T>(ax, lh, ll);
+
+            const FLOAT_VEC_T yh = splitd_hi<FLOAT_VEC_T, UINT_VEC_T>(y);
+            const FLOAT_VEC_T lhh = splitd_hi<FLOAT_VEC_T, UINT_VEC_T>(lh);
+            mul_ext(yh, y - yh, lhh, lh - lhh, th, tl);
+            tl += y * ll;
+            const FLOAT_VEC_T t = th + tl;
+            tl -= t - th;
+
+            const FLOAT_VEC_T e = expd<FLOAT_VEC_T, UINT_VEC_T>(t);
+            res = e + e * tl;
+            res.assign(e == std::numeric_limits<double>::infinity(), e);
+            res[th > MAXLOG] = std::numeric_limits<double>::infinity();
+            res[th < MINLOG] = 0.0;
+
+            return pow_special<FLOAT_VEC_T, MASK_T, double>(x, y, res, false);
+        }
+        // MPOW - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
+        UME_FORCE_INLINE FLOAT_VEC_T powf(MASK_T const & mask, FLOAT_VEC_T const & x, FLOAT_VEC_T const & y) {
+            FLOAT_VEC_T t0 = x;
+            FLOAT_VEC_T t1 = powf<FLOAT_VEC_T, UINT_VEC_T, MASK_T, P>(x, y);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MPOW - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
+        UME_FORCE_INLINE FLOAT_VEC_T powd(MASK_T const & mask, FLOAT_VEC_T const & x, FLOAT_VEC_T const & y) {
+            FLOAT_VEC_T t0 = x;
+            FLOAT_VEC_T t1 = powd<FLOAT_VEC_T, UINT_VEC_T, MASK_T, P>(x, y);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // POWI - x^n for an integer n, by repeated squaring. Each squaring doubles
+        // the relative error, so pow() is the better choice for large |n|.
+        template<typename FLOAT_VEC_T, typename SCALAR_T>
+        inline FLOAT_VEC_T powi(FLOAT_VEC_T const & x, int n) {
+            unsigned int k = (n < 0) ? 0u - (unsigned int)n : (unsigned int)n;
+            FLOAT_VEC_T res(SCALAR_T(1));
+            FLOAT_VEC_T b = x;
+            while (true) {
+                if (k & 1) res *= b;
+                k >>= 1;
+                if (k == 0) break;
+                b *= b;
+            }
+            if (n < 0) res = FLOAT_VEC_T(SCALAR_T(1)) / res;
+            return res;
+        }
+        // MPOWI
+        template<typename FLOAT_VEC_T, typename SCALAR_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T powi(MASK_T const & mask, FLOAT_VEC_T const & x, int n) {
+            FLOAT_VEC_T t0 = x;
+            FLOAT_VEC_T t1 = powi<FLOAT_VEC_T, SCALAR_T>(x, n);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // x^N for an integer N known at compile time: the squarings of powi() are
+        // unrolled into a fixed sequence of multiplications.
+        template<typename FLOAT_VEC_T, typename SCALAR_T, int N, bool NEGATIVE = (N < 0)>
+        struct powi_unrolled {
+            static UME_FORCE_INLINE FLOAT_VEC_T eval(FLOAT_VEC_T const & x) {
+                const FLOAT_VEC_T h = powi_unrolled<FLOAT_VEC_T, SCALAR_T, N / 2>::eval(x);
+                return (N % 2 == 0) ? h * h : h * h * x;
+            }
+        };
+        template<typename FLOAT_VEC_T, typename SCALAR_T, int N>
+        struct powi_unrolled<FLOAT_VEC_T, SCALAR_T, N, true> {
+            static UME_FORCE_INLINE FLOAT_VEC_T eval(FLOAT_VEC_T const & x) {
+                return FLOAT_VEC_T(SCALAR_T(1)) / powi_unrolled<FLOAT_VEC_T, SCALAR_T, -N>::eval(x);
+            }
+        };
+        template<typename FLOAT_VEC_T, typename SCALAR_T>
+        struct powi_unrolled<FLOAT_VEC_T, SCALAR_T, 1, false> {
+            static UME_FORCE_INLINE FLOAT_VEC_T eval(FLOAT_VEC_T const & x) {
+                return x;
+            }
+        };
+        template<typename FLOAT_VEC_T, typename SCALAR_T>
+        struct powi_unrolled<FLOAT_VEC_T, SCALAR_T, 0, false> {
+            static UME_FORCE_INLINE FLOAT_VEC_T eval(FLOAT_VEC_T const &) {
+                return FLOAT_VEC_T(SCALAR_T(1));
+            }
+        };
+        // POWN - x^N, compile time exponent
+        template<int N, typename FLOAT_VEC_T, typename SCALAR_T>
+        UME_FORCE_INLINE FLOAT_VEC_T powi(FLOAT_VEC_T const & x) {
+            return powi_unrolled<FLOAT_VEC_T, SCALAR_T, N>::eval(x);
+        }
+
+        // exp(-s * x^2) for x >= 0 and s a power of 2. 'x' is split as m + f with m
+        // a multiple of 1/32, so that m^2 is exact and the rounding of x^2 does not
+        // get amplified.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T expmx2f(FLOAT_VEC_T const & x, float s) {
+            const FLOAT_VEC_T m = (32.0f * x + 0.5f).floor() * 0.03125f;
+            const FLOAT_VEC_T f = x - m;
+            const FLOAT_VEC_T u = s * (m * m);
+            const FLOAT_VEC_T u1 = s * ((m + m) * f + f * f);
+            return expf<FLOAT_VEC_T, UINT_VEC_T>(-u) * expf<FLOAT_VEC_T, UINT_VEC_T>(-u1);
+        }
+        // Double precision counterpart of expmx2f(), m being a multiple of 1/128.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T expmx2d(FLOAT_VEC_T const & x, double s) {
+            const FLOAT_VEC_T m = (128.0 * x + 0.5).floor() * 0.0078125;
+            const FLOAT_VEC_T f = x - m;
+            const FLOAT_VEC_T u = s * (m * m);
+            const FLOAT_VEC_T u1 = s * ((m + m) * f + f * f);
+            return expd<FLOAT_VEC_T, UINT_VEC_T>(-u) * expd<FLOAT_VEC_T, UINT_VEC_T>(-u1);
+        }
+        // erf(x) for |x| <= 1.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T erff_small(FLOAT_VEC_T const & x) {
+            const float T1erff = 7.853861353153693E-5f;
+            const float T2erff = -8.010193625184903E-4f;
+            const float T3erff = 5.188327685732524E-3f;
+            const float T4erff = -2.685381193529856E-2f;
+            const float T5erff = 1.128358514861418E-1f;
+            const float T6erff = -3.761262582423300E-1f;
+            const float T7erff = 1.128379165726710E0f;
+
+            const FLOAT_VEC_T z = x * x;
+            FLOAT_VEC_T y = z * T1erff;
+            y += T2erff;
+            y *= z;
+            y += T3erff;
+            y *= z;
+            y += T4erff;
+            y *= z;
+            y += T5erff;
+            y *= z;
+            y += T6erff;
+            y *= z;
+            y += T7erff;
+            return x * y;
+        }
+        // erfc(x) for x >= 1, given ex = exp(-x^2).
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T erfcf_large(FLOAT_VEC_T const & x, FLOAT_VEC_T const & ex) {
+            // erfc(x) underflows beyond this
+            const float MAXERFCF = 10.1f;
+
+            const float P1erfcf = 2.326819970068386E-2f;
+            const float P2erfcf = -1.387039388740657E-1f;
+            const float P3erfcf = 3.687424674597105E-1f;
+            const float P4erfcf = -5.824733027278666E-1f;
+            const float P5erfcf = 6.210004621745983E-1f;
+            const float P6erfcf = -4.944515323274145E-1f;
+            const float P7erfcf = 3.404879937665872E-1f;
+            const float P8erfcf = -2.741127028184656E-1f;
+            const float P9erfcf = 5.638259427386472E-1f;
+
+            const float R1erfcf = -1.047766399936249E1f;
+            const float R2erfcf = 1.297719955372516E1f;
+            const float R3erfcf = -7.495518717768503E0f;
+            const float R4erfcf = 2.921019019210786E0f;
+            const float R5erfcf = -1.015265279202700E0f;
+            const float R6erfcf = 4.218463358204948E-1f;
+            const float R7erfcf = -2.820767439740514E-1f;
+            const float R8erfcf = 5.641895067754075E-1f;
+
+            // erfc(x) = exp(-x^2) / x * P(1/x^2), with P for x < 2 and R above.
+            const FLOAT_VEC_T q = FLOAT_VEC_T(1.0f) / x;
+            const FLOAT_VEC_T q2 = q * q;
+
+            FLOAT_VEC_T p = q2 * P1erfcf;
+            p += P2erfcf;
+            p *= q2;
+            p += P3erfcf;
+            p *= q2;
+            p += P4erfcf;
+            p *= q2;
+            p += P5erfcf;
+            p *= q2;
+            p += P6erfcf;
+            p *= q2;
+            p += P7erfcf;
+            p *= q2;
+            p += P8erfcf;
+            p *= q2;
+            p += P9erfcf;
+
+            FLOAT_VEC_T r = q2 * R1erfcf;
+            r += R2erfcf;
+            r *= q2;
+            r += R3erfcf;
+            r *= q2;
+            r += R4erfcf;
+            r *= q2;
+            r += R5erfcf;
+            r *= q2;
+            r += R6erfcf;
+            r *= q2;
+            r += R7erfcf;
+            r *= q2;
+            r += R8erfcf;
+
+            p[x >= 2.0f] = r;
+
+            FLOAT_VEC_T y = ex * q * p;
+            y[x > MAXERFCF] = 0.0f;
+            return y;
+        }
+        // erf(x) for |x| <= 1.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T erfd_small(FLOAT_VEC_T const & x) {
+            const double T1erf = 9.60497373987051638749E0;
+            const double T2erf = 9.00260197203842689217E1;
+            const double T3erf = 2.23200534594684319226E3;
+            const double T4erf = 7.00332514112805075473E3;
+            const double T5erf = 5.55923013010394962768E4;
+            const double U1erf = 3.35617141647503099647E1;
+            const double U2erf = 5.21357949780152679795E2;
+            const double U3erf = 4.59432382970980127987E3;
+            const double U4erf = 2.26290000613890934246E4;
+            const double U5erf = 4.92673942608635921086E4;
+
+            const FLOAT_VEC_T z = x * x;
+
+            FLOAT_VEC_T px(T1erf);
+            px *= z;
+            px += T2erf;
+            px *= z;
+            px += T3erf;
+            px *= z;
+            px += T4erf;
+            px *= z;
+            px += T5erf;
+
+            FLOAT_VEC_T qx = z + U1erf;
+            qx *= z;
+            qx += U2erf;
+            qx *= z;
+            qx += U3erf;
+            qx *= z;
+            qx += U4erf;
+            qx *= z;
+            qx += U5erf;
+
+            return x * px / qx;
+        }
+        // erfc(x) for x >= 1, given ex = exp(-x^2).
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T erfcd_large(FLOAT_VEC_T const & x, FLOAT_VEC_T const & ex) {
+            // erfc(x) underflows beyond this
+            const double MAXERFC = 27.3;
+
+            const double P1erfc = 2.46196981473530512524E-10;
+            const double P2erfc = 5.64189564831068821977E-1;
+            const double P3erfc = 7.46321056442269912687E0;
+            const double P4erfc = 4.86371970985681366614E1;
+            const double P5erfc = 1.96520832956077098242E2;
+            const double P6erfc = 5.26445194995477358631E2;
+            const double P7erfc = 9.34528527171957607540E2;
+            const double P8erfc = 1.02755188689515710272E3;
+            const double P9erfc = 5.57535335369399327526E2;
+            const double Q1erfc = 1.32281951154744992508E1;
+            const double Q2erfc = 8.67072140885989742329E1;
+            const double Q3erfc = 3.54937778887819891062E2;
+            const double Q4erfc = 9.75708501743205489753E2;
+            const double Q5erfc = 1.82390916687909736289E3;
+            const double Q6erfc = 2.24633760818710981792E3;
+            const double Q7erfc = 1.65666309194161350182E3;
+            const double Q8erfc = 5.57535340817727675546E2;
+
+            const double R1erfc = 5.64189583547755073984E-1;
+            const double R2erfc = 1.27536670759978104416E0;
+            const double R3erfc = 5.01905042251180477414E0;
+            const double R4erfc = 6.16021097993053585195E0;
+            const double R5erfc = 7.40974269950448939160E0;
+            const double R6erfc = 2.97886665372100240670E0;
+            const double S1erfc = 2.26052863220117276590E0;
+            const double S2erfc = 9.39603524938001434673E0;
+            const double S3erfc = 1.20489539808096656605E1;
+            const double S4erfc = 1.70814450747565897222E1;
+            const double S5erfc = 9.60896809063285878198E0;
+            const double S6erfc = 3.36907645100081516050E0;
+
+            // erfc(x) = exp(-x^2) * P(x)/Q(x) for x < 8, and R(x)/S(x) above.
+            FLOAT_VEC_T px(P1erfc);
+            px *= x;
+            px += P2erfc;
+            px *= x;
+            px += P3erfc;
+            px *= x;
+            px += P4erfc;
+            px *= x;
+            px += P5erfc;
+            px *= x;
+            px += P6erfc;
+            px *= x;
+            px += P7erfc;
+            px *= x;
+            px += P8erfc;
+            px *= x;
+            px += P9erfc;
+
+            FLOAT_VEC_T qx = x + Q1erfc;
+            qx *= x;
+            qx += Q2erfc;
+            qx *= x;
+            qx += Q3erfc;
+            qx *= x;
+            qx += Q4erfc;
+            qx *= x;
+            qx += Q5erfc;
+            qx *= x;
+            qx += Q6erfc;
+            qx *= x;
+            qx += Q7erfc;
+            qx *= x;
+            qx += Q8erfc;
+
+            FLOAT_VEC_T rx(R1erfc);
+            rx *= x;
+            rx += R2erfc;
+            rx *= x;
+            rx += R3erfc;
+            rx *= x;
+            rx += R4erfc;
+            rx *= x;
+            rx += R5erfc;
+            rx *= x;
+            rx += R6erfc;
+
+            FLOAT_VEC_T sx = x + S1erfc;
+            sx *= x;
+            sx += S2erfc;
+            sx *= x;
+            sx += S3erfc;
+            sx *= x;
+            sx += S4erfc;
+            sx *= x;
+            sx += S5erfc;
+            sx *= x;
+            sx += S6erfc;
+
+            FLOAT_VEC_T p = px / qx;
+            p[x >= 8.0] = rx / sx;
+
+            FLOAT_VEC_T y = ex * p;
+            y[x > MAXERFC] = 0.0;
+            return y;
+        }
+
+        // ERF: max. error 3 ULP in both precisions, measured against long double.
+        // ERF - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T erff(FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T y = erff_small(xx);
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+            MASK_T mask_big = x_pos > 1.0f;
+            if (mask_big.hlor()) {
+                FLOAT_VEC_T t = 1.0f - erfcf_large(x_pos, expmx2f<FLOAT_VEC_T, UINT_VEC_T>(x_pos, 1.0f));
+                t.nega(xx < 0.0f);
+                y.assign(mask_big, t);
+            }
+            return y;
+        }
+        // ERF - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T erfd(FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T y = erfd_small(xx);
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+            MASK_T mask_big = x_pos > 1.0;
+            if (mask_big.hlor()) {
+                FLOAT_VEC_T t = 1.0 - erfcd_large(x_pos, expmx2d<FLOAT_VEC_T, UINT_VEC_T>(x_pos, 1.0));
+                t.nega(xx < 0.0);
+                y.assign(mask_big, t);
+            }
+            return y;
+        }
+        // MERF - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T erff(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = erff<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MERF - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T erfd(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = erfd<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // ERFC: max. error 11 ULP in both precisions, measured against long double.
+        // The error peaks just below |x| = 1, where erfc is evaluated as 1 - erf.
+        // ERFC - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T erfcf(FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T y = 1.0f - erff_small(xx);
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+            MASK_T mask_big = x_pos > 1.0f;
+            if (mask_big.hlor()) {
+                FLOAT_VEC_T t = erfcf_large(x_pos, expmx2f<FLOAT_VEC_T, UINT_VEC_T>(x_pos, 1.0f));
+                t[xx < 0.0f] = 2.0f - t;
+                y.assign(mask_big, t);
+            }
+            return y;
+        }
+        // ERFC - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T erfcd(FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T y = 1.0 - erfd_small(xx);
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+            MASK_T mask_big = x_pos > 1.0;
+            if (mask_big.hlor()) {
+                FLOAT_VEC_T t = erfcd_large(x_pos, expmx2d<FLOAT_VEC_T, UINT_VEC_T>(x_pos, 1.0));
+                t[xx < 0.0] = 2.0 - t;
+                y.assign(mask_big, t);
+            }
+            return y;
+        }
+        // MERFC - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T erfcf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = erfcf<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MERFC - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T erfcd(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = erfcd<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // NORMCDF: max. error 11 ULP in both precisions, measured against long double.
+        // NORMCDF - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T normcdff(FLOAT_VEC_T const & xx) {
+            const float SQRTHF = 0.707106781186547524f;
+
+            // Phi(x) = erfc(z)/2 with z = -x/sqrt(2). In the lower tail exp(-z^2) is
+            // evaluated as exp(-x^2/2) so that the rounding of 'z' does not get amplified.
+            const FLOAT_VEC_T z = xx * (-SQRTHF);
+            FLOAT_VEC_T y = 1.0f - erff_small(z);
+
+            const FLOAT_VEC_T z_pos = z.abs();
+            MASK_T mask_big = z_pos > 1.0f;
+            if (mask_big.hlor()) {
+                FLOAT_VEC_T t = erfcf_large(z_pos, expmx2f<FLOAT_VEC_T, UINT_VEC_T>(xx.abs(), 0.5f));
+                t[z < 0.0f] = 2.0f - t;
+                y.assign(mask_big, t);
+            }
+            return 0.5f * y;
+        }
+        // NORMCDF - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T normcdfd(FLOAT_VEC_T const & xx) {
+            const double SQRTH = 0.70710678118654752440;
+
+            const FLOAT_VEC_T z = xx * (-SQRTH);
+            FLOAT_VEC_T y = 1.0 - erfd_small(z);
+
+            const FLOAT_VEC_T z_pos = z.abs();
+            MASK_T mask_big = z_pos > 1.0;
+            if (mask_big.hlor()) {
+                FLOAT_VEC_T t = erfcd_large(z_pos, expmx2d<FLOAT_VEC_T, UINT_VEC_T>(xx.abs(), 0.5));
+                t[z < 0.0] = 2.0 - t;
+                y.assign(mask_big, t);
+            }
+            return 0.5 * y;
+        }
+        // MNORMCDF - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T normcdff(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = normcdff<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MNORMCDF - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T normcdfd(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = normcdfd<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // Rational approximations of the inverse normal CDF by P. J. Acklam,
+        // relative error below 1.15e-9. Central region: |p - 0.5| <= 0.5 - 0.02425.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T norminvd_central(FLOAT_VEC_T const & q) {
+            const double A1 = -3.969683028665376e+01;
+            const double A2 = 2.209460984245205e+02;
+            const double A3 = -2.759285104469687e+02;
+            const double A4 = 1.383577518672690e+02;
+            const double A5 = -3.066479806614716e+01;
+            const double A6 = 2.506628277459239e+00;
+            const double B1 = -5.447609879822406e+01;
+            const double B2 = 1.615858368580409e+02;
+            const double B3 = -1.556989798598866e+02;
+            const double B4 = 6.680131188771972e+01;
+            const double B5 = -1.328068155288572e+01;
+
+            const FLOAT_VEC_T r = q * q;
+
+            FLOAT_VEC_T num = r * A1;
+            num += A2;
+            num *= r;
+            num += A3;
+            num *= r;
+            num += A4;
+            num *= r;
+            num += A5;
+            num *= r;
+            num += A6;
+            num *= q;
+
+            FLOAT_VEC_T den = r * B1;
+            den += B2;
+            den *= r;
+            den += B3;
+            den *= r;
+            den += B4;
+            den *= r;
+            den += B5;
+            den *= r;
+            den += 1.0;
+
+            return num / den;
+        }
+        // Lower tail counterpart of norminvd_central(), taking t = sqrt(-2 * log(p))
+        // for p < 0.02425. Well conditioned enough to be used in single precision too.
+        template<typename FLOAT_VEC_T, typename SCALAR_T>
+        UME_FORCE_INLINE FLOAT_VEC_T norminv_tail(FLOAT_VEC_T const & t) {
+            const SCALAR_T C1 = SCALAR_T(-7.784894002430293e-03);
+            const SCALAR_T C2 = SCALAR_T(-3.223964580411365e-01);
+            const SCALAR_T C3 = SCALAR_T(-2.400758277161838e+00);
+            const SCALAR_T C4 = SCALAR_T(-2.549732539343734e+00);
+            const SCALAR_T C5 = SCALAR_T(4.374664141464968e+00);
+            const SCALAR_T C6 = SCALAR_T(2.938163982698783e+00);
+            const SCALAR_T D1 = SCALAR_T(7.784695709041462e-03);
+            const SCALAR_T D2 = SCALAR_T(3.224671290700398e-01);
+            const SCALAR_T D3 = SCALAR_T(2.445134137142996e+00);
+            const SCALAR_T D4 = SCALAR_T(3.754408661907416e+00);
+
+            FLOAT_VEC_T c = t * C1;
+            c += C2;
+            c *= t;
+            c += C3;
+            c *= t;
+            c += C4;
+            c *= t;
+            c += C5;
+            c *= t;
+            c += C6;
+
+            FLOAT_VEC_T d = t * D1;
+            d += D2;
+            d *= t;
+            d += D3;
+            d *= t;
+            d += D4;
+            d *= t;
+            d += SCALAR_T(1.0);
+
+            return c / d;
+        }
+        // NORMINV: max. error 6 ULP in both precisions, measured against long double.
+        // NORMINV - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T norminvf(FLOAT_VEC_T const & p) {
+            const float SQRT2F = 1.41421356237309504880f;
+
+            // Phi^-1(p) = sqrt(2) * erfinv(x) with x = 2p - 1, using the central single
+            // precision erfinv approximation by M. Giles: erfinv(x) = x * P(w), with
+            // w = -log(1 - x^2) < 5.
+            // 1 - x^2 = 4p(1 - p) is formed from 'p' directly to keep the tails accurate.
+            const FLOAT_VEC_T x = 2.0f * p - 1.0f;
+            const FLOAT_VEC_T w = -logf<FLOAT_VEC_T, UINT_VEC_T>(4.0f * p * (1.0f - p));
+
+            const FLOAT_VEC_T w0 = w - 2.5f;
+            FLOAT_VEC_T y = w0 * 2.81022636e-08f;
+            y += 3.43273939e-07f;
+            y *= w0;
+            y += -3.5233877e-06f;
+            y *= w0;
+            y += -4.39150654e-06f;
+            y *= w0;
+            y += 0.00021858087f;
+            y *= w0;
+            y += -0.00125372503f;
+            y *= w0;
+            y += -0.00417768164f;
+            y *= w0;
+            y += 0.246640727f;
+            y *= w0;
+            y += 1.50140941f;
+
+            y *= SQRT2F * x;
+
+            // For w >= 5 (p < 0.0017) the tail approximation of P. J. Acklam is used
+            // instead: Giles' tail polynomial does not cover p below 2^-24.
+            MASK_T mask_tail = w >= 5.0f;
+            if (mask_tail.hlor()) {
+                const FLOAT_VEC_T p_low = p.min(1.0f - p);
+                const FLOAT_VEC_T t = (-2.0f * logf<FLOAT_VEC_T, UINT_VEC_T>(p_low)).sqrt();
+                FLOAT_VEC_T y_tail = norminv_tail<FLOAT_VEC_T, float>(t);
+                y_tail.nega(p > 0.5f);
+                y.assign(mask_tail, y_tail);
+            }
+
+            y[p == 0.0f] = -std::numeric_limits<float>::infinity();
+            y[p == 1.0f] = std::numeric_limits<float>::infinity();
+            y[p < 0.0f] = std::numeric_limits<float>::quiet_NaN();
+            y[p > 1.0f] = std::numeric_limits<float>::quiet_NaN();
+            y[p.isnan()] = p;
+            return y;
+        }
+        // NORMINV - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T norminvd(FLOAT_VEC_T const & p) {
+            const double P_LOW = 0.02425;
+            const double SQRTH = 0.70710678118654752440;
+            const double SQRT2PI = 2.50662827463100050242;
+
+            const FLOAT_VEC_T q = p - 0.5;
+            FLOAT_VEC_T y = norminvd_central(q);
+
+            // Tails, using the symmetry Phi^-1(1 - p) = -Phi^-1(p)
+            const FLOAT_VEC_T p_low = p.min(1.0 - p);
+            MASK_T mask_tail = p_low < P_LOW;
+            if (mask_tail.hlor()) {
+                const FLOAT_VEC_T t = (-2.0 * logd<FLOAT_VEC_T, UINT_VEC_T>(p_low)).sqrt();
+                FLOAT_VEC_T y_tail = norminv_tail<FLOAT_VEC_T, double>(t);
+                y_tail.nega(p > 0.5);
+                y.assign(mask_tail, y_tail);
+            }
+
+            // One step of Halley's method brings the result to full double precision.
+            // Phi(-|y|) - min(p, 1 - p), negated in the upper half, equals Phi(y) - p but
+            // does not cancel in the upper tail. Close to the median the residual is
+            // formed as erf(y/sqrt(2))/2 - (p - 0.5), accurate relative to a small 'y'.
+            const FLOAT_VEC_T z = y * (-SQRTH);
+            FLOAT_VEC_T e = 0.5 * erfcd<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(z.abs()) - p_low;
+            e.nega(p > 0.5);
+            e[z.abs() <= 1.0] = -0.5 * erfd_small(z) - q;
+            // Beyond |y| = 37.5 exp() would overflow, and 'p' is subnormal anyway.
+            const FLOAT_VEC_T u = e * SQRT2PI * expd<FLOAT_VEC_T, UINT_VEC_T>(0.5 * y * y);
+            y.assign(y.abs() < 37.5, y - u / (1.0 + 0.5 * y * u));
+
+            y[p == 0.0] = -std::numeric_limits<double>::infinity();
+            y[p == 1.0] = std::numeric_limits<double>::infinity();
+            y[p < 0.0] = std::numeric_limits<double>::quiet_NaN();
+            y[p > 1.0] = std::numeric_limits<double>::quiet_NaN();
+            y[p.isnan()] = p;
+            return y;
+        }
+        // MNORMINV - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T norminvf(MASK_T const & mask, FLOAT_VEC_T const & p) {
+            FLOAT_VEC_T t0 = p;
+            FLOAT_VEC_T t1 = norminvf<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(p);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MNORMINV - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T norminvd(MASK_T const & mask, FLOAT_VEC_T const & p) {
+            FLOAT_VEC_T t0 = p;
+            FLOAT_VEC_T t1 = norminvd<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(p);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // a + b as the unevaluated sum hi + lo, exactly.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE void sum_ext(FLOAT_VEC_T const & a, FLOAT_VEC_T const & b, FLOAT_VEC_T & hi, FLOAT_VEC_T & lo) {
+            hi = a + b;
+            const FLOAT_VEC_T bb = hi - a;
+            lo = (a - (hi - bb)) + (b - bb);
+        }
+        // (hi + lo) + b as the unevaluated sum hi + lo, renormalized so that 'lo'
+        // stays below one ulp of 'hi'.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE void add_ext(FLOAT_VEC_T & hi, FLOAT_VEC_T & lo, FLOAT_VEC_T const & b) {
+            FLOAT_VEC_T s, e;
+            sum_ext(hi, b, s, e);
+            e += lo;
+            hi = s + e;
+            lo = e - (hi - s);
+        }
+
+        // Payne-Hanek reduction of x_pos >= 8192 to [-pi/4, pi/4], with the same
+        // output convention as trigf_reduce(). Infinite and NaN arguments give NaN.
+        //
+        // With x_pos = m * 2^(d + 12k), m a 24 bit integer and d in [-10, 1], only
+        // the bits of 2/pi from position 12k onwards contribute to x_pos * 2/pi
+        // modulo 4. They are fetched from a table in 12 bit chunks, so that with
+        // 'm' split into two 12 bit halves all partial products are exact. The
+        // integer part is removed as the products are summed, and the fraction
+        // is kept in extended precision: arguments close to a multiple of pi/2
+        // cancel up to 30 of its leading bits.
+        template<typename FLOAT_VEC_T, typename INT_VEC_T>
+        inline FLOAT_VEC_T trigf_reduce_large(FLOAT_VEC_T const & x_pos, INT_VEC_T & j) {
+            // 2/pi in 12 bit chunks, each scaled to [0, 1). The leading zero is
+            // its integer part.
+            static const float TWOOPIF_CHUNKS[17] = {
+                0.0f,             0.636474609375f,  0.594482421875f,  0.4306640625f,
+                0.8916015625f,    0.08251953125f,   0.6240234375f,    0.153564453125f,
+                0.488525390625f,  0.957763671875f,  0.303955078125f,  0.753173828125f,
+                0.71142578125f,   0.584228515625f,  0.5771484375f,    0.263916015625f,
+                0.015869140625f };
+            const float PIO2F_HI = 1.57079637050628662109375f;
+            const float PIO2F_LO = -4.37113900018624283e-8f;
+            const float TWOM12F = 2.44140625e-4f;
+            const float TWOM24F = 5.9604644775390625e-8f;
+
+            alignas(FLOAT_VEC_T::alignment()) float raw[FLOAT_VEC_T::length()];
+            alignas(FLOAT_VEC_T::alignment()) int32_t raw_k[FLOAT_VEC_T::length()];
+
+            x_pos.storea(raw);
+            INT_VEC_T n;
+            n.loada((int32_t*)&raw[0]);
+
+            // k = floor((e - 140) / 12) for the biased exponent 'e' in [140, 255]
+            const FLOAT_VEC_T e = FLOAT_VEC_T(n & 0x7F800000) * 1.1920928955078125e-7f;
+            INT_VEC_T k = INT_VEC_T((e - 139.5f) * (1.0f / 12.0f));
+            k.storea(raw_k);
+
+            // 2^(-12k), built in the exponent field as in pow2if()
+            INT_VEC_T scale_bits = INT_VEC_T((127.0f - 12.0f * FLOAT_VEC_T(k)) * 8388608.0f);
+            scale_bits.storea((int32_t*)&raw[0]);
+            const FLOAT_VEC_T scale(raw);
+
+            INT_VEC_T n_hi = n & int32_t(0xFFFFF000);
+            n_hi.storea((int32_t*)&raw[0]);
+            const FLOAT_VEC_T xh = FLOAT_VEC_T(raw) * scale;
+            const FLOAT_VEC_T xl = x_pos * scale - xh;
+
+            FLOAT_VEC_T c0, c1, c2, c3, c4, c5, c6, c7;
+            c0.gather(&TWOOPIF_CHUNKS[0], (uint32_t const *)raw_k);
+            c1.gather(&TWOOPIF_CHUNKS[1], (uint32_t const *)raw_k);
+            c2.gather(&TWOOPIF_CHUNKS[2], (uint32_t const *)raw_k);
+            c3.gather(&TWOOPIF_CHUNKS[3], (uint32_t const *)raw_k);
+            c4.gather(&TWOOPIF_CHUNKS[4], (uint32_t const *)raw_k);
+            c5.gather(&TWOOPIF_CHUNKS[5], (uint32_t const *)raw_k);
+            c6.gather(&TWOOPIF_CHUNKS[6], (uint32_t const *)raw_k);
+            c7.gather(&TWOOPIF_CHUNKS[7], (uint32_t const *)raw_k);
+
+            // The four leading products are multiples of 2^-22 or more. Reduced
+            // modulo 4 and split into integer and fractional parts, they sum up
+            // exactly.
+            FLOAT_VEC_T p0 = xh * c1;
+            FLOAT_VEC_T p1 = (xl * 4096.0f) * c0;
+            FLOAT_VEC_T p2 = (xh * TWOM12F) * c2;
+            FLOAT_VEC_T p3 = xl * c1;
+            p0 -= 4.0f * (0.25f * p0).round();
+            p1 -= 4.0f * (0.25f * p1).round();
+            p2 -= 4.0f * (0.25f * p2).round();
+            p3 -= 4.0f * (0.25f * p3).round();
+            const FLOAT_VEC_T n0 = p0.round();
+            const FLOAT_VEC_T n1 = p1.round();
+            const FLOAT_VEC_T n2 = p2.round();
+            const FLOAT_VEC_T n3 = p3.round();
+            FLOAT_VEC_T q = (n0 + n1) + (n2 + n3);
+            FLOAT_VEC_T hi = ((p0 - n0) + (p1 - n1)) + ((p2 - n2) + (p3 - n3));
+
+            // The next ones need extended precision additions, the smallest ones
+            // can be summed in working precision.
+            FLOAT_VEC_T s2, e2, s3, e3, s4, e4, lo;
+            sum_ext((xh * TWOM24F) * c3, (xl * TWOM12F) * c2, s2, e2);
+            sum_ext((xh * (TWOM12F * TWOM24F)) * c4, (xl * TWOM24F) * c3, s3, e3);
+            sum_ext((xh * (TWOM24F * TWOM24F)) * c5, (xl * (TWOM12F * TWOM24F)) * c4, s4, e4);
+            const FLOAT_VEC_T tail = (e3 + e4)
+                + ((xh * (TWOM12F * TWOM24F * TWOM24F)) * c6 + (xl * (TWOM24F * TWOM24F)) * c5)
+                + ((xh * (TWOM24F * TWOM24F * TWOM24F)) * c7 + (xl * (TWOM12F * TWOM24F * TWOM24F)) * c6);
+
+            FLOAT_VEC_T hi2;
+            sum_ext(hi, s2, hi2, lo);
+            lo += e2;
+            const FLOAT_VEC_T n4 = hi2.round();
+            q += n4;
+            hi = hi2 - n4;
+            add_ext(hi, lo, s3);
+            add_ext(hi, lo, s4);
+            lo += tail;
+
+            // x_pos = (q + hi + lo) * pi/2, and j = 2 * (q mod 4)
+            j = INT_VEC_T(2.0f * (q - 4.0f * (0.25f * q).floor()));
+            return hi * PIO2F_HI + (hi * PIO2F_LO + lo * PIO2F_HI);
+        }
+
+        // Reduction of a non-negative argument to [-pi/4, pi/4], shared by the
+        // single precision trigonometric kernels. On return 'j' holds the octant
+        // index rounded up to an even value. Cody-Waite reduction is used up to
+        // LOSSTH, above which it is no longer accurate; lanes beyond it take the
+        // slower trigf_reduce_large(), which is skipped when there are none.
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T trigf_reduce(FLOAT_VEC_T const & x_pos, INT_VEC_T & j) {
+            const float ONEOPIO4F = 4.0f / (3.1415927f);
+            const float LOSSTH = 8192.0f;
+
+            // pi/4 split into four parts; the first three have at most 11
+            // significant bits, so their products with 'y' (at most 13 bits
+            // below LOSSTH) are exact even without FMA.
+            const float DP1F = 0.78515625f;
+            const float DP2F = 2.4187564849853515625e-4f;
+            const float DP3F = 3.77476681023836135864e-8f;
+            const float DP4F = 1.28167203412854480149e-12f;
+
+            j = INT_VEC_T(ONEOPIO4F * x_pos); /* integer part of x/PIO4 */
+
+            j = (j + 1) & (~1);
+            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
+
+            // Extended precision modular arithmetic
+            FLOAT_VEC_T x = (((x_pos - y * DP1F) - y * DP2F) - y * DP3F) - y * DP4F;
+
+            // NaN lanes compare false and stay on the Cody-Waite path.
+            MASK_T mask_big = x_pos >= LOSSTH;
+            if (mask_big.hlor()) {
+                FLOAT_VEC_T x_big(LOSSTH);
+                x_big.assign(mask_big, x_pos);
+                INT_VEC_T j_big;
+                x.assign(mask_big, trigf_reduce_large<FLOAT_VEC_T, INT_VEC_T>(x_big, j_big));
+                j.assign(mask_big, j_big);
+            }
+            return x;
+        }
+
+        // Double precision counterpart of trigf_reduce().
+        template<typename FLOAT_VEC_T, typename INT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T trigd_reduce(FLOAT_VEC_T const & x_pos, INT_VEC_T & j) {
+            const double ONEOPIO4 = 4.0 / (3.14159265358979323846);
+
+            const double DP1D = 7.853981554508209228515625E-1;
+            const double DP2D = 7.94662735614792836714E-9;
+            const double DP3D = 3.06161699786838294307E-17;
+
+            j = INT_VEC_T(ONEOPIO4 * x_pos); // always positive, so (int) == std::floor
+            j = (j + 1) & (~1);
+            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
+            // Extended precision modular arithmetic
+            return ((x_pos - y * DP1D) - y * DP2D) - y * DP3D;
+        }
+
+        // Reduction of 'xx' to [-pi/2, pi/2], used by the fast tier of the single
+        // precision trigonometric kernels: returns xx - j * pi, for integer or
+        // half-integer valued 'j'.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T trigf_reduce_pi(FLOAT_VEC_T const & xx, FLOAT_VEC_T const & j) {
+            // Same four-part split as in trigf_reduce(), scaled to pi. The
+            // products with 'j' are exact for |xx| < 8192.
+            const float DP1F = 3.140625f;
+            const float DP2F = 9.67502593994140625e-4f;
+            const float DP3F = 1.50990672409534454346e-7f;
+            const float DP4F = 5.12668813651417920596e-12f;
+
+            return (((xx - j * DP1F) - j * DP2F) - j * DP3F) - j * DP4F;
+        }
+
+        // sin(x) for x in [-pi/2, pi/2], shared by the fast single precision kernels.
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T sinf_fast_poly(FLOAT_VEC_T const & x) {
+            const float C1sinf = 2.6347563918E-6f;
+            const float C2sinf = -1.9822739489E-4f;
+            const float C3sinf = 8.3332421351E-3f;
+            const float C4sinf = -1.6666665964E-1f;
+
+            const FLOAT_VEC_T z = x * x;
+
+            FLOAT_VEC_T px = z * C1sinf;
+            px += C2sinf;
+            px *= z;
+            px += C3sinf;
+            px *= z;
+            px += C4sinf;
+            return x + x * z * px;
+        }
+
+        // SIN - single precision version, fast tier (max. 2.7 ULP for |x| < 8192)
+        // A single polynomial evaluated after reduction by pi, instead of the
+        // octant selection between sine and cosine polynomials.
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T sinf_fast(FLOAT_VEC_T const & xx) {
+            const float ONEOPIF = 0.318309886183790671538f;
+
+            // sin(xx) = (-1)^j * sin(xx - j * pi)
+            const FLOAT_VEC_T j = (xx * ONEOPIF + 0.5f).floor();
+            FLOAT_VEC_T s = sinf_fast_poly(trigf_reduce_pi(xx, j));
+
+            // 'j' is odd
+            MASK_T mask_sign = (0.5f * j).floor() * 2.0f != j;
+            s.nega(mask_sign);
+            return s;
+        }
 
-            FLOAT_VEC_T res = px / qx ;
+        // COS - single precision version, fast tier (max. 2.7 ULP for |x| < 8192)
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T cosf_fast(FLOAT_VEC_T const & xx) {
+            const float ONEOPIF = 0.318309886183790671538f;
 
-            res -= fe * 2.121944400546905827679e-4;
-            res -= 0.5 * x2  ;
+            // cos(xx) = -(-1)^j * sin(xx - (j + 0.5) * pi)
+            const FLOAT_VEC_T j = (xx * ONEOPIF).floor();
+            FLOAT_VEC_T c = sinf_fast_poly(trigf_reduce_pi(xx, j + 0.5f));
 
-            res = x + res;
-            res += fe * 0.693359375;
+            // 'j' is even
+            MASK_T mask_sign = (0.5f * j).floor() * 2.0f == j;
+            c.nega(mask_sign);
+            return c;
+        }
 
-            res[initial_x > LOG_UPPER_LIMIT] = std::numeric_limits<double>::infinity();
-            res[initial_x < LOG_LOWER_LIMIT] = -std::numeric_limits<double>::quiet_NaN();
+        // Double precision counterpart of trigf_reduce_pi().
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T trigd_reduce_pi(FLOAT_VEC_T const & xx, FLOAT_VEC_T const & j) {
+            const double DP1D = 3.1415926218032836914E0;
+            const double DP2D = 3.17865094245917134686E-8;
+            const double DP3D = 1.22464679914735317723E-16;
 
-            return res;
+            return ((xx - j * DP1D) - j * DP2D) - j * DP3D;
+        }
 
+        // Double precision counterpart of sinf_fast_poly().
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T sind_fast_poly(FLOAT_VEC_T const & x) {
+            const double C1sin = 2.7307591900069502E-15;
+            const double C2sin = -7.6439023368821041E-13;
+            const double C3sin = 1.6058974582409856E-10;
+            const double C4sin = -2.5052107560145002E-8;
+            const double C5sin = 2.7557319218512362E-6;
+            const double C6sin = -1.9841269841250977E-4;
+            const double C7sin = 8.3333333333333041E-3;
+            const double C8sin = -1.6666666666666666E-1;
+
+            const FLOAT_VEC_T z = x * x;
+
+            FLOAT_VEC_T px = z * C1sin;
+            px += C2sin;
+            px *= z;
+            px += C3sin;
+            px *= z;
+            px += C4sin;
+            px *= z;
+            px += C5sin;
+            px *= z;
+            px += C6sin;
+            px *= z;
+            px += C7sin;
+            px *= z;
+            px += C8sin;
+            return x + x * z * px;
         }
-        // MLOG - single precision version
-        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
-        UME_FORCE_INLINE FLOAT_VEC_T logf(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
-            FLOAT_VEC_T t0 = initial_x;
-            FLOAT_VEC_T t1 = logf<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
-            t0.assign(mask, t1);
-            return t0;
+
+        // SIN - double precision version, fast tier (max. 2.1 ULP for |x| < 1.0e5)
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T sind_fast(FLOAT_VEC_T const & xx) {
+            const double ONEOPI = 0.318309886183790671538;
+
+            const FLOAT_VEC_T j = (xx * ONEOPI + 0.5).floor();
+            FLOAT_VEC_T s = sind_fast_poly(trigd_reduce_pi(xx, j));
+
+            // 'j' is odd
+            MASK_T mask_sign = (0.5 * j).floor() * 2.0 != j;
+            s.nega(mask_sign);
+            return s;
         }
-        // MLOG - double precision version
-        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
-        UME_FORCE_INLINE FLOAT_VEC_T logd(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
-            FLOAT_VEC_T t0 = initial_x;
-            FLOAT_VEC_T t1 = logd<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
-            t0.assign(mask, t1);
-            return t0;
+
+        // COS - double precision version, fast tier (max. 2.5 ULP for |x| < 1.0e5)
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T cosd_fast(FLOAT_VEC_T const & xx) {
+            const double ONEOPI = 0.318309886183790671538;
+
+            const FLOAT_VEC_T j = (xx * ONEOPI).floor();
+            FLOAT_VEC_T c = sind_fast_poly(trigd_reduce_pi(xx, j + 0.5));
+
+            // 'j' is even
+            MASK_T mask_sign = (0.5 * j).floor() * 2.0 == j;
+            c.nega(mask_sign);
+            return c;
         }
-    
-        // LOG2
-        // LOG10
 
         // SIN - single precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
         inline FLOAT_VEC_T sinf(FLOAT_VEC_T const & xx)
         {
-            FLOAT_VEC_T s;
-
-            const float ONEOPIO4F = 4.0f / (3.1415927f);
+            if (P == PRECISION_FAST) {
+                return sinf_fast<FLOAT_VEC_T, MASK_T>(xx);
+            }
 
-            const float DP1F = (float)0.78515625;
-            const float DP2F = (float)2.4187564849853515625e-4;
-            const float DP3F = (float)3.77489497744594108e-8;
+            FLOAT_VEC_T s;
 
             INT_VEC_T j;
 
             /* make argument positive */
             FLOAT_VEC_T x_pos = xx.abs();
 
-            j = INT_VEC_T(ONEOPIO4F * x_pos); /* integer part of x/PIO4 */
-
-            j = (j + 1) & (~1);
-            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
-
-            // Extended precision modular arithmetic
-            const FLOAT_VEC_T x = ((x_pos - y * DP1F) - y * DP2F) - y * DP3F;
+            const FLOAT_VEC_T x = trigf_reduce<FLOAT_VEC_T, INT_VEC_T, MASK_T>(x_pos, j);
 
             INT_VEC_T signS = (j & 4);
             j -= 2;
@@ -434,12 +2461,14 @@ namespace SIMD
         }
 
         // SIN - double precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
         inline FLOAT_VEC_T sind(FLOAT_VEC_T const & xx)
         {
-            FLOAT_VEC_T s, c;
-            const double ONEOPIO4 = 4.0 / (3.14159265358979323846);
+            if (P == PRECISION_FAST) {
+                return sind_fast<FLOAT_VEC_T, MASK_T>(xx);
+            }
 
+            FLOAT_VEC_T s, c;
             const double C1sin = 1.58962301576546568060E-10;
             const double C2sin = -2.50507477628578072866E-8;
             const double C3sin = 2.75573136213857245213E-6;
@@ -454,18 +2483,9 @@ namespace SIMD
             const double C5cos = -1.38888888888730564116E-3;
             const double C6cos = 4.16666666666665929218E-2;
 
-            const double DP1D = 7.853981554508209228515625E-1;
-            const double DP2D = 7.94662735614792836714E-9;
-            const double DP3D = 3.06161699786838294307E-17;
-
             INT_VEC_T j;
 
-            FLOAT_VEC_T x = xx.abs();
-            j = INT_VEC_T(ONEOPIO4 * x); // always positive, so (int) == std::floor
-            j = (j + 1) & (~1);
-            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
-            // Extended precision modular arithmetic
-            x = ((x - y * DP1D) - y * DP2D) - y * DP3D;
+            FLOAT_VEC_T x = trigd_reduce<FLOAT_VEC_T, INT_VEC_T>(xx.abs(), j);
 
             const FLOAT_VEC_T signS = (j & 4);
 
@@ -518,47 +2538,39 @@ namespace SIMD
         }
 
         // MSIN - single precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
         UME_FORCE_INLINE FLOAT_VEC_T sinf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
             FLOAT_VEC_T t0 = xx;
-            FLOAT_VEC_T t1 = sinf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            FLOAT_VEC_T t1 = sinf<FLOAT_VEC_T, INT_VEC_T, MASK_T, P>(xx);
             t0.assign(mask, t1);
             return t0;
         }
 
         // MSIN - double precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
         UME_FORCE_INLINE FLOAT_VEC_T sind(MASK_T const & mask, FLOAT_VEC_T const & xx) {
             FLOAT_VEC_T t0 = xx;
-            FLOAT_VEC_T t1 = sind<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            FLOAT_VEC_T t1 = sind<FLOAT_VEC_T, INT_VEC_T, MASK_T, P>(xx);
             t0.assign(mask, t1);
             return t0;
         }
 
         // COS - single precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
         inline FLOAT_VEC_T cosf(FLOAT_VEC_T const & xx)
         {
-            FLOAT_VEC_T c;
-
-            const float ONEOPIO4F = 4.0f / (3.1415927f);
+            if (P == PRECISION_FAST) {
+                return cosf_fast<FLOAT_VEC_T, MASK_T>(xx);
+            }
 
-            const float DP1F = (float)0.78515625;
-            const float DP2F = (float)2.4187564849853515625e-4;
-            const float DP3F = (float)3.77489497744594108e-8;
+            FLOAT_VEC_T c;
 
             INT_VEC_T j;
 
             /* make argument positive */
             FLOAT_VEC_T x_pos = xx.abs();
 
-            j = INT_VEC_T(ONEOPIO4F * x_pos); /* integer part of x/PIO4 */
-
-            j = (j + 1) & (~1);
-            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
-
-            // Extended precision modular arithmetic
-            const FLOAT_VEC_T x = ((x_pos - y * DP1F) - y * DP2F) - y * DP3F;
+            const FLOAT_VEC_T x = trigf_reduce<FLOAT_VEC_T, INT_VEC_T, MASK_T>(x_pos, j);
 
             INT_VEC_T signS = (j & 4);
             j -= 2;
@@ -592,12 +2604,14 @@ namespace SIMD
         }
 
         // COS - double precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
         inline FLOAT_VEC_T cosd(FLOAT_VEC_T const & xx)
         {
-            FLOAT_VEC_T s, c;
+            if (P == PRECISION_FAST) {
+                return cosd_fast<FLOAT_VEC_T, MASK_T>(xx);
+            }
 
-            const double ONEOPIO4 = 4.0 / (3.14159265358979323846);
+            FLOAT_VEC_T s, c;
 
             const double C1sin = 1.58962301576546568060E-10;
             const double C2sin = -2.50507477628578072866E-8;
@@ -613,18 +2627,9 @@ namespace SIMD
             const double C5cos = -1.38888888888730564116E-3;
             const double C6cos = 4.16666666666665929218E-2;
 
-            const double DP1D = 7.853981554508209228515625E-1;
-            const double DP2D = 7.94662735614792836714E-9;
-            const double DP3D = 3.06161699786838294307E-17;
-
             INT_VEC_T j;
 
-            FLOAT_VEC_T x = xx.abs();
-            j = INT_VEC_T(ONEOPIO4 * x); // always positive, so (int) == std::floor
-            j = (j + 1) & (~1);
-            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
-            // Extended precision modular arithmetic
-            x = ((x - y * DP1D) - y * DP2D) - y * DP3D;
+            FLOAT_VEC_T x = trigd_reduce<FLOAT_VEC_T, INT_VEC_T>(xx.abs(), j);
 
             const FLOAT_VEC_T signS = (j & 4);
 
@@ -673,19 +2678,19 @@ namespace SIMD
         }
 
         // MCOS - single precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
         UME_FORCE_INLINE FLOAT_VEC_T cosf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
             FLOAT_VEC_T t0 = xx;
-            FLOAT_VEC_T t1 = cosf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            FLOAT_VEC_T t1 = cosf<FLOAT_VEC_T, INT_VEC_T, MASK_T, P>(xx);
             t0.assign(mask, t1);
             return t0;
         }
 
         // MCOS - double precision version
-        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T, Precision P = PRECISION_ACCURATE>
         UME_FORCE_INLINE FLOAT_VEC_T cosd(MASK_T const & mask, FLOAT_VEC_T const & xx) {
             FLOAT_VEC_T t0 = xx;
-            FLOAT_VEC_T t1 = cosd<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            FLOAT_VEC_T t1 = cosd<FLOAT_VEC_T, INT_VEC_T, MASK_T, P>(xx);
             t0.assign(mask, t1);
             return t0;
         }
@@ -694,24 +2699,12 @@ namespace SIMD
         template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
         inline void sincosf(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T &c)
         {
-            const float ONEOPIO4F = 4.0f / (3.1415927f);
-
-            const float DP1F = (float)0.78515625;
-            const float DP2F = (float)2.4187564849853515625e-4;
-            const float DP3F = (float)3.77489497744594108e-8;
-
             INT_VEC_T j;
 
             /* make argument positive */
             FLOAT_VEC_T x_pos = xx.abs();
 
-            j = INT_VEC_T(ONEOPIO4F * x_pos); /* integer part of x/PIO4 */
-
-            j = (j + 1) & (~1);
-            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
-
-            // Extended precision modular arithmetic
-            const FLOAT_VEC_T x = ((x_pos - y * DP1F) - y * DP2F) - y * DP3F;
+            const FLOAT_VEC_T x = trigf_reduce<FLOAT_VEC_T, INT_VEC_T, MASK_T>(x_pos, j);
 
             INT_VEC_T signS = (j & 4);
             j -= 2;
@@ -755,8 +2748,6 @@ namespace SIMD
         // SINCOS - double precision version
         template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
         inline void sincosd(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
-            const double ONEOPIO4 = 4.0 / (3.14159265358979323846);
-
             const double C1sin = 1.58962301576546568060E-10;
             const double C2sin = -2.50507477628578072866E-8;
             const double C3sin = 2.75573136213857245213E-6;
@@ -771,18 +2762,9 @@ namespace SIMD
             const double C5cos = -1.38888888888730564116E-3;
             const double C6cos = 4.16666666666665929218E-2;
 
-            const double DP1D = 7.853981554508209228515625E-1;
-            const double DP2D = 7.94662735614792836714E-9;
-            const double DP3D = 3.06161699786838294307E-17;
-
             INT_VEC_T j;
 
-            FLOAT_VEC_T x = xx.abs();
-            j = INT_VEC_T(ONEOPIO4 * x); // always positive, so (int) == std::floor
-            j = (j + 1) & (~1);
-            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
-            // Extended precision modular arithmetic
-            x = ((x - y * DP1D) - y * DP2D) - y * DP3D;
+            FLOAT_VEC_T x = trigd_reduce<FLOAT_VEC_T, INT_VEC_T>(xx.abs(), j);
 
             const FLOAT_VEC_T signS = (j & 4);
 
@@ -837,32 +2819,549 @@ namespace SIMD
         }
 
         // MSINCOS - single precision version
-        template<typename FLOAT_VEC_T, typename MASK_TYPE>
-        UME_FORCE_INLINE void sincosf(MASK_TYPE const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE void sincosf(MASK_T const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
             FLOAT_VEC_T masked_s, masked_c;
             s = xx;
             c = xx;
-            sincosf<FLOAT_VEC_T>(xx, masked_s, masked_c);
+            sincosf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx, masked_s, masked_c);
             s.assign(mask, masked_s);
             c.assign(mask, masked_c);
         }
 
         // MSINCOS - double precision version
-        template<typename FLOAT_VEC_T, typename MASK_TYPE>
-        UME_FORCE_INLINE void sincosd(MASK_TYPE const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE void sincosd(MASK_T const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
             FLOAT_VEC_T masked_s, masked_c;
             s = xx;
             c = xx;
-            sincosd<FLOAT_VEC_T>(xx, masked_s, masked_c);
+            sincosd<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx, masked_s, masked_c);
             s.assign(mask, masked_s);
             c.assign(mask, masked_c);
         }
 
-        // TAN
-        // MTAN
-        // CTAN
-        // MCTAN
+        // tan(x) for a reduced argument |x| <= pi/4 - single precision
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tanf_poly(FLOAT_VEC_T const & x) {
+            const FLOAT_VEC_T z = x * x;
+
+            FLOAT_VEC_T px(9.38540185543E-3f);
+            px *= z;
+            px += 3.11992232697E-3f;
+            px *= z;
+            px += 2.44301354525E-2f;
+            px *= z;
+            px += 5.34112807005E-2f;
+            px *= z;
+            px += 1.33387994085E-1f;
+            px *= z;
+            px += 3.33331568548E-1f;
+            return x + px * z * x;
+        }
+
+        // tan(x) for a reduced argument |x| <= pi/4 - double precision
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tand_poly(FLOAT_VEC_T const & x) {
+            const FLOAT_VEC_T z = x * x;
+
+            FLOAT_VEC_T px(-1.30936939181383777646E4);
+            px *= z;
+            px += 1.15351664838587416140E6;
+            px *= z;
+            px += -1.79565251976484877988E7;
+
+            FLOAT_VEC_T qx = z + 1.36812963470692954678E4;
+            qx *= z;
+            qx += -1.32089234440210967447E6;
+            qx *= z;
+            qx += 2.50083801823357915839E7;
+            qx *= z;
+            qx += -5.38695755929454629881E7;
+
+            return x + x * (z * px / qx);
+        }
+
+        // TAN - single precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T tanf(FLOAT_VEC_T const & xx) {
+            INT_VEC_T j;
+            const FLOAT_VEC_T x_pos = xx.abs();
+            const FLOAT_VEC_T x = trigf_reduce<FLOAT_VEC_T, INT_VEC_T, MASK_T>(x_pos, j);
+
+            FLOAT_VEC_T y = tanf_poly(x);
+
+            // tan(x + pi/2) = -1/tan(x)
+            MASK_T mask_cot = ((j & 2) != 0);
+            y.assign(mask_cot, FLOAT_VEC_T(-1.0f) / y);
+
+            MASK_T mask_xx = (xx < 0);
+            y.nega(mask_xx);
+            return y;
+        }
+
+        // TAN - double precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T tand(FLOAT_VEC_T const & xx) {
+            const double LOSSTH = 1.073741824e9;
+
+            INT_VEC_T j;
+            const FLOAT_VEC_T x_pos = xx.abs();
+            const FLOAT_VEC_T x = trigd_reduce<FLOAT_VEC_T, INT_VEC_T>(x_pos, j);
+
+            FLOAT_VEC_T y = tand_poly(x);
+
+            // tan(x + pi/2) = -1/tan(x)
+            MASK_T mask_cot = ((j & 2) != 0);
+            y.assign(mask_cot, FLOAT_VEC_T(-1.0) / y);
+
+            MASK_T mask_xx = (xx < 0);
+            y.nega(mask_xx);
+
+            // Cody-Waite reduction is not accurate above LOSSTH
+            MASK_T mask_big = (x_pos > LOSSTH);
+            if (mask_big.hlor()) {
+                y.assign(mask_big, SCALAR_EMULATION::MATH::tan<FLOAT_VEC_T, MASK_T>(mask_big, xx));
+            }
+            return y;
+        }
+
+        // MTAN - single precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tanf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = tanf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // MTAN - double precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tand(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = tand<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // CTAN - single precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T ctanf(FLOAT_VEC_T const & xx) {
+            INT_VEC_T j;
+            const FLOAT_VEC_T x_pos = xx.abs();
+            const FLOAT_VEC_T x = trigf_reduce<FLOAT_VEC_T, INT_VEC_T, MASK_T>(x_pos, j);
+
+            const FLOAT_VEC_T t = tanf_poly(x);
+            FLOAT_VEC_T y = FLOAT_VEC_T(1.0f) / t;
+
+            // cot(x + pi/2) = -tan(x)
+            MASK_T mask_cot = ((j & 2) != 0);
+            y.assign(mask_cot, -t);
+
+            MASK_T mask_xx = (xx < 0);
+            y.nega(mask_xx);
+            return y;
+        }
+
+        // CTAN - double precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T ctand(FLOAT_VEC_T const & xx) {
+            const double LOSSTH = 1.073741824e9;
+
+            INT_VEC_T j;
+            const FLOAT_VEC_T x_pos = xx.abs();
+            const FLOAT_VEC_T x = trigd_reduce<FLOAT_VEC_T, INT_VEC_T>(x_pos, j);
+
+            const FLOAT_VEC_T t = tand_poly(x);
+            FLOAT_VEC_T y = FLOAT_VEC_T(1.0) / t;
+
+            // cot(x + pi/2) = -tan(x)
+            MASK_T mask_cot = ((j & 2) != 0);
+            y.assign(mask_cot, -t);
+
+            MASK_T mask_xx = (xx < 0);
+            y.nega(mask_xx);
+
+            // Cody-Waite reduction is not accurate above LOSSTH
+            MASK_T mask_big = (x_pos > LOSSTH);
+            if (mask_big.hlor()) {
+                FLOAT_VEC_T t_big = SCALAR_EMULATION::MATH::tan<FLOAT_VEC_T, MASK_T>(mask_big, xx);
+                y.assign(mask_big, FLOAT_VEC_T(1.0) / t_big);
+            }
+            return y;
+        }
+
+        // MCTAN - single precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ctanf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = ctanf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // MCTAN - double precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ctand(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = ctand<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // atan(x) for a reduced argument |x| <= tan(pi/8) - single precision
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atanf_poly(FLOAT_VEC_T const & x) {
+            const FLOAT_VEC_T z = x * x;
+
+            FLOAT_VEC_T px(8.05374449538E-2f);
+            px *= z;
+            px += -1.38776856032E-1f;
+            px *= z;
+            px += 1.99777106478E-1f;
+            px *= z;
+            px += -3.33329491539E-1f;
+            return x + px * z * x;
+        }
+
+        // atan(x) for a reduced argument |x| <= 0.66 - double precision
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atand_poly(FLOAT_VEC_T const & x) {
+            const FLOAT_VEC_T z = x * x;
+
+            FLOAT_VEC_T px(-8.750608600031904122785E-1);
+            px *= z;
+            px += -1.615753718733365076637E1;
+            px *= z;
+            px += -7.500855792314704667340E1;
+            px *= z;
+            px += -1.228866684490136173410E2;
+            px *= z;
+            px += -6.485021904942025371773E1;
+
+            FLOAT_VEC_T qx = z + 2.485846490142306297962E1;
+            qx *= z;
+            qx += 1.650270098316988542046E2;
+            qx *= z;
+            qx += 4.328810604912902668951E2;
+            qx *= z;
+            qx += 4.853903996359136964868E2;
+            qx *= z;
+            qx += 1.945506571482613964425E2;
+
+            return x + x * (z * px / qx);
+        }
+
+        // ATAN - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T atanf(FLOAT_VEC_T const & xx) {
+            const float T3P8F = 2.414213562373095f;
+            const float TP8F = 0.4142135623730950f;
+            const float PIO2F = 1.5707963267948966192f;
+            const float PIO4F = 0.7853981633974483096f;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            // atan(x) = pi/2 + atan(-1/x) = pi/4 + atan((x-1)/(x+1))
+            MASK_T mask_big = (x_pos > T3P8F);
+            MASK_T mask_mid = (x_pos > TP8F) & !mask_big;
+
+            FLOAT_VEC_T num = x_pos;
+            FLOAT_VEC_T den(1.0f);
+            FLOAT_VEC_T y0(0.0f);
+            num.assign(mask_mid, x_pos - 1.0f);
+            den.assign(mask_mid, x_pos + 1.0f);
+            y0.assign(mask_mid, PIO4F);
+            num.assign(mask_big, -1.0f);
+            den.assign(mask_big, x_pos);
+            y0.assign(mask_big, PIO2F);
+
+            FLOAT_VEC_T y = y0 + atanf_poly(num / den);
+
+            MASK_T mask_xx = (xx < 0);
+            y.nega(mask_xx);
+            return y;
+        }
+
+        // ATAN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T atand(FLOAT_VEC_T const & xx) {
+            const double T3P8 = 2.41421356237309504880;
+            const double PIO2 = 1.57079632679489661923;
+            const double PIO4 = 7.85398163397448309616E-1;
+            const double MOREBITS = 6.123233995736765886130E-17;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            // atan(x) = pi/2 + atan(-1/x) = pi/4 + atan((x-1)/(x+1))
+            MASK_T mask_big = (x_pos > T3P8);
+            MASK_T mask_mid = (x_pos > 0.66) & !mask_big;
+
+            FLOAT_VEC_T num = x_pos;
+            FLOAT_VEC_T den(1.0);
+            FLOAT_VEC_T y0(0.0);
+            FLOAT_VEC_T lo(0.0);
+            num.assign(mask_mid, x_pos - 1.0);
+            den.assign(mask_mid, x_pos + 1.0);
+            y0.assign(mask_mid, PIO4);
+            lo.assign(mask_mid, 0.5 * MOREBITS);
+            num.assign(mask_big, -1.0);
+            den.assign(mask_big, x_pos);
+            y0.assign(mask_big, PIO2);
+            lo.assign(mask_big, MOREBITS);
+
+            FLOAT_VEC_T y = y0 + (atand_poly(num / den) + lo);
+
+            MASK_T mask_xx = (xx < 0);
+            y.nega(mask_xx);
+            return y;
+        }
+
+        // MATAN - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atanf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = atanf<FLOAT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // MATAN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atand(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = atand<FLOAT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // Quadrant correction shared by atan2f() and atan2d(). 'z' is atan(y/x).
+        template<typename FLOAT_VEC_T, typename MASK_T, typename SCALAR_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atan2_quadrant(FLOAT_VEC_T const & y, FLOAT_VEC_T const & x, FLOAT_VEC_T const & z) {
+            const SCALAR_T PI = SCALAR_T(3.14159265358979323846);
+            const SCALAR_T PIO2 = SCALAR_T(1.57079632679489661923);
+
+            FLOAT_VEC_T res = z;
+
+            // Left half-plane: shift by +/-pi depending on the sign of y
+            FLOAT_VEC_T shift(PI);
+            shift.nega(y < 0);
+            res.adda(x < 0, shift);
+
+            // On the y axis y/x is +/-inf or NaN, so set the result explicitly
+            MASK_T mask_x0 = (x == 0);
+            FLOAT_VEC_T axis(PIO2);
+            axis.nega(y < 0);
+            axis.assign(y == 0, SCALAR_T(0));
+            res.assign(mask_x0, axis);
+            return res;
+        }
+
+        // ATAN2 - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T atan2f(FLOAT_VEC_T const & y, FLOAT_VEC_T const & x) {
+            FLOAT_VEC_T z = atanf<FLOAT_VEC_T, MASK_T>(y / x);
+            return atan2_quadrant<FLOAT_VEC_T, MASK_T, float>(y, x, z);
+        }
+
+        // ATAN2 - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T atan2d(FLOAT_VEC_T const & y, FLOAT_VEC_T const & x) {
+            FLOAT_VEC_T z = atand<FLOAT_VEC_T, MASK_T>(y / x);
+            return atan2_quadrant<FLOAT_VEC_T, MASK_T, double>(y, x, z);
+        }
+
+        // MATAN2 - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atan2f(MASK_T const & mask, FLOAT_VEC_T const & y, FLOAT_VEC_T const & x) {
+            FLOAT_VEC_T t0 = y;
+            FLOAT_VEC_T t1 = atan2f<FLOAT_VEC_T, MASK_T>(y, x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // MATAN2 - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atan2d(MASK_T const & mask, FLOAT_VEC_T const & y, FLOAT_VEC_T const & x) {
+            FLOAT_VEC_T t0 = y;
+            FLOAT_VEC_T t1 = atan2d<FLOAT_VEC_T, MASK_T>(y, x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // asin(x) for a reduced argument |x| <= 0.5 - single precision
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T asinf_poly(FLOAT_VEC_T const & x) {
+            const FLOAT_VEC_T z = x * x;
+
+            FLOAT_VEC_T px(4.2163199048E-2f);
+            px *= z;
+            px += 2.4181311049E-2f;
+            px *= z;
+            px += 4.5470025998E-2f;
+            px *= z;
+            px += 7.4953002686E-2f;
+            px *= z;
+            px += 1.6666752422E-1f;
+            return x + px * z * x;
+        }
+
+        // asin(x) for a reduced argument |x| <= 0.5 - double precision
+        template<typename FLOAT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T asind_poly(FLOAT_VEC_T const & x) {
+            const FLOAT_VEC_T z = x * x;
+
+            FLOAT_VEC_T px(4.253011369004428248960E-3);
+            px *= z;
+            px += -6.019598008014123785661E-1;
+            px *= z;
+            px += 5.444622390564711410273E0;
+            px *= z;
+            px += -1.626247967210700244449E1;
+            px *= z;
+            px += 1.956261983317594739197E1;
+            px *= z;
+            px += -8.198089802484824371615E0;
+
+            FLOAT_VEC_T qx = z + -1.474091372988853791896E1;
+            qx *= z;
+            qx += 7.049610280856842141659E1;
+            qx *= z;
+            qx += -1.471791292232726029859E2;
+            qx *= z;
+            qx += 1.395105614657485689735E2;
+            qx *= z;
+            qx += -4.918853881490881290097E1;
+
+            return x + x * (z * px / qx);
+        }
+
+        // ASIN - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T asinf(FLOAT_VEC_T const & xx) {
+            const float PIO2F = 1.5707963267948966192f;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            // asin(x) = pi/2 - 2 * asin(sqrt((1 - x)/2)) for x > 0.5.
+            // Arguments above 1 produce NaN through the square root.
+            MASK_T mask_big = (x_pos > 0.5f);
+            FLOAT_VEC_T t = x_pos;
+            t.assign(mask_big, (0.5f * (1.0f - x_pos)).sqrt());
+
+            const FLOAT_VEC_T p = asinf_poly(t);
+            FLOAT_VEC_T y = p;
+            y.assign(mask_big, PIO2F - (p + p));
+
+            MASK_T mask_xx = (xx < 0);
+            y.nega(mask_xx);
+            return y;
+        }
+
+        // ASIN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T asind(FLOAT_VEC_T const & xx) {
+            const double PIO2 = 1.57079632679489661923;
+            const double MOREBITS = 6.123233995736765886130E-17;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            // asin(x) = pi/2 - 2 * asin(sqrt((1 - x)/2)) for x > 0.5.
+            // Arguments above 1 produce NaN through the square root.
+            MASK_T mask_big = (x_pos > 0.5);
+            FLOAT_VEC_T t = x_pos;
+            t.assign(mask_big, (0.5 * (1.0 - x_pos)).sqrt());
+
+            const FLOAT_VEC_T p = asind_poly(t);
+            FLOAT_VEC_T y = p;
+            y.assign(mask_big, (PIO2 - (p + p)) + MOREBITS);
+
+            MASK_T mask_xx = (xx < 0);
+            y.nega(mask_xx);
+            return y;
+        }
+
+        // MASIN - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T asinf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = asinf<FLOAT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // MASIN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T asind(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = asind<FLOAT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // ACOS - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T acosf(FLOAT_VEC_T const & xx) {
+            const float PIF = 3.14159265358979323846f;
+            const float PIO2F = 1.5707963267948966192f;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            // acos(x) = 2 * asin(sqrt((1 - x)/2)) for x > 0.5, and
+            // pi - 2 * asin(sqrt((1 + x)/2)) for x < -0.5.
+            MASK_T mask_big = (x_pos > 0.5f);
+            FLOAT_VEC_T t = xx;
+            t.assign(mask_big, (0.5f * (1.0f - x_pos)).sqrt());
+
+            const FLOAT_VEC_T p = asinf_poly(t);
+            FLOAT_VEC_T y = PIO2F - p;
+            FLOAT_VEC_T y_big = p + p;
+            y_big.assign(xx < 0, PIF - y_big);
+            y.assign(mask_big, y_big);
+            return y;
+        }
+
+        // ACOS - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        inline FLOAT_VEC_T acosd(FLOAT_VEC_T const & xx) {
+            const double PI = 3.14159265358979323846;
+            const double PIO4 = 7.85398163397448309616E-1;
+            const double MOREBITS = 6.123233995736765886130E-17;
+
+            const FLOAT_VEC_T x_pos = xx.abs();
+
+            // acos(x) = 2 * asin(sqrt((1 - x)/2)) for x > 0.5, and
+            // pi - 2 * asin(sqrt((1 + x)/2)) for x < -0.5.
+            MASK_T mask_big = (x_pos > 0.5);
+            FLOAT_VEC_T t = xx;
+            t.assign(mask_big, (0.5 * (1.0 - x_pos)).sqrt());
+
+            const FLOAT_VEC_T p = asind_poly(t);
+            FLOAT_VEC_T y = ((PIO4 - p) + MOREBITS) + PIO4;
+            FLOAT_VEC_T y_big = p + p;
+            y_big.assign(xx < 0, (PI - y_big) + 2.0 * MOREBITS);
+            y.assign(mask_big, y_big);
+            return y;
+        }
+
+        // MACOS - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T acosf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = acosf<FLOAT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // MACOS - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T acosd(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = acosd<FLOAT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
     }
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
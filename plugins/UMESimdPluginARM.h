@@ -40,6 +40,7 @@ namespace UME
 {
 namespace SIMD
 {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 // Specialize SuggestedVecLen
 #if defined(__clang__)
 // clang is good in auto-vectorization. Use SIMD-1 as default
@@ -114,6 +115,7 @@ namespace SIMD
     //template<> class SIMDVec_f<double, 8>;
     //template<> class SIMDVec_f<double, 16>;
     
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -128,6 +130,7 @@ namespace UME
 {
 namespace SIMD
 {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
     // Mask types
     typedef SIMDVecMask<1>      SIMDMask1;
     typedef SIMDVecMask<2>      SIMDMask2;
@@ -254,6 +257,7 @@ namespace SIMD
     // 1024b float vectors
     typedef SIMDVec_f<float,  32>    SIMD32_32f;
     typedef SIMDVec_f<double, 16>    SIMD16_64f;
+UME_SIMD_END_PLUGIN_NAMESPACE
 } // SIMD
 } // UME
 
@@ -62,6 +62,7 @@ namespace UME
 {
 namespace SIMD
 {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 // Specialize SuggestedVecLen
 #if defined(__clang__)
 // clang is good in auto-vectorization. Use SIMD-1 as default
@@ -75,6 +76,17 @@ namespace SIMD
     template<> struct SuggestedVecLen<int64_t> { static const int value = 1; };
     template<> struct SuggestedVecLen<float> { static const int value = 1; };
     template<> struct SuggestedVecLen<double> { static const int value = 1; };
+#elif defined(__AVX512BW__)
+    template<> struct SuggestedVecLen<uint8_t> { static const int value = 64; };
+    template<> struct SuggestedVecLen<int8_t> { static const int value = 64; };
+    template<> struct SuggestedVecLen<uint16_t> { static const int value = 32; };
+    template<> struct SuggestedVecLen<int16_t> { static const int value = 32; };
+    template<> struct SuggestedVecLen<uint32_t> { static const int value = 16; };
+    template<> struct SuggestedVecLen<int32_t> { static const int value = 16; };
+    template<> struct SuggestedVecLen<uint64_t> { static const int value = 8; };
+    template<> struct SuggestedVecLen<int64_t> { static const int value = 8; };
+    template<> struct SuggestedVecLen<float> { static const int value = 16; };
+    template<> struct SuggestedVecLen<double> { static const int value = 8; };
 #else
     template<> struct SuggestedVecLen<uint8_t> { static const int value = 1; };
     template<> struct SuggestedVecLen<int8_t> { static const int value = 1; };
@@ -96,6 +108,20 @@ namespace SIMD
 
     // Forward declarations of template specializations.
     // Only fully specialized classes should be listed here.
+#if defined(__AVX512BW__)
+    // Byte and word vectors
+#if defined(__AVX512VL__)
+    template<> class SIMDVec_u<uint8_t, 32>;
+    template<> class SIMDVec_u<uint16_t, 16>;
+    template<> class SIMDVec_i<int8_t, 32>;
+    template<> class SIMDVec_i<int16_t, 16>;
+#endif
+    template<> class SIMDVec_u<uint8_t, 64>;
+    template<> class SIMDVec_u<uint16_t, 32>;
+    template<> class SIMDVec_i<int8_t, 64>;
+    template<> class SIMDVec_i<int16_t, 32>;
+#endif
+
     template<> class SIMDVec_u<uint32_t, 1>;
     template<> class SIMDVec_u<uint32_t, 2>;
     template<> class SIMDVec_u<uint32_t, 4>;
@@ -134,6 +160,7 @@ namespace SIMD
     template<> class SIMDVec_f<double, 4>;
     template<> class SIMDVec_f<double, 8>;
     template<> class SIMDVec_f<double, 16>;
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -148,6 +175,7 @@ namespace UME
 {
 namespace SIMD
 {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
     // Mask types
     typedef SIMDVecMask<1>      SIMDMask1;
     typedef SIMDVecMask<2>      SIMDMask2;
@@ -274,6 +302,7 @@ namespace SIMD
     // 1024b float vectors
     typedef SIMDVec_f<float,  32>    SIMD32_32f;
     typedef SIMDVec_f<double, 16>    SIMD16_64f;
+UME_SIMD_END_PLUGIN_NAMESPACE
 } // SIMD
 } // UME
 
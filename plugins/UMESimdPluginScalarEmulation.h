@@ -39,6 +39,7 @@ namespace UME
 {
 namespace SIMD
 {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
     // Specialize SuggestedVecLen
     template<> struct SuggestedVecLen<uint8_t> { static const int value = 1; };
     template<> struct SuggestedVecLen<int8_t> { static const int value = 1; };
@@ -99,6 +100,7 @@ namespace SIMD
     //template<> class SIMDVec_f<double, 8>;
     //template<> class SIMDVec_f<double, 16>;
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -113,6 +115,7 @@ namespace UME
 {
 namespace SIMD
 {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
     // Mask types
     typedef SIMDVecMask<1>      SIMDMask1;
     typedef SIMDVecMask<2>      SIMDMask2;
@@ -239,6 +242,7 @@ namespace SIMD
     // 1024b float vectors
     typedef SIMDVec_f<float,  32>    SIMD32_32f;
     typedef SIMDVec_f<double, 16>    SIMD16_64f;
+UME_SIMD_END_PLUGIN_NAMESPACE
 } // SIMD
 } // UME
 
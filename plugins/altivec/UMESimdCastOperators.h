@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
     // Operators for non-specialized types require 'template<>' syntax.
     // Compliant compiler will not accept this syntax for non-specialized
     // types, so make sure only proper definitions have it.
@@ -902,6 +903,7 @@ namespace SIMD {
     UME_FORCE_INLINE SIMDVec_f<double, 16>::operator SIMDVec_f<float, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_f<float, 16>, float, SIMDVec_f<double, 16>>(*this);
     }
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<float, 2> :
@@ -1277,6 +1278,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_i<int32_t, 2>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
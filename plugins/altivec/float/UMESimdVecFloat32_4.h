@@ -42,6 +42,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<float, 4> :
@@ -1726,6 +1727,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_i<int32_t, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
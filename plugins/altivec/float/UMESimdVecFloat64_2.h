@@ -42,6 +42,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<double, 2> :
@@ -1113,6 +1114,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_i<int64_t, 2>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
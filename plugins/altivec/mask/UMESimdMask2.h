@@ -36,6 +36,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<2> :
@@ -227,6 +228,7 @@ namespace SIMD {
         }
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
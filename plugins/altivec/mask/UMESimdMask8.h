@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<8> :
@@ -128,6 +129,7 @@ namespace SIMD {
         }
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -40,6 +40,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint32_t, 4>  :
@@ -2059,6 +2060,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
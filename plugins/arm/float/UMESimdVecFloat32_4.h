@@ -44,6 +44,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<float, 4> :
@@ -192,8 +193,10 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, float const *p) {
-            float32x4_t t0 = vld1q_f32(p);
-            mVec = vbslq_f32(mask.mMask, t0, mVec);
+            if (vgetq_lane_u32(mask.mMask, 0) != 0) mVec = vld1q_lane_f32(p, mVec, 0);
+            if (vgetq_lane_u32(mask.mMask, 1) != 0) mVec = vld1q_lane_f32(p + 1, mVec, 1);
+            if (vgetq_lane_u32(mask.mMask, 2) != 0) mVec = vld1q_lane_f32(p + 2, mVec, 2);
+            if (vgetq_lane_u32(mask.mMask, 3) != 0) mVec = vld1q_lane_f32(p + 3, mVec, 3);
             return *this;
         }
         // LOADA
@@ -214,9 +217,10 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE float* store(SIMDVecMask<4> const & mask, float* p) const {
-            float32x4_t t0 = vld1q_f32(p);
-            float32x4_t t1 = vbslq_f32(mask.mMask, mVec, t0);
-            vst1q_f32(p, t1);
+            if (vgetq_lane_u32(mask.mMask, 0) != 0) vst1q_lane_f32(p, mVec, 0);
+            if (vgetq_lane_u32(mask.mMask, 1) != 0) vst1q_lane_f32(p + 1, mVec, 1);
+            if (vgetq_lane_u32(mask.mMask, 2) != 0) vst1q_lane_f32(p + 2, mVec, 2);
+            if (vgetq_lane_u32(mask.mMask, 3) != 0) vst1q_lane_f32(p + 3, mVec, 3);
             return p;
         }
         // STOREA
@@ -226,9 +230,10 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE float* storea(SIMDVecMask<4> const & mask, float* p) const {
-            float32x4_t tmp = vld1q_f32(p);
-            float32x4_t tmp2 = vbslq_f32(mask.mMask, mVec, tmp);
-            vst1q_f32(p, tmp2);
+            if (vgetq_lane_u32(mask.mMask, 0) != 0) vst1q_lane_f32(p, mVec, 0);
+            if (vgetq_lane_u32(mask.mMask, 1) != 0) vst1q_lane_f32(p + 1, mVec, 1);
+            if (vgetq_lane_u32(mask.mMask, 2) != 0) vst1q_lane_f32(p + 2, mVec, 2);
+            if (vgetq_lane_u32(mask.mMask, 3) != 0) vst1q_lane_f32(p + 3, mVec, 3);
             return p;
         }
 
@@ -246,6 +251,138 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint32_t, 4> const & indices) const {
+            // Expand each element index into the byte indices of that element.
+            uint32x4_t t0 = vandq_u32(indices.mVec, vdupq_n_u32(0x3));
+            uint8x16_t t1 = vreinterpretq_u8_u32(vmlaq_n_u32(vdupq_n_u32(0x03020100), t0, 0x04040404));
+            uint8x8x2_t t2;
+            t2.val[0] = vget_low_u8(vreinterpretq_u8_f32(mVec));
+            t2.val[1] = vget_high_u8(vreinterpretq_u8_f32(mVec));
+            uint8x16_t t3 = vcombine_u8(vtbl2_u8(t2, vget_low_u8(t1)), vtbl2_u8(t2, vget_high_u8(t1)));
+            float32x4_t t4 = vreinterpretq_f32_u8(t3);
+            return SIMDVec_f(t4);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint32_t, 4> const & indices) const {
+            uint32x4_t t0 = vandq_u32(indices.mVec, vdupq_n_u32(0x7));
+            uint8x16_t t1 = vreinterpretq_u8_u32(vmlaq_n_u32(vdupq_n_u32(0x03020100), t0, 0x04040404));
+            uint8x8x4_t t2;
+            t2.val[0] = vget_low_u8(vreinterpretq_u8_f32(mVec));
+            t2.val[1] = vget_high_u8(vreinterpretq_u8_f32(mVec));
+            t2.val[2] = vget_low_u8(vreinterpretq_u8_f32(b.mVec));
+            t2.val[3] = vget_high_u8(vreinterpretq_u8_f32(b.mVec));
+            uint8x16_t t3 = vcombine_u8(vtbl4_u8(t2, vget_low_u8(t1)), vtbl4_u8(t2, vget_high_u8(t1)));
+            float32x4_t t4 = vreinterpretq_f32_u8(t3);
+            return SIMDVec_f(t4);
+        }
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static float32x4_t sortNetwork(float32x4_t const & a, bool descending, bool bitonic) {
+            alignas(16) static const uint32_t MAX_MASK[3][4] = {
+                { 0, 0xFFFFFFFF, 0xFFFFFFFF, 0 },
+                { 0, 0, 0xFFFFFFFF, 0xFFFFFFFF },
+                { 0, 0xFFFFFFFF, 0, 0xFFFFFFFF } };
+            float32x4_t t0 = vrev64q_f32(a);
+            uint32x4_t t1 = vld1q_u32(MAX_MASK[0]);
+            float32x4_t t2 = vminq_f32(a, t0);
+            float32x4_t t3 = vmaxq_f32(a, t0);
+            float32x4_t t4 = descending ? vbslq_f32(t1, t2, t3) : vbslq_f32(t1, t3, t2);
+            float32x4_t t5 = bitonic ? a : t4;
+            float32x4_t t6 = vextq_f32(t5, t5, 2);
+            uint32x4_t t7 = vld1q_u32(MAX_MASK[1]);
+            float32x4_t t8 = vminq_f32(t5, t6);
+            float32x4_t t9 = vmaxq_f32(t5, t6);
+            float32x4_t t10 = descending ? vbslq_f32(t7, t8, t9) : vbslq_f32(t7, t9, t8);
+            float32x4_t t11 = vrev64q_f32(t10);
+            uint32x4_t t12 = vld1q_u32(MAX_MASK[2]);
+            float32x4_t t13 = vminq_f32(t10, t11);
+            float32x4_t t14 = vmaxq_f32(t10, t11);
+            float32x4_t t15 = descending ? vbslq_f32(t12, t13, t14) : vbslq_f32(t12, t14, t13);
+            return t15;
+        }
+        UME_FORCE_INLINE static float32x4_t sortNetwork(float32x4_t const & a, uint32x4_t & payload, bool descending, bool bitonic) {
+            alignas(16) static const uint32_t MAX_MASK[3][4] = {
+                { 0, 0xFFFFFFFF, 0xFFFFFFFF, 0 },
+                { 0, 0, 0xFFFFFFFF, 0xFFFFFFFF },
+                { 0, 0xFFFFFFFF, 0, 0xFFFFFFFF } };
+            float32x4_t t0 = vrev64q_f32(a);
+            uint32x4_t t1 = vrev64q_u32(payload);
+            uint32x4_t t2 = vld1q_u32(MAX_MASK[0]);
+            uint32x4_t t3 = vcgtq_f32(a, t0);
+            uint32x4_t t4 = vcgtq_f32(t0, a);
+            uint32x4_t t5 = descending ? vbslq_u32(t2, t3, t4) : vbslq_u32(t2, t4, t3);
+            float32x4_t t6 = vbslq_f32(t5, t0, a);
+            uint32x4_t t7 = vbslq_u32(t5, t1, payload);
+            float32x4_t t8 = bitonic ? a : t6;
+            uint32x4_t t9 = bitonic ? payload : t7;
+            float32x4_t t10 = vextq_f32(t8, t8, 2);
+            uint32x4_t t11 = vextq_u32(t9, t9, 2);
+            uint32x4_t t12 = vld1q_u32(MAX_MASK[1]);
+            uint32x4_t t13 = vcgtq_f32(t8, t10);
+            uint32x4_t t14 = vcgtq_f32(t10, t8);
+            uint32x4_t t15 = descending ? vbslq_u32(t12, t13, t14) : vbslq_u32(t12, t14, t13);
+            float32x4_t t16 = vbslq_f32(t15, t10, t8);
+            uint32x4_t t17 = vbslq_u32(t15, t11, t9);
+            float32x4_t t18 = vrev64q_f32(t16);
+            uint32x4_t t19 = vrev64q_u32(t17);
+            uint32x4_t t20 = vld1q_u32(MAX_MASK[2]);
+            uint32x4_t t21 = vcgtq_f32(t16, t18);
+            uint32x4_t t22 = vcgtq_f32(t18, t16);
+            uint32x4_t t23 = descending ? vbslq_u32(t20, t21, t22) : vbslq_u32(t20, t22, t21);
+            float32x4_t t24 = vbslq_f32(t23, t18, t16);
+            uint32x4_t t25 = vbslq_u32(t23, t19, t17);
+            payload = t25;
+            return t24;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            float32x4_t t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            float32x4_t t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 4> & payload) const {
+            float32x4_t t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 4> & payload) const {
+            float32x4_t t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_f bsorta() const {
+            float32x4_t t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_f bsortd() const {
+            float32x4_t t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsorta(SIMDVec_u<uint32_t, 4> & payload) const {
+            float32x4_t t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsortd(SIMDVec_u<uint32_t, 4> & payload) const {
+            float32x4_t t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             float32x4_t t0 = vaddq_f32(mVec, b.mVec);
@@ -1555,6 +1692,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_i<int32_t, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
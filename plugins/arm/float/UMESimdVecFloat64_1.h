@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<double, 1> :
@@ -1072,6 +1073,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_i<int64_t, 1>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
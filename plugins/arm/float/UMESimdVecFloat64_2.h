@@ -39,6 +39,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<double, 2> :
@@ -175,8 +176,8 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<2> const & mask, double const * p) {
-            float64x2_t tmp = vld1q_f64(p);
-            mVec = vbslq_f64(mask.mMask, tmp, mVec);
+            if (vgetq_lane_u64(mask.mMask, 0) != 0) mVec = vld1q_lane_f64(p, mVec, 0);
+            if (vgetq_lane_u64(mask.mMask, 1) != 0) mVec = vld1q_lane_f64(p + 1, mVec, 1);
             return *this;
         }
         // LOADA
@@ -197,9 +198,8 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE double* store(SIMDVecMask<2> const & mask, double * p) const {
-            float64x2_t tmp = vld1q_f64(p);
-            float64x2_t tmp2 = vbslq_f64(mask.mMask, mVec, tmp);
-            vst1q_f64(p, tmp2);
+            if (vgetq_lane_u64(mask.mMask, 0) != 0) vst1q_lane_f64(p, mVec, 0);
+            if (vgetq_lane_u64(mask.mMask, 1) != 0) vst1q_lane_f64(p + 1, mVec, 1);
             return p;
         }
         // STOREA
@@ -209,9 +209,8 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE double* storea(SIMDVecMask<2> const & mask, double * p) const {
-            float64x2_t tmp = vld1q_f64(p);
-            float64x2_t tmp2 = vbslq_f64(mask.mMask, mVec, tmp);
-            vst1q_f64(p, tmp2);
+            if (vgetq_lane_u64(mask.mMask, 0) != 0) vst1q_lane_f64(p, mVec, 0);
+            if (vgetq_lane_u64(mask.mMask, 1) != 0) vst1q_lane_f64(p + 1, mVec, 1);
             return p;
         }
 
@@ -1270,6 +1269,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_i<int64_t, 2>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 1> :
@@ -1451,6 +1452,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 1>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
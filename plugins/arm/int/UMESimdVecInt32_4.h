@@ -44,6 +44,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 4> :
@@ -182,8 +183,10 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<4> const & mask, int32_t const *p) {
-            int32x4_t t0 = vld1q_s32(p);
-            mVec = BLEND(mVec, t0, mask.mMask);
+            if (vgetq_lane_u32(mask.mMask, 0) != 0) mVec = vld1q_lane_s32(p, mVec, 0);
+            if (vgetq_lane_u32(mask.mMask, 1) != 0) mVec = vld1q_lane_s32(p + 1, mVec, 1);
+            if (vgetq_lane_u32(mask.mMask, 2) != 0) mVec = vld1q_lane_s32(p + 2, mVec, 2);
+            if (vgetq_lane_u32(mask.mMask, 3) != 0) mVec = vld1q_lane_s32(p + 3, mVec, 3);
             return *this;
         }
         // LOADA
@@ -204,9 +207,10 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t* store(SIMDVecMask<4> const & mask, int32_t* p) const {
-            int32x4_t t0 = vld1q_s32(p);
-            t0 = BLEND(t0, mVec, mask.mMask);
-            vst1q_s32(p, t0);
+            if (vgetq_lane_u32(mask.mMask, 0) != 0) vst1q_lane_s32(p, mVec, 0);
+            if (vgetq_lane_u32(mask.mMask, 1) != 0) vst1q_lane_s32(p + 1, mVec, 1);
+            if (vgetq_lane_u32(mask.mMask, 2) != 0) vst1q_lane_s32(p + 2, mVec, 2);
+            if (vgetq_lane_u32(mask.mMask, 3) != 0) vst1q_lane_s32(p + 3, mVec, 3);
             return p;
         }
         // STOREA
@@ -216,11 +220,37 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE int32_t* storea(SIMDVecMask<4> const & mask, int32_t* p) const {
-            int32x4_t t0 = vld1q_s32(p);
-            t0 = BLEND(t0, mVec, mask.mMask);
-            vst1q_s32(p, t0);
+            if (vgetq_lane_u32(mask.mMask, 0) != 0) vst1q_lane_s32(p, mVec, 0);
+            if (vgetq_lane_u32(mask.mMask, 1) != 0) vst1q_lane_s32(p + 1, mVec, 1);
+            if (vgetq_lane_u32(mask.mMask, 2) != 0) vst1q_lane_s32(p + 2, mVec, 2);
+            if (vgetq_lane_u32(mask.mMask, 3) != 0) vst1q_lane_s32(p + 3, mVec, 3);
             return p;
         }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint32_t, 4> const & indices) const {
+            // Expand each element index into the byte indices of that element.
+            uint32x4_t t0 = vandq_u32(indices.mVec, vdupq_n_u32(0x3));
+            uint8x16_t t1 = vreinterpretq_u8_u32(vmlaq_n_u32(vdupq_n_u32(0x03020100), t0, 0x04040404));
+            uint8x8x2_t t2;
+            t2.val[0] = vget_low_u8(vreinterpretq_u8_s32(mVec));
+            t2.val[1] = vget_high_u8(vreinterpretq_u8_s32(mVec));
+            uint8x16_t t3 = vcombine_u8(vtbl2_u8(t2, vget_low_u8(t1)), vtbl2_u8(t2, vget_high_u8(t1)));
+            int32x4_t t4 = vreinterpretq_s32_u8(t3);
+            return SIMDVec_i(t4);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint32_t, 4> const & indices) const {
+            uint32x4_t t0 = vandq_u32(indices.mVec, vdupq_n_u32(0x7));
+            uint8x16_t t1 = vreinterpretq_u8_u32(vmlaq_n_u32(vdupq_n_u32(0x03020100), t0, 0x04040404));
+            uint8x8x4_t t2;
+            t2.val[0] = vget_low_u8(vreinterpretq_u8_s32(mVec));
+            t2.val[1] = vget_high_u8(vreinterpretq_u8_s32(mVec));
+            t2.val[2] = vget_low_u8(vreinterpretq_u8_s32(b.mVec));
+            t2.val[3] = vget_high_u8(vreinterpretq_u8_s32(b.mVec));
+            uint8x16_t t3 = vcombine_u8(vtbl4_u8(t2, vget_low_u8(t1)), vtbl4_u8(t2, vget_high_u8(t1)));
+            int32x4_t t4 = vreinterpretq_s32_u8(t3);
+            return SIMDVec_i(t4);
+        }
 /*
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
@@ -241,6 +271,113 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 */
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static int32x4_t sortNetwork(int32x4_t const & a, bool descending, bool bitonic) {
+            alignas(16) static const uint32_t MAX_MASK[3][4] = {
+                { 0, 0xFFFFFFFF, 0xFFFFFFFF, 0 },
+                { 0, 0, 0xFFFFFFFF, 0xFFFFFFFF },
+                { 0, 0xFFFFFFFF, 0, 0xFFFFFFFF } };
+            int32x4_t t0 = vrev64q_s32(a);
+            uint32x4_t t1 = vld1q_u32(MAX_MASK[0]);
+            int32x4_t t2 = vminq_s32(a, t0);
+            int32x4_t t3 = vmaxq_s32(a, t0);
+            int32x4_t t4 = descending ? vbslq_s32(t1, t2, t3) : vbslq_s32(t1, t3, t2);
+            int32x4_t t5 = bitonic ? a : t4;
+            int32x4_t t6 = vextq_s32(t5, t5, 2);
+            uint32x4_t t7 = vld1q_u32(MAX_MASK[1]);
+            int32x4_t t8 = vminq_s32(t5, t6);
+            int32x4_t t9 = vmaxq_s32(t5, t6);
+            int32x4_t t10 = descending ? vbslq_s32(t7, t8, t9) : vbslq_s32(t7, t9, t8);
+            int32x4_t t11 = vrev64q_s32(t10);
+            uint32x4_t t12 = vld1q_u32(MAX_MASK[2]);
+            int32x4_t t13 = vminq_s32(t10, t11);
+            int32x4_t t14 = vmaxq_s32(t10, t11);
+            int32x4_t t15 = descending ? vbslq_s32(t12, t13, t14) : vbslq_s32(t12, t14, t13);
+            return t15;
+        }
+        UME_FORCE_INLINE static int32x4_t sortNetwork(int32x4_t const & a, uint32x4_t & payload, bool descending, bool bitonic) {
+            alignas(16) static const uint32_t MAX_MASK[3][4] = {
+                { 0, 0xFFFFFFFF, 0xFFFFFFFF, 0 },
+                { 0, 0, 0xFFFFFFFF, 0xFFFFFFFF },
+                { 0, 0xFFFFFFFF, 0, 0xFFFFFFFF } };
+            int32x4_t t0 = vrev64q_s32(a);
+            uint32x4_t t1 = vrev64q_u32(payload);
+            uint32x4_t t2 = vld1q_u32(MAX_MASK[0]);
+            uint32x4_t t3 = vcgtq_s32(a, t0);
+            uint32x4_t t4 = vcgtq_s32(t0, a);
+            uint32x4_t t5 = descending ? vbslq_u32(t2, t3, t4) : vbslq_u32(t2, t4, t3);
+            int32x4_t t6 = vbslq_s32(t5, t0, a);
+            uint32x4_t t7 = vbslq_u32(t5, t1, payload);
+            int32x4_t t8 = bitonic ? a : t6;
+            uint32x4_t t9 = bitonic ? payload : t7;
+            int32x4_t t10 = vextq_s32(t8, t8, 2);
+            uint32x4_t t11 = vextq_u32(t9, t9, 2);
+            uint32x4_t t12 = vld1q_u32(MAX_MASK[1]);
+            uint32x4_t t13 = vcgtq_s32(t8, t10);
+            uint32x4_t t14 = vcgtq_s32(t10, t8);
+            uint32x4_t t15 = descending ? vbslq_u32(t12, t13, t14) : vbslq_u32(t12, t14, t13);
+            int32x4_t t16 = vbslq_s32(t15, t10, t8);
+            uint32x4_t t17 = vbslq_u32(t15, t11, t9);
+            int32x4_t t18 = vrev64q_s32(t16);
+            uint32x4_t t19 = vrev64q_u32(t17);
+            uint32x4_t t20 = vld1q_u32(MAX_MASK[2]);
+            uint32x4_t t21 = vcgtq_s32(t16, t18);
+            uint32x4_t t22 = vcgtq_s32(t18, t16);
+            uint32x4_t t23 = descending ? vbslq_u32(t20, t21, t22) : vbslq_u32(t20, t22, t21);
+            int32x4_t t24 = vbslq_s32(t23, t18, t16);
+            uint32x4_t t25 = vbslq_u32(t23, t19, t17);
+            payload = t25;
+            return t24;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            int32x4_t t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            int32x4_t t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 4> & payload) const {
+            int32x4_t t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 4> & payload) const {
+            int32x4_t t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_i bsorta() const {
+            int32x4_t t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_i bsortd() const {
+            int32x4_t t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsorta(SIMDVec_u<uint32_t, 4> & payload) const {
+            int32x4_t t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsortd(SIMDVec_u<uint32_t, 4> & payload) const {
+            int32x4_t t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             int32x4_t t0 = vaddq_s32(mVec, b.mVec);
@@ -838,7 +975,27 @@ namespace SIMD {
             int32_t t2 = mask.mMask[2] ? mVec[2] * b : mVec[2];
             int32_t t3 = mask.mMask[3] ? mVec[3] * b : mVec[3];
             return SIMDVec_i(t0, t1, t2, t3);
-        }/*
+        }
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int32_t> const & divider) const {
+            int32x2_t t0 = vdup_n_s32(divider.magic());
+            int32x2_t t1 = vshrn_n_s64(vmull_s32(vget_low_s32(mVec), t0), 32);
+            int32x2_t t2 = vshrn_n_s64(vmull_s32(vget_high_s32(mVec), t0), 32);
+            int32x4_t t3 = vaddq_s32(mVec, vcombine_s32(t1, t2));
+            int32x4_t t4 = vdupq_n_s32(-int32_t(divider.shift2()));
+            int32x4_t t5 = vsubq_s32(vshlq_s32(t3, t4), vshrq_n_s32(mVec, 31));
+            int32x4_t t6 = vdupq_n_s32(divider.sign());
+            int32x4_t t7 = vsubq_s32(veorq_s32(t5, t6), t6);
+            return SIMDVec_i(t7);
+        }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            int32x2_t t0 = vshrn_n_s64(vmull_s32(vget_low_s32(mVec), vget_low_s32(b.mVec)), 32);
+            int32x2_t t1 = vshrn_n_s64(vmull_s32(vget_high_s32(mVec), vget_high_s32(b.mVec)), 32);
+            int32x4_t t2 = vcombine_s32(t0, t1);
+            return SIMDVec_i(t2);
+        }
+/*
         // MULVA
         UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
             mVec[0] *= b.mVec[0];
@@ -1043,7 +1200,26 @@ namespace SIMD {
         }
         UME_FORCE_INLINE SIMDVecMask<4> operator< (int32_t b) const {
             return cmplt(b);
-        }/*
+        }
+        // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            uint32x4_t t0 = vceqq_s32(mVec, vextq_s32(mVec, mVec, 3));
+            uint32x4_t t1 = vceqq_s32(mVec, vextq_s32(mVec, mVec, 2));
+            uint32x4_t t2 = vorrq_u32(t0, t1);
+            uint32x2_t t3 = vorr_u32(vget_low_u32(t2), vget_high_u32(t2));
+            return vget_lane_u32(vpmax_u32(t3, t3), 0) == 0;
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_i conflict() const {
+            // Compare with the vector rotated by 1, 2 and 3 elements and keep
+            // the bits of the elements that did not wrap around.
+            alignas(16) static const uint32_t BITS[3][4] = { { 0, 1, 2, 4 }, { 0, 0, 1, 2 }, { 0, 0, 0, 1 } };
+            uint32x4_t t0 = vandq_u32(vceqq_s32(mVec, vextq_s32(mVec, mVec, 3)), vld1q_u32(BITS[0]));
+            uint32x4_t t1 = vandq_u32(vceqq_s32(mVec, vextq_s32(mVec, mVec, 2)), vld1q_u32(BITS[1]));
+            uint32x4_t t2 = vandq_u32(vceqq_s32(mVec, vextq_s32(mVec, mVec, 1)), vld1q_u32(BITS[2]));
+            return SIMDVec_i(vreinterpretq_s32_u32(vorrq_u32(t0, vorrq_u32(t1, t2))));
+        }
+/*
         // CMPGEV
         UME_FORCE_INLINE SIMDVecMask<4> cmpge(SIMDVec_i const & b) const {
             bool m0 = mVec[0] >= b.mVec[0];
@@ -1104,16 +1280,6 @@ namespace SIMD {
             bool m3 = mVec[3] == b;
             return m0 && m1 && m2 && m3;
         }
-        // UNIQUE
-        UME_FORCE_INLINE bool unique() const {
-            bool m0 = mVec[0] != mVec[1];
-            bool m1 = mVec[0] != mVec[2];
-            bool m2 = mVec[0] != mVec[3];
-            bool m3 = mVec[1] != mVec[2];
-            bool m4 = mVec[1] != mVec[3];
-            bool m5 = mVec[2] != mVec[3];
-            return m0 && m1 && m2 && m3 && m4 && m5;
-        }
         // HADD
         UME_FORCE_INLINE int32_t hadd() const {
             return mVec[0] + mVec[1] + mVec[2] + mVec[3];
@@ -1176,7 +1342,33 @@ namespace SIMD {
             int32_t t2 = mask.mMask[2] ? (mVec[2] * b.mVec[2] + c.mVec[2]) : mVec[2];
             int32_t t3 = mask.mMask[3] ? (mVec[3] * b.mVec[3] + c.mVec[3]) : mVec[3];
             return SIMDVec_i(t0, t1, t2, t3);
-        }/*
+        }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_i popcnt() const {
+            uint8x16_t t0 = vcntq_u8(vreinterpretq_u8_s32(mVec));
+            int32x4_t t1 = vreinterpretq_s32_u32(vpaddlq_u16(vpaddlq_u8(t0)));
+            return SIMDVec_i(t1);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_i lzcnt() const {
+            int32x4_t t0 = vclzq_s32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_i tzcnt() const {
+            // Trailing zeros are the set bits of '~x & (x - 1)'.
+            uint32x4_t t0 = vreinterpretq_u32_s32(mVec);
+            uint32x4_t t1 = vbicq_u32(vsubq_u32(t0, vdupq_n_u32(1)), t0);
+            int32x4_t t2 = vreinterpretq_s32_u32(vsubq_u32(vdupq_n_u32(32), vclzq_u32(t1)));
+            return SIMDVec_i(t2);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_i bitrev() const {
+            uint8x16_t t0 = vrev32q_u8(vrbitq_u8(vreinterpretq_u8_s32(mVec)));
+            int32x4_t t1 = vreinterpretq_s32_u8(t0);
+            return SIMDVec_i(t1);
+        }
+/*
         // FMULSUBV
         UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVec_i const & b, SIMDVec_i const & c) const {
             int32_t t0 = mVec[0] * b.mVec[0] - c.mVec[0];
@@ -2154,6 +2346,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int64_t, 2> :
@@ -377,6 +378,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<double, 2>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<1> :
@@ -100,6 +101,7 @@ namespace SIMD {
         }
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<2> :
@@ -89,6 +90,20 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVecMask(SIMDVecMask const & mask) {
             mMask = mask.mMask;
         }
+        // FIRSTN
+        static UME_FORCE_INLINE SIMDVecMask firstN(uint32_t count) {
+            uint64_t const t0[2] = { 0, 1 };
+            return SIMDVecMask(vcltq_u64(vld1q_u64(t0), vdupq_n_u64(count)));
+        }
+        // TOBITMASK
+        UME_FORCE_INLINE uint64_t toBitmask() const {
+            return (vgetq_lane_u64(mMask, 0) & 1) | (vgetq_lane_u64(mMask, 1) & 2);
+        }
+        // FROMBITMASK
+        static UME_FORCE_INLINE SIMDVecMask fromBitmask(uint64_t bits) {
+            uint64_t const t0[2] = { 1, 2 };
+            return SIMDVecMask(vtstq_u64(vdupq_n_u64(bits), vld1q_u64(t0)));
+        }
 
         UME_FORCE_INLINE bool extract(uint32_t index) const {
             if ((index & 1) == 0) {
@@ -123,6 +138,7 @@ namespace SIMD {
         }
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<4> :
@@ -85,6 +86,27 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVecMask(SIMDVecMask const & mask) {
             mMask = mask.mMask;
         }
+        // FIRSTN
+        static UME_FORCE_INLINE SIMDVecMask firstN(uint32_t count) {
+            uint32_t const t0[4] = { 0, 1, 2, 3 };
+            SIMDVecMask retval;
+            retval.mMask = vcltq_u32(vld1q_u32(t0), vdupq_n_u32(count));
+            return retval;
+        }
+        // TOBITMASK
+        UME_FORCE_INLINE uint64_t toBitmask() const {
+            uint32_t const t0[4] = { 1, 2, 4, 8 };
+            uint32x4_t t1 = vandq_u32(mMask, vld1q_u32(t0));
+            uint32x2_t t2 = vorr_u32(vget_low_u32(t1), vget_high_u32(t1));
+            return uint64_t(vget_lane_u32(t2, 0) | vget_lane_u32(t2, 1));
+        }
+        // FROMBITMASK
+        static UME_FORCE_INLINE SIMDVecMask fromBitmask(uint64_t bits) {
+            uint32_t const t0[4] = { 1, 2, 4, 8 };
+            SIMDVecMask retval;
+            retval.mMask = vtstq_u32(vdupq_n_u32(uint32_t(bits)), vld1q_u32(t0));
+            return retval;
+        }
 
         UME_FORCE_INLINE bool extract(uint32_t index) const {
             alignas(16) uint32_t raw[4];
@@ -108,6 +130,7 @@ namespace SIMD {
         }
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -36,6 +36,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<uint32_t VEC_LEN>
     struct SIMDVecMask_traits {};
@@ -316,6 +317,7 @@ namespace SIMD {
         }
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -42,6 +42,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint32_t, 4>  :
@@ -174,8 +175,10 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<4> const & mask, uint32_t const *p) {
-            uint32x4_t t0 = vld1q_u32(p);
-            mVec = BLEND(mVec, t0, mask.mMask);
+            if (vgetq_lane_u32(mask.mMask, 0) != 0) mVec = vld1q_lane_u32(p, mVec, 0);
+            if (vgetq_lane_u32(mask.mMask, 1) != 0) mVec = vld1q_lane_u32(p + 1, mVec, 1);
+            if (vgetq_lane_u32(mask.mMask, 2) != 0) mVec = vld1q_lane_u32(p + 2, mVec, 2);
+            if (vgetq_lane_u32(mask.mMask, 3) != 0) mVec = vld1q_lane_u32(p + 3, mVec, 3);
             return *this;
         }
         // LOADA
@@ -196,9 +199,10 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE uint32_t* store(SIMDVecMask<4> const & mask, uint32_t* p) const {
-            uint32x4_t t0 = vld1q_u32(p);
-            t0 = BLEND(t0, mVec, mask.mMask);
-            vst1q_u32(p, t0);
+            if (vgetq_lane_u32(mask.mMask, 0) != 0) vst1q_lane_u32(p, mVec, 0);
+            if (vgetq_lane_u32(mask.mMask, 1) != 0) vst1q_lane_u32(p + 1, mVec, 1);
+            if (vgetq_lane_u32(mask.mMask, 2) != 0) vst1q_lane_u32(p + 2, mVec, 2);
+            if (vgetq_lane_u32(mask.mMask, 3) != 0) vst1q_lane_u32(p + 3, mVec, 3);
             return p;
         }
         // STOREA
@@ -208,11 +212,37 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE uint32_t* storea(SIMDVecMask<4> const & mask, uint32_t* p) const {
-            uint32x4_t t0 = vld1q_u32(p);
-            t0 = BLEND(t0, mVec, mask.mMask);
-            vst1q_u32(p, t0);
+            if (vgetq_lane_u32(mask.mMask, 0) != 0) vst1q_lane_u32(p, mVec, 0);
+            if (vgetq_lane_u32(mask.mMask, 1) != 0) vst1q_lane_u32(p + 1, mVec, 1);
+            if (vgetq_lane_u32(mask.mMask, 2) != 0) vst1q_lane_u32(p + 2, mVec, 2);
+            if (vgetq_lane_u32(mask.mMask, 3) != 0) vst1q_lane_u32(p + 3, mVec, 3);
             return p;
         }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_u permute(SIMDVec_u const & indices) const {
+            // Expand each element index into the byte indices of that element.
+            uint32x4_t t0 = vandq_u32(indices.mVec, vdupq_n_u32(0x3));
+            uint8x16_t t1 = vreinterpretq_u8_u32(vmlaq_n_u32(vdupq_n_u32(0x03020100), t0, 0x04040404));
+            uint8x8x2_t t2;
+            t2.val[0] = vget_low_u8(vreinterpretq_u8_u32(mVec));
+            t2.val[1] = vget_high_u8(vreinterpretq_u8_u32(mVec));
+            uint8x16_t t3 = vcombine_u8(vtbl2_u8(t2, vget_low_u8(t1)), vtbl2_u8(t2, vget_high_u8(t1)));
+            uint32x4_t t4 = vreinterpretq_u32_u8(t3);
+            return SIMDVec_u(t4);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_u permute2(SIMDVec_u const & b, SIMDVec_u const & indices) const {
+            uint32x4_t t0 = vandq_u32(indices.mVec, vdupq_n_u32(0x7));
+            uint8x16_t t1 = vreinterpretq_u8_u32(vmlaq_n_u32(vdupq_n_u32(0x03020100), t0, 0x04040404));
+            uint8x8x4_t t2;
+            t2.val[0] = vget_low_u8(vreinterpretq_u8_u32(mVec));
+            t2.val[1] = vget_high_u8(vreinterpretq_u8_u32(mVec));
+            t2.val[2] = vget_low_u8(vreinterpretq_u8_u32(b.mVec));
+            t2.val[3] = vget_high_u8(vreinterpretq_u8_u32(b.mVec));
+            uint8x16_t t3 = vcombine_u8(vtbl4_u8(t2, vget_low_u8(t1)), vtbl4_u8(t2, vget_high_u8(t1)));
+            uint32x4_t t4 = vreinterpretq_u32_u8(t3);
+            return SIMDVec_u(t4);
+        }
     /*
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
@@ -233,6 +263,113 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 */
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static uint32x4_t sortNetwork(uint32x4_t const & a, bool descending, bool bitonic) {
+            alignas(16) static const uint32_t MAX_MASK[3][4] = {
+                { 0, 0xFFFFFFFF, 0xFFFFFFFF, 0 },
+                { 0, 0, 0xFFFFFFFF, 0xFFFFFFFF },
+                { 0, 0xFFFFFFFF, 0, 0xFFFFFFFF } };
+            uint32x4_t t0 = vrev64q_u32(a);
+            uint32x4_t t1 = vld1q_u32(MAX_MASK[0]);
+            uint32x4_t t2 = vminq_u32(a, t0);
+            uint32x4_t t3 = vmaxq_u32(a, t0);
+            uint32x4_t t4 = descending ? vbslq_u32(t1, t2, t3) : vbslq_u32(t1, t3, t2);
+            uint32x4_t t5 = bitonic ? a : t4;
+            uint32x4_t t6 = vextq_u32(t5, t5, 2);
+            uint32x4_t t7 = vld1q_u32(MAX_MASK[1]);
+            uint32x4_t t8 = vminq_u32(t5, t6);
+            uint32x4_t t9 = vmaxq_u32(t5, t6);
+            uint32x4_t t10 = descending ? vbslq_u32(t7, t8, t9) : vbslq_u32(t7, t9, t8);
+            uint32x4_t t11 = vrev64q_u32(t10);
+            uint32x4_t t12 = vld1q_u32(MAX_MASK[2]);
+            uint32x4_t t13 = vminq_u32(t10, t11);
+            uint32x4_t t14 = vmaxq_u32(t10, t11);
+            uint32x4_t t15 = descending ? vbslq_u32(t12, t13, t14) : vbslq_u32(t12, t14, t13);
+            return t15;
+        }
+        UME_FORCE_INLINE static uint32x4_t sortNetwork(uint32x4_t const & a, uint32x4_t & payload, bool descending, bool bitonic) {
+            alignas(16) static const uint32_t MAX_MASK[3][4] = {
+                { 0, 0xFFFFFFFF, 0xFFFFFFFF, 0 },
+                { 0, 0, 0xFFFFFFFF, 0xFFFFFFFF },
+                { 0, 0xFFFFFFFF, 0, 0xFFFFFFFF } };
+            uint32x4_t t0 = vrev64q_u32(a);
+            uint32x4_t t1 = vrev64q_u32(payload);
+            uint32x4_t t2 = vld1q_u32(MAX_MASK[0]);
+            uint32x4_t t3 = vcgtq_u32(a, t0);
+            uint32x4_t t4 = vcgtq_u32(t0, a);
+            uint32x4_t t5 = descending ? vbslq_u32(t2, t3, t4) : vbslq_u32(t2, t4, t3);
+            uint32x4_t t6 = vbslq_u32(t5, t0, a);
+            uint32x4_t t7 = vbslq_u32(t5, t1, payload);
+            uint32x4_t t8 = bitonic ? a : t6;
+            uint32x4_t t9 = bitonic ? payload : t7;
+            uint32x4_t t10 = vextq_u32(t8, t8, 2);
+            uint32x4_t t11 = vextq_u32(t9, t9, 2);
+            uint32x4_t t12 = vld1q_u32(MAX_MASK[1]);
+            uint32x4_t t13 = vcgtq_u32(t8, t10);
+            uint32x4_t t14 = vcgtq_u32(t10, t8);
+            uint32x4_t t15 = descending ? vbslq_u32(t12, t13, t14) : vbslq_u32(t12, t14, t13);
+            uint32x4_t t16 = vbslq_u32(t15, t10, t8);
+            uint32x4_t t17 = vbslq_u32(t15, t11, t9);
+            uint32x4_t t18 = vrev64q_u32(t16);
+            uint32x4_t t19 = vrev64q_u32(t17);
+            uint32x4_t t20 = vld1q_u32(MAX_MASK[2]);
+            uint32x4_t t21 = vcgtq_u32(t16, t18);
+            uint32x4_t t22 = vcgtq_u32(t18, t16);
+            uint32x4_t t23 = descending ? vbslq_u32(t20, t21, t22) : vbslq_u32(t20, t22, t21);
+            uint32x4_t t24 = vbslq_u32(t23, t18, t16);
+            uint32x4_t t25 = vbslq_u32(t23, t19, t17);
+            payload = t25;
+            return t24;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() const {
+            uint32x4_t t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_u(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() const {
+            uint32x4_t t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_u(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) const {
+            uint32x4_t t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_u(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) const {
+            uint32x4_t t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_u(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_u bsorta() const {
+            uint32x4_t t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_u bsortd() const {
+            uint32x4_t t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_u bsorta(SIMDVec_u & payload) const {
+            uint32x4_t t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_u bsortd(SIMDVec_u & payload) const {
+            uint32x4_t t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_u(t0);
+        }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             uint32x4_t t0 = vaddq_u32(mVec, b.mVec);
@@ -755,6 +892,25 @@ namespace SIMD {
             uint32_t t3 = mask.mMask[3] ? mVec[3] * b : mVec[3];
             return SIMDVec_u(t0, t1, t2, t3);
         }
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_u divide(SIMDDivider<uint32_t> const & divider) const {
+            uint32x2_t t0 = vdup_n_u32(divider.magic());
+            uint32x2_t t1 = vshrn_n_u64(vmull_u32(vget_low_u32(mVec), t0), 32);
+            uint32x2_t t2 = vshrn_n_u64(vmull_u32(vget_high_u32(mVec), t0), 32);
+            uint32x4_t t3 = vcombine_u32(t1, t2);
+            int32x4_t t4 = vdupq_n_s32(-int32_t(divider.shift1()));
+            int32x4_t t5 = vdupq_n_s32(-int32_t(divider.shift2()));
+            uint32x4_t t6 = vaddq_u32(vshlq_u32(vsubq_u32(mVec, t3), t4), t3);
+            uint32x4_t t7 = vshlq_u32(t6, t5);
+            return SIMDVec_u(t7);
+        }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_u mulhi(SIMDVec_u const & b) const {
+            uint32x2_t t0 = vshrn_n_u64(vmull_u32(vget_low_u32(mVec), vget_low_u32(b.mVec)), 32);
+            uint32x2_t t1 = vshrn_n_u64(vmull_u32(vget_high_u32(mVec), vget_high_u32(b.mVec)), 32);
+            uint32x4_t t2 = vcombine_u32(t0, t1);
+            return SIMDVec_u(t2);
+        }
         /*
         // MULVA
         UME_FORCE_INLINE SIMDVec_u & mula(SIMDVec_u const & b) {
@@ -1023,13 +1179,21 @@ namespace SIMD {
         }*/
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            bool m0 = mVec[0] != mVec[1];
-            bool m1 = mVec[0] != mVec[2];
-            bool m2 = mVec[0] != mVec[3];
-            bool m3 = mVec[1] != mVec[2];
-            bool m4 = mVec[1] != mVec[3];
-            bool m5 = mVec[2] != mVec[3];
-            return m0 && m1 && m2 && m3 && m4 && m5;
+            uint32x4_t t0 = vceqq_u32(mVec, vextq_u32(mVec, mVec, 3));
+            uint32x4_t t1 = vceqq_u32(mVec, vextq_u32(mVec, mVec, 2));
+            uint32x4_t t2 = vorrq_u32(t0, t1);
+            uint32x2_t t3 = vorr_u32(vget_low_u32(t2), vget_high_u32(t2));
+            return vget_lane_u32(vpmax_u32(t3, t3), 0) == 0;
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            // Compare with the vector rotated by 1, 2 and 3 elements and keep
+            // the bits of the elements that did not wrap around.
+            alignas(16) static const uint32_t BITS[3][4] = { { 0, 1, 2, 4 }, { 0, 0, 1, 2 }, { 0, 0, 0, 1 } };
+            uint32x4_t t0 = vandq_u32(vceqq_u32(mVec, vextq_u32(mVec, mVec, 3)), vld1q_u32(BITS[0]));
+            uint32x4_t t1 = vandq_u32(vceqq_u32(mVec, vextq_u32(mVec, mVec, 2)), vld1q_u32(BITS[1]));
+            uint32x4_t t2 = vandq_u32(vceqq_u32(mVec, vextq_u32(mVec, mVec, 1)), vld1q_u32(BITS[2]));
+            return SIMDVec_u(vorrq_u32(t0, vorrq_u32(t1, t2)));
         }/*
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
@@ -1093,7 +1257,32 @@ namespace SIMD {
             uint32_t t2 = mask.mMask[2] ? (mVec[2] * b.mVec[2] + c.mVec[2]) : mVec[2];
             uint32_t t3 = mask.mMask[3] ? (mVec[3] * b.mVec[3] + c.mVec[3]) : mVec[3];
             return SIMDVec_u(t0, t1, t2, t3);
-        }/*
+        }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_u popcnt() const {
+            uint8x16_t t0 = vcntq_u8(vreinterpretq_u8_u32(mVec));
+            uint32x4_t t1 = vpaddlq_u16(vpaddlq_u8(t0));
+            return SIMDVec_u(t1);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_u lzcnt() const {
+            uint32x4_t t0 = vclzq_u32(mVec);
+            return SIMDVec_u(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_u tzcnt() const {
+            // Trailing zeros are the set bits of '~x & (x - 1)'.
+            uint32x4_t t0 = vbicq_u32(vsubq_u32(mVec, vdupq_n_u32(1)), mVec);
+            uint32x4_t t1 = vsubq_u32(vdupq_n_u32(32), vclzq_u32(t0));
+            return SIMDVec_u(t1);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_u bitrev() const {
+            uint8x16_t t0 = vrev32q_u8(vrbitq_u8(vreinterpretq_u8_u32(mVec)));
+            uint32x4_t t1 = vreinterpretq_u32_u8(t0);
+            return SIMDVec_u(t1);
+        }
+/*
         // FMULSUBV
         UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVec_u const & b, SIMDVec_u const & c) const {
             uint32_t t0 = mVec[0] * b.mVec[0] - c.mVec[0];
@@ -2014,6 +2203,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -0,0 +1,124 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_COMPRESS_TABLE_AVX_H_
+#define UME_SIMD_COMPRESS_TABLE_AVX_H_
+
+#include <immintrin.h>
+#include "../../UMEBasicTypes.h"
+#include "../../UMEInline.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    // Lookup tables used by COMPRESS, COMPRESSSTORE and EXPANDLOAD. AVX has no
+    // permute across 128-bit lanes, so 256-bit vectors are processed as two
+    // 128-bit halves with _mm_permutevar_ps/_mm_permutevar_pd.
+    class CompressTableAVX {
+    public:
+        // Moves the 32-bit elements selected by 'bits' to the front.
+        static UME_FORCE_INLINE __m128i compress4(int bits) {
+            alignas(16) static const int32_t table[16][4] = {
+                { 0, 0, 0, 0 },
+                { 0, 0, 0, 0 },
+                { 1, 0, 0, 0 },
+                { 0, 1, 0, 0 },
+                { 2, 0, 0, 0 },
+                { 0, 2, 0, 0 },
+                { 1, 2, 0, 0 },
+                { 0, 1, 2, 0 },
+                { 3, 0, 0, 0 },
+                { 0, 3, 0, 0 },
+                { 1, 3, 0, 0 },
+                { 0, 1, 3, 0 },
+                { 2, 3, 0, 0 },
+                { 0, 2, 3, 0 },
+                { 1, 2, 3, 0 },
+                { 0, 1, 2, 3 }
+            };
+            return _mm_load_si128((__m128i const *)table[bits]);
+        }
+        // Moves the leading 32-bit elements to the positions selected by 'bits'.
+        static UME_FORCE_INLINE __m128i expand4(int bits) {
+            alignas(16) static const int32_t table[16][4] = {
+                { 0, 0, 0, 0 },
+                { 0, 0, 0, 0 },
+                { 0, 0, 0, 0 },
+                { 0, 1, 0, 0 },
+                { 0, 0, 0, 0 },
+                { 0, 0, 1, 0 },
+                { 0, 0, 1, 0 },
+                { 0, 1, 2, 0 },
+                { 0, 0, 0, 0 },
+                { 0, 0, 0, 1 },
+                { 0, 0, 0, 1 },
+                { 0, 1, 0, 2 },
+                { 0, 0, 0, 1 },
+                { 0, 0, 1, 2 },
+                { 0, 0, 1, 2 },
+                { 0, 1, 2, 3 }
+            };
+            return _mm_load_si128((__m128i const *)table[bits]);
+        }
+        // Same for 64-bit elements. _mm_permutevar_pd selects with bit 1.
+        static UME_FORCE_INLINE __m128i compress2(int bits) {
+            alignas(16) static const int64_t table[4][2] = {
+                { 0, 0 },
+                { 0, 0 },
+                { 2, 0 },
+                { 0, 2 }
+            };
+            return _mm_load_si128((__m128i const *)table[bits]);
+        }
+        static UME_FORCE_INLINE __m128i expand2(int bits) {
+            alignas(16) static const int64_t table[4][2] = {
+                { 0, 0 },
+                { 0, 0 },
+                { 0, 0 },
+                { 0, 2 }
+            };
+            return _mm_load_si128((__m128i const *)table[bits]);
+        }
+        // Number of bits set in a 4-bit mask.
+        static UME_FORCE_INLINE uint32_t count4(int bits) {
+            return uint32_t(0x4332322132212110ULL >> (4 * bits)) & 0xF;
+        }
+        // Mask of the first 'count' 32-bit elements.
+        static UME_FORCE_INLINE __m128i prefix4(uint32_t count) {
+            return _mm_cmpgt_epi32(_mm_set1_epi32(int(count)), _mm_setr_epi32(0, 1, 2, 3));
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
@@ -0,0 +1,82 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+#ifndef UME_SIMD_DIVIDE_AVX_H_
+#define UME_SIMD_DIVIDE_AVX_H_
+
+#include <immintrin.h>
+#include "../../UMEBasicTypes.h"
+#include "../../UMEInline.h"
+#include "../../UMESimdDivider.h"
+#include "UMESimdMulHighAVX.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    // Division of 32-bit integer vectors by a SIMDDivider (see
+    // UMESimdDivider.h for the method). AVX has no 256-bit integer
+    // arithmetic, so 256-bit vectors are processed as two 128-bit halves.
+    class DivideAVX {
+    private:
+        static UME_FORCE_INLINE __m128i count(uint32_t n) {
+            return _mm_cvtsi32_si128(int(n));
+        }
+
+    public:
+        static UME_FORCE_INLINE __m128i divu32(__m128i const & x, SIMDDivider<uint32_t> const & d) {
+            __m128i t0 = MulHighAVX::mulhiu32(x, _mm_set1_epi32(d.magic()));
+            __m128i t1 = _mm_add_epi32(_mm_srl_epi32(_mm_sub_epi32(x, t0), count(d.shift1())), t0);
+            return _mm_srl_epi32(t1, count(d.shift2()));
+        }
+        static UME_FORCE_INLINE __m128i divs32(__m128i const & x, SIMDDivider<int32_t> const & d) {
+            __m128i t0 = _mm_add_epi32(x, MulHighAVX::mulhis32(x, _mm_set1_epi32(d.magic())));
+            __m128i t1 = _mm_sub_epi32(_mm_sra_epi32(t0, count(d.shift2())), _mm_srai_epi32(x, 31));
+            __m128i t2 = _mm_set1_epi32(d.sign());
+            return _mm_sub_epi32(_mm_xor_si128(t1, t2), t2);
+        }
+        static UME_FORCE_INLINE __m256i divu32(__m256i const & x, SIMDDivider<uint32_t> const & d) {
+            __m128i t0 = divu32(_mm256_castsi256_si128(x), d);
+            __m128i t1 = divu32(_mm256_extractf128_si256(x, 1), d);
+            return _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+        }
+        static UME_FORCE_INLINE __m256i divs32(__m256i const & x, SIMDDivider<int32_t> const & d) {
+            __m128i t0 = divs32(_mm256_castsi256_si128(x), d);
+            __m128i t1 = divs32(_mm256_extractf128_si256(x, 1), d);
+            return _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
@@ -0,0 +1,74 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+#ifndef UME_SIMD_MUL_HIGH_AVX_H_
+#define UME_SIMD_MUL_HIGH_AVX_H_
+
+#include <immintrin.h>
+#include "../../UMEBasicTypes.h"
+#include "../../UMEInline.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    // High halves of 32x32-bit products, from the even/odd 32x32->64
+    // multiplies. AVX has no 256-bit integer arithmetic, so 256-bit
+    // registers are processed as two 128-bit halves.
+    class MulHighAVX {
+    public:
+        static UME_FORCE_INLINE __m128i mulhiu32(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+            __m128i t1 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+            return _mm_blend_epi16(t0, t1, 0xCC);
+        }
+        static UME_FORCE_INLINE __m128i mulhis32(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_srli_epi64(_mm_mul_epi32(a, b), 32);
+            __m128i t1 = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+            return _mm_blend_epi16(t0, t1, 0xCC);
+        }
+        static UME_FORCE_INLINE __m256i mulhiu32(__m256i const & a, __m256i const & b) {
+            __m128i t0 = mulhiu32(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b));
+            __m128i t1 = mulhiu32(_mm256_extractf128_si256(a, 1), _mm256_extractf128_si256(b, 1));
+            return _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+        }
+        static UME_FORCE_INLINE __m256i mulhis32(__m256i const & a, __m256i const & b) {
+            __m128i t0 = mulhis32(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b));
+            __m128i t1 = mulhis32(_mm256_extractf128_si256(a, 1), _mm256_extractf128_si256(b, 1));
+            return _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
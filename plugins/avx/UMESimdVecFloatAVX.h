@@ -37,6 +37,7 @@
 
 #include "UMESimdMaskAVX.h"
 #include "UMESimdSwizzleAVX.h"
+#include "UMESimdCompressTableAVX.h"
 #include "UMESimdVecUintAVX.h"
 #include "UMESimdVecIntAVX.h"
 
@@ -37,6 +37,8 @@
 
 #include "UMESimdMaskAVX.h"
 #include "UMESimdSwizzleAVX.h"
+#include "UMESimdMulHighAVX.h"
+#include "UMESimdDivideAVX.h"
 
 // ********************************************************************************************
 // UNSIGNED INTEGER VECTOR TEMPLATE
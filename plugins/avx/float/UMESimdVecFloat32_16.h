@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     //class SIMDVec_f<double, 16>;
 
@@ -185,8 +186,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -196,8 +206,8 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<16> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m256 t1 = _mm256_loadu_ps(p + 8);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
             mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
@@ -210,9 +220,9 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<16> const & mask, float const * p) {
-            __m256 t0 = _mm256_load_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
             mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
-            __m256 t1 = _mm256_load_ps(p + 8);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
             mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
         }
@@ -224,12 +234,8 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE float* store(SIMDVecMask<16> const & mask, float * p) const {
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m256 t1 = _mm256_loadu_ps(p + 8);
-            __m256 t2 = _mm256_blendv_ps(t0, mVec[0], _mm256_castsi256_ps(mask.mMask[0]));
-            __m256 t3 = _mm256_blendv_ps(t1, mVec[1], _mm256_castsi256_ps(mask.mMask[1]));
-            _mm256_storeu_ps(p, t2);
-            _mm256_storeu_ps(p + 8, t3);
+            _mm256_maskstore_ps(p, mask.mMask[0], mVec[0]);
+            _mm256_maskstore_ps(p + 8, mask.mMask[1], mVec[1]);
             return p;
         }
         // STOREA
@@ -244,6 +250,16 @@ namespace SIMD {
             _mm256_maskstore_ps(p + 8, mask.mMask[1], mVec[1]);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE float* sstore(float* p) const {
+            _mm256_stream_ps(p, mVec[0]);
+            _mm256_stream_ps(p + 8, mVec[1]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE float* sstore(SIMDVecMask<16> const & mask, float* p) const {
+            return storea(mask, p);
+        }
 
         // BLENDV
         // BLENDS
@@ -735,10 +751,35 @@ namespace SIMD {
         }
         // SQRTA     - Square root of vector values and assign
         // MSQRTA    - Masked square root of vector values and assign
-        // POWV      - Power (exponents in vector)
-        // MPOWV     - Masked power (exponents in vector)
-        // POWS      - Power (exponent in scalar)
-        // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<16> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float, SIMDVecMask<16>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, float>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec[0], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -787,11 +828,91 @@ namespace SIMD {
         // ISZEROSUB - Is zero or subnormal
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, DEFAULT_PRECISION>(*this);
         }
         // MEXP
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<16> const & mask) const {
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this);
+        }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
         }
         // LOG
         // MLOG
@@ -818,6 +939,7 @@ namespace SIMD {
         // FTOI
         UME_FORCE_INLINE operator SIMDVec_i<int32_t, 16>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
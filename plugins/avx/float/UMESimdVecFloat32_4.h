@@ -40,6 +40,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<> class SIMDVec_f<double, 4>;
 
@@ -157,8 +158,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -167,7 +177,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, float const * p) {
-            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t0 = _mm_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -178,7 +188,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<4> const & mask, float const * p) {
-            __m128 t0 = _mm_load_ps(p);
+            __m128 t0 = _mm_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -202,6 +212,15 @@ namespace SIMD {
             _mm_maskstore_ps(p, mask.mMask, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE float* sstore(float * p) const {
+            _mm_stream_ps(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE float* sstore(SIMDVecMask<4> const & mask, float * p) const {
+            return storea(mask, p);
+        }
 
         // BLENDV
         // BLENDS
@@ -1102,9 +1121,34 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<4> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float, SIMDVecMask<4>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, float>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m128 t0 = _mm_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT);
@@ -1160,11 +1204,91 @@ namespace SIMD {
 
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, DEFAULT_PRECISION>(*this);
         }
         // MEXP
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<4> const & mask) const {
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this);
+        }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
         }
         // LOG
         // MLOG
@@ -1237,6 +1361,7 @@ namespace SIMD {
         // FTOI
         UME_FORCE_INLINE operator SIMDVec_i<int32_t, 4>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
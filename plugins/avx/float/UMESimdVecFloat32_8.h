@@ -40,6 +40,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<> class SIMDVec_f<double, 8>;
 
@@ -158,8 +159,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -168,7 +178,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<8> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -179,7 +189,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<8> const & mask, float const * p) {
-            __m256 t0 = _mm256_load_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -203,6 +213,45 @@ namespace SIMD {
             _mm256_maskstore_ps(p, mask.mMask, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE float* sstore(float* p) const {
+            _mm256_stream_ps(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE float* sstore(SIMDVecMask<8> const & mask, float* p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<8> const & mask) const {
+            alignas(32) float raw[8] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+            compressStore(mask, raw);
+            return SIMDVec_f(_mm256_load_ps(raw));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, float * p) const {
+            int t0 = _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask));
+            uint32_t t1 = CompressTableAVX::count4(t0 & 0xF);
+            uint32_t t2 = CompressTableAVX::count4(t0 >> 4);
+            __m128 t3 = _mm_permutevar_ps(_mm256_castps256_ps128(mVec), CompressTableAVX::compress4(t0 & 0xF));
+            __m128 t4 = _mm_permutevar_ps(_mm256_extractf128_ps(mVec, 1), CompressTableAVX::compress4(t0 >> 4));
+            _mm_maskstore_ps(p, CompressTableAVX::prefix4(t1), t3);
+            _mm_maskstore_ps(p + t1, CompressTableAVX::prefix4(t2), t4);
+            return t1 + t2;
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<8> const & mask, float const * p) {
+            int t0 = _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask));
+            uint32_t t1 = CompressTableAVX::count4(t0 & 0xF);
+            uint32_t t2 = CompressTableAVX::count4(t0 >> 4);
+            __m128 t3 = _mm_maskload_ps(p, CompressTableAVX::prefix4(t1));
+            __m128 t4 = _mm_maskload_ps(p + t1, CompressTableAVX::prefix4(t2));
+            __m128 t5 = _mm_permutevar_ps(t3, CompressTableAVX::expand4(t0 & 0xF));
+            __m128 t6 = _mm_permutevar_ps(t4, CompressTableAVX::expand4(t0 >> 4));
+            __m256 t7 = _mm256_insertf128_ps(_mm256_castps128_ps256(t5), t6, 1);
+            mVec = BLEND(mVec, t7, mask.mMask);
+            return t1 + t2;
+        }
 
         // BLENDV
         // BLENDS
@@ -740,16 +789,19 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            /* alignas(32) int32_t raw[8];
-            _mm256_store_si256((__m256i *)raw, mVec);
-            for (unsigned int i = 0; i < 7; i++) {
-            for (unsigned int j = i + 1; j < 8; j++) {
-            if (raw[i] == raw[j]) {
-            return false;
-            }
-            }
-            }*/
-            return true;
+            // Pairs inside a 128-bit lane are covered by rotating the lanes
+            // by 1 and 2 elements, pairs across the lanes by all 4 rotations
+            // of the swapped lanes.
+            __m256 t0 = _mm256_permute2f128_ps(mVec, mVec, 0x01);
+            __m256 t1 = _mm256_cmp_ps(mVec, _mm256_permute_ps(mVec, 0x39), _CMP_EQ_OQ);
+            __m256 t2 = _mm256_cmp_ps(mVec, _mm256_permute_ps(mVec, 0x4E), _CMP_EQ_OQ);
+            __m256 t3 = _mm256_cmp_ps(mVec, t0, _CMP_EQ_OQ);
+            __m256 t4 = _mm256_cmp_ps(mVec, _mm256_permute_ps(t0, 0x39), _CMP_EQ_OQ);
+            __m256 t5 = _mm256_cmp_ps(mVec, _mm256_permute_ps(t0, 0x4E), _CMP_EQ_OQ);
+            __m256 t6 = _mm256_cmp_ps(mVec, _mm256_permute_ps(t0, 0x93), _CMP_EQ_OQ);
+            __m256 t7 = _mm256_or_ps(_mm256_or_ps(t1, t2), _mm256_or_ps(t3, t4));
+            __m256 t8 = _mm256_or_ps(t7, _mm256_or_ps(t5, t6));
+            return _mm256_movemask_ps(t8) == 0;
         }
         // HADD
         UME_FORCE_INLINE float hadd() const {
@@ -1171,9 +1223,34 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<8> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float, SIMDVecMask<8>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, float>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -1229,11 +1306,91 @@ namespace SIMD {
 
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, DEFAULT_PRECISION>(*this);
         }
         // MEXP
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<8> const & mask) const {
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
+        }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
         }
         // LOG
         // MLOG
@@ -1246,7 +1403,7 @@ namespace SIMD {
             __m256 t0 = _mm256_sin_ps(mVec);
             return SIMDVec_f(t0);
 #else
-            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this);
 #endif
         }
         // MSIN
@@ -1256,7 +1413,7 @@ namespace SIMD {
             __m256 t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t0);
 #else
-            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
 #endif
         }
         // COS
@@ -1265,7 +1422,7 @@ namespace SIMD {
             __m256 t0 = _mm256_cos_ps(mVec);
             return SIMDVec_f(t0);
 #else
-            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this);
 #endif
         }
         // MCOS
@@ -1275,7 +1432,7 @@ namespace SIMD {
             __m256 t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t0);
 #else
-            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
 #endif
         }
         // SINCOS
@@ -1297,14 +1454,68 @@ namespace SIMD {
             sinvec.mVec = BLEND(mVec, t0, mask.mMask);
             cosvec.mVec = BLEND(mVec, t1, mask.mMask);
 #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this, sinvec, cosvec);
 #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+#if defined(UME_USE_SVML)
+            __m256 t0 = _mm256_tan_ps(mVec);
+            return SIMDVec_f(t0);
+#else
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+#endif
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+#if defined(UME_USE_SVML)
+            __m256 t0 = _mm256_tan_ps(mVec);
+            __m256 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+#else
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+#endif
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
+        // MATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(mask, *this, b);
+        }
+        // ASIN
+        UME_FORCE_INLINE SIMDVec_f asin() const {
+            return VECTOR_EMULATION::asinf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MASIN
+        UME_FORCE_INLINE SIMDVec_f asin(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::asinf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ACOS
+        UME_FORCE_INLINE SIMDVec_f acos() const {
+            return VECTOR_EMULATION::acosf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MACOS
+        UME_FORCE_INLINE SIMDVec_f acos(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::acosf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 4> const & a, SIMDVec_f<float, 4> const & b) {
@@ -1348,6 +1559,7 @@ namespace SIMD {
         // FTOI
         UME_FORCE_INLINE operator SIMDVec_i<int32_t, 8>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<double, 1> :
@@ -148,8 +149,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         //(Memory access)
         // LOAD
@@ -1079,6 +1089,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_i<int64_t, 1>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
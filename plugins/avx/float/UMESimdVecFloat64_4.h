@@ -56,6 +56,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<double, 4> :
@@ -192,7 +193,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, double const * p) {
-            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t0 = _mm256_maskload_pd(p, _mm256_castpd_si256(_mm256_cvtepi32_pd(mask.mMask)));
             __m256d mask_pd = _mm256_cvtepi32_pd(mask.mMask);
             mVec = _mm256_blendv_pd(mVec, t0, mask_pd);
             return *this;
@@ -204,7 +205,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<4> const & mask, double const * p) {
-            __m256d t0 = _mm256_load_pd(p);
+            __m256d t0 = _mm256_maskload_pd(p, _mm256_castpd_si256(_mm256_cvtepi32_pd(mask.mMask)));
             __m256d mask_pd = _mm256_cvtepi32_pd(mask.mMask);
             mVec = _mm256_blendv_pd(mVec, t0, mask_pd);
             return *this;
@@ -216,9 +217,7 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE double* store(SIMDVecMask<4> const & mask, double* p) const {
-            __m256d t0 = _mm256_loadu_pd(p);
-            __m256d t1 = _mm256_blendv_pd(t0, mVec, _mm256_cvtepi32_pd(mask.mMask));
-            _mm256_storeu_pd(p, t1);
+            _mm256_maskstore_pd(p, _mm256_castpd_si256(_mm256_cvtepi32_pd(mask.mMask)), mVec);
             return p;
         }
         // STOREA
@@ -237,6 +236,45 @@ namespace SIMD {
             _mm256_maskstore_pd(p, x.epi64, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE double* sstore(double* p) const {
+            _mm256_stream_pd(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE double* sstore(SIMDVecMask<4> const & mask, double* p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<4> const & mask) const {
+            alignas(32) double raw[4] = { 0.0, 0.0, 0.0, 0.0 };
+            compressStore(mask, raw);
+            return SIMDVec_f(_mm256_load_pd(raw));
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, double * p) const {
+            int t0 = _mm_movemask_ps(_mm_castsi128_ps(mask.mMask));
+            uint32_t t1 = CompressTableAVX::count4(t0 & 0x3);
+            uint32_t t2 = CompressTableAVX::count4(t0 >> 2);
+            __m128d t3 = _mm_permutevar_pd(_mm256_castpd256_pd128(mVec), CompressTableAVX::compress2(t0 & 0x3));
+            __m128d t4 = _mm_permutevar_pd(_mm256_extractf128_pd(mVec, 1), CompressTableAVX::compress2(t0 >> 2));
+            _mm_maskstore_pd(p, CompressTableAVX::prefix4(2 * t1), t3);
+            _mm_maskstore_pd(p + t1, CompressTableAVX::prefix4(2 * t2), t4);
+            return t1 + t2;
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<4> const & mask, double const * p) {
+            int t0 = _mm_movemask_ps(_mm_castsi128_ps(mask.mMask));
+            uint32_t t1 = CompressTableAVX::count4(t0 & 0x3);
+            uint32_t t2 = CompressTableAVX::count4(t0 >> 2);
+            __m128d t3 = _mm_maskload_pd(p, CompressTableAVX::prefix4(2 * t1));
+            __m128d t4 = _mm_maskload_pd(p + t1, CompressTableAVX::prefix4(2 * t2));
+            __m128d t5 = _mm_permutevar_pd(t3, CompressTableAVX::expand2(t0 & 0x3));
+            __m128d t6 = _mm_permutevar_pd(t4, CompressTableAVX::expand2(t0 >> 2));
+            __m256d t7 = _mm256_insertf128_pd(_mm256_castpd128_pd256(t5), t6, 1);
+            mVec = _mm256_blendv_pd(mVec, t7, _mm256_cvtepi32_pd(mask.mMask));
+            return t1 + t2;
+        }
         //(Addition operations)
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
@@ -975,10 +1013,35 @@ namespace SIMD {
         }
         // SQRTA     - Square root of vector values and assign
         // MSQRTA    - Masked square root of vector values and assign
-        // POWV      - Power (exponents in vector)
-        // MPOWV     - Masked power (exponents in vector)
-        // POWS      - Power (exponent in scalar)
-        // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<4> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double, SIMDVecMask<4>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, double>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm256_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -1005,11 +1068,91 @@ namespace SIMD {
         // ISZEROSUB - Is zero or subnormal
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, DEFAULT_PRECISION>(*this);
         }
         // MEXP
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<4> const & mask) const {
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>> (mask, *this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION> (mask, *this);
+        }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
         }
         // LOG
         // MLOG
@@ -1036,6 +1179,7 @@ namespace SIMD {
         // FTOI
         UME_FORCE_INLINE operator SIMDVec_i<int64_t, 4>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
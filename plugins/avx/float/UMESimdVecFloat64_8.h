@@ -61,6 +61,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<double, 8> :
@@ -221,10 +222,10 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<8> const & mask, double const * p) {
-            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t0 = _mm256_maskload_pd(p, _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0))));
             __m128i t1 = _mm256_extractf128_si256(mask.mMask, 0);
             mVec[0] = _mm256_blendv_pd(mVec[0], t0, _mm256_cvtepi32_pd(t1));
-            __m256d t2 = _mm256_loadu_pd(p + 4);
+            __m256d t2 = _mm256_maskload_pd(p + 4, _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1))));
             __m128i t3 = _mm256_extractf128_si256(mask.mMask, 1);
             mVec[1] = _mm256_blendv_pd(mVec[1], t2, _mm256_cvtepi32_pd(t3));
             return *this;
@@ -237,8 +238,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<8> const & mask, double const * p) {
-            __m256d t0 = _mm256_load_pd(p);
-            __m256d t1 = _mm256_load_pd(p + 4);
+            __m256d t0 = _mm256_maskload_pd(p, _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0))));
+            __m256d t1 = _mm256_maskload_pd(p + 4, _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1))));
 
             __m128i t2 = _mm256_extractf128_si256(mask.mMask, 0);
             __m128i t3 = _mm256_extractf128_si256(mask.mMask, 1);
@@ -257,14 +258,8 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE double* store(SIMDVecMask<8> const & mask, double* p) const {
-            __m256d t0 = _mm256_loadu_pd(p);
-            __m128i t1 = _mm256_extractf128_si256(mask.mMask, 0);
-            __m256d t2 = _mm256_blendv_pd(t0, mVec[0], _mm256_cvtepi32_pd(t1));
-            _mm256_storeu_pd(p, t2);
-            __m256d t3 = _mm256_loadu_pd(p + 4);
-            __m128i t4 = _mm256_extractf128_si256(mask.mMask, 1);
-            __m256d t5 = _mm256_blendv_pd(t3, mVec[1], _mm256_cvtepi32_pd(t4));
-            _mm256_storeu_pd(p + 4, t5);
+            _mm256_maskstore_pd(p, _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0))), mVec[0]);
+            _mm256_maskstore_pd(p + 4, _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1))), mVec[1]);
             return p;
         }
         // STOREA
@@ -290,6 +285,16 @@ namespace SIMD {
 
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE double* sstore(double* p) const {
+            _mm256_stream_pd(p, mVec[0]);
+            _mm256_stream_pd(p + 4, mVec[1]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE double* sstore(SIMDVecMask<8> const & mask, double* p) const {
+            return storea(mask, p);
+        }
         //(Addition operations)
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
@@ -827,10 +832,35 @@ namespace SIMD {
         }
         // SQRTA     - Square root of vector values and assign
         // MSQRTA    - Masked square root of vector values and assign
-        // POWV      - Power (exponents in vector)
-        // MPOWV     - Masked power (exponents in vector)
-        // POWS      - Power (exponent in scalar)
-        // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<8> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double, SIMDVecMask<8>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, double>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm256_round_pd(mVec[0], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -860,11 +890,91 @@ namespace SIMD {
         // ISZEROSUB - Is zero or subnormal
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, DEFAULT_PRECISION>(*this);
         }
         // MEXP
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<8> const & mask) const {
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
+        }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
         }
         // LOG
         // MLOG
@@ -891,6 +1001,7 @@ namespace SIMD {
         // FTOI
         UME_FORCE_INLINE operator SIMDVec_i<int64_t, 8>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 1> :
@@ -139,8 +140,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const *p) {
@@ -1448,6 +1458,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 1>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
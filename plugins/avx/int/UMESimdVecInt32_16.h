@@ -45,6 +45,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 16> :
@@ -177,8 +178,8 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<16> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask[0]));
+            __m256i t1 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 8), mask.mMask[1]));
             mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
             mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
             return *this;
@@ -191,8 +192,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<16> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask[0]));
+            __m256i t1 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 8), mask.mMask[1]));
             mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
             mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
             return *this;
@@ -205,12 +206,8 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<16> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec[0], mask.mMask[0]);
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 8));
-            __m256i t3 = BLEND(t2, mVec[1], mask.mMask[1]);
-            _mm256_storeu_si256((__m256i*)p, t1);
-            _mm256_storeu_si256((__m256i*)(p + 8), t3);
+            _mm256_maskstore_ps((float *)p, mask.mMask[0], _mm256_castsi256_ps(mVec[0]));
+            _mm256_maskstore_ps((float *)(p + 8), mask.mMask[1], _mm256_castsi256_ps(mVec[1]));
             return p;
         }
         // STOREA
@@ -221,14 +218,20 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * storea(SIMDVecMask<16> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec[0], mask.mMask[0]);
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 8));
-            __m256i t3 = BLEND(t2, mVec[1], mask.mMask[1]);
-            _mm256_store_si256((__m256i*)p, t1);
-            _mm256_store_si256((__m256i*)(p + 8), t3);
+            _mm256_maskstore_ps((float *)p, mask.mMask[0], _mm256_castsi256_ps(mVec[0]));
+            _mm256_maskstore_ps((float *)(p + 8), mask.mMask[1], _mm256_castsi256_ps(mVec[1]));
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int32_t * sstore(int32_t * p) const {
+            _mm256_stream_si256((__m256i*)p, mVec[0]);
+            _mm256_stream_si256((__m256i*)(p + 8), mVec[1]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int32_t * sstore(SIMDVecMask<16> const & mask, int32_t * p) const {
+            return storea(mask, p);
+        }
 
         // ABS
         SIMDVec_i abs() const {
@@ -285,6 +288,7 @@ namespace SIMD {
         UME_FORCE_INLINE  operator SIMDVec_f<float, 16> () const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
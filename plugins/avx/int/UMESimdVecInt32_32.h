@@ -44,6 +44,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 32> :
@@ -205,13 +206,13 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<32> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask[0]));
             mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 8));
+            __m256i t1 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 8), mask.mMask[1]));
             mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 16));
+            __m256i t2 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 16), mask.mMask[2]));
             mVec[2] = BLEND(mVec[2], t2, mask.mMask[2]);
-            __m256i t3 = _mm256_loadu_si256((__m256i*)(p + 24));
+            __m256i t3 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 24), mask.mMask[3]));
             mVec[3] = BLEND(mVec[3], t3, mask.mMask[3]);
             return *this;
         }
@@ -225,13 +226,13 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<32> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask[0]));
             mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 8));
+            __m256i t1 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 8), mask.mMask[1]));
             mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 16));
+            __m256i t2 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 16), mask.mMask[2]));
             mVec[2] = BLEND(mVec[2], t2, mask.mMask[2]);
-            __m256i t3 = _mm256_load_si256((__m256i*)(p + 24));
+            __m256i t3 = _mm256_castps_si256(_mm256_maskload_ps((float const *)(p + 24), mask.mMask[3]));
             mVec[3] = BLEND(mVec[3], t3, mask.mMask[3]);
             return *this;
         }
@@ -245,18 +246,10 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<32> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec[0], mask.mMask[0]);
-            _mm256_storeu_si256((__m256i*)p, t1);
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 8));
-            __m256i t3 = BLEND(t2, mVec[1], mask.mMask[1]);
-            _mm256_storeu_si256((__m256i*)(p + 8), t3);
-            __m256i t4 = _mm256_loadu_si256((__m256i*)(p + 16));
-            __m256i t5 = BLEND(t4, mVec[2], mask.mMask[2]);
-            _mm256_storeu_si256((__m256i*)(p + 16), t5);
-            __m256i t6 = _mm256_loadu_si256((__m256i*)(p + 24));
-            __m256i t7 = BLEND(t6, mVec[3], mask.mMask[3]);
-            _mm256_storeu_si256((__m256i*)(p + 24), t7);
+            _mm256_maskstore_ps((float *)p, mask.mMask[0], _mm256_castsi256_ps(mVec[0]));
+            _mm256_maskstore_ps((float *)(p + 8), mask.mMask[1], _mm256_castsi256_ps(mVec[1]));
+            _mm256_maskstore_ps((float *)(p + 16), mask.mMask[2], _mm256_castsi256_ps(mVec[2]));
+            _mm256_maskstore_ps((float *)(p + 24), mask.mMask[3], _mm256_castsi256_ps(mVec[3]));
             return p;
         }
         // STOREA
@@ -269,20 +262,24 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * storea(SIMDVecMask<32> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec[0], mask.mMask[0]);
-            _mm256_store_si256((__m256i*)p, t1);
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 8));
-            __m256i t3 = BLEND(t2, mVec[1], mask.mMask[1]);
-            _mm256_store_si256((__m256i*)(p + 8), t3);
-            __m256i t4 = _mm256_load_si256((__m256i*)(p + 16));
-            __m256i t5 = BLEND(t4, mVec[2], mask.mMask[2]);
-            _mm256_store_si256((__m256i*)(p + 16), t5);
-            __m256i t6 = _mm256_load_si256((__m256i*)(p + 24));
-            __m256i t7 = BLEND(t6, mVec[3], mask.mMask[3]);
-            _mm256_store_si256((__m256i*)(p + 24), t7);
+            _mm256_maskstore_ps((float *)p, mask.mMask[0], _mm256_castsi256_ps(mVec[0]));
+            _mm256_maskstore_ps((float *)(p + 8), mask.mMask[1], _mm256_castsi256_ps(mVec[1]));
+            _mm256_maskstore_ps((float *)(p + 16), mask.mMask[2], _mm256_castsi256_ps(mVec[2]));
+            _mm256_maskstore_ps((float *)(p + 24), mask.mMask[3], _mm256_castsi256_ps(mVec[3]));
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int32_t * sstore(int32_t * p) const {
+            _mm256_stream_si256((__m256i*)p, mVec[0]);
+            _mm256_stream_si256((__m256i*)(p + 8), mVec[1]);
+            _mm256_stream_si256((__m256i*)(p + 16), mVec[2]);
+            _mm256_stream_si256((__m256i*)(p + 24), mVec[3]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int32_t * sstore(SIMDVecMask<32> const & mask, int32_t * p) const {
+            return storea(mask, p);
+        }
 
         // ABS
         // MABS
@@ -297,6 +294,7 @@ namespace SIMD {
         // ITOF
         UME_FORCE_INLINE  operator SIMDVec_f<float, 32> () const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 4> :
@@ -159,8 +160,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
@@ -169,7 +179,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<4> const & mask, int32_t const * p) {
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
+            __m128i t0 = _mm_castps_si128(_mm_maskload_ps((float const *)p, mask.mMask));
             mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
@@ -180,7 +190,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<4> const & mask, int32_t const * p) {
-            __m128i t0 = _mm_load_si128((__m128i*)p);
+            __m128i t0 = _mm_castps_si128(_mm_maskload_ps((float const *)p, mask.mMask));
             mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
@@ -191,9 +201,7 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<4> const & mask, int32_t * p) const {
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m128i t1 = _mm_blendv_epi8(t0, mVec, mask.mMask);
-            _mm_storeu_si128((__m128i*) p, t1);
+            _mm_maskstore_ps((float *)p, mask.mMask, _mm_castsi128_ps(mVec));
             return p;
         }
         // STOREA
@@ -203,11 +211,18 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE int32_t * storea(SIMDVecMask<4> const & mask, int32_t * p) const {
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m128i t1 = _mm_blendv_epi8(t0, mVec, mask.mMask);
-            _mm_store_si128((__m128i*) p, t1);
+            _mm_maskstore_ps((float *)p, mask.mMask, _mm_castsi128_ps(mVec));
+            return p;
+        }
+        // SSTORE
+        UME_FORCE_INLINE int32_t * sstore(int32_t * p) const {
+            _mm_stream_si128((__m128i *)p, mVec);
             return p;
         }
+        // MSSTORE
+        UME_FORCE_INLINE int32_t * sstore(SIMDVecMask<4> const & mask, int32_t * p) const {
+            return storea(mask, p);
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
@@ -224,7 +239,7 @@ namespace SIMD {
         // SWIZZLEA
 
         // SORTA
-        UME_FORCE_INLINE SIMDVec_i sorta() {
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
             __m128i t0 = _mm_shuffle_epi32(mVec, 0xB1); // permute BADC
             __m128i t1 = _mm_min_epi32(mVec, t0);
             __m128i t2 = _mm_max_epi32(mVec, t0);
@@ -240,7 +255,7 @@ namespace SIMD {
             return SIMDVec_i(t11);
         }
         // SORTD
-        UME_FORCE_INLINE SIMDVec_i sortd() {
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
             __m128i t0 = _mm_shuffle_epi32(mVec, 0xB1); // permute BADC
             __m128i t1 = _mm_min_epi32(mVec, t0);
             __m128i t2 = _mm_max_epi32(mVec, t0);
@@ -255,6 +270,100 @@ namespace SIMD {
             __m128i t11 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t10), _mm_castsi128_ps(t9), 0x0A));
             return SIMDVec_i(t11);
         }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, 0xB1); // permute BADC
+            __m128i t1 = _mm_shuffle_epi32(payload.mVec, 0xB1);
+            __m128i t2 = _mm_blendv_epi8(_mm_cmpgt_epi32(mVec, t0), _mm_cmpgt_epi32(t0, mVec), _mm_setr_epi32(0, -1, -1, 0));
+            __m128i t3 = _mm_blendv_epi8(mVec, t0, t2);
+            __m128i t4 = _mm_blendv_epi8(payload.mVec, t1, t2);
+            __m128i t5 = _mm_shuffle_epi32(t3, 0x4E); // permute CDAB
+            __m128i t6 = _mm_shuffle_epi32(t4, 0x4E);
+            __m128i t7 = _mm_blendv_epi8(_mm_cmpgt_epi32(t3, t5), _mm_cmpgt_epi32(t5, t3), _mm_setr_epi32(0, 0, -1, -1));
+            __m128i t8 = _mm_blendv_epi8(t3, t5, t7);
+            __m128i t9 = _mm_blendv_epi8(t4, t6, t7);
+            __m128i t10 = _mm_shuffle_epi32(t8, 0xB1); // permute BADC
+            __m128i t11 = _mm_shuffle_epi32(t9, 0xB1);
+            __m128i t12 = _mm_blendv_epi8(_mm_cmpgt_epi32(t8, t10), _mm_cmpgt_epi32(t10, t8), _mm_setr_epi32(0, -1, 0, -1));
+            __m128i t13 = _mm_blendv_epi8(t8, t10, t12);
+            __m128i t14 = _mm_blendv_epi8(t9, t11, t12);
+            payload.mVec = t14;
+            return SIMDVec_i(t13);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, 0xB1); // permute BADC
+            __m128i t1 = _mm_shuffle_epi32(payload.mVec, 0xB1);
+            __m128i t2 = _mm_blendv_epi8(_mm_cmpgt_epi32(t0, mVec), _mm_cmpgt_epi32(mVec, t0), _mm_setr_epi32(0, -1, -1, 0));
+            __m128i t3 = _mm_blendv_epi8(mVec, t0, t2);
+            __m128i t4 = _mm_blendv_epi8(payload.mVec, t1, t2);
+            __m128i t5 = _mm_shuffle_epi32(t3, 0x4E); // permute CDAB
+            __m128i t6 = _mm_shuffle_epi32(t4, 0x4E);
+            __m128i t7 = _mm_blendv_epi8(_mm_cmpgt_epi32(t5, t3), _mm_cmpgt_epi32(t3, t5), _mm_setr_epi32(0, 0, -1, -1));
+            __m128i t8 = _mm_blendv_epi8(t3, t5, t7);
+            __m128i t9 = _mm_blendv_epi8(t4, t6, t7);
+            __m128i t10 = _mm_shuffle_epi32(t8, 0xB1); // permute BADC
+            __m128i t11 = _mm_shuffle_epi32(t9, 0xB1);
+            __m128i t12 = _mm_blendv_epi8(_mm_cmpgt_epi32(t10, t8), _mm_cmpgt_epi32(t8, t10), _mm_setr_epi32(0, -1, 0, -1));
+            __m128i t13 = _mm_blendv_epi8(t8, t10, t12);
+            __m128i t14 = _mm_blendv_epi8(t9, t11, t12);
+            payload.mVec = t14;
+            return SIMDVec_i(t13);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_i bsorta() const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, 0x4E);   // permute CDAB
+            __m128i t1 = _mm_min_epi32(mVec, t0);
+            __m128i t2 = _mm_max_epi32(mVec, t0);
+            __m128i t3 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t1), _mm_castsi128_ps(t2), 0x0C));
+            __m128i t4 = _mm_shuffle_epi32(t3, 0xB1); // permute BADC
+            __m128i t5 = _mm_min_epi32(t3, t4);
+            __m128i t6 = _mm_max_epi32(t3, t4);
+            __m128i t7 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t5), _mm_castsi128_ps(t6), 0x0A));
+            return SIMDVec_i(t7);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_i bsortd() const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, 0x4E);   // permute CDAB
+            __m128i t1 = _mm_min_epi32(mVec, t0);
+            __m128i t2 = _mm_max_epi32(mVec, t0);
+            __m128i t3 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t2), _mm_castsi128_ps(t1), 0x0C));
+            __m128i t4 = _mm_shuffle_epi32(t3, 0xB1); // permute BADC
+            __m128i t5 = _mm_min_epi32(t3, t4);
+            __m128i t6 = _mm_max_epi32(t3, t4);
+            __m128i t7 = _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(t6), _mm_castsi128_ps(t5), 0x0A));
+            return SIMDVec_i(t7);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsorta(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, 0x4E); // permute CDAB
+            __m128i t1 = _mm_shuffle_epi32(payload.mVec, 0x4E);
+            __m128i t2 = _mm_blendv_epi8(_mm_cmpgt_epi32(mVec, t0), _mm_cmpgt_epi32(t0, mVec), _mm_setr_epi32(0, 0, -1, -1));
+            __m128i t3 = _mm_blendv_epi8(mVec, t0, t2);
+            __m128i t4 = _mm_blendv_epi8(payload.mVec, t1, t2);
+            __m128i t5 = _mm_shuffle_epi32(t3, 0xB1); // permute BADC
+            __m128i t6 = _mm_shuffle_epi32(t4, 0xB1);
+            __m128i t7 = _mm_blendv_epi8(_mm_cmpgt_epi32(t3, t5), _mm_cmpgt_epi32(t5, t3), _mm_setr_epi32(0, -1, 0, -1));
+            __m128i t8 = _mm_blendv_epi8(t3, t5, t7);
+            __m128i t9 = _mm_blendv_epi8(t4, t6, t7);
+            payload.mVec = t9;
+            return SIMDVec_i(t8);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsortd(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, 0x4E); // permute CDAB
+            __m128i t1 = _mm_shuffle_epi32(payload.mVec, 0x4E);
+            __m128i t2 = _mm_blendv_epi8(_mm_cmpgt_epi32(t0, mVec), _mm_cmpgt_epi32(mVec, t0), _mm_setr_epi32(0, 0, -1, -1));
+            __m128i t3 = _mm_blendv_epi8(mVec, t0, t2);
+            __m128i t4 = _mm_blendv_epi8(payload.mVec, t1, t2);
+            __m128i t5 = _mm_shuffle_epi32(t3, 0xB1); // permute BADC
+            __m128i t6 = _mm_shuffle_epi32(t4, 0xB1);
+            __m128i t7 = _mm_blendv_epi8(_mm_cmpgt_epi32(t5, t3), _mm_cmpgt_epi32(t3, t5), _mm_setr_epi32(0, -1, 0, -1));
+            __m128i t8 = _mm_blendv_epi8(t3, t5, t7);
+            __m128i t9 = _mm_blendv_epi8(t4, t6, t7);
+            payload.mVec = t9;
+            return SIMDVec_i(t8);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -560,6 +669,11 @@ namespace SIMD {
             mVec = _mm_blendv_epi8(mVec, t1, mask.mMask);
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            __m128i t0 = MulHighAVX::mulhis32(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // DIVV
         // MDIVV
         // DIVS
@@ -568,6 +682,11 @@ namespace SIMD {
         // MDIVVA
         // DIVSA
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int32_t> const & divider) const {
+            __m128i t0 = DivideAVX::divs32(mVec, divider);
+            return SIMDVec_i(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1388,6 +1507,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -150,6 +150,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 8> :
@@ -268,8 +269,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
@@ -278,7 +288,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<8> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask));
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -289,7 +299,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<8> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask));
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -300,9 +310,7 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<8> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i*)p, t1);
+            _mm256_maskstore_ps((float *)p, mask.mMask, _mm256_castsi256_ps(mVec));
             return p;
         }
         // STOREA
@@ -312,11 +320,18 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * storea(SIMDVecMask<8> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_store_si256((__m256i*)p, t1);
+            _mm256_maskstore_ps((float *)p, mask.mMask, _mm256_castsi256_ps(mVec));
+            return p;
+        }
+        // SSTORE
+        UME_FORCE_INLINE int32_t * sstore(int32_t * p) const {
+            _mm256_stream_si256((__m256i*)p, mVec);
             return p;
         }
+        // MSSTORE
+        UME_FORCE_INLINE int32_t * sstore(SIMDVecMask<8> const & mask, int32_t * p) const {
+            return storea(mask, p);
+        }
         // BLENDV
         // BLENDS
         // SWIZZLE
@@ -614,6 +629,11 @@ namespace SIMD {
             mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, t0, mask.mMask, _mm_mullo_epi32);
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            __m256i t0 = MulHighAVX::mulhis32(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // DIVV
 
         UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
@@ -636,6 +656,11 @@ namespace SIMD {
             return diva(b);
         }
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int32_t> const & divider) const {
+            __m256i t0 = DivideAVX::divs32(mVec, divider);
+            return SIMDVec_i(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -881,16 +906,58 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            alignas(32) int32_t raw[8];
-            _mm256_store_si256((__m256i *)raw, mVec);
-            for (unsigned int i = 0; i < 7; i++) {
-                for (unsigned int j = i + 1; j < 8; j++) {
-                    if (raw[i] == raw[j]) {
-                        return false;
-                    }
-                }
-            }
-            return true;
+            // Compare each half with its own rotations and the upper half
+            // with all four rotations of the lower half.
+            __m128i t0 = _mm256_extractf128_si256(mVec, 0);
+            __m128i t1 = _mm256_extractf128_si256(mVec, 1);
+            __m128i t2 = _mm_or_si128(
+                _mm_cmpeq_epi32(t0, _mm_shuffle_epi32(t0, _MM_SHUFFLE(2, 1, 0, 3))),
+                _mm_cmpeq_epi32(t0, _mm_shuffle_epi32(t0, _MM_SHUFFLE(1, 0, 3, 2))));
+            __m128i t3 = _mm_or_si128(
+                _mm_cmpeq_epi32(t1, _mm_shuffle_epi32(t1, _MM_SHUFFLE(2, 1, 0, 3))),
+                _mm_cmpeq_epi32(t1, _mm_shuffle_epi32(t1, _MM_SHUFFLE(1, 0, 3, 2))));
+            __m128i t4 = _mm_or_si128(
+                _mm_cmpeq_epi32(t1, t0),
+                _mm_cmpeq_epi32(t1, _mm_shuffle_epi32(t0, _MM_SHUFFLE(2, 1, 0, 3))));
+            __m128i t5 = _mm_or_si128(
+                _mm_cmpeq_epi32(t1, _mm_shuffle_epi32(t0, _MM_SHUFFLE(1, 0, 3, 2))),
+                _mm_cmpeq_epi32(t1, _mm_shuffle_epi32(t0, _MM_SHUFFLE(0, 3, 2, 1))));
+            __m128i t6 = _mm_or_si128(_mm_or_si128(t2, t3), _mm_or_si128(t4, t5));
+            return _mm_testz_si128(t6, t6) != 0;
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_i conflict() const {
+            __m128i t0 = _mm256_extractf128_si256(mVec, 0);
+            __m128i t1 = _mm256_extractf128_si256(mVec, 1);
+            __m128i t2 = _mm_shuffle_epi32(t0, _MM_SHUFFLE(2, 1, 0, 3));
+            __m128i t3 = _mm_shuffle_epi32(t0, _MM_SHUFFLE(1, 0, 3, 2));
+            __m128i t4 = _mm_shuffle_epi32(t0, _MM_SHUFFLE(0, 3, 2, 1));
+            __m128i t5 = _mm_shuffle_epi32(t1, _MM_SHUFFLE(2, 1, 0, 3));
+            __m128i t6 = _mm_shuffle_epi32(t1, _MM_SHUFFLE(1, 0, 3, 2));
+            __m128i t7 = _mm_shuffle_epi32(t1, _MM_SHUFFLE(0, 3, 2, 1));
+            // Lower half: conflicts within the half.
+            __m128i t8 = _mm_or_si128(
+                _mm_and_si128(_mm_cmpeq_epi32(t0, t2), _mm_setr_epi32(0, 1, 2, 4)),
+                _mm_or_si128(
+                    _mm_and_si128(_mm_cmpeq_epi32(t0, t3), _mm_setr_epi32(0, 0, 1, 2)),
+                    _mm_and_si128(_mm_cmpeq_epi32(t0, t4), _mm_setr_epi32(0, 0, 0, 1))));
+            // Upper half: conflicts within the half (bits 4-7) and with
+            // every element of the lower half (bits 0-3).
+            __m128i t9 = _mm_or_si128(
+                _mm_and_si128(_mm_cmpeq_epi32(t1, t5), _mm_setr_epi32(0, 0x10, 0x20, 0x40)),
+                _mm_or_si128(
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t6), _mm_setr_epi32(0, 0, 0x10, 0x20)),
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t7), _mm_setr_epi32(0, 0, 0, 0x10))));
+            __m128i t10 = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t0), _mm_setr_epi32(1, 2, 4, 8)),
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t2), _mm_setr_epi32(8, 1, 2, 4))),
+                _mm_or_si128(
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t3), _mm_setr_epi32(4, 8, 1, 2)),
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t4), _mm_setr_epi32(2, 4, 8, 1))));
+            __m256i t11 = _mm256_castsi128_si256(t8);
+            __m256i t12 = _mm256_insertf128_si256(t11, _mm_or_si128(t9, t10), 1);
+            return SIMDVec_i(t12);
         }
         // HADD
         UME_FORCE_INLINE int32_t hadd() const {
@@ -1860,6 +1927,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 8>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -166,6 +166,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int64_t, 4> :
@@ -287,8 +288,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const * p) {
@@ -297,7 +307,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<4> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)p, _mm256_castpd_si256(_mm256_cvtepi32_pd(mask.mMask))));
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -308,7 +318,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<4> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)p, _mm256_castpd_si256(_mm256_cvtepi32_pd(mask.mMask))));
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -319,9 +329,7 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int64_t * store(SIMDVecMask<4> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i*) p, t1);
+            _mm256_maskstore_pd((double *)p, _mm256_castpd_si256(_mm256_cvtepi32_pd(mask.mMask)), _mm256_castsi256_pd(mVec));
             return p;
         }
         // STOREA
@@ -331,11 +339,18 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE int64_t * storea(SIMDVecMask<4> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_store_si256((__m256i*) p, t1);
+            _mm256_maskstore_pd((double *)p, _mm256_castpd_si256(_mm256_cvtepi32_pd(mask.mMask)), _mm256_castsi256_pd(mVec));
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int64_t * sstore(int64_t * p) const {
+            _mm256_stream_si256((__m256i *)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int64_t * sstore(SIMDVecMask<4> const & mask, int64_t * p) const {
+            return storea(mask, p);
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
@@ -741,6 +756,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<double, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
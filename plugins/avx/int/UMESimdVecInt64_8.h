@@ -76,6 +76,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int64_t, 8> :
@@ -215,8 +216,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const * p) {
@@ -226,8 +236,8 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<8> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 4));
+            __m256i t0 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)p, _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0)))));
+            __m256i t1 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)(p + 4), _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1)))));
 
             mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
             mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
@@ -242,8 +252,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<8> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 4));
+            __m256i t0 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)p, _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0)))));
+            __m256i t1 = _mm256_castpd_si256(_mm256_maskload_pd((double const *)(p + 4), _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1)))));
             mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
             mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
             return *this;
@@ -256,12 +266,8 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int64_t * store(SIMDVecMask<8> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 4));
-            __m256i t2 = BLEND_LO(t0, mVec[0], mask.mMask);
-            __m256i t3 = BLEND_HI(t1, mVec[1], mask.mMask);
-            _mm256_storeu_si256((__m256i*) p, t2);
-            _mm256_storeu_si256((__m256i*) (p + 4), t3);
+            _mm256_maskstore_pd((double *)p, _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0))), _mm256_castsi256_pd(mVec[0]));
+            _mm256_maskstore_pd((double *)(p + 4), _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1))), _mm256_castsi256_pd(mVec[1]));
             return p;
         }
         // STOREA
@@ -272,14 +278,20 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE int64_t * storea(SIMDVecMask<8> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 4));
-            __m256i t2 = BLEND_LO(t0, mVec[0], mask.mMask);
-            __m256i t3 = BLEND_HI(t1, mVec[1], mask.mMask);
-            _mm256_store_si256((__m256i*) p, t2);
-            _mm256_store_si256((__m256i*) (p + 4), t3);
+            _mm256_maskstore_pd((double *)p, _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 0))), _mm256_castsi256_pd(mVec[0]));
+            _mm256_maskstore_pd((double *)(p + 4), _mm256_castpd_si256(_mm256_cvtepi32_pd(_mm256_extractf128_si256(mask.mMask, 1))), _mm256_castsi256_pd(mVec[1]));
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int64_t * sstore(int64_t * p) const {
+            _mm256_stream_si256((__m256i *)p, mVec[0]);
+            _mm256_stream_si256((__m256i *)(p + 4), mVec[1]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int64_t * sstore(SIMDVecMask<8> const & mask, int64_t * p) const {
+            return storea(mask, p);
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
@@ -536,6 +548,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<double, 8>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -33,6 +33,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<16> :
@@ -59,6 +60,16 @@ namespace SIMD {
         __m256i mMask[2];
 
         inline SIMDVecMask(__m256i const & x0, __m256i const & x1) { mMask[0] = x0; mMask[1] = x1; };
+
+        // Expand the lowest 8 bits of 'bits' to eight 32-bit lanes.
+        static inline __m256i expand8(uint32_t bits) {
+            __m128i t0 = _mm_set1_epi32(int32_t(bits));
+            __m128i t1 = _mm_setr_epi32(1, 2, 4, 8);
+            __m128i t2 = _mm_setr_epi32(16, 32, 64, 128);
+            __m128i t3 = _mm_cmpeq_epi32(_mm_and_si128(t0, t1), t1);
+            __m128i t4 = _mm_cmpeq_epi32(_mm_and_si128(t0, t2), t2);
+            return _mm256_insertf128_si256(_mm256_castsi128_si256(t3), t4, 1);
+        }
     public:
         inline SIMDVecMask() {}
 
@@ -98,6 +109,27 @@ namespace SIMD {
             mMask[0] = mask.mMask[0];
             mMask[1] = mask.mMask[1];
         }
+        // FIRSTN
+        static inline SIMDVecMask firstN(uint32_t count) {
+            __m256 t0 = _mm256_set1_ps(float(count < 16 ? count : 16));
+            SIMDVecMask retval;
+            retval.mMask[0] = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7), t0, _CMP_LT_OQ));
+            retval.mMask[1] = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(8, 9, 10, 11, 12, 13, 14, 15), t0, _CMP_LT_OQ));
+            return retval;
+        }
+        // TOBITMASK
+        inline uint64_t toBitmask() const {
+            uint64_t t0 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[0])));
+            uint64_t t1 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[1])));
+            return t0 | (t1 << 8);
+        }
+        // FROMBITMASK
+        static inline SIMDVecMask fromBitmask(uint64_t bits) {
+            SIMDVecMask retval;
+            retval.mMask[0] = expand8(uint32_t(bits));
+            retval.mMask[1] = expand8(uint32_t(bits >> 8));
+            return retval;
+        }
         // EXTRACT
         inline bool extract(uint32_t index) const {
             UME_PERFORMANCE_UNOPTIMAL_WARNING()
@@ -147,6 +179,12 @@ namespace SIMD {
             __m256i t7 = _mm256_castps_si256(t6);
             return SIMDVecMask(t3, t7);
         }
+        inline SIMDVecMask operator& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        inline SIMDVecMask operator&& (SIMDVecMask const & b) const {
+            return land(b);
+        }
         // LANDS
         inline SIMDVecMask land(bool b) const {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -159,6 +197,12 @@ namespace SIMD {
             __m256i t7 = _mm256_castps_si256(t6);
             return SIMDVecMask(t4, t7);
         }
+        inline SIMDVecMask operator& (bool b) const {
+            return land(b);
+        }
+        inline SIMDVecMask operator&& (bool b) const {
+            return land(b);
+        }
         // LANDVA
         inline SIMDVecMask & landa(SIMDVecMask const & b) {
             __m256 t0 = _mm256_castsi256_ps(mMask[0]);
@@ -171,6 +215,9 @@ namespace SIMD {
             mMask[1] = _mm256_castps_si256(t6);
             return *this;
         }
+        inline SIMDVecMask operator&= (SIMDVecMask const & b) {
+            return landa(b);
+        }
         // LANDSA
         inline SIMDVecMask & landa(bool b) {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -183,6 +230,9 @@ namespace SIMD {
             mMask[1] = _mm256_castps_si256(t6);
             return *this;
         }
+        inline SIMDVecMask operator&= (bool b) {
+            return landa(b);
+        }
         // LORV
         inline SIMDVecMask lor(SIMDVecMask const & b) const {
             __m256 t0 = _mm256_castsi256_ps(mMask[0]);
@@ -195,6 +245,12 @@ namespace SIMD {
             __m256i t7 = _mm256_castps_si256(t6);
             return SIMDVecMask(t3, t7);
         }
+        inline SIMDVecMask operator| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        inline SIMDVecMask operator|| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
         // LORS
         inline SIMDVecMask lor(bool b) const {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -207,6 +263,12 @@ namespace SIMD {
             __m256i t7 = _mm256_castps_si256(t6);
             return SIMDVecMask(t4, t7);
         }
+        inline SIMDVecMask operator| (bool b) const {
+            return lor(b);
+        }
+        inline SIMDVecMask operator|| (bool b) const {
+            return lor(b);
+        }
         // LORVA
         inline SIMDVecMask & lora(SIMDVecMask const & b) {
             __m256 t0 = _mm256_castsi256_ps(mMask[0]);
@@ -219,6 +281,9 @@ namespace SIMD {
             mMask[1] = _mm256_castps_si256(t6);
             return *this;
         }
+        inline SIMDVecMask & operator|= (SIMDVecMask const & b) {
+            return lora(b);
+        }
         // LORSA
         inline SIMDVecMask & lora(bool b) {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -231,6 +296,9 @@ namespace SIMD {
             mMask[1] = _mm256_castps_si256(t6);
             return *this;
         }
+        inline SIMDVecMask & operator|= (bool b) {
+            return lora(b);
+        }
         // LXORV
         inline SIMDVecMask lxor(SIMDVecMask const & b) const {
             __m256 t0 = _mm256_castsi256_ps(mMask[0]);
@@ -243,6 +311,9 @@ namespace SIMD {
             __m256i t7 = _mm256_castps_si256(t6);
             return SIMDVecMask(t3, t7);
         }
+        inline SIMDVecMask operator^ (SIMDVecMask const & b) const {
+            return lxor(b);
+        }
         // LXORS
         inline SIMDVecMask lxor(bool b) const {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -255,6 +326,9 @@ namespace SIMD {
             __m256i t7 = _mm256_castps_si256(t6);
             return SIMDVecMask(t4, t7);
         }
+        inline SIMDVecMask operator^ (bool b) const {
+            return lxor(b);
+        }
         // LXORVA
         inline SIMDVecMask & lxora(SIMDVecMask const & b) {
             __m256 t0 = _mm256_castsi256_ps(mMask[0]);
@@ -267,6 +341,9 @@ namespace SIMD {
             mMask[1] = _mm256_castps_si256(t6);
             return *this;
         }
+        inline SIMDVecMask operator^= (SIMDVecMask const & b) {
+            return lxora(b);
+        }
         // LXORSA
         inline SIMDVecMask & lxora(bool b) {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -279,6 +356,9 @@ namespace SIMD {
             mMask[1] = _mm256_castps_si256(t6);
             return *this;
         }
+        inline SIMDVecMask operator^= (bool b) {
+            return lxora(b);
+        }
         // LNOT
         inline SIMDVecMask lnot() const {
             __m256i t0 = _mm256_set1_epi32(TRUE_VAL());
@@ -291,6 +371,9 @@ namespace SIMD {
             __m256i t7 = _mm256_castps_si256(t5);
             return SIMDVecMask(t6, t7);
         }
+        inline SIMDVecMask operator! () const {
+            return lnot();
+        }
         // LNOTA
         inline SIMDVecMask & lnota() {
             __m256i t0 = _mm256_set1_epi32(TRUE_VAL());
@@ -318,6 +401,7 @@ namespace SIMD {
             return (t0 == 0) | (t1 == 0);
         }
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<32> :
@@ -66,6 +67,16 @@ namespace SIMD {
             mMask[3] = x3;
         };
 
+
+        // Expand the lowest 8 bits of 'bits' to eight 32-bit lanes.
+        static inline __m256i expand8(uint32_t bits) {
+            __m128i t0 = _mm_set1_epi32(int32_t(bits));
+            __m128i t1 = _mm_setr_epi32(1, 2, 4, 8);
+            __m128i t2 = _mm_setr_epi32(16, 32, 64, 128);
+            __m128i t3 = _mm_cmpeq_epi32(_mm_and_si128(t0, t1), t1);
+            __m128i t4 = _mm_cmpeq_epi32(_mm_and_si128(t0, t2), t2);
+            return _mm256_insertf128_si256(_mm256_castsi128_si256(t3), t4, 1);
+        }
     public:
         inline SIMDVecMask() {}
 
@@ -123,6 +134,33 @@ namespace SIMD {
             mMask[2] = mask.mMask[2];
             mMask[3] = mask.mMask[3];
         }
+        // FIRSTN
+        static inline SIMDVecMask firstN(uint32_t count) {
+            __m256 t0 = _mm256_set1_ps(float(count < 32 ? count : 32));
+            SIMDVecMask retval;
+            retval.mMask[0] = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7), t0, _CMP_LT_OQ));
+            retval.mMask[1] = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(8, 9, 10, 11, 12, 13, 14, 15), t0, _CMP_LT_OQ));
+            retval.mMask[2] = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(16, 17, 18, 19, 20, 21, 22, 23), t0, _CMP_LT_OQ));
+            retval.mMask[3] = _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(24, 25, 26, 27, 28, 29, 30, 31), t0, _CMP_LT_OQ));
+            return retval;
+        }
+        // TOBITMASK
+        inline uint64_t toBitmask() const {
+            uint64_t t0 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[0])));
+            uint64_t t1 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[1])));
+            uint64_t t2 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[2])));
+            uint64_t t3 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[3])));
+            return t0 | (t1 << 8) | (t2 << 16) | (t3 << 24);
+        }
+        // FROMBITMASK
+        static inline SIMDVecMask fromBitmask(uint64_t bits) {
+            SIMDVecMask retval;
+            retval.mMask[0] = expand8(uint32_t(bits));
+            retval.mMask[1] = expand8(uint32_t(bits >> 8));
+            retval.mMask[2] = expand8(uint32_t(bits >> 16));
+            retval.mMask[3] = expand8(uint32_t(bits >> 24));
+            return retval;
+        }
 
         inline bool extract(uint32_t index) const {
             UME_PERFORMANCE_UNOPTIMAL_WARNING()
@@ -195,6 +233,7 @@ namespace SIMD {
         }
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 #endif
@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<4> :
@@ -94,6 +95,22 @@ namespace SIMD {
         inline SIMDVecMask(SIMDVecMask const & mask) {
             this->mMask = mask.mMask;
         }
+        // FIRSTN
+        static inline SIMDVecMask firstN(uint32_t count) {
+            __m128i t0 = _mm_set1_epi32(count < 4 ? int32_t(count) : 4);
+            __m128i t1 = _mm_cmpgt_epi32(t0, _mm_setr_epi32(0, 1, 2, 3));
+            return SIMDVecMask(t1);
+        }
+        // TOBITMASK
+        inline uint64_t toBitmask() const {
+            return uint64_t(_mm_movemask_ps(_mm_castsi128_ps(mMask)));
+        }
+        // FROMBITMASK
+        static inline SIMDVecMask fromBitmask(uint64_t bits) {
+            __m128i t0 = _mm_setr_epi32(1, 2, 4, 8);
+            __m128i t1 = _mm_and_si128(_mm_set1_epi32(int32_t(bits)), t0);
+            return SIMDVecMask(_mm_cmpeq_epi32(t1, t0));
+        }
         // EXTRACT
         inline bool extract(uint32_t index) const {
             UME_PERFORMANCE_UNOPTIMAL_WARNING()
@@ -306,6 +323,7 @@ namespace SIMD {
         }
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<8> :
@@ -65,6 +66,16 @@ namespace SIMD {
         __m256i mMask;
 
         inline explicit SIMDVecMask(__m256i const & x) { mMask = x; };
+
+        // Expand the lowest 8 bits of 'bits' to eight 32-bit lanes.
+        static inline __m256i expand8(uint32_t bits) {
+            __m128i t0 = _mm_set1_epi32(int32_t(bits));
+            __m128i t1 = _mm_setr_epi32(1, 2, 4, 8);
+            __m128i t2 = _mm_setr_epi32(16, 32, 64, 128);
+            __m128i t3 = _mm_cmpeq_epi32(_mm_and_si128(t0, t1), t1);
+            __m128i t4 = _mm_cmpeq_epi32(_mm_and_si128(t0, t2), t2);
+            return _mm256_insertf128_si256(_mm256_castsi128_si256(t3), t4, 1);
+        }
     public:
         inline SIMDVecMask() {}
 
@@ -94,6 +105,20 @@ namespace SIMD {
         inline SIMDVecMask(SIMDVecMask const & mask) {
             this->mMask = mask.mMask;
         }
+        // FIRSTN
+        static inline SIMDVecMask firstN(uint32_t count) {
+            __m256 t0 = _mm256_set1_ps(float(count < 8 ? count : 8));
+            __m256 t1 = _mm256_cmp_ps(_mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7), t0, _CMP_LT_OQ);
+            return SIMDVecMask(_mm256_castps_si256(t1));
+        }
+        // TOBITMASK
+        inline uint64_t toBitmask() const {
+            return uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask)));
+        }
+        // FROMBITMASK
+        static inline SIMDVecMask fromBitmask(uint64_t bits) {
+            return SIMDVecMask(expand8(uint32_t(bits)));
+        }
         // EXTRACT
         inline bool extract(uint32_t index) const {
             alignas(32) uint32_t raw[8];
@@ -123,6 +148,12 @@ namespace SIMD {
             __m256i t3 = _mm256_castps_si256(t2);
             return SIMDVecMask(t3);
         }
+        inline SIMDVecMask operator& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        inline SIMDVecMask operator&& (SIMDVecMask const & b) const {
+            return land(b);
+        }
         // LANDS
         inline SIMDVecMask land(bool b) const {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -132,6 +163,12 @@ namespace SIMD {
             __m256i t4 = _mm256_castps_si256(t3);
             return SIMDVecMask(t4);
         }
+        inline SIMDVecMask operator& (bool b) const {
+            return land(b);
+        }
+        inline SIMDVecMask operator&& (bool b) const {
+            return land(b);
+        }
         // LANDVA
         inline SIMDVecMask & landa(SIMDVecMask const & b) {
             __m256 t0 = _mm256_castsi256_ps(mMask);
@@ -140,6 +177,9 @@ namespace SIMD {
             mMask = _mm256_castps_si256(t2);
             return *this;
         }
+        inline SIMDVecMask operator&= (SIMDVecMask const & b) {
+            return landa(b);
+        }
         // LANDSA
         inline SIMDVecMask & landa(bool b) {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -149,6 +189,9 @@ namespace SIMD {
             mMask = _mm256_castps_si256(t3);
             return *this;
         }
+        inline SIMDVecMask operator&= (bool b) {
+            return landa(b);
+        }
         // LORV
         inline SIMDVecMask lor(SIMDVecMask const & b) const {
             __m256 t0 = _mm256_castsi256_ps(mMask);
@@ -157,6 +200,12 @@ namespace SIMD {
             __m256i t3 = _mm256_castps_si256(t2);
             return SIMDVecMask(t3);
         }
+        inline SIMDVecMask operator| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        inline SIMDVecMask operator|| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
         // LORS
         inline SIMDVecMask lor(bool b) const {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -166,6 +215,12 @@ namespace SIMD {
             __m256i t4 = _mm256_castps_si256(t3);
             return SIMDVecMask(t4);
         }
+        inline SIMDVecMask operator| (bool b) const {
+            return lor(b);
+        }
+        inline SIMDVecMask operator|| (bool b) const {
+            return lor(b);
+        }
         // LORVA
         inline SIMDVecMask & lora(SIMDVecMask const & b) {
             __m256 t0 = _mm256_castsi256_ps(mMask);
@@ -174,6 +229,9 @@ namespace SIMD {
             mMask = _mm256_castps_si256(t2);
             return *this;
         }
+        inline SIMDVecMask & operator|= (SIMDVecMask const & b) {
+            return lora(b);
+        }
         // LORSA
         inline SIMDVecMask & lora(bool b) {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -183,6 +241,9 @@ namespace SIMD {
             mMask = _mm256_castps_si256(t3);
             return *this;
         }
+        inline SIMDVecMask & operator|= (bool b) {
+            return lora(b);
+        }
         // LXORV
         inline SIMDVecMask lxor(SIMDVecMask const & b) const {
             __m256 t0 = _mm256_castsi256_ps(mMask);
@@ -191,6 +252,9 @@ namespace SIMD {
             __m256i t3 = _mm256_castps_si256(t2);
             return SIMDVecMask(t3);
         }
+        inline SIMDVecMask operator^ (SIMDVecMask const & b) const {
+            return lxor(b);
+        }
         // LXORS
         inline SIMDVecMask lxor(bool b) const {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -200,6 +264,9 @@ namespace SIMD {
             __m256i t4 = _mm256_castps_si256(t3);
             return SIMDVecMask(t4);
         }
+        inline SIMDVecMask operator^ (bool b) const {
+            return lxor(b);
+        }
         // LXORVA
         inline SIMDVecMask & lxora(SIMDVecMask const & b) {
             __m256 t0 = _mm256_castsi256_ps(mMask);
@@ -208,6 +275,9 @@ namespace SIMD {
             mMask = _mm256_castps_si256(t2);
             return *this;
         }
+        inline SIMDVecMask operator^= (SIMDVecMask const & b) {
+            return lxora(b);
+        }
         // LXORSA
         inline SIMDVecMask & lxora(bool b) {
             __m256i t0 = _mm256_set1_epi32(b ? TRUE_VAL() : FALSE_VAL());
@@ -217,6 +287,9 @@ namespace SIMD {
             mMask = _mm256_castps_si256(t3);
             return *this;
         }
+        inline SIMDVecMask operator^= (bool b) {
+            return lxora(b);
+        }
         // LNOT
         inline SIMDVecMask lnot() const {
             __m256i t0 = _mm256_set1_epi32(TRUE_VAL());
@@ -226,6 +299,9 @@ namespace SIMD {
             __m256i t4 = _mm256_castps_si256(t3);
             return SIMDVecMask(t4);
         }
+        inline SIMDVecMask operator! () const {
+            return lnot();
+        }
         // LNOTA
         inline SIMDVecMask & lnota() {
             __m256i t0 = _mm256_set1_epi32(TRUE_VAL());
@@ -254,6 +330,7 @@ namespace SIMD {
             return (raw[0] ^ raw[1] ^ raw[2] ^ raw[3] ^ raw[4] ^ raw[5] ^ raw[6] ^ raw[7]) == TRUE_VAL();
         }
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint32_t, 16> :
@@ -175,6 +176,7 @@ namespace SIMD {
         // UTOF
         UME_FORCE_INLINE operator SIMDVec_f<float, 16>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint32_t, 4> :
@@ -157,8 +158,17 @@ namespace SIMD {
             return *this;
         }
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
             mVec = _mm_loadu_si128((__m128i*)p);
@@ -166,7 +176,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<4> const & mask, uint32_t const * p) {
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
+            __m128i t0 = _mm_castps_si128(_mm_maskload_ps((float const *)p, mask.mMask));
             mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
@@ -177,7 +187,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<4> const & mask, uint32_t const * p) {
-            __m128i t0 = _mm_load_si128((__m128i*)p);
+            __m128i t0 = _mm_castps_si128(_mm_maskload_ps((float const *)p, mask.mMask));
             mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
@@ -188,9 +198,7 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE uint32_t * store(SIMDVecMask<4> const & mask, uint32_t * p) const {
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m128i t1 = _mm_blendv_epi8(t0, mVec, mask.mMask);
-            _mm_storeu_si128((__m128i*) p, t1);
+            _mm_maskstore_ps((float *)p, mask.mMask, _mm_castsi128_ps(mVec));
             return p;
         }
         // STOREA
@@ -200,11 +208,18 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE uint32_t * storea(SIMDVecMask<4> const & mask, uint32_t * p) const {
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m128i t1 = _mm_blendv_epi8(t0, mVec, mask.mMask);
-            _mm_store_si128((__m128i*) p, t1);
+            _mm_maskstore_ps((float *)p, mask.mMask, _mm_castsi128_ps(mVec));
+            return p;
+        }
+        // SSTORE
+        UME_FORCE_INLINE uint32_t * sstore(uint32_t * p) const {
+            _mm_stream_si128((__m128i *)p, mVec);
             return p;
         }
+        // MSSTORE
+        UME_FORCE_INLINE uint32_t * sstore(SIMDVecMask<4> const & mask, uint32_t * p) const {
+            return storea(mask, p);
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m128i t0 = _mm_blendv_epi8(mVec, b.mVec, mask.mMask);
@@ -522,6 +537,11 @@ namespace SIMD {
             mVec = _mm_blendv_epi8(mVec, t1, mask.mMask);
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_u mulhi(SIMDVec_u const & b) const {
+            __m128i t0 = MulHighAVX::mulhiu32(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // DIVV
         // MDIVV
         // DIVS
@@ -530,6 +550,11 @@ namespace SIMD {
         // MDIVVA
         // DIVSA
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_u divide(SIMDDivider<uint32_t> const & divider) const {
+            __m128i t0 = DivideAVX::divu32(mVec, divider);
+            return SIMDVec_u(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1344,6 +1369,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -150,6 +150,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint32_t, 8> :
@@ -267,8 +268,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
@@ -277,7 +287,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<8> const & mask, uint32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask));
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -288,18 +298,30 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<8> const & mask, uint32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = _mm256_castps_si256(_mm256_maskload_ps((float const *)p, mask.mMask));
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
         // STORE
+        UME_FORCE_INLINE uint32_t * store(uint32_t * p) const {
+            _mm256_storeu_si256((__m256i*)p, mVec);
+            return p;
+        }
         // MSTORE
+        UME_FORCE_INLINE uint32_t * store(SIMDVecMask<8> const & mask, uint32_t * p) const {
+            _mm256_maskstore_ps((float *)p, mask.mMask, _mm256_castsi256_ps(mVec));
+            return p;
+        }
         // STOREA
-        /*UME_FORCE_INLINE uint32_t * storea(uint32_t * addrAligned) const {
-            _mm256_store_si256((__m256i*)addrAligned, mVec);
-            return addrAligned;
-        }*/
+        UME_FORCE_INLINE uint32_t * storea(uint32_t * p) const {
+            _mm256_store_si256((__m256i*)p, mVec);
+            return p;
+        }
         // MSTOREA
+        UME_FORCE_INLINE uint32_t * storea(SIMDVecMask<8> const & mask, uint32_t * p) const {
+            _mm256_maskstore_ps((float *)p, mask.mMask, _mm256_castsi256_ps(mVec));
+            return p;
+        }
         // BLENDV
         // BLENDS
         // SWIZZLE
@@ -597,6 +619,11 @@ namespace SIMD {
             mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, t0, mask.mMask, _mm_mullo_epi32);
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_u mulhi(SIMDVec_u const & b) const {
+            __m256i t0 = MulHighAVX::mulhiu32(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // DIVV
 
         UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
@@ -619,6 +646,11 @@ namespace SIMD {
             return diva(b);
         }
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_u divide(SIMDDivider<uint32_t> const & divider) const {
+            __m256i t0 = DivideAVX::divu32(mVec, divider);
+            return SIMDVec_u(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -886,16 +918,58 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            alignas(32) uint32_t raw[8];
-            _mm256_store_si256((__m256i *)raw, mVec);
-            for (unsigned int i = 0; i < 7; i++) {
-                for (unsigned int j = i + 1; j < 8; j++) {
-                    if (raw[i] == raw[j]) {
-                        return false;
-                    }
-                }
-            }
-            return true;
+            // Compare each half with its own rotations and the upper half
+            // with all four rotations of the lower half.
+            __m128i t0 = _mm256_extractf128_si256(mVec, 0);
+            __m128i t1 = _mm256_extractf128_si256(mVec, 1);
+            __m128i t2 = _mm_or_si128(
+                _mm_cmpeq_epi32(t0, _mm_shuffle_epi32(t0, _MM_SHUFFLE(2, 1, 0, 3))),
+                _mm_cmpeq_epi32(t0, _mm_shuffle_epi32(t0, _MM_SHUFFLE(1, 0, 3, 2))));
+            __m128i t3 = _mm_or_si128(
+                _mm_cmpeq_epi32(t1, _mm_shuffle_epi32(t1, _MM_SHUFFLE(2, 1, 0, 3))),
+                _mm_cmpeq_epi32(t1, _mm_shuffle_epi32(t1, _MM_SHUFFLE(1, 0, 3, 2))));
+            __m128i t4 = _mm_or_si128(
+                _mm_cmpeq_epi32(t1, t0),
+                _mm_cmpeq_epi32(t1, _mm_shuffle_epi32(t0, _MM_SHUFFLE(2, 1, 0, 3))));
+            __m128i t5 = _mm_or_si128(
+                _mm_cmpeq_epi32(t1, _mm_shuffle_epi32(t0, _MM_SHUFFLE(1, 0, 3, 2))),
+                _mm_cmpeq_epi32(t1, _mm_shuffle_epi32(t0, _MM_SHUFFLE(0, 3, 2, 1))));
+            __m128i t6 = _mm_or_si128(_mm_or_si128(t2, t3), _mm_or_si128(t4, t5));
+            return _mm_testz_si128(t6, t6) != 0;
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            __m128i t0 = _mm256_extractf128_si256(mVec, 0);
+            __m128i t1 = _mm256_extractf128_si256(mVec, 1);
+            __m128i t2 = _mm_shuffle_epi32(t0, _MM_SHUFFLE(2, 1, 0, 3));
+            __m128i t3 = _mm_shuffle_epi32(t0, _MM_SHUFFLE(1, 0, 3, 2));
+            __m128i t4 = _mm_shuffle_epi32(t0, _MM_SHUFFLE(0, 3, 2, 1));
+            __m128i t5 = _mm_shuffle_epi32(t1, _MM_SHUFFLE(2, 1, 0, 3));
+            __m128i t6 = _mm_shuffle_epi32(t1, _MM_SHUFFLE(1, 0, 3, 2));
+            __m128i t7 = _mm_shuffle_epi32(t1, _MM_SHUFFLE(0, 3, 2, 1));
+            // Lower half: conflicts within the half.
+            __m128i t8 = _mm_or_si128(
+                _mm_and_si128(_mm_cmpeq_epi32(t0, t2), _mm_setr_epi32(0, 1, 2, 4)),
+                _mm_or_si128(
+                    _mm_and_si128(_mm_cmpeq_epi32(t0, t3), _mm_setr_epi32(0, 0, 1, 2)),
+                    _mm_and_si128(_mm_cmpeq_epi32(t0, t4), _mm_setr_epi32(0, 0, 0, 1))));
+            // Upper half: conflicts within the half (bits 4-7) and with
+            // every element of the lower half (bits 0-3).
+            __m128i t9 = _mm_or_si128(
+                _mm_and_si128(_mm_cmpeq_epi32(t1, t5), _mm_setr_epi32(0, 0x10, 0x20, 0x40)),
+                _mm_or_si128(
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t6), _mm_setr_epi32(0, 0, 0x10, 0x20)),
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t7), _mm_setr_epi32(0, 0, 0, 0x10))));
+            __m128i t10 = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t0), _mm_setr_epi32(1, 2, 4, 8)),
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t2), _mm_setr_epi32(8, 1, 2, 4))),
+                _mm_or_si128(
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t3), _mm_setr_epi32(4, 8, 1, 2)),
+                    _mm_and_si128(_mm_cmpeq_epi32(t1, t4), _mm_setr_epi32(2, 4, 8, 1))));
+            __m256i t11 = _mm256_castsi128_si256(t8);
+            __m256i t12 = _mm256_insertf128_si256(t11, _mm_or_si128(t9, t10), 1);
+            return SIMDVec_u(t12);
         }
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
@@ -1833,6 +1907,7 @@ namespace SIMD {
 
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -40,6 +40,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
     // ********************************************************************************************
     // UNSIGNED INTEGER VECTORS
     // ********************************************************************************************
@@ -763,6 +764,7 @@ namespace SIMD {
         SIMDVec_u() {}
         ~SIMDVec_u() {}
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
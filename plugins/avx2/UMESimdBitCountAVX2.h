@@ -0,0 +1,170 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_BIT_COUNT_AVX2_H_
+#define UME_SIMD_BIT_COUNT_AVX2_H_
+
+#include <immintrin.h>
+#include "../../UMEBasicTypes.h"
+#include "../../UMEInline.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    // Per-lane POPCNT, LZCNT, TZCNT and BITREV of 256-bit integer vectors.
+    // AVX2 has no native instructions for these, so each byte is processed
+    // as two nibbles looked up in 16-entry tables with VPSHUFB, and the byte
+    // results are then combined into 16, 32 and 64-bit lanes.
+    class BitCountAVX2 {
+    private:
+        static UME_FORCE_INLINE __m256i loNibbles(__m256i const & x) {
+            return _mm256_and_si256(x, _mm256_set1_epi8(0x0F));
+        }
+        static UME_FORCE_INLINE __m256i hiNibbles(__m256i const & x) {
+            return _mm256_and_si256(_mm256_srli_epi16(x, 4), _mm256_set1_epi8(0x0F));
+        }
+    public:
+        // POPCNT
+        static UME_FORCE_INLINE __m256i popcnt8(__m256i const & x) {
+            __m256i t0 = _mm256_setr_epi8(
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            __m256i t1 = _mm256_shuffle_epi8(t0, loNibbles(x));
+            __m256i t2 = _mm256_shuffle_epi8(t0, hiNibbles(x));
+            return _mm256_add_epi8(t1, t2);
+        }
+        static UME_FORCE_INLINE __m256i popcnt16(__m256i const & x) {
+            __m256i t0 = popcnt8(x);
+            return _mm256_add_epi16(_mm256_and_si256(t0, _mm256_set1_epi16(0xFF)), _mm256_srli_epi16(t0, 8));
+        }
+        static UME_FORCE_INLINE __m256i popcnt32(__m256i const & x) {
+            __m256i t0 = _mm256_maddubs_epi16(popcnt8(x), _mm256_set1_epi8(1));
+            return _mm256_madd_epi16(t0, _mm256_set1_epi16(1));
+        }
+        static UME_FORCE_INLINE __m256i popcnt64(__m256i const & x) {
+            return _mm256_sad_epu8(popcnt8(x), _mm256_setzero_si256());
+        }
+
+        // LZCNT
+        // The count of a wider lane is the count of its upper half, plus the
+        // count of the lower half when the upper half is zero.
+        static UME_FORCE_INLINE __m256i lzcnt8(__m256i const & x) {
+            __m256i t0 = _mm256_setr_epi8(
+                4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+                4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0);
+            __m256i t1 = hiNibbles(x);
+            __m256i t2 = _mm256_shuffle_epi8(t0, t1);
+            __m256i t3 = _mm256_shuffle_epi8(t0, loNibbles(x));
+            __m256i t4 = _mm256_cmpeq_epi8(t1, _mm256_setzero_si256());
+            return _mm256_add_epi8(t2, _mm256_and_si256(t3, t4));
+        }
+        static UME_FORCE_INLINE __m256i lzcnt16(__m256i const & x) {
+            __m256i t0 = lzcnt8(x);
+            __m256i t1 = _mm256_srli_epi16(t0, 8);
+            __m256i t2 = _mm256_and_si256(t0, _mm256_set1_epi16(0xFF));
+            __m256i t3 = _mm256_cmpeq_epi16(t1, _mm256_set1_epi16(8));
+            return _mm256_add_epi16(t1, _mm256_and_si256(t2, t3));
+        }
+        static UME_FORCE_INLINE __m256i lzcnt32(__m256i const & x) {
+            __m256i t0 = lzcnt16(x);
+            __m256i t1 = _mm256_srli_epi32(t0, 16);
+            __m256i t2 = _mm256_and_si256(t0, _mm256_set1_epi32(0xFFFF));
+            __m256i t3 = _mm256_cmpeq_epi32(t1, _mm256_set1_epi32(16));
+            return _mm256_add_epi32(t1, _mm256_and_si256(t2, t3));
+        }
+        static UME_FORCE_INLINE __m256i lzcnt64(__m256i const & x) {
+            __m256i t0 = lzcnt32(x);
+            __m256i t1 = _mm256_srli_epi64(t0, 32);
+            __m256i t2 = _mm256_and_si256(t0, _mm256_set1_epi64x(0xFFFFFFFF));
+            __m256i t3 = _mm256_cmpeq_epi64(t1, _mm256_set1_epi64x(32));
+            return _mm256_add_epi64(t1, _mm256_and_si256(t2, t3));
+        }
+
+        // TZCNT
+        // Trailing zeros are the set bits of '~x & (x - 1)'.
+        static UME_FORCE_INLINE __m256i tzcnt8(__m256i const & x) {
+            __m256i t0 = _mm256_sub_epi8(x, _mm256_set1_epi8(1));
+            return popcnt8(_mm256_andnot_si256(x, t0));
+        }
+        static UME_FORCE_INLINE __m256i tzcnt16(__m256i const & x) {
+            __m256i t0 = _mm256_sub_epi16(x, _mm256_set1_epi16(1));
+            return popcnt16(_mm256_andnot_si256(x, t0));
+        }
+        static UME_FORCE_INLINE __m256i tzcnt32(__m256i const & x) {
+            __m256i t0 = _mm256_sub_epi32(x, _mm256_set1_epi32(1));
+            return popcnt32(_mm256_andnot_si256(x, t0));
+        }
+        static UME_FORCE_INLINE __m256i tzcnt64(__m256i const & x) {
+            __m256i t0 = _mm256_sub_epi64(x, _mm256_set1_epi64x(1));
+            return popcnt64(_mm256_andnot_si256(x, t0));
+        }
+
+        // BITREV
+        // Bits are reversed within each byte, then the bytes are reversed
+        // within each lane.
+        static UME_FORCE_INLINE __m256i bitrev8(__m256i const & x) {
+            __m256i t0 = _mm256_setr_epi8(
+                0x00, char(0x80), 0x40, char(0xC0), 0x20, char(0xA0), 0x60, char(0xE0),
+                0x10, char(0x90), 0x50, char(0xD0), 0x30, char(0xB0), 0x70, char(0xF0),
+                0x00, char(0x80), 0x40, char(0xC0), 0x20, char(0xA0), 0x60, char(0xE0),
+                0x10, char(0x90), 0x50, char(0xD0), 0x30, char(0xB0), 0x70, char(0xF0));
+            __m256i t1 = _mm256_setr_epi8(
+                0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15,
+                0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15);
+            __m256i t2 = _mm256_shuffle_epi8(t0, loNibbles(x));
+            __m256i t3 = _mm256_shuffle_epi8(t1, hiNibbles(x));
+            return _mm256_or_si256(t2, t3);
+        }
+        static UME_FORCE_INLINE __m256i bitrev16(__m256i const & x) {
+            __m256i t0 = _mm256_setr_epi8(
+                1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+            return _mm256_shuffle_epi8(bitrev8(x), t0);
+        }
+        static UME_FORCE_INLINE __m256i bitrev32(__m256i const & x) {
+            __m256i t0 = _mm256_setr_epi8(
+                3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+            return _mm256_shuffle_epi8(bitrev8(x), t0);
+        }
+        static UME_FORCE_INLINE __m256i bitrev64(__m256i const & x) {
+            __m256i t0 = _mm256_setr_epi8(
+                7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+            return _mm256_shuffle_epi8(bitrev8(x), t0);
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
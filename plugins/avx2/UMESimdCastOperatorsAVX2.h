@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
     // Operators for non-specialized types require 'template<>' syntax.
     // Compliant compiler will not accept this syntax for non-specialized
     // types, so make sure only proper definitions have it.
@@ -67,9 +68,8 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 16>, int8_t, SIMDVec_u<uint8_t, 16>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 32>, int8_t, SIMDVec_u<uint8_t, 32>>(*this);
+        return SIMDVec_i<int8_t, 32>(mVec);
     }
 
     template<>
@@ -102,9 +102,8 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 8>, int16_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_u<uint16_t, 16>>(*this);
+        return SIMDVec_i<int16_t, 16>(mVec);
     }
 
     template<>
@@ -254,9 +253,8 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 16>, uint8_t, SIMDVec_i<int8_t, 16>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 32>, uint8_t, SIMDVec_i<int8_t, 32>>(*this);
+        return SIMDVec_u<uint8_t, 32>(mVec);
     }
 
     template<>
@@ -289,9 +287,8 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 8>, uint16_t, SIMDVec_i<int16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_i<int16_t, 16>>(*this);
+        return SIMDVec_u<uint16_t, 16>(mVec);
     }
 
     template<>
@@ -480,7 +477,7 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_f<float, 4>::operator SIMDVec_i<int32_t, 4>() const {
-        __m128i t0 = _mm_cvtps_epi32(mVec);
+        __m128i t0 = _mm_cvttps_epi32(mVec);
         return SIMDVec_i<int32_t, 4>(t0);
     }
 
@@ -612,7 +609,6 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_u<uint8_t, 16>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 32>, uint16_t, SIMDVec_u<uint8_t, 32>>(*this);
     }
@@ -642,9 +638,10 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 8>, uint32_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint32_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 16>, uint32_t, SIMDVec_u<uint16_t, 16>>(*this);
+        __m256i t0 = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(mVec));
+        __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 1));
+        return SIMDVec_u<uint32_t, 16>(t0, t1);
     }
 
     template<>
@@ -697,7 +694,6 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_i<int8_t, 16>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 32>, int16_t, SIMDVec_i<int8_t, 32>>(*this);
     }
@@ -727,9 +723,10 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 8>, int32_t, SIMDVec_i<int16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int32_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 16>, int32_t, SIMDVec_i<int16_t, 16>>(*this);
+        __m256i t0 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(mVec));
+        __m256i t1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 1));
+        return SIMDVec_i<int32_t, 16>(t0, t1);
     }
 
     template<>
@@ -797,9 +794,14 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 8>, uint8_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 16>, uint8_t, SIMDVec_u<uint16_t, 16>>(*this);
+        // Truncate to the low byte and pack both 128-bit lanes into the low half.
+        __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi16(0x00FF));
+        __m256i t1 = _mm256_packus_epi16(t0, t0);
+        __m256i t2 = _mm256_permute4x64_epi64(t1, 0x08);
+        alignas(32) uint8_t raw[16];
+        _mm_store_si128((__m128i*)raw, _mm256_castsi256_si128(t2));
+        return SIMDVec_u<uint8_t, 16>(raw);
     }
 
     template<>
@@ -829,7 +831,12 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_u<uint32_t, 16>>(*this);
+        // Truncate to the low word and pack, then restore the lane order.
+        __m256i t0 = _mm256_and_si256(mVec[0], _mm256_set1_epi32(0x0000FFFF));
+        __m256i t1 = _mm256_and_si256(mVec[1], _mm256_set1_epi32(0x0000FFFF));
+        __m256i t2 = _mm256_packus_epi32(t0, t1);
+        __m256i t3 = _mm256_permute4x64_epi64(t2, 0xD8);
+        return SIMDVec_u<uint16_t, 16>(t3);
     }
 
     template<>
@@ -878,9 +885,14 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 8>, int8_t, SIMDVec_i<int16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 16>, int8_t, SIMDVec_i<int16_t, 16>>(*this);
+        // Truncate to the low byte and pack both 128-bit lanes into the low half.
+        __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi16(0x00FF));
+        __m256i t1 = _mm256_packus_epi16(t0, t0);
+        __m256i t2 = _mm256_permute4x64_epi64(t1, 0x08);
+        alignas(32) int8_t raw[16];
+        _mm_store_si128((__m128i*)raw, _mm256_castsi256_si128(t2));
+        return SIMDVec_i<int8_t, 16>(raw);
     }
 
     template<>
@@ -910,7 +922,12 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_i<int32_t, 16>>(*this);
+        // Truncate to the low word and pack, then restore the lane order.
+        __m256i t0 = _mm256_and_si256(mVec[0], _mm256_set1_epi32(0x0000FFFF));
+        __m256i t1 = _mm256_and_si256(mVec[1], _mm256_set1_epi32(0x0000FFFF));
+        __m256i t2 = _mm256_packus_epi32(t0, t1);
+        __m256i t3 = _mm256_permute4x64_epi64(t2, 0xD8);
+        return SIMDVec_i<int16_t, 16>(t3);
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
@@ -957,6 +974,7 @@ namespace SIMD {
     UME_FORCE_INLINE SIMDVec_f<double, 16>::operator SIMDVec_f<float, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_f<float, 16>, float, SIMDVec_f<double, 16>>(*this);
     }
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -0,0 +1,161 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_COMPRESS_TABLE_AVX2_H_
+#define UME_SIMD_COMPRESS_TABLE_AVX2_H_
+
+#include <immintrin.h>
+#include "../../UMEBasicTypes.h"
+#include "../../UMEInline.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    // Lookup tables used by COMPRESS, COMPRESSSTORE and EXPANDLOAD of 256-bit
+    // vectors. An entry describes one mask value: bits 0-23 hold eight 3-bit
+    // indices for _mm256_permutevar8x32, bits 24-27 the number of 32-bit
+    // elements read or written and bits 28-31 the number of vector elements.
+    // 64-bit elements are moved as pairs of 32-bit elements.
+    class CompressTableAVX2 {
+    public:
+        // Moves the 32-bit elements selected by 'bits' to the front.
+        static UME_FORCE_INLINE uint32_t compress8(int bits) {
+            static const uint32_t table[256] = {
+                0x00000000, 0x11000000, 0x11000001, 0x22000008, 0x11000002, 0x22000010, 0x22000011, 0x33000088,
+                0x11000003, 0x22000018, 0x22000019, 0x330000C8, 0x2200001A, 0x330000D0, 0x330000D1, 0x44000688,
+                0x11000004, 0x22000020, 0x22000021, 0x33000108, 0x22000022, 0x33000110, 0x33000111, 0x44000888,
+                0x22000023, 0x33000118, 0x33000119, 0x440008C8, 0x3300011A, 0x440008D0, 0x440008D1, 0x55004688,
+                0x11000005, 0x22000028, 0x22000029, 0x33000148, 0x2200002A, 0x33000150, 0x33000151, 0x44000A88,
+                0x2200002B, 0x33000158, 0x33000159, 0x44000AC8, 0x3300015A, 0x44000AD0, 0x44000AD1, 0x55005688,
+                0x2200002C, 0x33000160, 0x33000161, 0x44000B08, 0x33000162, 0x44000B10, 0x44000B11, 0x55005888,
+                0x33000163, 0x44000B18, 0x44000B19, 0x550058C8, 0x44000B1A, 0x550058D0, 0x550058D1, 0x6602C688,
+                0x11000006, 0x22000030, 0x22000031, 0x33000188, 0x22000032, 0x33000190, 0x33000191, 0x44000C88,
+                0x22000033, 0x33000198, 0x33000199, 0x44000CC8, 0x3300019A, 0x44000CD0, 0x44000CD1, 0x55006688,
+                0x22000034, 0x330001A0, 0x330001A1, 0x44000D08, 0x330001A2, 0x44000D10, 0x44000D11, 0x55006888,
+                0x330001A3, 0x44000D18, 0x44000D19, 0x550068C8, 0x44000D1A, 0x550068D0, 0x550068D1, 0x66034688,
+                0x22000035, 0x330001A8, 0x330001A9, 0x44000D48, 0x330001AA, 0x44000D50, 0x44000D51, 0x55006A88,
+                0x330001AB, 0x44000D58, 0x44000D59, 0x55006AC8, 0x44000D5A, 0x55006AD0, 0x55006AD1, 0x66035688,
+                0x330001AC, 0x44000D60, 0x44000D61, 0x55006B08, 0x44000D62, 0x55006B10, 0x55006B11, 0x66035888,
+                0x44000D63, 0x55006B18, 0x55006B19, 0x660358C8, 0x55006B1A, 0x660358D0, 0x660358D1, 0x771AC688,
+                0x11000007, 0x22000038, 0x22000039, 0x330001C8, 0x2200003A, 0x330001D0, 0x330001D1, 0x44000E88,
+                0x2200003B, 0x330001D8, 0x330001D9, 0x44000EC8, 0x330001DA, 0x44000ED0, 0x44000ED1, 0x55007688,
+                0x2200003C, 0x330001E0, 0x330001E1, 0x44000F08, 0x330001E2, 0x44000F10, 0x44000F11, 0x55007888,
+                0x330001E3, 0x44000F18, 0x44000F19, 0x550078C8, 0x44000F1A, 0x550078D0, 0x550078D1, 0x6603C688,
+                0x2200003D, 0x330001E8, 0x330001E9, 0x44000F48, 0x330001EA, 0x44000F50, 0x44000F51, 0x55007A88,
+                0x330001EB, 0x44000F58, 0x44000F59, 0x55007AC8, 0x44000F5A, 0x55007AD0, 0x55007AD1, 0x6603D688,
+                0x330001EC, 0x44000F60, 0x44000F61, 0x55007B08, 0x44000F62, 0x55007B10, 0x55007B11, 0x6603D888,
+                0x44000F63, 0x55007B18, 0x55007B19, 0x6603D8C8, 0x55007B1A, 0x6603D8D0, 0x6603D8D1, 0x771EC688,
+                0x2200003E, 0x330001F0, 0x330001F1, 0x44000F88, 0x330001F2, 0x44000F90, 0x44000F91, 0x55007C88,
+                0x330001F3, 0x44000F98, 0x44000F99, 0x55007CC8, 0x44000F9A, 0x55007CD0, 0x55007CD1, 0x6603E688,
+                0x330001F4, 0x44000FA0, 0x44000FA1, 0x55007D08, 0x44000FA2, 0x55007D10, 0x55007D11, 0x6603E888,
+                0x44000FA3, 0x55007D18, 0x55007D19, 0x6603E8C8, 0x55007D1A, 0x6603E8D0, 0x6603E8D1, 0x771F4688,
+                0x330001F5, 0x44000FA8, 0x44000FA9, 0x55007D48, 0x44000FAA, 0x55007D50, 0x55007D51, 0x6603EA88,
+                0x44000FAB, 0x55007D58, 0x55007D59, 0x6603EAC8, 0x55007D5A, 0x6603EAD0, 0x6603EAD1, 0x771F5688,
+                0x44000FAC, 0x55007D60, 0x55007D61, 0x6603EB08, 0x55007D62, 0x6603EB10, 0x6603EB11, 0x771F5888,
+                0x55007D63, 0x6603EB18, 0x6603EB19, 0x771F58C8, 0x6603EB1A, 0x771F58D0, 0x771F58D1, 0x88FAC688
+            };
+            return table[bits];
+        }
+        // Moves the leading 32-bit elements to the positions selected by 'bits'.
+        static UME_FORCE_INLINE uint32_t expand8(int bits) {
+            static const uint32_t table[256] = {
+                0x00000000, 0x11000000, 0x11000000, 0x22000008, 0x11000000, 0x22000040, 0x22000040, 0x33000088,
+                0x11000000, 0x22000200, 0x22000200, 0x33000408, 0x22000200, 0x33000440, 0x33000440, 0x44000688,
+                0x11000000, 0x22001000, 0x22001000, 0x33002008, 0x22001000, 0x33002040, 0x33002040, 0x44003088,
+                0x22001000, 0x33002200, 0x33002200, 0x44003408, 0x33002200, 0x44003440, 0x44003440, 0x55004688,
+                0x11000000, 0x22008000, 0x22008000, 0x33010008, 0x22008000, 0x33010040, 0x33010040, 0x44018088,
+                0x22008000, 0x33010200, 0x33010200, 0x44018408, 0x33010200, 0x44018440, 0x44018440, 0x55020688,
+                0x22008000, 0x33011000, 0x33011000, 0x4401A008, 0x33011000, 0x4401A040, 0x4401A040, 0x55023088,
+                0x33011000, 0x4401A200, 0x4401A200, 0x55023408, 0x4401A200, 0x55023440, 0x55023440, 0x6602C688,
+                0x11000000, 0x22040000, 0x22040000, 0x33080008, 0x22040000, 0x33080040, 0x33080040, 0x440C0088,
+                0x22040000, 0x33080200, 0x33080200, 0x440C0408, 0x33080200, 0x440C0440, 0x440C0440, 0x55100688,
+                0x22040000, 0x33081000, 0x33081000, 0x440C2008, 0x33081000, 0x440C2040, 0x440C2040, 0x55103088,
+                0x33081000, 0x440C2200, 0x440C2200, 0x55103408, 0x440C2200, 0x55103440, 0x55103440, 0x66144688,
+                0x22040000, 0x33088000, 0x33088000, 0x440D0008, 0x33088000, 0x440D0040, 0x440D0040, 0x55118088,
+                0x33088000, 0x440D0200, 0x440D0200, 0x55118408, 0x440D0200, 0x55118440, 0x55118440, 0x66160688,
+                0x33088000, 0x440D1000, 0x440D1000, 0x5511A008, 0x440D1000, 0x5511A040, 0x5511A040, 0x66163088,
+                0x440D1000, 0x5511A200, 0x5511A200, 0x66163408, 0x5511A200, 0x66163440, 0x66163440, 0x771AC688,
+                0x11000000, 0x22200000, 0x22200000, 0x33400008, 0x22200000, 0x33400040, 0x33400040, 0x44600088,
+                0x22200000, 0x33400200, 0x33400200, 0x44600408, 0x33400200, 0x44600440, 0x44600440, 0x55800688,
+                0x22200000, 0x33401000, 0x33401000, 0x44602008, 0x33401000, 0x44602040, 0x44602040, 0x55803088,
+                0x33401000, 0x44602200, 0x44602200, 0x55803408, 0x44602200, 0x55803440, 0x55803440, 0x66A04688,
+                0x22200000, 0x33408000, 0x33408000, 0x44610008, 0x33408000, 0x44610040, 0x44610040, 0x55818088,
+                0x33408000, 0x44610200, 0x44610200, 0x55818408, 0x44610200, 0x55818440, 0x55818440, 0x66A20688,
+                0x33408000, 0x44611000, 0x44611000, 0x5581A008, 0x44611000, 0x5581A040, 0x5581A040, 0x66A23088,
+                0x44611000, 0x5581A200, 0x5581A200, 0x66A23408, 0x5581A200, 0x66A23440, 0x66A23440, 0x77C2C688,
+                0x22200000, 0x33440000, 0x33440000, 0x44680008, 0x33440000, 0x44680040, 0x44680040, 0x558C0088,
+                0x33440000, 0x44680200, 0x44680200, 0x558C0408, 0x44680200, 0x558C0440, 0x558C0440, 0x66B00688,
+                0x33440000, 0x44681000, 0x44681000, 0x558C2008, 0x44681000, 0x558C2040, 0x558C2040, 0x66B03088,
+                0x44681000, 0x558C2200, 0x558C2200, 0x66B03408, 0x558C2200, 0x66B03440, 0x66B03440, 0x77D44688,
+                0x33440000, 0x44688000, 0x44688000, 0x558D0008, 0x44688000, 0x558D0040, 0x558D0040, 0x66B18088,
+                0x44688000, 0x558D0200, 0x558D0200, 0x66B18408, 0x558D0200, 0x66B18440, 0x66B18440, 0x77D60688,
+                0x44688000, 0x558D1000, 0x558D1000, 0x66B1A008, 0x558D1000, 0x66B1A040, 0x66B1A040, 0x77D63088,
+                0x558D1000, 0x66B1A200, 0x66B1A200, 0x77D63408, 0x66B1A200, 0x77D63440, 0x77D63440, 0x88FAC688
+            };
+            return table[bits];
+        }
+        // Moves the 64-bit elements selected by 'bits' to the front.
+        static UME_FORCE_INLINE uint32_t compress4x64(int bits) {
+            static const uint32_t table[16] = {
+                0x00208208, 0x12208208, 0x1220821A, 0x24208688, 0x1220822C, 0x24208B08, 0x24208B1A, 0x3622C688,
+                0x1220823E, 0x24208F88, 0x24208F9A, 0x3623E688, 0x24208FAC, 0x3623EB08, 0x3623EB1A, 0x48FAC688
+            };
+            return table[bits];
+        }
+        // Moves the leading 64-bit elements to the positions selected by 'bits'.
+        static UME_FORCE_INLINE uint32_t expand4x64(int bits) {
+            static const uint32_t table[16] = {
+                0x00208208, 0x12208208, 0x12208208, 0x24208688, 0x12208208, 0x2421A208, 0x2421A208, 0x3622C688,
+                0x12208208, 0x24688208, 0x24688208, 0x36B08688, 0x24688208, 0x36B1A208, 0x36B1A208, 0x48FAC688
+            };
+            return table[bits];
+        }
+        // Permutation indices of an entry.
+        static UME_FORCE_INLINE __m256i index(uint32_t entry) {
+            __m256i t0 = _mm256_srlv_epi32(_mm256_set1_epi32(int(entry)), _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21));
+            return _mm256_and_si256(t0, _mm256_set1_epi32(7));
+        }
+        // Mask of the 32-bit elements read or written.
+        static UME_FORCE_INLINE __m256i prefix(uint32_t entry) {
+            __m256i t0 = _mm256_set1_epi32(int((entry >> 24) & 0xF));
+            return _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        }
+        // Number of vector elements read or written.
+        static UME_FORCE_INLINE uint32_t count(uint32_t entry) {
+            return entry >> 28;
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
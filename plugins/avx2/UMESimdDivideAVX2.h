@@ -0,0 +1,152 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+#ifndef UME_SIMD_DIVIDE_AVX2_H_
+#define UME_SIMD_DIVIDE_AVX2_H_
+
+#include <immintrin.h>
+#include "../../UMEBasicTypes.h"
+#include "../../UMEInline.h"
+#include "../../UMESimdDivider.h"
+#include "UMESimdMulHighAVX2.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    // Division of integer vectors by a SIMDDivider (see UMESimdDivider.h for
+    // the method). The high-half products come from MulHighAVX2, except for
+    // 8-bit elements which are divided in 16-bit halves.
+    class DivideAVX2 {
+    private:
+        static UME_FORCE_INLINE __m128i count(uint32_t n) {
+            return _mm_cvtsi32_si128(int(n));
+        }
+
+        // Arithmetic right shift of 64-bit elements.
+        static UME_FORCE_INLINE __m256i srai64(__m256i const & a, __m128i const & n) {
+            __m256i t0 = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+            return _mm256_xor_si256(_mm256_srl_epi64(_mm256_xor_si256(a, t0), n), t0);
+        }
+
+    public:
+        // 8-bit elements, computed in 16-bit halves.
+        static UME_FORCE_INLINE __m256i divu8(__m256i const & x, SIMDDivider<uint8_t> const & d) {
+            __m256i t0 = _mm256_set1_epi16(d.magic());
+            __m256i t1 = _mm256_unpacklo_epi8(x, _mm256_setzero_si256());
+            __m256i t2 = _mm256_unpackhi_epi8(x, _mm256_setzero_si256());
+            __m256i t3 = _mm256_srli_epi16(_mm256_mullo_epi16(t1, t0), 8);
+            __m256i t4 = _mm256_srli_epi16(_mm256_mullo_epi16(t2, t0), 8);
+            __m256i t5 = _mm256_add_epi16(_mm256_srl_epi16(_mm256_sub_epi16(t1, t3), count(d.shift1())), t3);
+            __m256i t6 = _mm256_add_epi16(_mm256_srl_epi16(_mm256_sub_epi16(t2, t4), count(d.shift1())), t4);
+            __m256i t7 = _mm256_srl_epi16(t5, count(d.shift2()));
+            __m256i t8 = _mm256_srl_epi16(t6, count(d.shift2()));
+            return _mm256_packus_epi16(t7, t8);
+        }
+        static UME_FORCE_INLINE __m256i divs8(__m256i const & x, SIMDDivider<int8_t> const & d) {
+            // Sign extended halves: the byte goes to the upper half of a
+            // 16-bit element, then is shifted back arithmetically.
+            __m256i t0 = _mm256_set1_epi16(d.magic());
+            __m256i t1 = _mm256_srai_epi16(_mm256_unpacklo_epi8(_mm256_setzero_si256(), x), 8);
+            __m256i t2 = _mm256_srai_epi16(_mm256_unpackhi_epi8(_mm256_setzero_si256(), x), 8);
+            __m256i t3 = _mm256_srai_epi16(_mm256_mullo_epi16(t1, t0), 8);
+            __m256i t4 = _mm256_srai_epi16(_mm256_mullo_epi16(t2, t0), 8);
+            // In 16-bit precision x + mulhi is exact, which is the value
+            // the method is derived from.
+            __m256i t5 = _mm256_sra_epi16(_mm256_add_epi16(t1, t3), count(d.shift2()));
+            __m256i t6 = _mm256_sra_epi16(_mm256_add_epi16(t2, t4), count(d.shift2()));
+            t5 = _mm256_sub_epi16(t5, _mm256_srai_epi16(t1, 15));
+            t6 = _mm256_sub_epi16(t6, _mm256_srai_epi16(t2, 15));
+            __m256i t7 = _mm256_set1_epi16(d.sign());
+            t5 = _mm256_sub_epi16(_mm256_xor_si256(t5, t7), t7);
+            t6 = _mm256_sub_epi16(_mm256_xor_si256(t6, t7), t7);
+            // Keep the low byte, as the wrapping 8-bit computation does.
+            __m256i t8 = _mm256_set1_epi16(0xFF);
+            return _mm256_packus_epi16(_mm256_and_si256(t5, t8), _mm256_and_si256(t6, t8));
+        }
+
+        // 16-bit elements
+        static UME_FORCE_INLINE __m256i divu16(__m256i const & x, SIMDDivider<uint16_t> const & d) {
+            __m256i t0 = _mm256_mulhi_epu16(x, _mm256_set1_epi16(d.magic()));
+            __m256i t1 = _mm256_add_epi16(_mm256_srl_epi16(_mm256_sub_epi16(x, t0), count(d.shift1())), t0);
+            return _mm256_srl_epi16(t1, count(d.shift2()));
+        }
+        static UME_FORCE_INLINE __m256i divs16(__m256i const & x, SIMDDivider<int16_t> const & d) {
+            __m256i t0 = _mm256_add_epi16(x, _mm256_mulhi_epi16(x, _mm256_set1_epi16(d.magic())));
+            __m256i t1 = _mm256_sub_epi16(_mm256_sra_epi16(t0, count(d.shift2())), _mm256_srai_epi16(x, 15));
+            __m256i t2 = _mm256_set1_epi16(d.sign());
+            return _mm256_sub_epi16(_mm256_xor_si256(t1, t2), t2);
+        }
+
+        // 32-bit elements
+        static UME_FORCE_INLINE __m256i divu32(__m256i const & x, SIMDDivider<uint32_t> const & d) {
+            __m256i t0 = MulHighAVX2::mulhiu32(x, _mm256_set1_epi32(d.magic()));
+            __m256i t1 = _mm256_add_epi32(_mm256_srl_epi32(_mm256_sub_epi32(x, t0), count(d.shift1())), t0);
+            return _mm256_srl_epi32(t1, count(d.shift2()));
+        }
+        static UME_FORCE_INLINE __m256i divs32(__m256i const & x, SIMDDivider<int32_t> const & d) {
+            __m256i t0 = _mm256_add_epi32(x, MulHighAVX2::mulhis32(x, _mm256_set1_epi32(d.magic())));
+            __m256i t1 = _mm256_sub_epi32(_mm256_sra_epi32(t0, count(d.shift2())), _mm256_srai_epi32(x, 31));
+            __m256i t2 = _mm256_set1_epi32(d.sign());
+            return _mm256_sub_epi32(_mm256_xor_si256(t1, t2), t2);
+        }
+        static UME_FORCE_INLINE __m128i divu32(__m128i const & x, SIMDDivider<uint32_t> const & d) {
+            __m128i t0 = MulHighAVX2::mulhiu32(x, _mm_set1_epi32(d.magic()));
+            __m128i t1 = _mm_add_epi32(_mm_srl_epi32(_mm_sub_epi32(x, t0), count(d.shift1())), t0);
+            return _mm_srl_epi32(t1, count(d.shift2()));
+        }
+        static UME_FORCE_INLINE __m128i divs32(__m128i const & x, SIMDDivider<int32_t> const & d) {
+            __m128i t0 = _mm_add_epi32(x, MulHighAVX2::mulhis32(x, _mm_set1_epi32(d.magic())));
+            __m128i t1 = _mm_sub_epi32(_mm_sra_epi32(t0, count(d.shift2())), _mm_srai_epi32(x, 31));
+            __m128i t2 = _mm_set1_epi32(d.sign());
+            return _mm_sub_epi32(_mm_xor_si128(t1, t2), t2);
+        }
+
+        // 64-bit elements
+        static UME_FORCE_INLINE __m256i divu64(__m256i const & x, SIMDDivider<uint64_t> const & d) {
+            __m256i t0 = MulHighAVX2::mulhiu64(x, _mm256_set1_epi64x(d.magic()));
+            __m256i t1 = _mm256_add_epi64(_mm256_srl_epi64(_mm256_sub_epi64(x, t0), count(d.shift1())), t0);
+            return _mm256_srl_epi64(t1, count(d.shift2()));
+        }
+        static UME_FORCE_INLINE __m256i divs64(__m256i const & x, SIMDDivider<int64_t> const & d) {
+            __m256i t0 = _mm256_add_epi64(x, MulHighAVX2::mulhis64(x, _mm256_set1_epi64x(d.magic())));
+            __m256i t1 = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+            __m256i t2 = _mm256_sub_epi64(srai64(t0, count(d.shift2())), t1);
+            __m256i t3 = _mm256_set1_epi64x(d.sign());
+            return _mm256_sub_epi64(_mm256_xor_si256(t2, t3), t3);
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
@@ -37,6 +37,10 @@
 
 #include "UMESimdMaskAVX2.h"
 #include "UMESimdSwizzleAVX2.h"
+#include "UMESimdCompressTableAVX2.h"
+#include "UMESimdBitCountAVX2.h"
+#include "UMESimdMulHighAVX2.h"
+#include "UMESimdDivideAVX2.h"
 
 // ********************************************************************************************
 // UNSIGNED INTEGER VECTOR TEMPLATE
@@ -46,6 +50,10 @@
 // ********************************************************************************************
 // UNSIGNED INTEGER VECTOR SPECIALIZATIONS
 // ********************************************************************************************
+#include "uint/UMESimdVecUint8_32.h"
+
+#include "uint/UMESimdVecUint16_16.h"
+
 #include "uint/UMESimdVecUint32_1.h"
 #include "uint/UMESimdVecUint32_2.h"
 #include "uint/UMESimdVecUint32_4.h"
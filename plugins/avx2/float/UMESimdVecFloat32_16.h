@@ -40,6 +40,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<float, 16> :
@@ -181,8 +182,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -192,8 +202,8 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<16> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m256 t1 = _mm256_loadu_ps(p + 8);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
             mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
@@ -206,8 +216,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<16> const & mask, float const * p) {
-            __m256 t0 = _mm256_load_ps(p);
-            __m256 t1 = _mm256_load_ps(p + 8);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask[0]);
+            __m256 t1 = _mm256_maskload_ps(p + 8, mask.mMask[1]);
             mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
             mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
             return *this;
@@ -263,15 +273,7 @@ namespace SIMD {
         }
         // MSSTORE
         UME_FORCE_INLINE float* sstore(SIMDVecMask<16> const & mask, float* p) const {
-            __m256i t0 = _mm256_stream_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_stream_load_si256((__m256i*)(p + 8));
-            __m256 t2 = _mm256_castsi256_ps(t0);
-            __m256 t3 = _mm256_castsi256_ps(t1);
-            __m256 t4 = BLEND(t2, mVec[0], mask.mMask[0]);
-            __m256 t5 = BLEND(t3, mVec[1], mask.mMask[1]);
-            _mm256_stream_ps(p, t4);
-            _mm256_stream_ps(p + 8, t5);
-            return p;
+            return storea(mask, p);
         }
 
         // BLENDV
@@ -288,6 +290,34 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint32_t, 16> const & indices) const {
+            __m256 t0 = permute16(mVec[0], mVec[1], indices.mVec[0]);
+            __m256 t1 = permute16(mVec[0], mVec[1], indices.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint32_t, 16> const & indices) const {
+            // Bit 4 of the index selects the source vector.
+            __m256 t0 = _mm256_castsi256_ps(_mm256_slli_epi32(indices.mVec[0], 27));
+            __m256 t1 = _mm256_castsi256_ps(_mm256_slli_epi32(indices.mVec[1], 27));
+            __m256 t2 = permute16(mVec[0], mVec[1], indices.mVec[0]);
+            __m256 t3 = permute16(b.mVec[0], b.mVec[1], indices.mVec[0]);
+            __m256 t4 = permute16(mVec[0], mVec[1], indices.mVec[1]);
+            __m256 t5 = permute16(b.mVec[0], b.mVec[1], indices.mVec[1]);
+            __m256 t6 = _mm256_blendv_ps(t2, t3, t0);
+            __m256 t7 = _mm256_blendv_ps(t4, t5, t1);
+            return SIMDVec_f(t6, t7);
+        }
+    private:
+        // Select element (idx % 16) of the 16-element vector held in (lo, hi).
+        UME_FORCE_INLINE static __m256 permute16(__m256 const & lo, __m256 const & hi, __m256i const & idx) {
+            __m256 t0 = _mm256_permutevar8x32_ps(lo, idx);
+            __m256 t1 = _mm256_permutevar8x32_ps(hi, idx);
+            __m256 t2 = _mm256_castsi256_ps(_mm256_slli_epi32(idx, 28));
+            return _mm256_blendv_ps(t0, t1, t2);
+        }
+    public:
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
@@ -944,16 +974,23 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            /* alignas(32) int32_t raw[8];
-            _mm256_store_si256((__m256i *)raw, mVec);
-            for (unsigned int i = 0; i < 7; i++) {
-            for (unsigned int j = i + 1; j < 8; j++) {
-            if (raw[i] == raw[j]) {
-            return false;
+            // Pairs inside a half are covered by 4 rotations of that half,
+            // pairs across the halves by all 8 rotations of the upper half.
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256 t1 = _mm256_setzero_ps();
+            for (int k = 1; k <= 4; k++) {
+                __m256i t2 = _mm256_sub_epi32(t0, _mm256_set1_epi32(k));
+                __m256 t3 = _mm256_permutevar8x32_ps(mVec[0], t2);
+                __m256 t4 = _mm256_permutevar8x32_ps(mVec[1], t2);
+                t1 = _mm256_or_ps(t1, _mm256_cmp_ps(mVec[0], t3, _CMP_EQ_OQ));
+                t1 = _mm256_or_ps(t1, _mm256_cmp_ps(mVec[1], t4, _CMP_EQ_OQ));
             }
+            for (int k = 0; k < 8; k++) {
+                __m256i t5 = _mm256_sub_epi32(t0, _mm256_set1_epi32(k));
+                __m256 t6 = _mm256_permutevar8x32_ps(mVec[1], t5);
+                t1 = _mm256_or_ps(t1, _mm256_cmp_ps(mVec[0], t6, _CMP_EQ_OQ));
             }
-            }*/
-            return true;
+            return _mm256_movemask_ps(t1) == 0;
         }
         // HADD
         UME_FORCE_INLINE float hadd() const {
@@ -1574,9 +1611,34 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<16> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float, SIMDVecMask<16>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, float>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec[0], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -1648,12 +1710,92 @@ namespace SIMD {
             __m256 t1 = _mm256_exp_ps(mVec[1]);
             return SIMDVec_f(t0, t1);
 #else
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, DEFAULT_PRECISION>(*this);
 #endif
         }
         // MEXP
         UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<16> const & mask) const {
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this);
+        }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
         }
         // LOG
         // MLOG
@@ -1710,6 +1852,7 @@ namespace SIMD {
         // FTOI
         UME_FORCE_INLINE operator SIMDVec_i<int32_t, 16>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -40,6 +40,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<> class SIMDVec_f<double, 8>;
 
@@ -162,8 +163,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(float const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
@@ -172,7 +182,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<8> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -183,7 +193,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<8> const & mask, float const * p) {
-            __m256 t0 = _mm256_load_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -228,11 +238,29 @@ namespace SIMD {
         }
         // MSSTORE
         UME_FORCE_INLINE float* sstore(SIMDVecMask<8> const & mask, float* p) const {
-            __m256i t0 = _mm256_stream_load_si256((__m256i*)p);
-            __m256 t1 = _mm256_castsi256_ps(t0);
-            __m256 t2 = BLEND(t1, mVec, mask.mMask);
-            _mm256_stream_ps(p, t2);
-            return p;
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<8> const & mask) const {
+            uint32_t t0 = CompressTableAVX2::compress8(_mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+            __m256 t1 = _mm256_permutevar8x32_ps(mVec, CompressTableAVX2::index(t0));
+            __m256 t2 = _mm256_and_ps(t1, _mm256_castsi256_ps(CompressTableAVX2::prefix(t0)));
+            return SIMDVec_f(t2);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, float * p) const {
+            uint32_t t0 = CompressTableAVX2::compress8(_mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+            __m256 t1 = _mm256_permutevar8x32_ps(mVec, CompressTableAVX2::index(t0));
+            _mm256_maskstore_ps(p, CompressTableAVX2::prefix(t0), t1);
+            return CompressTableAVX2::count(t0);
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<8> const & mask, float const * p) {
+            uint32_t t0 = CompressTableAVX2::expand8(_mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+            __m256 t1 = _mm256_maskload_ps(p, CompressTableAVX2::prefix(t0));
+            __m256 t2 = _mm256_permutevar8x32_ps(t1, CompressTableAVX2::index(t0));
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return CompressTableAVX2::count(t0);
         }
 
         // BLENDV
@@ -247,6 +275,114 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint32_t, 8> const & indices) const {
+            __m256 t0 = _mm256_permutevar8x32_ps(mVec, indices.mVec);
+            return SIMDVec_f(t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint32_t, 8> const & indices) const {
+            // Bit 3 of the index selects the source, shift it into the sign bit for blendv.
+            __m256 t0 = _mm256_permutevar8x32_ps(mVec, indices.mVec);
+            __m256 t1 = _mm256_permutevar8x32_ps(b.mVec, indices.mVec);
+            __m256 t2 = _mm256_castsi256_ps(_mm256_slli_epi32(indices.mVec, 28));
+            __m256 t3 = _mm256_blendv_ps(t0, t1, t2);
+            return SIMDVec_f(t3);
+        }
+
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m256 sortNetwork(__m256 const & a, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256 t1 = a;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m256i t2 = _mm256_set1_epi32(j);
+                    __m256i t3 = _mm256_set1_epi32(k);
+                    __m256i t4 = _mm256_xor_si256(
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t2), t2),
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t3), t3));
+                    __m256 t5 = _mm256_permutevar8x32_ps(t1, _mm256_xor_si256(t0, t2));
+                    __m256 t6 = _mm256_min_ps(t1, t5);
+                    __m256 t7 = _mm256_max_ps(t1, t5);
+                    t1 = descending ? _mm256_blendv_ps(t7, t6, _mm256_castsi256_ps(t4)) : _mm256_blendv_ps(t6, t7, _mm256_castsi256_ps(t4));
+                }
+            }
+            return t1;
+        }
+        UME_FORCE_INLINE static __m256 sortNetwork(__m256 const & a, __m256i & payload, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256 t1 = a;
+            __m256i t2 = payload;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m256i t3 = _mm256_set1_epi32(j);
+                    __m256i t4 = _mm256_set1_epi32(k);
+                    __m256i t5 = _mm256_xor_si256(
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t3), t3),
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t4), t4));
+                    __m256i t6 = _mm256_xor_si256(t0, t3);
+                    __m256 t7 = _mm256_permutevar8x32_ps(t1, t6);
+                    __m256i t8 = _mm256_permutevar8x32_epi32(t2, t6);
+                    // Take the partner element if it is larger (smaller)
+                    // than the element keeping the maximum (minimum).
+                    __m256i t9 = _mm256_castps_si256(_mm256_cmp_ps(t1, t7, _CMP_GT_OQ));
+                    __m256i t10 = _mm256_castps_si256(_mm256_cmp_ps(t7, t1, _CMP_GT_OQ));
+                    __m256i t11 = descending ? _mm256_blendv_epi8(t10, t9, t5) : _mm256_blendv_epi8(t9, t10, t5);
+                    t1 = _mm256_blendv_ps(t1, t7, _mm256_castsi256_ps(t11));
+                    t2 = _mm256_blendv_epi8(t2, t8, t11);
+                }
+            }
+            payload = t2;
+            return t1;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m256 t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m256 t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256 t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256 t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_f bsorta() const {
+            __m256 t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_f bsortd() const {
+            __m256 t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsorta(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256 t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsortd(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256 t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_f(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
@@ -779,16 +915,16 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            /* alignas(32) int32_t raw[8];
-            _mm256_store_si256((__m256i *)raw, mVec);
-            for (unsigned int i = 0; i < 7; i++) {
-            for (unsigned int j = i + 1; j < 8; j++) {
-            if (raw[i] == raw[j]) {
-            return false;
-            }
+            // Any two elements are at most 4 positions apart in one of the
+            // rotations, so comparing with 4 rotations covers every pair.
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256 t1 = _mm256_setzero_ps();
+            for (int k = 1; k <= 4; k++) {
+                __m256i t2 = _mm256_sub_epi32(t0, _mm256_set1_epi32(k));
+                __m256 t3 = _mm256_permutevar8x32_ps(mVec, t2);
+                t1 = _mm256_or_ps(t1, _mm256_cmp_ps(mVec, t3, _CMP_EQ_OQ));
             }
-            }*/
-            return true;
+            return _mm256_movemask_ps(t1) == 0;
         }
         // HADD
         UME_FORCE_INLINE float hadd() const {
@@ -1273,9 +1409,34 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<8> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float, SIMDVecMask<8>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, float>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -1335,7 +1496,7 @@ namespace SIMD {
             __m256 t0 = _mm256_exp_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MEXP
@@ -1345,16 +1506,96 @@ namespace SIMD {
             __m256 t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t1);
         #else
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
             __m256 t0 = _mm256_log_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MLOG
@@ -1364,20 +1605,54 @@ namespace SIMD {
             __m256 t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t1);
         #else
-            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+        #if defined(UME_USE_SVML)
+            __m256 t0 = _mm256_log2_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        #endif
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m256 t0 = _mm256_log2_ps(mVec);
+            __m256 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        #else
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        #endif
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+        #if defined(UME_USE_SVML)
+            __m256 t0 = _mm256_log10_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        #endif
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m256 t0 = _mm256_log10_ps(mVec);
+            __m256 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        #else
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        #endif
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
             __m256 t0 = _mm256_sin_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MSIN
@@ -1387,7 +1662,7 @@ namespace SIMD {
             __m256 t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // COS
@@ -1396,7 +1671,7 @@ namespace SIMD {
             __m256 t0 = _mm256_cos_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MCOS
@@ -1406,7 +1681,7 @@ namespace SIMD {
             __m256 t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // SINCOS
@@ -1428,14 +1703,68 @@ namespace SIMD {
             sinvec.mVec = BLEND(mVec, t0, mask.mMask);
             cosvec.mVec = BLEND(mVec, t1, mask.mMask);
         #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+        #if defined(UME_USE_SVML)
+            __m256 t0 = _mm256_tan_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        #endif
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m256 t0 = _mm256_tan_ps(mVec);
+            __m256 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        #else
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        #endif
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
+        // MATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(mask, *this, b);
+        }
+        // ASIN
+        UME_FORCE_INLINE SIMDVec_f asin() const {
+            return VECTOR_EMULATION::asinf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MASIN
+        UME_FORCE_INLINE SIMDVec_f asin(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::asinf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ACOS
+        UME_FORCE_INLINE SIMDVec_f acos() const {
+            return VECTOR_EMULATION::acosf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MACOS
+        UME_FORCE_INLINE SIMDVec_f acos(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::acosf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 4> const & a, SIMDVec_f<float, 4> const & b) {
@@ -1479,6 +1808,7 @@ namespace SIMD {
         // FTOI
         UME_FORCE_INLINE operator SIMDVec_i<int32_t, 8>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
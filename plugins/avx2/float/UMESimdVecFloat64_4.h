@@ -38,25 +38,32 @@
 
 #if defined UME_USE_MASK_64B
     #define BLEND(a_256d, b_256d, mask_256i) _mm256_blendv_pd(a_256d, b_256d, _mm256_castsi256_pd(mask_256i))
+    #define MASK_LOAD(f64_addr, mask_256i) _mm256_maskload_pd(f64_addr, mask_256i)
     #define MASK_STORE(f64_addr, mask_256i, a_256d) \
         _mm256_maskstore_pd( \
             f64_addr, \
             mask_256i, \
             a_256d \
             )
+    #define MOVEMASK(mask_256i) _mm256_movemask_pd(_mm256_castsi256_pd(mask_256i))
 #else
     #define BLEND(a_256d, b_256d, mask_128i) \
         _mm256_blendv_pd( \
             a_256d, \
             b_256d, \
             _mm256_cvtepi32_pd(mask_128i))
+    #define MASK_LOAD(f64_addr, mask_128i) \
+        _mm256_maskload_pd( \
+            f64_addr, _mm256_cvtepi32_epi64(mask_128i))
     #define MASK_STORE(f64_addr, mask_128i, a_256d) \
         _mm256_maskstore_pd( \
             f64_addr, _mm256_cvtepi32_epi64(mask_128i), a_256d)
+    #define MOVEMASK(mask_128i) _mm_movemask_ps(_mm_castsi128_ps(mask_128i))
 #endif
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<double, 4> :
@@ -189,7 +196,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, double const * p) {
-            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -200,7 +207,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<4> const & mask, double const * p) {
-            __m256d t0 = _mm256_load_pd(p);
+            __m256d t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -211,9 +218,7 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE double* store(SIMDVecMask<4> const & mask, double* p) const {
-            __m256d t0 = _mm256_loadu_pd(p);
-            __m256d t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_pd(p, t1);
+            MASK_STORE(p, mask.mMask, mVec);
             return p;
         }
         // STOREA
@@ -226,6 +231,37 @@ namespace SIMD {
             MASK_STORE(p, mask.mMask, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE double* sstore(double* p) const {
+            _mm256_stream_pd(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE double* sstore(SIMDVecMask<4> const & mask, double* p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<4> const & mask) const {
+            uint32_t t0 = CompressTableAVX2::compress4x64(MOVEMASK(mask.mMask));
+            __m256d t1 = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(mVec), CompressTableAVX2::index(t0)));
+            __m256d t2 = _mm256_and_pd(t1, _mm256_castsi256_pd(CompressTableAVX2::prefix(t0)));
+            return SIMDVec_f(t2);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, double * p) const {
+            uint32_t t0 = CompressTableAVX2::compress4x64(MOVEMASK(mask.mMask));
+            __m256d t1 = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(mVec), CompressTableAVX2::index(t0)));
+            _mm256_maskstore_pd(p, CompressTableAVX2::prefix(t0), t1);
+            return CompressTableAVX2::count(t0);
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<4> const & mask, double const * p) {
+            uint32_t t0 = CompressTableAVX2::expand4x64(MOVEMASK(mask.mMask));
+            __m256d t1 = _mm256_maskload_pd(p, CompressTableAVX2::prefix(t0));
+            __m256d t2 = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(t1), CompressTableAVX2::index(t0)));
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return CompressTableAVX2::count(t0);
+        }
         
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
@@ -241,6 +277,105 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
         //(Addition operations)
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m256d sortNetwork(__m256d const & a, bool descending, bool bitonic) {
+            __m256d t0 = _mm256_permute4x64_pd(a, 0xB1);
+            __m256i t1 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256d t2 = _mm256_min_pd(a, t0);
+            __m256d t3 = _mm256_max_pd(a, t0);
+            __m256d t4 = descending ? _mm256_blendv_pd(t3, t2, _mm256_castsi256_pd(t1)) : _mm256_blendv_pd(t2, t3, _mm256_castsi256_pd(t1));
+            __m256d t5 = bitonic ? a : t4;
+            __m256d t6 = _mm256_permute4x64_pd(t5, 0x4E);
+            __m256i t7 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256d t8 = _mm256_min_pd(t5, t6);
+            __m256d t9 = _mm256_max_pd(t5, t6);
+            __m256d t10 = descending ? _mm256_blendv_pd(t9, t8, _mm256_castsi256_pd(t7)) : _mm256_blendv_pd(t8, t9, _mm256_castsi256_pd(t7));
+            __m256d t11 = _mm256_permute4x64_pd(t10, 0xB1);
+            __m256i t12 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256d t13 = _mm256_min_pd(t10, t11);
+            __m256d t14 = _mm256_max_pd(t10, t11);
+            __m256d t15 = descending ? _mm256_blendv_pd(t14, t13, _mm256_castsi256_pd(t12)) : _mm256_blendv_pd(t13, t14, _mm256_castsi256_pd(t12));
+            return t15;
+        }
+        UME_FORCE_INLINE static __m256d sortNetwork(__m256d const & a, __m256i & payload, bool descending, bool bitonic) {
+            __m256d t0 = _mm256_permute4x64_pd(a, 0xB1);
+            __m256i t1 = _mm256_permute4x64_epi64(payload, 0xB1);
+            __m256i t2 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256i t3 = _mm256_castpd_si256(_mm256_cmp_pd(a, t0, _CMP_GT_OQ));
+            __m256i t4 = _mm256_castpd_si256(_mm256_cmp_pd(t0, a, _CMP_GT_OQ));
+            __m256i t5 = descending ? _mm256_blendv_epi8(t4, t3, t2) : _mm256_blendv_epi8(t3, t4, t2);
+            __m256d t6 = _mm256_blendv_pd(a, t0, _mm256_castsi256_pd(t5));
+            __m256i t7 = _mm256_blendv_epi8(payload, t1, t5);
+            __m256d t8 = bitonic ? a : t6;
+            __m256i t9 = bitonic ? payload : t7;
+            __m256d t10 = _mm256_permute4x64_pd(t8, 0x4E);
+            __m256i t11 = _mm256_permute4x64_epi64(t9, 0x4E);
+            __m256i t12 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256i t13 = _mm256_castpd_si256(_mm256_cmp_pd(t8, t10, _CMP_GT_OQ));
+            __m256i t14 = _mm256_castpd_si256(_mm256_cmp_pd(t10, t8, _CMP_GT_OQ));
+            __m256i t15 = descending ? _mm256_blendv_epi8(t14, t13, t12) : _mm256_blendv_epi8(t13, t14, t12);
+            __m256d t16 = _mm256_blendv_pd(t8, t10, _mm256_castsi256_pd(t15));
+            __m256i t17 = _mm256_blendv_epi8(t9, t11, t15);
+            __m256d t18 = _mm256_permute4x64_pd(t16, 0xB1);
+            __m256i t19 = _mm256_permute4x64_epi64(t17, 0xB1);
+            __m256i t20 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256i t21 = _mm256_castpd_si256(_mm256_cmp_pd(t16, t18, _CMP_GT_OQ));
+            __m256i t22 = _mm256_castpd_si256(_mm256_cmp_pd(t18, t16, _CMP_GT_OQ));
+            __m256i t23 = descending ? _mm256_blendv_epi8(t22, t21, t20) : _mm256_blendv_epi8(t21, t22, t20);
+            __m256d t24 = _mm256_blendv_pd(t16, t18, _mm256_castsi256_pd(t23));
+            __m256i t25 = _mm256_blendv_epi8(t17, t19, t23);
+            payload = t25;
+            return t24;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m256d t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m256d t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256d t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256d t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_f bsorta() const {
+            __m256d t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_f bsortd() const {
+            __m256d t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsorta(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256d t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsortd(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256d t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m256d t0 = _mm256_add_pd(mVec, b.mVec);
@@ -926,10 +1061,35 @@ namespace SIMD {
         }
         // SQRTA     - Square root of vector values and assign
         // MSQRTA    - Masked square root of vector values and assign
-        // POWV      - Power (exponents in vector)
-        // MPOWV     - Masked power (exponents in vector)
-        // POWS      - Power (exponent in scalar)
-        // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<4> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double, SIMDVecMask<4>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, double>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm256_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -960,7 +1120,7 @@ namespace SIMD {
             __m256d t0 = _mm256_exp_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MEXP
@@ -970,16 +1130,96 @@ namespace SIMD {
             __m256d t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t1);
         #else
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>> (mask, *this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION> (mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
             __m256d t0 = _mm256_log_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MLOG
@@ -989,20 +1229,54 @@ namespace SIMD {
             __m256d t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t1);
         #else
-            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>> (mask, *this);
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION> (mask, *this);
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+        #if defined(UME_USE_SVML)
+            __m256d t0 = _mm256_log2_pd(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        #endif
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m256d t0 = _mm256_log2_pd(mVec);
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        #else
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>> (mask, *this);
+        #endif
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+        #if defined(UME_USE_SVML)
+            __m256d t0 = _mm256_log10_pd(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        #endif
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m256d t0 = _mm256_log10_pd(mVec);
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        #else
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>> (mask, *this);
+        #endif
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
 #if defined(UME_USE_SVML)
             __m256d t0 = _mm256_sin_pd(mVec);
             return SIMDVec_f(t0);
 #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this);
 #endif
         }
         // MSIN
@@ -1012,7 +1286,7 @@ namespace SIMD {
             __m256d t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t1);
 #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this);
 #endif
         }
         // COS
@@ -1021,7 +1295,7 @@ namespace SIMD {
             __m256d t0 = _mm256_cos_pd(mVec);
             return SIMDVec_f(t0);
 #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this);
 #endif
         }
         // MCOS
@@ -1031,13 +1305,68 @@ namespace SIMD {
             __m256d t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t1);
 #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this);
+#endif
+        }
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+#if defined(UME_USE_SVML)
+            __m256d t0 = _mm256_tan_pd(mVec);
+            return SIMDVec_f(t0);
+#else
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+#endif
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+#if defined(UME_USE_SVML)
+            __m256d t0 = _mm256_tan_pd(mVec);
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+#else
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
 #endif
         }
-        // TAN       - Tangent
-        // MTAN      - Masked tangent
-        // CTAN      - Cotangent
-        // MCTAN     - Masked cotangent
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
+        // MATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<4>>(mask, *this, b);
+        }
+        // ASIN
+        UME_FORCE_INLINE SIMDVec_f asin() const {
+            return VECTOR_EMULATION::asind<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MASIN
+        UME_FORCE_INLINE SIMDVec_f asin(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::asind<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ACOS
+        UME_FORCE_INLINE SIMDVec_f acos() const {
+            return VECTOR_EMULATION::acosd<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MACOS
+        UME_FORCE_INLINE SIMDVec_f acos(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::acosd<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
 
         // PROMOTE
         // -
@@ -1049,9 +1378,13 @@ namespace SIMD {
         // FTOI
         UME_FORCE_INLINE operator SIMDVec_i<int64_t, 4>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
 #undef BLEND
+#undef MASK_LOAD
+#undef MASK_STORE
+#undef MOVEMASK
 
 #endif
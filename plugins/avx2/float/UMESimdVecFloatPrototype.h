@@ -42,6 +42,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<typename SCALAR_FLOAT_TYPE, uint32_t VEC_LEN>
     struct SIMDVec_f_traits {
@@ -593,6 +594,7 @@ namespace SIMD {
         SIMDVec_f() {}
         ~SIMDVec_f() {}
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 16> :
@@ -57,6 +58,7 @@ namespace SIMD {
         friend class SIMDVec_u<uint32_t, 16>;
         friend class SIMDVec_f<float, 16>;
         friend class SIMDVec_f<double, 16>;
+        friend class SIMDVec_i<int16_t, 16>;
     private:
         __m256i mVec[2];
 
@@ -176,8 +178,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
@@ -187,8 +198,8 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<16> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask[0]);
+            __m256i t1 = _mm256_maskload_epi32((int const *)(p + 8), mask.mMask[1]);
             mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             return *this;
@@ -201,8 +212,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<16> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask[0]);
+            __m256i t1 = _mm256_maskload_epi32((int const *)(p + 8), mask.mMask[1]);
             mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             return *this;
@@ -253,18 +264,40 @@ namespace SIMD {
         }
         // MSSTORE
         UME_FORCE_INLINE int32_t* sstore(SIMDVecMask<16> const & mask, int32_t* p) const {
-            __m256i t0 = _mm256_stream_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_stream_load_si256((__m256i*)(p + 8));
-            __m256i t2 = _mm256_blendv_epi8(t0, mVec[0], mask.mMask[0]);
-            __m256i t3 = _mm256_blendv_epi8(t1, mVec[1], mask.mMask[1]);
-            _mm256_stream_si256((__m256i*)p, t2);
-            _mm256_stream_si256((__m256i*)(p + 8), t3);
-            return p;
+            return storea(mask, p);
         }
         // BLENDV
         // BLENDS
         // SWIZZLE 
         // SWIZZLEA
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint32_t, 16> const & indices) const {
+            __m256i t0 = permute16(mVec[0], mVec[1], indices.mVec[0]);
+            __m256i t1 = permute16(mVec[0], mVec[1], indices.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint32_t, 16> const & indices) const {
+            // Bit 4 of the index selects the source vector.
+            __m256 t0 = _mm256_castsi256_ps(_mm256_slli_epi32(indices.mVec[0], 27));
+            __m256 t1 = _mm256_castsi256_ps(_mm256_slli_epi32(indices.mVec[1], 27));
+            __m256i t2 = permute16(mVec[0], mVec[1], indices.mVec[0]);
+            __m256i t3 = permute16(b.mVec[0], b.mVec[1], indices.mVec[0]);
+            __m256i t4 = permute16(mVec[0], mVec[1], indices.mVec[1]);
+            __m256i t5 = permute16(b.mVec[0], b.mVec[1], indices.mVec[1]);
+            __m256i t6 = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t2), _mm256_castsi256_ps(t3), t0));
+            __m256i t7 = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t4), _mm256_castsi256_ps(t5), t1));
+            return SIMDVec_i(t6, t7);
+        }
+    private:
+        // Select element (idx % 16) of the 16-element vector held in (lo, hi).
+        UME_FORCE_INLINE static __m256i permute16(__m256i const & lo, __m256i const & hi, __m256i const & idx) {
+            __m256i t0 = _mm256_permutevar8x32_epi32(lo, idx);
+            __m256i t1 = _mm256_permutevar8x32_epi32(hi, idx);
+            __m256 t2 = _mm256_castsi256_ps(_mm256_slli_epi32(idx, 28));
+            return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t0), _mm256_castsi256_ps(t1), t2));
+        }
+    public:
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -631,6 +664,12 @@ namespace SIMD {
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            __m256i t0 = MulHighAVX2::mulhis32(mVec[0], b.mVec[0]);
+            __m256i t1 = MulHighAVX2::mulhis32(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
         // DIVV
         UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
             return div(b);
@@ -651,6 +690,12 @@ namespace SIMD {
             return diva(b);
         }
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int32_t> const & divider) const {
+            __m256i t0 = DivideAVX2::divs32(mVec[0], divider);
+            __m256i t1 = DivideAVX2::divs32(mVec[1], divider);
+            return SIMDVec_i(t0, t1);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1800,6 +1845,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 16>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
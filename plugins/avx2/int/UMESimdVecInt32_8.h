@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 8> :
@@ -158,8 +159,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
@@ -168,7 +178,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<8> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask);
             mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
@@ -179,7 +189,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<8> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask);
             mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
@@ -201,9 +211,7 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<8> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_blendv_epi8(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i*)p, t1);
+            _mm256_maskstore_epi32((int *)p, mask.mMask, mVec);
             return p;
         }
         // STOREA
@@ -223,10 +231,29 @@ namespace SIMD {
         }
         // MSSTORE
         UME_FORCE_INLINE int32_t* sstore(SIMDVecMask<8> const & mask, int32_t* p) const {
-            __m256i t0 = _mm256_stream_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_blendv_epi8(t0, mVec, mask.mMask);
-            _mm256_stream_si256((__m256i*)p, t1);
-            return p;
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<8> const & mask) const {
+            uint32_t t0 = CompressTableAVX2::compress8(_mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+            __m256i t1 = _mm256_permutevar8x32_epi32(mVec, CompressTableAVX2::index(t0));
+            __m256i t2 = _mm256_and_si256(t1, CompressTableAVX2::prefix(t0));
+            return SIMDVec_i(t2);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, int32_t * p) const {
+            uint32_t t0 = CompressTableAVX2::compress8(_mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+            __m256i t1 = _mm256_permutevar8x32_epi32(mVec, CompressTableAVX2::index(t0));
+            _mm256_maskstore_epi32((int *)p, CompressTableAVX2::prefix(t0), t1);
+            return CompressTableAVX2::count(t0);
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<8> const & mask, int32_t const * p) {
+            uint32_t t0 = CompressTableAVX2::expand8(_mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+            __m256i t1 = _mm256_maskload_epi32((int const *)p, CompressTableAVX2::prefix(t0));
+            __m256i t2 = _mm256_permutevar8x32_epi32(t1, CompressTableAVX2::index(t0));
+            mVec = _mm256_blendv_epi8(mVec, t2, mask.mMask);
+            return CompressTableAVX2::count(t0);
         }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
@@ -241,6 +268,114 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint32_t, 8> const & indices) const {
+            __m256i t0 = _mm256_permutevar8x32_epi32(mVec, indices.mVec);
+            return SIMDVec_i(t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint32_t, 8> const & indices) const {
+            // Bit 3 of the index selects the source, shift it into the sign bit for blendv.
+            __m256i t0 = _mm256_permutevar8x32_epi32(mVec, indices.mVec);
+            __m256i t1 = _mm256_permutevar8x32_epi32(b.mVec, indices.mVec);
+            __m256 t2 = _mm256_castsi256_ps(_mm256_slli_epi32(indices.mVec, 28));
+            __m256i t3 = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t0), _mm256_castsi256_ps(t1), t2));
+            return SIMDVec_i(t3);
+        }
+
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256i t1 = a;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m256i t2 = _mm256_set1_epi32(j);
+                    __m256i t3 = _mm256_set1_epi32(k);
+                    __m256i t4 = _mm256_xor_si256(
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t2), t2),
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t3), t3));
+                    __m256i t5 = _mm256_permutevar8x32_epi32(t1, _mm256_xor_si256(t0, t2));
+                    __m256i t6 = _mm256_min_epi32(t1, t5);
+                    __m256i t7 = _mm256_max_epi32(t1, t5);
+                    t1 = descending ? _mm256_blendv_epi8(t7, t6, t4) : _mm256_blendv_epi8(t6, t7, t4);
+                }
+            }
+            return t1;
+        }
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, __m256i & payload, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256i t1 = a;
+            __m256i t2 = payload;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m256i t3 = _mm256_set1_epi32(j);
+                    __m256i t4 = _mm256_set1_epi32(k);
+                    __m256i t5 = _mm256_xor_si256(
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t3), t3),
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t4), t4));
+                    __m256i t6 = _mm256_xor_si256(t0, t3);
+                    __m256i t7 = _mm256_permutevar8x32_epi32(t1, t6);
+                    __m256i t8 = _mm256_permutevar8x32_epi32(t2, t6);
+                    // Take the partner element if it is larger (smaller)
+                    // than the element keeping the maximum (minimum).
+                    __m256i t9 = _mm256_cmpgt_epi32(t1, t7);
+                    __m256i t10 = _mm256_cmpgt_epi32(t7, t1);
+                    __m256i t11 = descending ? _mm256_blendv_epi8(t10, t9, t5) : _mm256_blendv_epi8(t9, t10, t5);
+                    t1 = _mm256_blendv_epi8(t1, t7, t11);
+                    t2 = _mm256_blendv_epi8(t2, t8, t11);
+                }
+            }
+            payload = t2;
+            return t1;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m256i t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m256i t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_i bsorta() const {
+            __m256i t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_i bsortd() const {
+            __m256i t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsorta(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsortd(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_i(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -544,6 +679,11 @@ namespace SIMD {
             mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            __m256i t0 = MulHighAVX2::mulhis32(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // DIVV
         UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
             return div(b);
@@ -564,6 +704,11 @@ namespace SIMD {
             return diva(b);
         }
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int32_t> const & divider) const {
+            __m256i t0 = DivideAVX2::divs32(mVec, divider);
+            return SIMDVec_i(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -700,16 +845,33 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            /* alignas(32) int32_t raw[8];
-            _mm256_store_si256((__m256i *)raw, mVec);
-            for (unsigned int i = 0; i < 7; i++) {
-            for (unsigned int j = i + 1; j < 8; j++) {
-            if (raw[i] == raw[j]) {
-            return false;
+            // Any two elements are at most 4 positions apart in one of the
+            // rotations, so comparing with 4 rotations covers every pair.
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256i t1 = _mm256_setzero_si256();
+            for (int k = 1; k <= 4; k++) {
+                __m256i t2 = _mm256_sub_epi32(t0, _mm256_set1_epi32(k));
+                __m256i t3 = _mm256_permutevar8x32_epi32(mVec, t2);
+                t1 = _mm256_or_si256(t1, _mm256_cmpeq_epi32(mVec, t3));
             }
+            return _mm256_testz_si256(t1, t1) != 0;
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_i conflict() const {
+            // Element i is compared with element (i - k) of the rotated
+            // vector. Negative shift counts are out of range for VPSLLVD
+            // and give 0, so wrapped-around elements set no bit.
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256i t1 = _mm256_set1_epi32(1);
+            __m256i t2 = _mm256_setzero_si256();
+            for (int k = 1; k < 8; k++) {
+                __m256i t3 = _mm256_sub_epi32(t0, _mm256_set1_epi32(k));
+                __m256i t4 = _mm256_permutevar8x32_epi32(mVec, t3);
+                __m256i t5 = _mm256_cmpeq_epi32(mVec, t4);
+                __m256i t6 = _mm256_sllv_epi32(t1, t3);
+                t2 = _mm256_or_si256(t2, _mm256_and_si256(t5, t6));
             }
-            }*/
-            return true;
+            return SIMDVec_i(t2);
         }
         // HADD
         UME_FORCE_INLINE int32_t hadd() const {
@@ -1213,6 +1375,26 @@ namespace SIMD {
             mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
             return *this;
         }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_i popcnt() const {
+            __m256i t0 = BitCountAVX2::popcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_i lzcnt() const {
+            __m256i t0 = BitCountAVX2::lzcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_i tzcnt() const {
+            __m256i t0 = BitCountAVX2::tzcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_i bitrev() const {
+            __m256i t0 = BitCountAVX2::bitrev32(mVec);
+            return SIMDVec_i(t0);
+        }
         // HBAND
         UME_FORCE_INLINE int32_t hband() const {
             __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
@@ -1535,6 +1717,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 8>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -76,6 +76,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int64_t, 16> :
@@ -221,8 +222,20 @@ namespace SIMD {
         // MASSIGNS
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+            _mm_prefetch((const char *)(p + 8), _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+            _mm_prefetch((const char *)(p + 8), _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+            _mm_prefetch((const char *)(p + 8), _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const * p) {
@@ -234,10 +247,10 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<16> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 4));
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 8));
-            __m256i t3 = _mm256_loadu_si256((__m256i*)(p + 12));
+            __m256i t0 = _mm256_maskload_epi64((long long const *)p, _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[0], 0)));
+            __m256i t1 = _mm256_maskload_epi64((long long const *)(p + 4), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[0], 1)));
+            __m256i t2 = _mm256_maskload_epi64((long long const *)(p + 8), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[1], 0)));
+            __m256i t3 = _mm256_maskload_epi64((long long const *)(p + 12), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[1], 1)));
 
             mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask[0]);
             mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask[0]);
@@ -256,10 +269,10 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<16> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 4));
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 8));
-            __m256i t3 = _mm256_load_si256((__m256i*)(p + 12));
+            __m256i t0 = _mm256_maskload_epi64((long long const *)p, _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[0], 0)));
+            __m256i t1 = _mm256_maskload_epi64((long long const *)(p + 4), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[0], 1)));
+            __m256i t2 = _mm256_maskload_epi64((long long const *)(p + 8), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[1], 0)));
+            __m256i t3 = _mm256_maskload_epi64((long long const *)(p + 12), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[1], 1)));
             mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask[0]);
             mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask[0]);
             mVec[2] = BLEND_LO(mVec[2], t2, mask.mMask[1]);
@@ -276,18 +289,10 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int64_t * store(SIMDVecMask<16> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 4));
-            __m256i t2 = _mm256_loadu_si256((__m256i*)(p + 8));
-            __m256i t3 = _mm256_loadu_si256((__m256i*)(p + 12));
-            __m256i t4 = BLEND_LO(t0, mVec[0], mask.mMask[0]);
-            __m256i t5 = BLEND_HI(t1, mVec[1], mask.mMask[0]);
-            __m256i t6 = BLEND_LO(t2, mVec[2], mask.mMask[1]);
-            __m256i t7 = BLEND_HI(t3, mVec[3], mask.mMask[1]);
-            _mm256_storeu_si256((__m256i*) p, t4);
-            _mm256_storeu_si256((__m256i*) (p + 4), t5);
-            _mm256_storeu_si256((__m256i*) (p + 8), t6);
-            _mm256_storeu_si256((__m256i*) (p + 12), t7);
+            _mm256_maskstore_epi64((long long *)p, _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[0], 0)), mVec[0]);
+            _mm256_maskstore_epi64((long long *)(p + 4), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[0], 1)), mVec[1]);
+            _mm256_maskstore_epi64((long long *)(p + 8), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[1], 0)), mVec[2]);
+            _mm256_maskstore_epi64((long long *)(p + 12), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[1], 1)), mVec[3]);
             return p;
         }
         // STOREA
@@ -300,20 +305,24 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE int64_t * storea(SIMDVecMask<16> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 4));
-            __m256i t2 = _mm256_load_si256((__m256i*)(p + 8));
-            __m256i t3 = _mm256_load_si256((__m256i*)(p + 12));
-            __m256i t4 = BLEND_LO(t0, mVec[0], mask.mMask[0]);
-            __m256i t5 = BLEND_HI(t1, mVec[1], mask.mMask[0]);
-            __m256i t6 = BLEND_LO(t2, mVec[2], mask.mMask[1]);
-            __m256i t7 = BLEND_HI(t3, mVec[3], mask.mMask[1]);
-            _mm256_store_si256((__m256i*) p, t4);
-            _mm256_store_si256((__m256i*) (p + 4), t5);
-            _mm256_store_si256((__m256i*) (p + 8), t6);
-            _mm256_store_si256((__m256i*) (p + 12), t7);
+            _mm256_maskstore_epi64((long long *)p, _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[0], 0)), mVec[0]);
+            _mm256_maskstore_epi64((long long *)(p + 4), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[0], 1)), mVec[1]);
+            _mm256_maskstore_epi64((long long *)(p + 8), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[1], 0)), mVec[2]);
+            _mm256_maskstore_epi64((long long *)(p + 12), _mm256_cvtepi32_epi64(_mm256_extractf128_si256(mask.mMask[1], 1)), mVec[3]);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int64_t * sstore(int64_t * p) const {
+            _mm256_stream_si256((__m256i *)p, mVec[0]);
+            _mm256_stream_si256((__m256i *)(p + 4), mVec[1]);
+            _mm256_stream_si256((__m256i *)(p + 8), mVec[2]);
+            _mm256_stream_si256((__m256i *)(p + 12), mVec[3]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int64_t * sstore(SIMDVecMask<16> const & mask, int64_t * p) const {
+            return storea(mask, p);
+        }
 
         // BLENDV
         // BLENDS
@@ -559,6 +568,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<double, 16>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
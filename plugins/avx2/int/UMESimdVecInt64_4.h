@@ -54,12 +54,19 @@
 
 #if defined UME_USE_MASK_64B
     #define BLEND(a_256i, b_256i, mask_256i) _mm256_blendv_epi8(a_256i, b_256i, mask_256i)
+    #define MASK_LOAD(int64_addr, mask_256i) _mm256_maskload_epi64((long long const *)int64_addr, mask_256i)
+    #define MASK_STORE(int64_addr, mask_256i, a_256i) _mm256_maskstore_epi64((long long *)int64_addr, mask_256i, a_256i)
+    #define MOVEMASK(mask_256i) _mm256_movemask_pd(_mm256_castsi256_pd(mask_256i))
 #else
     #define BLEND(a_256i, b_256i, mask_128i) _mm256_blendv_epi8(a_256i, b_256i, _mm256_cvtepi32_epi64(mask_128i))
+    #define MASK_LOAD(int64_addr, mask_128i) _mm256_maskload_epi64((long long const *)int64_addr, _mm256_cvtepi32_epi64(mask_128i))
+    #define MASK_STORE(int64_addr, mask_128i, a_256i) _mm256_maskstore_epi64((long long *)int64_addr, _mm256_cvtepi32_epi64(mask_128i), a_256i)
+    #define MOVEMASK(mask_128i) _mm_movemask_ps(_mm_castsi128_ps(mask_128i))
 #endif
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int64_t, 4> :
@@ -181,8 +188,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const * p) {
@@ -191,7 +207,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<4> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -202,7 +218,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<4> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            __m256i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -213,9 +229,7 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int64_t * store(SIMDVecMask<4> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i*) p, t1);
+            MASK_STORE(p, mask.mMask, mVec);
             return p;
         }
         // STOREA
@@ -225,11 +239,40 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE int64_t * storea(SIMDVecMask<4> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_store_si256((__m256i*) p, t1);
+            MASK_STORE(p, mask.mMask, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int64_t * sstore(int64_t * p) const {
+            _mm256_stream_si256((__m256i *)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int64_t * sstore(SIMDVecMask<4> const & mask, int64_t * p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<4> const & mask) const {
+            uint32_t t0 = CompressTableAVX2::compress4x64(MOVEMASK(mask.mMask));
+            __m256i t1 = _mm256_permutevar8x32_epi32(mVec, CompressTableAVX2::index(t0));
+            __m256i t2 = _mm256_and_si256(t1, CompressTableAVX2::prefix(t0));
+            return SIMDVec_i(t2);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, int64_t * p) const {
+            uint32_t t0 = CompressTableAVX2::compress4x64(MOVEMASK(mask.mMask));
+            __m256i t1 = _mm256_permutevar8x32_epi32(mVec, CompressTableAVX2::index(t0));
+            _mm256_maskstore_epi64((long long *)p, CompressTableAVX2::prefix(t0), t1);
+            return CompressTableAVX2::count(t0);
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<4> const & mask, int64_t const * p) {
+            uint32_t t0 = CompressTableAVX2::expand4x64(MOVEMASK(mask.mMask));
+            __m256i t1 = _mm256_maskload_epi64((long long const *)p, CompressTableAVX2::prefix(t0));
+            __m256i t2 = _mm256_permutevar8x32_epi32(t1, CompressTableAVX2::index(t0));
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return CompressTableAVX2::count(t0);
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
@@ -245,6 +288,137 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+    private:
+        // Low 64 bits of a 64x64-bit product, built from 32x32-bit partial
+        // products: lo(a)*lo(b) + ((hi(a)*lo(b) + lo(a)*hi(b)) << 32).
+        UME_FORCE_INLINE static __m256i mul64(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_mul_epu32(a, b);
+            __m256i t1 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+            __m256i t2 = _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32));
+            __m256i t3 = _mm256_slli_epi64(_mm256_add_epi64(t1, t2), 32);
+            return _mm256_add_epi64(t0, t3);
+        }
+        // Arithmetic right shift: shift the one's complement of negative
+        // elements logically, then complement back.
+        UME_FORCE_INLINE static __m256i sra64(__m256i const & a, __m256i const & n) {
+            __m256i t0 = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+            return _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(a, t0), n), t0);
+        }
+        UME_FORCE_INLINE static __m256i sra64(__m256i const & a, uint64_t n) {
+            __m256i t0 = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+            return _mm256_xor_si256(_mm256_srl_epi64(_mm256_xor_si256(a, t0), _mm_cvtsi32_si128(int(n))), t0);
+        }
+        // Converts a 64-bit element compare result to the mask layout.
+        UME_FORCE_INLINE static SIMDVecMask<4> toMask(__m256i const & a) {
+#if defined UME_USE_MASK_64B
+            return SIMDVecMask<4>(a);
+#else
+            __m256i t0 = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+            __m256i t1 = _mm256_permutevar8x32_epi32(a, t0);
+            __m128i t2 = _mm256_castsi256_si128(t1);
+            return SIMDVecMask<4>(t2);
+#endif
+        }
+
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_permute4x64_epi64(a, 0xB1);
+            __m256i t1 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256i t2 = _mm256_cmpgt_epi64(a, t0);
+            __m256i t3 = _mm256_xor_si256(t2, t1);
+            __m256i t4 = descending ? _mm256_blendv_epi8(t0, a, t3) : _mm256_blendv_epi8(a, t0, t3);
+            __m256i t5 = bitonic ? a : t4;
+            __m256i t6 = bitonic ? a : t5;
+            __m256i t7 = _mm256_permute4x64_epi64(t6, 0x4E);
+            __m256i t8 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256i t9 = _mm256_cmpgt_epi64(t6, t7);
+            __m256i t10 = _mm256_xor_si256(t9, t8);
+            __m256i t11 = descending ? _mm256_blendv_epi8(t7, t6, t10) : _mm256_blendv_epi8(t6, t7, t10);
+            __m256i t12 = _mm256_permute4x64_epi64(t11, 0xB1);
+            __m256i t13 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256i t14 = _mm256_cmpgt_epi64(t11, t12);
+            __m256i t15 = _mm256_xor_si256(t14, t13);
+            __m256i t16 = descending ? _mm256_blendv_epi8(t12, t11, t15) : _mm256_blendv_epi8(t11, t12, t15);
+            return t16;
+        }
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, __m256i & payload, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_permute4x64_epi64(a, 0xB1);
+            __m256i t1 = _mm256_permute4x64_epi64(payload, 0xB1);
+            __m256i t2 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256i t3 = _mm256_cmpgt_epi64(a, t0);
+            __m256i t4 = _mm256_cmpgt_epi64(t0, a);
+            __m256i t5 = descending ? _mm256_blendv_epi8(t4, t3, t2) : _mm256_blendv_epi8(t3, t4, t2);
+            __m256i t6 = _mm256_blendv_epi8(a, t0, t5);
+            __m256i t7 = _mm256_blendv_epi8(payload, t1, t5);
+            __m256i t8 = bitonic ? a : t6;
+            __m256i t9 = bitonic ? payload : t7;
+            __m256i t10 = _mm256_permute4x64_epi64(t8, 0x4E);
+            __m256i t11 = _mm256_permute4x64_epi64(t9, 0x4E);
+            __m256i t12 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256i t13 = _mm256_cmpgt_epi64(t8, t10);
+            __m256i t14 = _mm256_cmpgt_epi64(t10, t8);
+            __m256i t15 = descending ? _mm256_blendv_epi8(t14, t13, t12) : _mm256_blendv_epi8(t13, t14, t12);
+            __m256i t16 = _mm256_blendv_epi8(t8, t10, t15);
+            __m256i t17 = _mm256_blendv_epi8(t9, t11, t15);
+            __m256i t18 = _mm256_permute4x64_epi64(t16, 0xB1);
+            __m256i t19 = _mm256_permute4x64_epi64(t17, 0xB1);
+            __m256i t20 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256i t21 = _mm256_cmpgt_epi64(t16, t18);
+            __m256i t22 = _mm256_cmpgt_epi64(t18, t16);
+            __m256i t23 = descending ? _mm256_blendv_epi8(t22, t21, t20) : _mm256_blendv_epi8(t21, t22, t20);
+            __m256i t24 = _mm256_blendv_epi8(t16, t18, t23);
+            __m256i t25 = _mm256_blendv_epi8(t17, t19, t23);
+            payload = t25;
+            return t24;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m256i t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m256i t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_i bsorta() const {
+            __m256i t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_i bsortd() const {
+            __m256i t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsorta(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsortd(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             __m256i t0 = _mm256_add_epi64(mVec, b.mVec);
@@ -416,13 +590,66 @@ namespace SIMD {
         // PREFDEC
         // MPREFDEC
         // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            __m256i t0 = mul64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
         // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = mul64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(int64_t b) const {
+            __m256i t0 = mul64(mVec, SET1_EPI64(b));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (int64_t b) const {
+            return mul(b);
+        }
         // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = mul64(mVec, SET1_EPI64(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            mVec = mul64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
         // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = mul64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(int64_t b) {
+            mVec = mul64(mVec, SET1_EPI64(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (int64_t b) {
+            return mula(b);
+        }
         // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = mul64(mVec, SET1_EPI64(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            __m256i t0 = MulHighAVX2::mulhis64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // DIVV
         // MDIVV
         // DIVS
@@ -431,6 +658,11 @@ namespace SIMD {
         // MDIVVA
         // DIVSA
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int64_t> const & divider) const {
+            __m256i t0 = DivideAVX2::divs64(mVec, divider);
+            return SIMDVec_i(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -441,20 +673,134 @@ namespace SIMD {
         // MRCPSA
 
         // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, b.mVec);
+            return toMask(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
         // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpeq_epi64(mVec, t0);
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (int64_t b) const {
+            return cmpeq(b);
+        }
         // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, b.mVec);
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_set1_epi32(-1));
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
         // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpeq_epi64(mVec, t0);
+            __m256i t2 = _mm256_xor_si256(t1, _mm256_set1_epi32(-1));
+            return toMask(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (int64_t b) const {
+            return cmpne(b);
+        }
         // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpgt_epi64(mVec, b.mVec);
+            return toMask(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
         // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, t0);
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (int64_t b) const {
+            return cmpgt(b);
+        }
         // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpgt_epi64(b.mVec, mVec);
+            return toMask(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
         // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec);
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (int64_t b) const {
+            return cmplt(b);
+        }
         // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpgt_epi64(b.mVec, mVec);
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_set1_epi32(-1));
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
         // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec);
+            __m256i t2 = _mm256_xor_si256(t1, _mm256_set1_epi32(-1));
+            return toMask(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (int64_t b) const {
+            return cmpge(b);
+        }
         // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpgt_epi64(mVec, b.mVec);
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_set1_epi32(-1));
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
         // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, t0);
+            __m256i t2 = _mm256_xor_si256(t1, _mm256_set1_epi32(-1));
+            return toMask(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (int64_t b) const {
+            return cmple(b);
+        }
         // CMPEV
         // CMPES
         // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            __m256i t0 = _mm256_permute4x64_epi64(mVec, _MM_SHUFFLE(2, 1, 0, 3));
+            __m256i t1 = _mm256_permute4x64_epi64(mVec, _MM_SHUFFLE(1, 0, 3, 2));
+            __m256i t2 = _mm256_or_si256(_mm256_cmpeq_epi64(mVec, t0), _mm256_cmpeq_epi64(mVec, t1));
+            return _mm256_testz_si256(t2, t2) != 0;
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_i conflict() const {
+            // Compare with the vector rotated by 1, 2 and 3 elements and keep
+            // the bits of the elements that did not wrap around.
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, _mm256_permute4x64_epi64(mVec, _MM_SHUFFLE(2, 1, 0, 3)));
+            __m256i t1 = _mm256_cmpeq_epi64(mVec, _mm256_permute4x64_epi64(mVec, _MM_SHUFFLE(1, 0, 3, 2)));
+            __m256i t2 = _mm256_cmpeq_epi64(mVec, _mm256_permute4x64_epi64(mVec, _MM_SHUFFLE(0, 3, 2, 1)));
+            __m256i t3 = _mm256_and_si256(t0, _mm256_setr_epi64x(0, 1, 2, 4));
+            __m256i t4 = _mm256_and_si256(t1, _mm256_setr_epi64x(0, 0, 1, 2));
+            __m256i t5 = _mm256_and_si256(t2, _mm256_setr_epi64x(0, 0, 0, 1));
+            return SIMDVec_i(_mm256_or_si256(t3, _mm256_or_si256(t4, t5)));
+        }
         // HADD
         // MHADD
         // HADDS
@@ -472,21 +818,121 @@ namespace SIMD {
         // FSUBMULV
         // MFSUBMULV
         // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(b.mVec, mVec, t1);
+            return SIMDVec_i(t2);
+        }
         // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(b.mVec, mVec, t1);
+            __m256i t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_i(t3);
+        }
         // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec, t1);
+            return SIMDVec_i(t2);
+        }
         // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec, t1);
+            __m256i t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_i(t3);
+        }
         // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(b.mVec, mVec, t1);
+            mVec = t2;
+            return *this;
+        }
         // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(b.mVec, mVec, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec, t1);
+            mVec = t2;
+            return *this;
+        }
         // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, b.mVec, t1);
+            return SIMDVec_i(t2);
+        }
         // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, b.mVec, t1);
+            __m256i t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_i(t3);
+        }
         // MINS
+        UME_FORCE_INLINE SIMDVec_i min(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t0, t1);
+            return SIMDVec_i(t2);
+        }
         // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t0, t1);
+            __m256i t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_i(t3);
+        }
         // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, b.mVec, t1);
+            mVec = t2;
+            return *this;
+        }
         // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, b.mVec, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t0, t1);
+            mVec = t2;
+            return *this;
+        }
         // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t0, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // HMAX
         // MHMAX
         // IMAX
@@ -524,6 +970,26 @@ namespace SIMD {
         // MBNOT
         // BNOTA
         // MBNOTA
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_i popcnt() const {
+            __m256i t0 = BitCountAVX2::popcnt64(mVec);
+            return SIMDVec_i(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_i lzcnt() const {
+            __m256i t0 = BitCountAVX2::lzcnt64(mVec);
+            return SIMDVec_i(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_i tzcnt() const {
+            __m256i t0 = BitCountAVX2::tzcnt64(mVec);
+            return SIMDVec_i(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_i bitrev() const {
+            __m256i t0 = BitCountAVX2::bitrev64(mVec);
+            return SIMDVec_i(t0);
+        }
         // HBAND
         // MHBAND
         // HBANDS
@@ -555,13 +1021,61 @@ namespace SIMD {
         // LSHSA
         // MLSHSA
         // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint64_t, 4> const & b) const {
+            __m256i t0 = sra64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint64_t, 4> const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & b) const {
+            __m256i t0 = sra64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint64_t b) const {
+            __m256i t0 = sra64(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint64_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = sra64(mVec, b);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint64_t, 4> const & b) {
+            mVec = sra64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint64_t, 4> const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & b) {
+            __m256i t0 = sra64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint64_t b) {
+            mVec = sra64(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint64_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = sra64(mVec, b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // ROLV
         // MROLV
         // ROLS
@@ -587,9 +1101,36 @@ namespace SIMD {
         // NEGA
         // MNEGA
         // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, _mm256_sub_epi64(t0, mVec), t1);
+            return SIMDVec_i(t2);
+        }
         // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, _mm256_sub_epi64(t0, mVec), t1);
+            __m256i t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_i(t3);
+        }
         // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, _mm256_sub_epi64(t0, mVec), t1);
+            mVec = t2;
+            return *this;
+        }
         // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<4> const & mask) {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, _mm256_sub_epi64(t0, mVec), t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
 
         // PACK
         // PACKLO
@@ -609,10 +1150,14 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<double, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
 #undef SET1_EPI64
 #undef BLEND
+#undef MASK_LOAD
+#undef MASK_STORE
+#undef MOVEMASK
 
 #endif
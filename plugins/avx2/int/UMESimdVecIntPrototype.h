@@ -40,6 +40,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     // ********************************************************************************************
     // SIGNED INTEGER VECTORS
@@ -827,6 +828,7 @@ namespace SIMD {
         SIMDVec_i() {}
         ~SIMDVec_i() {}
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -33,6 +33,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<16> :
@@ -102,6 +103,28 @@ namespace SIMD {
             mMask[0] = mask.mMask[0];
             mMask[1] = mask.mMask[1];
         }
+        // FIRSTN
+        static UME_FORCE_INLINE SIMDVecMask firstN(uint32_t count) {
+            __m256i t0 = _mm256_set1_epi32(count < 16 ? int32_t(count) : 16);
+            SIMDVecMask retval;
+            retval.mMask[0] = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            retval.mMask[1] = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            return retval;
+        }
+        // TOBITMASK
+        inline uint64_t toBitmask() const {
+            uint64_t t0 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[0])));
+            uint64_t t1 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[1])));
+            return t0 | (t1 << 8);
+        }
+        // FROMBITMASK
+        static UME_FORCE_INLINE SIMDVecMask fromBitmask(uint64_t bits) {
+            __m256i t0 = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+            SIMDVecMask retval;
+            retval.mMask[0] = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t(bits)), t0), t0);
+            retval.mMask[1] = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t((bits >> 8))), t0), t0);
+            return retval;
+        }
         // EXTRACT
         inline bool extract(uint32_t index) const {
             UME_PERFORMANCE_UNOPTIMAL_WARNING()
@@ -297,6 +320,7 @@ namespace SIMD {
             return (t0 == 0) | (t1 == 0);
         }
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<32> :
@@ -51,7 +52,9 @@ namespace SIMD {
         // This function returns a boolean value based on internal representation
         static inline bool toBool(uint32_t m) { if ((m & 0x80000000) != 0) return true; else return false; }
 
+        friend class SIMDVec_u<uint8_t, 32>;
         friend class SIMDVec_u<uint32_t, 32>;
+        friend class SIMDVec_i<int8_t, 32>;
         friend class SIMDVec_i<int32_t, 32>;
         friend class SIMDVec_f<float, 32>;
         friend class SIMDVec_f<double, 32>;
@@ -123,6 +126,34 @@ namespace SIMD {
             mMask[2] = mask.mMask[2];
             mMask[3] = mask.mMask[3];
         }
+        // FIRSTN
+        static UME_FORCE_INLINE SIMDVecMask firstN(uint32_t count) {
+            __m256i t0 = _mm256_set1_epi32(count < 32 ? int32_t(count) : 32);
+            SIMDVecMask retval;
+            retval.mMask[0] = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            retval.mMask[1] = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+            retval.mMask[2] = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(16, 17, 18, 19, 20, 21, 22, 23));
+            retval.mMask[3] = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(24, 25, 26, 27, 28, 29, 30, 31));
+            return retval;
+        }
+        // TOBITMASK
+        inline uint64_t toBitmask() const {
+            uint64_t t0 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[0])));
+            uint64_t t1 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[1])));
+            uint64_t t2 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[2])));
+            uint64_t t3 = uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask[3])));
+            return t0 | (t1 << 8) | (t2 << 16) | (t3 << 24);
+        }
+        // FROMBITMASK
+        static UME_FORCE_INLINE SIMDVecMask fromBitmask(uint64_t bits) {
+            __m256i t0 = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+            SIMDVecMask retval;
+            retval.mMask[0] = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t(bits)), t0), t0);
+            retval.mMask[1] = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t((bits >> 8))), t0), t0);
+            retval.mMask[2] = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t((bits >> 16))), t0), t0);
+            retval.mMask[3] = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t((bits >> 24))), t0), t0);
+            return retval;
+        }
 
         inline bool extract(uint32_t index) const {
             UME_PERFORMANCE_UNOPTIMAL_WARNING();
@@ -364,6 +395,7 @@ namespace SIMD {
             return (t0 == 0) | (t1 == 0) | (t2 == 0) | (t3 == 0);
         }
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<4> :
@@ -129,6 +130,37 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVecMask(SIMDVecMask const & mask) {
             this->mMask = mask.mMask;
         }
+        // FIRSTN
+        static UME_FORCE_INLINE SIMDVecMask firstN(uint32_t count) {
+#if defined UME_USE_MASK_64B
+            __m256i t0 = _mm256_set1_epi64x(count < 4 ? int64_t(count) : 4);
+            __m256i t1 = _mm256_cmpgt_epi64(t0, _mm256_setr_epi64x(0, 1, 2, 3));
+#else
+            __m128i t0 = _mm_set1_epi32(count < 4 ? int32_t(count) : 4);
+            __m128i t1 = _mm_cmpgt_epi32(t0, _mm_setr_epi32(0, 1, 2, 3));
+#endif
+            return SIMDVecMask(t1);
+        }
+        // TOBITMASK
+        UME_FORCE_INLINE uint64_t toBitmask() const {
+#if defined UME_USE_MASK_64B
+            return uint64_t(_mm256_movemask_pd(_mm256_castsi256_pd(mMask)));
+#else
+            return uint64_t(_mm_movemask_ps(_mm_castsi128_ps(mMask)));
+#endif
+        }
+        // FROMBITMASK
+        static UME_FORCE_INLINE SIMDVecMask fromBitmask(uint64_t bits) {
+#if defined UME_USE_MASK_64B
+            __m256i t0 = _mm256_setr_epi64x(1, 2, 4, 8);
+            __m256i t1 = _mm256_and_si256(_mm256_set1_epi64x(int64_t(bits)), t0);
+            return SIMDVecMask(_mm256_cmpeq_epi64(t1, t0));
+#else
+            __m128i t0 = _mm_setr_epi32(1, 2, 4, 8);
+            __m128i t1 = _mm_and_si128(_mm_set1_epi32(int32_t(bits)), t0);
+            return SIMDVecMask(_mm_cmpeq_epi32(t1, t0));
+#endif
+        }
         // EXTRACT
         UME_FORCE_INLINE bool extract(uint32_t index) const {
 #if defined UME_USE_MASK_64B
@@ -473,6 +505,7 @@ namespace SIMD {
         }
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
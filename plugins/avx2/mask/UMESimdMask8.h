@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<8> :
@@ -94,6 +95,22 @@ namespace SIMD {
         inline SIMDVecMask(SIMDVecMask const & mask) {
             this->mMask = mask.mMask;
         }
+        // FIRSTN
+        static UME_FORCE_INLINE SIMDVecMask firstN(uint32_t count) {
+            __m256i t0 = _mm256_set1_epi32(count < 8 ? int32_t(count) : 8);
+            __m256i t1 = _mm256_cmpgt_epi32(t0, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            return SIMDVecMask(t1);
+        }
+        // TOBITMASK
+        inline uint64_t toBitmask() const {
+            return uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(mMask)));
+        }
+        // FROMBITMASK
+        static UME_FORCE_INLINE SIMDVecMask fromBitmask(uint64_t bits) {
+            __m256i t0 = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+            __m256i t1 = _mm256_and_si256(_mm256_set1_epi32(int32_t(bits)), t0);
+            return SIMDVecMask(_mm256_cmpeq_epi32(t1, t0));
+        }
         // EXTRACT
         inline bool extract(uint32_t index) const {
             alignas(32) uint32_t raw[8];
@@ -263,6 +280,7 @@ namespace SIMD {
             return (raw[0] ^ raw[1] ^ raw[2] ^ raw[3] ^ raw[4] ^ raw[5] ^ raw[6] ^ raw[7]) == TRUE_VAL();
         }
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
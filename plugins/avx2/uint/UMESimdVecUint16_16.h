@@ -0,0 +1,1220 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_UINT16_16_H_
+#define UME_SIMD_VEC_UINT16_16_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+// SIMDVecMask<16> keeps a 32-bit element per lane. Narrow it to 16-bit lanes
+// before blending, and widen comparison results back when creating masks.
+#define NARROW_MASK(mask) \
+    _mm256_permute4x64_epi64(_mm256_packs_epi32(mask[0], mask[1]), 0xD8)
+#define WIDEN_MASK(x) \
+    SIMDVecMask<16>( \
+        _mm256_cvtepi16_epi32(_mm256_castsi256_si128(x)), \
+        _mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1)))
+#define BLEND(a_256i, b_256i, mask) _mm256_blendv_epi8((a_256i), (b_256i), NARROW_MASK(mask))
+
+// There is no unsigned comparison in AVX2. Flipping the sign bits of both
+// operands maps the unsigned ordering onto the signed one.
+#define CMPGT_EPU(a_256i, b_256i) \
+    _mm256_cmpgt_epi16( \
+        _mm256_xor_si256((a_256i), _mm256_set1_epi16(int16_t(0x8000))), \
+        _mm256_xor_si256((b_256i), _mm256_set1_epi16(int16_t(0x8000))))
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    template<>
+    class SIMDVec_u<uint16_t, 16> :
+        public SIMDVecUnsignedInterface<
+            SIMDVec_u<uint16_t, 16>,
+            uint16_t,
+            16,
+            SIMDVecMask<16>,
+            SIMDSwizzle<16>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_u<uint16_t, 16>,
+            SIMDVec_u<uint16_t, 8>>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_i<int16_t, 16>;
+        friend class SIMDVec_u<uint32_t, 16>;
+    private:
+        __m256i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_u(__m256i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_u(const __m256i & x) { mVec = x; }
+    public:
+
+        constexpr static uint32_t length() { return 16; }
+        constexpr static uint32_t alignment() { return 32; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_u() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint16_t i) {
+            mVec = _mm256_set1_epi16(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_u(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, uint16_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_u(static_cast<uint16_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_u(uint16_t const *p) { load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(
+            uint16_t i0, uint16_t i1, uint16_t i2, uint16_t i3,
+            uint16_t i4, uint16_t i5, uint16_t i6, uint16_t i7,
+            uint16_t i8, uint16_t i9, uint16_t i10, uint16_t i11,
+            uint16_t i12, uint16_t i13, uint16_t i14, uint16_t i15)
+        {
+            mVec = _mm256_setr_epi16(
+                i0, i1, i2, i3, i4, i5, i6, i7,
+                i8, i9, i10, i11, i12, i13, i14, i15);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE uint16_t extract(uint32_t index) const {
+            alignas(32) uint16_t raw[16];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE uint16_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_u & insert(uint32_t index, uint16_t value) {
+            alignas(32) uint16_t raw[16];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm256_load_si256((__m256i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_u, uint16_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_u, uint16_t>(index, static_cast<SIMDVec_u &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint16_t, SIMDVecMask<16>> operator() (SIMDVecMask<16> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint16_t, SIMDVecMask<16>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint16_t, SIMDVecMask<16>> operator[] (SIMDVecMask<16> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint16_t, SIMDVecMask<16>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVec_u const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (SIMDVec_u const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            mVec = BLEND(mVec, b.mVec, mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(uint16_t b) {
+            mVec = _mm256_set1_epi16(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (uint16_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+
+        // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint16_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
+        // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint16_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
+        // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint16_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_u & load(uint16_t const * p) {
+            mVec = _mm256_loadu_si256((__m256i*)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<16> const & mask, uint16_t const * p) {
+            __m256i t0 = NARROW_MASK(mask.mMask);
+            uint32_t t1 = uint32_t(_mm256_movemask_epi8(t0));
+            if (t1 == 0xFFFFFFFF) {
+                mVec = _mm256_loadu_si256((__m256i*)p);
+            }
+            else {
+                // There is no masked load for 16-bit lanes. Read only the active
+                // elements so that a loop tail does not touch memory past its end.
+                alignas(32) uint16_t raw[16];
+                _mm256_store_si256((__m256i*)raw, mVec);
+                for (uint32_t i = 0; i < 16; i++) {
+                    if (t1 & (1u << (2 * i))) raw[i] = p[i];
+                }
+                mVec = _mm256_load_si256((__m256i*)raw);
+            }
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(uint16_t const * p) {
+            mVec = _mm256_load_si256((__m256i *)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<16> const & mask, uint16_t const * p) {
+            // An aligned load never crosses a page boundary, so reading the
+            // inactive elements cannot fault.
+            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE uint16_t * store(uint16_t * p) const {
+            _mm256_storeu_si256((__m256i*)p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE uint16_t * store(SIMDVecMask<16> const & mask, uint16_t * p) const {
+            uint32_t t0 = uint32_t(_mm256_movemask_epi8(NARROW_MASK(mask.mMask)));
+            if (t0 == 0xFFFFFFFF) {
+                _mm256_storeu_si256((__m256i*)p, mVec);
+            }
+            else {
+                alignas(32) uint16_t raw[16];
+                _mm256_store_si256((__m256i*)raw, mVec);
+                for (uint32_t i = 0; i < 16; i++) {
+                    if (t0 & (1u << (2 * i))) p[i] = raw[i];
+                }
+            }
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE uint16_t * storea(uint16_t * p) const {
+            _mm256_store_si256((__m256i*)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE uint16_t * storea(SIMDVecMask<16> const & mask, uint16_t * p) const {
+            uint32_t t0 = uint32_t(_mm256_movemask_epi8(NARROW_MASK(mask.mMask)));
+            if (t0 == 0xFFFFFFFF) {
+                _mm256_store_si256((__m256i*)p, mVec);
+            }
+            else {
+                alignas(32) uint16_t raw[16];
+                _mm256_store_si256((__m256i*)raw, mVec);
+                for (uint32_t i = 0; i < 16; i++) {
+                    if (t0 & (1u << (2 * i))) p[i] = raw[i];
+                }
+            }
+            return p;
+        }
+        // SSTORE
+        UME_FORCE_INLINE uint16_t * sstore(uint16_t * p) const {
+            _mm256_stream_si256((__m256i*)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE uint16_t * sstore(SIMDVecMask<16> const & mask, uint16_t * p) const {
+            return storea(mask, p);
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = BLEND(mVec, b.mVec, mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = BLEND(mVec, _mm256_set1_epi16(b), mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_add_epi16(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (SIMDVec_u const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_add_epi16(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_u add(uint16_t b) const {
+            __m256i t0 = _mm256_add_epi16(mVec, _mm256_set1_epi16(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (uint16_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_add_epi16(mVec, _mm256_set1_epi16(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVec_u const & b) {
+            mVec = _mm256_add_epi16(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (SIMDVec_u const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_add_epi16(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(uint16_t b) {
+            mVec = _mm256_add_epi16(mVec, _mm256_set1_epi16(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (uint16_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_add_epi16(mVec, _mm256_set1_epi16(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_adds_epu16(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_adds_epu16(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint16_t b) const {
+            __m256i t0 = _mm256_adds_epu16(mVec, _mm256_set1_epi16(b));
+            return SIMDVec_u(t0);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_adds_epu16(mVec, _mm256_set1_epi16(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = _mm256_adds_epu16(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_adds_epu16(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint16_t b) {
+            mVec = _mm256_adds_epu16(mVec, _mm256_set1_epi16(b));
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_adds_epu16(mVec, _mm256_set1_epi16(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // POSTINC
+        // MPOSTINC
+        // PREFINC
+        // MPREFINC
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sub_epi16(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (SIMDVec_u const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sub_epi16(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_u sub(uint16_t b) const {
+            __m256i t0 = _mm256_sub_epi16(mVec, _mm256_set1_epi16(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (uint16_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_sub_epi16(mVec, _mm256_set1_epi16(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVec_u const & b) {
+            mVec = _mm256_sub_epi16(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (SIMDVec_u const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_sub_epi16(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(uint16_t b) {
+            mVec = _mm256_sub_epi16(mVec, _mm256_set1_epi16(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (uint16_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_sub_epi16(mVec, _mm256_set1_epi16(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_subs_epu16(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_subs_epu16(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint16_t b) const {
+            __m256i t0 = _mm256_subs_epu16(mVec, _mm256_set1_epi16(b));
+            return SIMDVec_u(t0);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_subs_epu16(mVec, _mm256_set1_epi16(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = _mm256_subs_epu16(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_subs_epu16(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint16_t b) {
+            mVec = _mm256_subs_epu16(mVec, _mm256_set1_epi16(b));
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_subs_epu16(mVec, _mm256_set1_epi16(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBFROMV
+        // MSUBFROMV
+        // SUBFROMS
+        // MSUBFROMS
+        // SUBFROMVA
+        // MSUBFROMVA
+        // SUBFROMSA
+        // MSUBFROMSA
+        // POSTDEC
+        // MPOSTDEC
+        // PREFDEC
+        // MPREFDEC
+        // MULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (SIMDVec_u const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_u mul(uint16_t b) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec, _mm256_set1_epi16(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (uint16_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec, _mm256_set1_epi16(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVec_u const & b) {
+            mVec = _mm256_mullo_epi16(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (SIMDVec_u const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(uint16_t b) {
+            mVec = _mm256_mullo_epi16(mVec, _mm256_set1_epi16(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (uint16_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_mullo_epi16(mVec, _mm256_set1_epi16(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_u mulhi(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_mulhi_epu16(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_u divide(SIMDDivider<uint16_t> const & divider) const {
+            __m256i t0 = DivideAVX2::divu16(mVec, divider);
+            return SIMDVec_u(t0);
+        }
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpeq(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi16(mVec, b.mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator== (SIMDVec_u const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<16> cmpeq(uint16_t b) const {
+            __m256i t1 = _mm256_set1_epi16(b);
+            __m256i t0 = _mm256_cmpeq_epi16(mVec, t1);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator== (uint16_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpne(SIMDVec_u const & b) const {
+            __m256i t2 = _mm256_cmpeq_epi16(mVec, b.mVec);
+            __m256i t0 = _mm256_xor_si256(t2, _mm256_set1_epi32(0xFFFFFFFF));
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator!= (SIMDVec_u const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<16> cmpne(uint16_t b) const {
+            __m256i t1 = _mm256_set1_epi16(b);
+            __m256i t2 = _mm256_cmpeq_epi16(mVec, t1);
+            __m256i t0 = _mm256_xor_si256(t2, _mm256_set1_epi32(0xFFFFFFFF));
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator!= (uint16_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpgt(SIMDVec_u const & b) const {
+            __m256i t0 = CMPGT_EPU(mVec, b.mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator> (SIMDVec_u const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<16> cmpgt(uint16_t b) const {
+            __m256i t1 = _mm256_set1_epi16(b);
+            __m256i t0 = CMPGT_EPU(mVec, t1);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator> (uint16_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<16> cmplt(SIMDVec_u const & b) const {
+            __m256i t0 = CMPGT_EPU(b.mVec, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator< (SIMDVec_u const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<16> cmplt(uint16_t b) const {
+            __m256i t1 = _mm256_set1_epi16(b);
+            __m256i t0 = CMPGT_EPU(t1, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator< (uint16_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpge(SIMDVec_u const & b) const {
+            __m256i t2 = _mm256_max_epu16(mVec, b.mVec);
+            __m256i t0 = _mm256_cmpeq_epi16(t2, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator>= (SIMDVec_u const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<16> cmpge(uint16_t b) const {
+            __m256i t1 = _mm256_set1_epi16(b);
+            __m256i t2 = _mm256_max_epu16(mVec, t1);
+            __m256i t0 = _mm256_cmpeq_epi16(t2, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator>= (uint16_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmple(SIMDVec_u const & b) const {
+            __m256i t2 = _mm256_min_epu16(mVec, b.mVec);
+            __m256i t0 = _mm256_cmpeq_epi16(t2, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator<= (SIMDVec_u const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<16> cmple(uint16_t b) const {
+            __m256i t1 = _mm256_set1_epi16(b);
+            __m256i t2 = _mm256_min_epu16(mVec, t1);
+            __m256i t0 = _mm256_cmpeq_epi16(t2, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator<= (uint16_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        // CMPES
+        // UNIQUE
+        // HADD
+        // MHADD
+        // HADDS
+        // MHADDS
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+        // FMULADDV
+        // MFMULADDV
+        // FMULSUBV
+        // MFMULSUBV
+        // FADDMULV
+        // MFADDMULV
+        // FSUBMULV
+        // MFSUBMULV
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_max_epu16(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_max_epu16(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_u max(uint16_t b) const {
+            __m256i t0 = _mm256_max_epu16(mVec, _mm256_set1_epi16(b));
+            return SIMDVec_u(t0);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_max_epu16(mVec, _mm256_set1_epi16(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVec_u const & b) {
+            mVec = _mm256_max_epu16(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_max_epu16(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(uint16_t b) {
+            mVec = _mm256_max_epu16(mVec, _mm256_set1_epi16(b));
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_max_epu16(mVec, _mm256_set1_epi16(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_min_epu16(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_min_epu16(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_u min(uint16_t b) const {
+            __m256i t0 = _mm256_min_epu16(mVec, _mm256_set1_epi16(b));
+            return SIMDVec_u(t0);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_min_epu16(mVec, _mm256_set1_epi16(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVec_u const & b) {
+            mVec = _mm256_min_epu16(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_min_epu16(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(uint16_t b) {
+            mVec = _mm256_min_epu16(mVec, _mm256_set1_epi16(b));
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_min_epu16(mVec, _mm256_set1_epi16(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // HMAX
+        // MHMAX
+        // IMAX
+        // MIMAX
+        // HMIN
+        // MHMIN
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (SIMDVec_u const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_u band(uint16_t b) const {
+            __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi16(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (uint16_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi16(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVec_u const & b) {
+            mVec = _mm256_and_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(uint16_t b) {
+            mVec = _mm256_and_si256(mVec, _mm256_set1_epi16(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (uint16_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi16(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (SIMDVec_u const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_u bor(uint16_t b) const {
+            __m256i t0 = _mm256_or_si256(mVec, _mm256_set1_epi16(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (uint16_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_or_si256(mVec, _mm256_set1_epi16(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVec_u const & b) {
+            mVec = _mm256_or_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(uint16_t b) {
+            mVec = _mm256_or_si256(mVec, _mm256_set1_epi16(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (uint16_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_or_si256(mVec, _mm256_set1_epi16(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SIMDVec_u const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(uint16_t b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi16(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (uint16_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi16(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVec_u const & b) {
+            mVec = _mm256_xor_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SIMDVec_u const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(uint16_t b) {
+            mVec = _mm256_xor_si256(mVec, _mm256_set1_epi16(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (uint16_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi16(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_u bnot() const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(0xFFFFFFFF));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<16> const & mask) const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(0xFFFFFFFF));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota() {
+            mVec = _mm256_xor_si256(mVec, _mm256_set1_epi32(0xFFFFFFFF));
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota(SIMDVecMask<16> const & mask) {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(0xFFFFFFFF));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_u popcnt() const {
+            __m256i t0 = BitCountAVX2::popcnt16(mVec);
+            return SIMDVec_u(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_u lzcnt() const {
+            __m256i t0 = BitCountAVX2::lzcnt16(mVec);
+            return SIMDVec_u(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_u tzcnt() const {
+            __m256i t0 = BitCountAVX2::tzcnt16(mVec);
+            return SIMDVec_u(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_u bitrev() const {
+            __m256i t0 = BitCountAVX2::bitrev16(mVec);
+            return SIMDVec_u(t0);
+        }
+        // HBAND
+        // MHBAND
+        // HBANDS
+        // MHBANDS
+        // HBOR
+        // MHBOR
+        // HBORS
+        // MHBORS
+        // HBXOR
+        // MHBXOR
+        // HBXORS
+        // MHBXORS
+
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+    private:
+        // AVX2 has no per-element 16-bit shifts. Shift the even and the odd
+        // elements as 32-bit lanes, each with its own count, and merge.
+        UME_FORCE_INLINE static __m256i sllv16(__m256i const & a, __m256i const & n) {
+            __m256i t0 = _mm256_set1_epi32(0x0000FFFF);
+            __m256i t1 = _mm256_sllv_epi32(a, _mm256_and_si256(n, t0));
+            __m256i t2 = _mm256_sllv_epi32(_mm256_andnot_si256(t0, a), _mm256_srli_epi32(n, 16));
+            return _mm256_blend_epi16(t1, t2, 0xAA);
+        }
+        UME_FORCE_INLINE static __m256i srlv16(__m256i const & a, __m256i const & n) {
+            __m256i t0 = _mm256_set1_epi32(0x0000FFFF);
+            __m256i t1 = _mm256_srlv_epi32(_mm256_and_si256(a, t0), _mm256_and_si256(n, t0));
+            __m256i t2 = _mm256_srlv_epi32(a, _mm256_srli_epi32(n, 16));
+            return _mm256_blend_epi16(t1, t2, 0xAA);
+        }
+    public:
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
+            __m256i t0 = sllv16(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = sllv16(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint16_t b) const {
+            __m256i t0 = _mm256_sll_epi16(mVec, _mm_cvtsi32_si128(int(b)));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint16_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_sll_epi16(mVec, _mm_cvtsi32_si128(int(b)));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u const & b) {
+            mVec = sllv16(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = sllv16(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint16_t b) {
+            mVec = _mm256_sll_epi16(mVec, _mm_cvtsi32_si128(int(b)));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint16_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_sll_epi16(mVec, _mm_cvtsi32_si128(int(b)));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u const & b) const {
+            __m256i t0 = srlv16(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = srlv16(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint16_t b) const {
+            __m256i t0 = _mm256_srl_epi16(mVec, _mm_cvtsi32_si128(int(b)));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint16_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i t0 = _mm256_srl_epi16(mVec, _mm_cvtsi32_si128(int(b)));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u const & b) {
+            mVec = srlv16(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = srlv16(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint16_t b) {
+            mVec = _mm256_srl_epi16(mVec, _mm_cvtsi32_si128(int(b)));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint16_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i t0 = _mm256_srl_epi16(mVec, _mm_cvtsi32_si128(int(b)));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+
+        // PACK
+        // PACKLO
+        // PACKHI
+        // UNPACK
+        // UNPACKLO
+        // UNPACKHI
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_u<uint32_t, 16>() const;
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_u<uint8_t, 16>() const;
+
+        // UTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int16_t, 16>() const;
+        // UTOF
+        // -
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#undef NARROW_MASK
+#undef WIDEN_MASK
+#undef BLEND
+#undef CMPGT_EPU
+
+#endif
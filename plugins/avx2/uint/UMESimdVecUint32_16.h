@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint32_t, 16> :
@@ -55,6 +56,7 @@ namespace SIMD {
         // Conversion operators require access to private members.
         friend class SIMDVec_i<int32_t, 16>;
         friend class SIMDVec_f<float, 16>;
+        friend class SIMDVec_u<uint16_t, 16>;
 
         friend class SIMDVec_u<uint32_t, 32>;
     private:
@@ -176,8 +178,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
@@ -187,8 +198,8 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<16> const & mask, uint32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_loadu_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask[0]);
+            __m256i t1 = _mm256_maskload_epi32((int const *)(p + 8), mask.mMask[1]);
             mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             return *this;
@@ -201,8 +212,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<16> const & mask, uint32_t const * p) {
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m256i t1 = _mm256_load_si256((__m256i*)(p + 8));
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask[0]);
+            __m256i t1 = _mm256_maskload_epi32((int const *)(p + 8), mask.mMask[1]);
             mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             return *this;
@@ -231,10 +242,48 @@ namespace SIMD {
             _mm256_maskstore_epi32((int*)(p + 8), mask.mMask[1], mVec[1]);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE uint32_t* sstore(uint32_t * p) const {
+            _mm256_stream_si256((__m256i*)p, mVec[0]);
+            _mm256_stream_si256((__m256i*)(p + 8), mVec[1]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE uint32_t* sstore(SIMDVecMask<16> const & mask, uint32_t * p) const {
+            return storea(mask, p);
+        }
         // BLENDV
         // BLENDS
         // SWIZZLE 
         // SWIZZLEA
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_u permute(SIMDVec_u const & indices) const {
+            __m256i t0 = permute16(mVec[0], mVec[1], indices.mVec[0]);
+            __m256i t1 = permute16(mVec[0], mVec[1], indices.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_u permute2(SIMDVec_u const & b, SIMDVec_u const & indices) const {
+            // Bit 4 of the index selects the source vector.
+            __m256 t0 = _mm256_castsi256_ps(_mm256_slli_epi32(indices.mVec[0], 27));
+            __m256 t1 = _mm256_castsi256_ps(_mm256_slli_epi32(indices.mVec[1], 27));
+            __m256i t2 = permute16(mVec[0], mVec[1], indices.mVec[0]);
+            __m256i t3 = permute16(b.mVec[0], b.mVec[1], indices.mVec[0]);
+            __m256i t4 = permute16(mVec[0], mVec[1], indices.mVec[1]);
+            __m256i t5 = permute16(b.mVec[0], b.mVec[1], indices.mVec[1]);
+            __m256i t6 = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t2), _mm256_castsi256_ps(t3), t0));
+            __m256i t7 = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t4), _mm256_castsi256_ps(t5), t1));
+            return SIMDVec_u(t6, t7);
+        }
+    private:
+        // Select element (idx % 16) of the 16-element vector held in (lo, hi).
+        UME_FORCE_INLINE static __m256i permute16(__m256i const & lo, __m256i const & hi, __m256i const & idx) {
+            __m256i t0 = _mm256_permutevar8x32_epi32(lo, idx);
+            __m256i t1 = _mm256_permutevar8x32_epi32(hi, idx);
+            __m256 t2 = _mm256_castsi256_ps(_mm256_slli_epi32(idx, 28));
+            return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t0), _mm256_castsi256_ps(t1), t2));
+        }
+    public:
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
@@ -601,6 +650,12 @@ namespace SIMD {
             mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_u mulhi(SIMDVec_u const & b) const {
+            __m256i t0 = MulHighAVX2::mulhiu32(mVec[0], b.mVec[0]);
+            __m256i t1 = MulHighAVX2::mulhiu32(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
         // DIVV
         UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
             return div(b);
@@ -621,6 +676,12 @@ namespace SIMD {
             return diva(b);
         }
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_u divide(SIMDDivider<uint32_t> const & divider) const {
+            __m256i t0 = DivideAVX2::divu32(mVec[0], divider);
+            __m256i t1 = DivideAVX2::divu32(mVec[1], divider);
+            return SIMDVec_u(t0, t1);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1741,6 +1802,7 @@ namespace SIMD {
 
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
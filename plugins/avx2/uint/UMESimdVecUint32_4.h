@@ -48,6 +48,15 @@
                 0 \
                 ))
 
+    #define MASK_LOAD(int32_addr, mask_256i) \
+        _mm_maskload_epi32( \
+            (int const *)int32_addr, \
+            _mm256_extractf128_si256( \
+                _mm256_permutevar8x32_epi32( \
+                    mask_256i, \
+                    _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0)), \
+                0))
+
     #define MASK_STORE(int32_addr, mask_256i, a_128i) \
         _mm_maskstore_epi32( \
             int32_addr, \
@@ -61,12 +70,14 @@
 
 #else
     #define BLEND(a_128i, b_128i, mask_128i) _mm_blendv_epi8(a_128i, b_128i, mask_128i)
+    #define MASK_LOAD(int32_addr, mask_128i) _mm_maskload_epi32((int const *)int32_addr, mask_128i)
     #define MASK_STORE(int32_addr, mask_128i, a_128i) _mm_maskstore_epi32(int32_addr, mask_128i, a_128i)
 #endif
 
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint32_t, 4> :
@@ -190,8 +201,17 @@ namespace SIMD {
             return *this;
         }
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
             mVec = _mm_loadu_si128((__m128i*)p);
@@ -199,7 +219,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<4> const & mask, uint32_t const * p) {
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
+            __m128i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -210,7 +230,7 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<4> const & mask, uint32_t const * p) {
-            __m128i t0 = _mm_load_si128((__m128i*)p);
+            __m128i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -234,6 +254,15 @@ namespace SIMD {
             MASK_STORE((int32_t*)p, mask.mMask, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE uint32_t * sstore(uint32_t * p) const {
+            _mm_stream_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE uint32_t * sstore(SIMDVecMask<4> const & mask, uint32_t * p) const {
+            return storea(mask, p);
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m128i t0 = BLEND(mVec, b.mVec, mask.mMask);
@@ -267,6 +296,106 @@ namespace SIMD {
             mVec = _mm_castps_si128(t1);
             return *this;
         }
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m128i sortNetwork(__m128i const & a, bool descending, bool bitonic) {
+            __m128i t0 = _mm_shuffle_epi32(a, 0xB1);
+            __m128i t1 = _mm_setr_epi32(0, -1, -1, 0);
+            __m128i t2 = _mm_min_epu32(a, t0);
+            __m128i t3 = _mm_max_epu32(a, t0);
+            __m128i t4 = descending ? _mm_blendv_epi8(t3, t2, t1) : _mm_blendv_epi8(t2, t3, t1);
+            __m128i t5 = bitonic ? a : t4;
+            __m128i t6 = _mm_shuffle_epi32(t5, 0x4E);
+            __m128i t7 = _mm_setr_epi32(0, 0, -1, -1);
+            __m128i t8 = _mm_min_epu32(t5, t6);
+            __m128i t9 = _mm_max_epu32(t5, t6);
+            __m128i t10 = descending ? _mm_blendv_epi8(t9, t8, t7) : _mm_blendv_epi8(t8, t9, t7);
+            __m128i t11 = _mm_shuffle_epi32(t10, 0xB1);
+            __m128i t12 = _mm_setr_epi32(0, -1, 0, -1);
+            __m128i t13 = _mm_min_epu32(t10, t11);
+            __m128i t14 = _mm_max_epu32(t10, t11);
+            __m128i t15 = descending ? _mm_blendv_epi8(t14, t13, t12) : _mm_blendv_epi8(t13, t14, t12);
+            return t15;
+        }
+        UME_FORCE_INLINE static __m128i sortNetwork(__m128i const & a, __m128i & payload, bool descending, bool bitonic) {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m128i t1 = _mm_shuffle_epi32(a, 0xB1);
+            __m128i t2 = _mm_shuffle_epi32(payload, 0xB1);
+            __m128i t3 = _mm_setr_epi32(0, -1, -1, 0);
+            __m128i t4 = _mm_cmpgt_epi32(_mm_xor_si128(a, t0), _mm_xor_si128(t1, t0));
+            __m128i t5 = _mm_cmpgt_epi32(_mm_xor_si128(t1, t0), _mm_xor_si128(a, t0));
+            __m128i t6 = descending ? _mm_blendv_epi8(t5, t4, t3) : _mm_blendv_epi8(t4, t5, t3);
+            __m128i t7 = _mm_blendv_epi8(a, t1, t6);
+            __m128i t8 = _mm_blendv_epi8(payload, t2, t6);
+            __m128i t9 = bitonic ? a : t7;
+            __m128i t10 = bitonic ? payload : t8;
+            __m128i t11 = _mm_shuffle_epi32(t9, 0x4E);
+            __m128i t12 = _mm_shuffle_epi32(t10, 0x4E);
+            __m128i t13 = _mm_setr_epi32(0, 0, -1, -1);
+            __m128i t14 = _mm_cmpgt_epi32(_mm_xor_si128(t9, t0), _mm_xor_si128(t11, t0));
+            __m128i t15 = _mm_cmpgt_epi32(_mm_xor_si128(t11, t0), _mm_xor_si128(t9, t0));
+            __m128i t16 = descending ? _mm_blendv_epi8(t15, t14, t13) : _mm_blendv_epi8(t14, t15, t13);
+            __m128i t17 = _mm_blendv_epi8(t9, t11, t16);
+            __m128i t18 = _mm_blendv_epi8(t10, t12, t16);
+            __m128i t19 = _mm_shuffle_epi32(t17, 0xB1);
+            __m128i t20 = _mm_shuffle_epi32(t18, 0xB1);
+            __m128i t21 = _mm_setr_epi32(0, -1, 0, -1);
+            __m128i t22 = _mm_cmpgt_epi32(_mm_xor_si128(t17, t0), _mm_xor_si128(t19, t0));
+            __m128i t23 = _mm_cmpgt_epi32(_mm_xor_si128(t19, t0), _mm_xor_si128(t17, t0));
+            __m128i t24 = descending ? _mm_blendv_epi8(t23, t22, t21) : _mm_blendv_epi8(t22, t23, t21);
+            __m128i t25 = _mm_blendv_epi8(t17, t19, t24);
+            __m128i t26 = _mm_blendv_epi8(t18, t20, t24);
+            payload = t26;
+            return t25;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() const {
+            __m128i t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_u(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() const {
+            __m128i t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_u(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) const {
+            __m128i t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_u(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) const {
+            __m128i t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_u(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_u bsorta() const {
+            __m128i t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_u bsortd() const {
+            __m128i t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_u bsorta(SIMDVec_u & payload) const {
+            __m128i t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_u bsortd(SIMDVec_u & payload) const {
+            __m128i t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_u(t0);
+        }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             __m128i t0 = _mm_add_epi32(mVec, b.mVec);
@@ -571,6 +700,11 @@ namespace SIMD {
             mVec = BLEND(mVec, t1, mask.mMask);
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_u mulhi(SIMDVec_u const & b) const {
+            __m128i t0 = MulHighAVX2::mulhiu32(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // DIVV
         // MDIVV
         // DIVS
@@ -579,6 +713,11 @@ namespace SIMD {
         // MDIVVA
         // DIVSA
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_u divide(SIMDDivider<uint32_t> const & divider) const {
+            __m128i t0 = DivideAVX2::divu32(mVec, divider);
+            return SIMDVec_u(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -724,14 +863,22 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            alignas(16) uint32_t raw[4];
-            _mm_store_si128((__m128i*)raw, mVec);
-            for (unsigned int i = 0; i < 3; i++) {
-                for (unsigned int j = i + 1; j < 4; j++) {
-                    if (raw[i] == raw[j]) return false;
-                }
-            }
-            return true;
+            __m128i t0 = _mm_shuffle_epi32(mVec, _MM_SHUFFLE(2, 1, 0, 3));
+            __m128i t1 = _mm_shuffle_epi32(mVec, _MM_SHUFFLE(1, 0, 3, 2));
+            __m128i t2 = _mm_or_si128(_mm_cmpeq_epi32(mVec, t0), _mm_cmpeq_epi32(mVec, t1));
+            return _mm_testz_si128(t2, t2) != 0;
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            // Compare with the vector rotated by 1, 2 and 3 elements and keep
+            // the bits of the elements that did not wrap around.
+            __m128i t0 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, _MM_SHUFFLE(2, 1, 0, 3)));
+            __m128i t1 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, _MM_SHUFFLE(1, 0, 3, 2)));
+            __m128i t2 = _mm_cmpeq_epi32(mVec, _mm_shuffle_epi32(mVec, _MM_SHUFFLE(0, 3, 2, 1)));
+            __m128i t3 = _mm_and_si128(t0, _mm_setr_epi32(0, 1, 2, 4));
+            __m128i t4 = _mm_and_si128(t1, _mm_setr_epi32(0, 0, 1, 2));
+            __m128i t5 = _mm_and_si128(t2, _mm_setr_epi32(0, 0, 0, 1));
+            return SIMDVec_u(_mm_or_si128(t3, _mm_or_si128(t4, t5)));
         }
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
@@ -1435,10 +1582,12 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
 #undef BLEND
+#undef MASK_LOAD
 #undef MASK_STORE
 
 #endif
@@ -54,16 +54,19 @@
 
 #if defined UME_USE_MASK_64B
 #define BLEND(a_256i, b_256i, mask_256i) _mm256_blendv_epi8((a_256i), (b_256i), mask_256i)
-#define MASK_LOAD(a_256i, mask_256i) _mm256_maskload_epi64((a_256i), mask_256i)
-#define MASK_STORE(ptr_u64, mask_256i, a_256i) _mm256_maskstore_epi64((__int64 *)ptr_u64, mask_256i, a_256i);
+#define MASK_LOAD(ptr_u64, mask_256i) _mm256_maskload_epi64((long long const *)ptr_u64, mask_256i)
+#define MASK_STORE(ptr_u64, mask_256i, a_256i) _mm256_maskstore_epi64((long long *)ptr_u64, mask_256i, a_256i)
+#define MOVEMASK(mask_256i) _mm256_movemask_pd(_mm256_castsi256_pd(mask_256i))
 #else
 #define BLEND(a_256i, b_256i, mask_128i) _mm256_blendv_epi8((a_256i), (b_256i), (_mm256_cvtepi32_epi64(mask_128i)))
-#define MASK_LOAD(a_256i, mask_128i) _mm256_maskload_epi64((a_256i), (_mm256_cvtepi32_epi64(mask_128i)))
-#define MASK_STORE(ptr_u64, mask_128i, a_256i) _mm256_maskstore_epi64((__int64 *)ptr_u64, (_mm256_cvtepi32_epi64(mask_128i)), a_256i);
+#define MASK_LOAD(ptr_u64, mask_128i) _mm256_maskload_epi64((long long const *)ptr_u64, (_mm256_cvtepi32_epi64(mask_128i)))
+#define MASK_STORE(ptr_u64, mask_128i, a_256i) _mm256_maskstore_epi64((long long *)ptr_u64, (_mm256_cvtepi32_epi64(mask_128i)), a_256i)
+#define MOVEMASK(mask_128i) _mm_movemask_ps(_mm_castsi128_ps(mask_128i))
 #endif
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint64_t, 4> :
@@ -179,8 +182,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint64_t const *p) {
@@ -189,13 +201,8 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<4> const & mask, uint64_t const *p) {
-#if defined __GNUG__
-            // G++ (so far 5.3) does not provide '_mm256_maskload_epi64' intrinsic
-            __m256i t0 = _mm256_loadu_si256((const __m256i *) p);
+            __m256i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
-#else
-            mVec = MASK_LOAD((__int64 const*)p, mask.mMask);
-#endif
             return *this;
         }
         // LOADA
@@ -205,13 +212,8 @@ namespace SIMD {
         }
         // MLOADA
         UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<4> const & mask, uint64_t const *p) {
-#if defined __GNUG__
-            // G++ (so far 5.3) does not provide '_mm256_maskload_epi64' intrinsic
-            __m256i t0 = _mm256_load_si256((const __m256i *) p);
+            __m256i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
-#else
-            mVec = MASK_LOAD((__int64 const*)p, mask.mMask);
-#endif
             return *this;
         }
         // STORE
@@ -221,14 +223,7 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE uint64_t* store(SIMDVecMask<4> const & mask, uint64_t* p) const {
-#if defined __GNUG__
-            // G++ (so far 5.3) does not provide '_mm256_maskstore_epi64' intrinsic
-            __m256i t0 = _mm256_loadu_si256((const __m256i *) p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i *)p, t1);
-#else
             MASK_STORE(p, mask.mMask, mVec);
-#endif
             return p;
         }
         // STOREA
@@ -238,16 +233,40 @@ namespace SIMD {
         }
         // MSTOREA
         UME_FORCE_INLINE uint64_t* storea(SIMDVecMask<4> const & mask, uint64_t* p) const {
-#if defined __GNUG__
-            // G++ (so far 5.3) does not provide '_mm256_maskstore_epi64' intrinsic
-            __m256i t0 = _mm256_load_si256((const __m256i *) p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_store_si256((__m256i *)p, t1);
-#else
             MASK_STORE(p, mask.mMask, mVec);
-#endif
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE uint64_t* sstore(uint64_t* p) const {
+            _mm256_stream_si256((__m256i *)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE uint64_t* sstore(SIMDVecMask<4> const & mask, uint64_t* p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_u compress(SIMDVecMask<4> const & mask) const {
+            uint32_t t0 = CompressTableAVX2::compress4x64(MOVEMASK(mask.mMask));
+            __m256i t1 = _mm256_permutevar8x32_epi32(mVec, CompressTableAVX2::index(t0));
+            __m256i t2 = _mm256_and_si256(t1, CompressTableAVX2::prefix(t0));
+            return SIMDVec_u(t2);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, uint64_t * p) const {
+            uint32_t t0 = CompressTableAVX2::compress4x64(MOVEMASK(mask.mMask));
+            __m256i t1 = _mm256_permutevar8x32_epi32(mVec, CompressTableAVX2::index(t0));
+            _mm256_maskstore_epi64((long long *)p, CompressTableAVX2::prefix(t0), t1);
+            return CompressTableAVX2::count(t0);
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<4> const & mask, uint64_t const * p) {
+            uint32_t t0 = CompressTableAVX2::expand4x64(MOVEMASK(mask.mMask));
+            __m256i t1 = _mm256_maskload_epi64((long long const *)p, CompressTableAVX2::prefix(t0));
+            __m256i t2 = _mm256_permutevar8x32_epi32(t1, CompressTableAVX2::index(t0));
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return CompressTableAVX2::count(t0);
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
@@ -263,8 +282,134 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+    private:
+        // Low 64 bits of a 64x64-bit product, built from 32x32-bit partial
+        // products: lo(a)*lo(b) + ((hi(a)*lo(b) + lo(a)*hi(b)) << 32).
+        UME_FORCE_INLINE static __m256i mul64(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_mul_epu32(a, b);
+            __m256i t1 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+            __m256i t2 = _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32));
+            __m256i t3 = _mm256_slli_epi64(_mm256_add_epi64(t1, t2), 32);
+            return _mm256_add_epi64(t0, t3);
+        }
+        // AVX2 only compares signed 64-bit elements. Flipping the sign bits
+        // maps the unsigned order onto the signed one.
+        UME_FORCE_INLINE static __m256i cmpgt64(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_set1_epi64x(0x8000000000000000);
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(a, t0), _mm256_xor_si256(b, t0));
+        }
+        // Converts a 64-bit element compare result to the mask layout.
+        UME_FORCE_INLINE static SIMDVecMask<4> toMask(__m256i const & a) {
+#if defined UME_USE_MASK_64B
+            return SIMDVecMask<4>(a);
+#else
+            __m256i t0 = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+            __m256i t1 = _mm256_permutevar8x32_epi32(a, t0);
+            __m128i t2 = _mm256_castsi256_si128(t1);
+            return SIMDVecMask<4>(t2);
+#endif
+        }
+
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_set1_epi64x(0x8000000000000000);
+            __m256i t1 = _mm256_permute4x64_epi64(a, 0xB1);
+            __m256i t2 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256i t3 = _mm256_cmpgt_epi64(_mm256_xor_si256(a, t0), _mm256_xor_si256(t1, t0));
+            __m256i t4 = _mm256_xor_si256(t3, t2);
+            __m256i t5 = descending ? _mm256_blendv_epi8(t1, a, t4) : _mm256_blendv_epi8(a, t1, t4);
+            __m256i t6 = bitonic ? a : t5;
+            __m256i t7 = bitonic ? a : t6;
+            __m256i t8 = _mm256_permute4x64_epi64(t7, 0x4E);
+            __m256i t9 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256i t10 = _mm256_cmpgt_epi64(_mm256_xor_si256(t7, t0), _mm256_xor_si256(t8, t0));
+            __m256i t11 = _mm256_xor_si256(t10, t9);
+            __m256i t12 = descending ? _mm256_blendv_epi8(t8, t7, t11) : _mm256_blendv_epi8(t7, t8, t11);
+            __m256i t13 = _mm256_permute4x64_epi64(t12, 0xB1);
+            __m256i t14 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256i t15 = _mm256_cmpgt_epi64(_mm256_xor_si256(t12, t0), _mm256_xor_si256(t13, t0));
+            __m256i t16 = _mm256_xor_si256(t15, t14);
+            __m256i t17 = descending ? _mm256_blendv_epi8(t13, t12, t16) : _mm256_blendv_epi8(t12, t13, t16);
+            return t17;
+        }
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, __m256i & payload, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_set1_epi64x(0x8000000000000000);
+            __m256i t1 = _mm256_permute4x64_epi64(a, 0xB1);
+            __m256i t2 = _mm256_permute4x64_epi64(payload, 0xB1);
+            __m256i t3 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256i t4 = _mm256_cmpgt_epi64(_mm256_xor_si256(a, t0), _mm256_xor_si256(t1, t0));
+            __m256i t5 = _mm256_cmpgt_epi64(_mm256_xor_si256(t1, t0), _mm256_xor_si256(a, t0));
+            __m256i t6 = descending ? _mm256_blendv_epi8(t5, t4, t3) : _mm256_blendv_epi8(t4, t5, t3);
+            __m256i t7 = _mm256_blendv_epi8(a, t1, t6);
+            __m256i t8 = _mm256_blendv_epi8(payload, t2, t6);
+            __m256i t9 = bitonic ? a : t7;
+            __m256i t10 = bitonic ? payload : t8;
+            __m256i t11 = _mm256_permute4x64_epi64(t9, 0x4E);
+            __m256i t12 = _mm256_permute4x64_epi64(t10, 0x4E);
+            __m256i t13 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256i t14 = _mm256_cmpgt_epi64(_mm256_xor_si256(t9, t0), _mm256_xor_si256(t11, t0));
+            __m256i t15 = _mm256_cmpgt_epi64(_mm256_xor_si256(t11, t0), _mm256_xor_si256(t9, t0));
+            __m256i t16 = descending ? _mm256_blendv_epi8(t15, t14, t13) : _mm256_blendv_epi8(t14, t15, t13);
+            __m256i t17 = _mm256_blendv_epi8(t9, t11, t16);
+            __m256i t18 = _mm256_blendv_epi8(t10, t12, t16);
+            __m256i t19 = _mm256_permute4x64_epi64(t17, 0xB1);
+            __m256i t20 = _mm256_permute4x64_epi64(t18, 0xB1);
+            __m256i t21 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256i t22 = _mm256_cmpgt_epi64(_mm256_xor_si256(t17, t0), _mm256_xor_si256(t19, t0));
+            __m256i t23 = _mm256_cmpgt_epi64(_mm256_xor_si256(t19, t0), _mm256_xor_si256(t17, t0));
+            __m256i t24 = descending ? _mm256_blendv_epi8(t23, t22, t21) : _mm256_blendv_epi8(t22, t23, t21);
+            __m256i t25 = _mm256_blendv_epi8(t17, t19, t24);
+            __m256i t26 = _mm256_blendv_epi8(t18, t20, t24);
+            payload = t26;
+            return t25;
+        }
+    public:
         // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() const {
+            __m256i t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_u(t0);
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() const {
+            __m256i t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_u(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_u(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_u(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_u bsorta() const {
+            __m256i t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_u bsortd() const {
+            __m256i t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_u bsorta(SIMDVec_u & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_u bsortd(SIMDVec_u & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_u(t0);
+        }
 
         // ADDV
         // MADDV
@@ -315,13 +460,66 @@ namespace SIMD {
         // PREFDEC
         // MPREFDEC
         // MULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVec_u const & b) const {
+            __m256i t0 = mul64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (SIMDVec_u const & b) const {
+            return mul(b);
+        }
         // MMULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = mul64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // MULS
+        UME_FORCE_INLINE SIMDVec_u mul(uint64_t b) const {
+            __m256i t0 = mul64(mVec, SET1_EPI64(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (uint64_t b) const {
+            return mul(b);
+        }
         // MMULS
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = mul64(mVec, SET1_EPI64(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // MULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVec_u const & b) {
+            mVec = mul64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (SIMDVec_u const & b) {
+            return mula(b);
+        }
         // MMULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = mul64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(uint64_t b) {
+            mVec = mul64(mVec, SET1_EPI64(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (uint64_t b) {
+            return mula(b);
+        }
         // MMULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = mul64(mVec, SET1_EPI64(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_u mulhi(SIMDVec_u const & b) const {
+            __m256i t0 = MulHighAVX2::mulhiu64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // DIVV
         // MDIVV
         // DIVS
@@ -330,6 +528,11 @@ namespace SIMD {
         // MDIVVA
         // DIVSA
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_u divide(SIMDDivider<uint64_t> const & divider) const {
+            __m256i t0 = DivideAVX2::divu64(mVec, divider);
+            return SIMDVec_u(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -339,20 +542,134 @@ namespace SIMD {
         // RCPSA
         // MRCPSA
         // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, b.mVec);
+            return toMask(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (SIMDVec_u const & b) const {
+            return cmpeq(b);
+        }
         // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpeq_epi64(mVec, t0);
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (uint64_t b) const {
+            return cmpeq(b);
+        }
         // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, b.mVec);
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_set1_epi32(-1));
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (SIMDVec_u const & b) const {
+            return cmpne(b);
+        }
         // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpeq_epi64(mVec, t0);
+            __m256i t2 = _mm256_xor_si256(t1, _mm256_set1_epi32(-1));
+            return toMask(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (uint64_t b) const {
+            return cmpne(b);
+        }
         // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(SIMDVec_u const & b) const {
+            __m256i t0 = cmpgt64(mVec, b.mVec);
+            return toMask(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (SIMDVec_u const & b) const {
+            return cmpgt(b);
+        }
         // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(mVec, t0);
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (uint64_t b) const {
+            return cmpgt(b);
+        }
         // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(SIMDVec_u const & b) const {
+            __m256i t0 = cmpgt64(b.mVec, mVec);
+            return toMask(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (SIMDVec_u const & b) const {
+            return cmplt(b);
+        }
         // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(t0, mVec);
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (uint64_t b) const {
+            return cmplt(b);
+        }
         // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(SIMDVec_u const & b) const {
+            __m256i t0 = cmpgt64(b.mVec, mVec);
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_set1_epi32(-1));
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (SIMDVec_u const & b) const {
+            return cmpge(b);
+        }
         // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(t0, mVec);
+            __m256i t2 = _mm256_xor_si256(t1, _mm256_set1_epi32(-1));
+            return toMask(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (uint64_t b) const {
+            return cmpge(b);
+        }
         // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(SIMDVec_u const & b) const {
+            __m256i t0 = cmpgt64(mVec, b.mVec);
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_set1_epi32(-1));
+            return toMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (SIMDVec_u const & b) const {
+            return cmple(b);
+        }
         // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(mVec, t0);
+            __m256i t2 = _mm256_xor_si256(t1, _mm256_set1_epi32(-1));
+            return toMask(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (uint64_t b) const {
+            return cmple(b);
+        }
         // CMPEV
         // CMPES
         // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            __m256i t0 = _mm256_permute4x64_epi64(mVec, _MM_SHUFFLE(2, 1, 0, 3));
+            __m256i t1 = _mm256_permute4x64_epi64(mVec, _MM_SHUFFLE(1, 0, 3, 2));
+            __m256i t2 = _mm256_or_si256(_mm256_cmpeq_epi64(mVec, t0), _mm256_cmpeq_epi64(mVec, t1));
+            return _mm256_testz_si256(t2, t2) != 0;
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            // Compare with the vector rotated by 1, 2 and 3 elements and keep
+            // the bits of the elements that did not wrap around.
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, _mm256_permute4x64_epi64(mVec, _MM_SHUFFLE(2, 1, 0, 3)));
+            __m256i t1 = _mm256_cmpeq_epi64(mVec, _mm256_permute4x64_epi64(mVec, _MM_SHUFFLE(1, 0, 3, 2)));
+            __m256i t2 = _mm256_cmpeq_epi64(mVec, _mm256_permute4x64_epi64(mVec, _MM_SHUFFLE(0, 3, 2, 1)));
+            __m256i t3 = _mm256_and_si256(t0, _mm256_setr_epi64x(0, 1, 2, 4));
+            __m256i t4 = _mm256_and_si256(t1, _mm256_setr_epi64x(0, 0, 1, 2));
+            __m256i t5 = _mm256_and_si256(t2, _mm256_setr_epi64x(0, 0, 0, 1));
+            return SIMDVec_u(_mm256_or_si256(t3, _mm256_or_si256(t4, t5)));
+        }
         // HADD
         // MHADD
         // HADDS
@@ -372,21 +689,121 @@ namespace SIMD {
         // MFSUBMULV
 
         // MAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVec_u const & b) const {
+            __m256i t1 = cmpgt64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(b.mVec, mVec, t1);
+            return SIMDVec_u(t2);
+        }
         // MMAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t1 = cmpgt64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(b.mVec, mVec, t1);
+            __m256i t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_u(t3);
+        }
         // MAXS
+        UME_FORCE_INLINE SIMDVec_u max(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec, t1);
+            return SIMDVec_u(t2);
+        }
         // MMAXS
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec, t1);
+            __m256i t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_u(t3);
+        }
         // MAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVec_u const & b) {
+            __m256i t1 = cmpgt64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(b.mVec, mVec, t1);
+            mVec = t2;
+            return *this;
+        }
         // MMAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t1 = cmpgt64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(b.mVec, mVec, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // MAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec, t1);
+            mVec = t2;
+            return *this;
+        }
         // MMAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // MINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVec_u const & b) const {
+            __m256i t1 = cmpgt64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, b.mVec, t1);
+            return SIMDVec_u(t2);
+        }
         // MMINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t1 = cmpgt64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, b.mVec, t1);
+            __m256i t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_u(t3);
+        }
         // MINS
+        UME_FORCE_INLINE SIMDVec_u min(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t0, t1);
+            return SIMDVec_u(t2);
+        }
         // MMINS
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t0, t1);
+            __m256i t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_u(t3);
+        }
         // MINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVec_u const & b) {
+            __m256i t1 = cmpgt64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, b.mVec, t1);
+            mVec = t2;
+            return *this;
+        }
         // MMINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t1 = cmpgt64(mVec, b.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, b.mVec, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // MINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t0, t1);
+            mVec = t2;
+            return *this;
+        }
         // MMINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgt64(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t0, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // HMAX
         // MHMAX
         // IMAX
@@ -424,6 +841,26 @@ namespace SIMD {
         // MBNOT
         // BNOTA
         // MBNOTA
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_u popcnt() const {
+            __m256i t0 = BitCountAVX2::popcnt64(mVec);
+            return SIMDVec_u(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_u lzcnt() const {
+            __m256i t0 = BitCountAVX2::lzcnt64(mVec);
+            return SIMDVec_u(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_u tzcnt() const {
+            __m256i t0 = BitCountAVX2::tzcnt64(mVec);
+            return SIMDVec_u(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_u bitrev() const {
+            __m256i t0 = BitCountAVX2::bitrev64(mVec);
+            return SIMDVec_u(t0);
+        }
         // HBAND
         // MHBAND
         // HBANDS
@@ -502,6 +939,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<double, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -509,5 +947,6 @@ namespace SIMD {
 #undef BLEND
 #undef MASK_LOAD
 #undef MASK_STORE
+#undef MOVEMASK
 
 #endif
@@ -0,0 +1,1079 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_UINT8_32_H_
+#define UME_SIMD_VEC_UINT8_32_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+// SIMDVecMask<32> keeps a 32-bit element per lane. Narrow it to 8-bit lanes
+// before blending, and widen comparison results back when creating masks.
+#define NARROW_MASK(mask) \
+    _mm256_permutevar8x32_epi32( \
+        _mm256_packs_epi16( \
+            _mm256_packs_epi32(mask[0], mask[1]), \
+            _mm256_packs_epi32(mask[2], mask[3])), \
+        _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7))
+#define WIDEN_MASK(x) \
+    SIMDVecMask<32>( \
+        _mm256_cvtepi8_epi32(_mm256_castsi256_si128(x)), \
+        _mm256_cvtepi8_epi32(_mm_srli_si128(_mm256_castsi256_si128(x), 8)), \
+        _mm256_cvtepi8_epi32(_mm256_extracti128_si256(x, 1)), \
+        _mm256_cvtepi8_epi32(_mm_srli_si128(_mm256_extracti128_si256(x, 1), 8)))
+#define BLEND(a_256i, b_256i, mask) _mm256_blendv_epi8((a_256i), (b_256i), NARROW_MASK(mask))
+
+// There is no unsigned comparison in AVX2. Flipping the sign bits of both
+// operands maps the unsigned ordering onto the signed one.
+#define CMPGT_EPU(a_256i, b_256i) \
+    _mm256_cmpgt_epi8( \
+        _mm256_xor_si256((a_256i), _mm256_set1_epi8(int8_t(0x80))), \
+        _mm256_xor_si256((b_256i), _mm256_set1_epi8(int8_t(0x80))))
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    template<>
+    class SIMDVec_u<uint8_t, 32> :
+        public SIMDVecUnsignedInterface<
+            SIMDVec_u<uint8_t, 32>,
+            uint8_t,
+            32,
+            SIMDVecMask<32>,
+            SIMDSwizzle<32>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_u<uint8_t, 32>,
+            SIMDVec_u<uint8_t, 16>>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_i<int8_t, 32>;
+    private:
+        __m256i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_u(__m256i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_u(const __m256i & x) { mVec = x; }
+    public:
+
+        constexpr static uint32_t length() { return 32; }
+        constexpr static uint32_t alignment() { return 32; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_u() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint8_t i) {
+            mVec = _mm256_set1_epi8(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_u(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, uint8_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_u(static_cast<uint8_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_u(uint8_t const *p) { load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(
+            uint8_t i0, uint8_t i1, uint8_t i2, uint8_t i3,
+            uint8_t i4, uint8_t i5, uint8_t i6, uint8_t i7,
+            uint8_t i8, uint8_t i9, uint8_t i10, uint8_t i11,
+            uint8_t i12, uint8_t i13, uint8_t i14, uint8_t i15,
+            uint8_t i16, uint8_t i17, uint8_t i18, uint8_t i19,
+            uint8_t i20, uint8_t i21, uint8_t i22, uint8_t i23,
+            uint8_t i24, uint8_t i25, uint8_t i26, uint8_t i27,
+            uint8_t i28, uint8_t i29, uint8_t i30, uint8_t i31)
+        {
+            mVec = _mm256_setr_epi8(
+                i0, i1, i2, i3, i4, i5, i6, i7,
+                i8, i9, i10, i11, i12, i13, i14, i15,
+                i16, i17, i18, i19, i20, i21, i22, i23,
+                i24, i25, i26, i27, i28, i29, i30, i31);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE uint8_t extract(uint32_t index) const {
+            alignas(32) uint8_t raw[32];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE uint8_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_u & insert(uint32_t index, uint8_t value) {
+            alignas(32) uint8_t raw[32];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm256_load_si256((__m256i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_u, uint8_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_u, uint8_t>(index, static_cast<SIMDVec_u &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint8_t, SIMDVecMask<32>> operator() (SIMDVecMask<32> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint8_t, SIMDVecMask<32>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint8_t, SIMDVecMask<32>> operator[] (SIMDVecMask<32> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint8_t, SIMDVecMask<32>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVec_u const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (SIMDVec_u const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            mVec = BLEND(mVec, b.mVec, mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(uint8_t b) {
+            mVec = _mm256_set1_epi8(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (uint8_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<32> const & mask, uint8_t b) {
+            __m256i t0 = _mm256_set1_epi8(b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+
+        // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint8_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
+        // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint8_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
+        // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint8_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_u & load(uint8_t const * p) {
+            mVec = _mm256_loadu_si256((__m256i*)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<32> const & mask, uint8_t const * p) {
+            __m256i t0 = NARROW_MASK(mask.mMask);
+            uint32_t t1 = uint32_t(_mm256_movemask_epi8(t0));
+            if (t1 == 0xFFFFFFFF) {
+                mVec = _mm256_loadu_si256((__m256i*)p);
+            }
+            else {
+                // There is no masked load for 8-bit lanes. Read only the active
+                // elements so that a loop tail does not touch memory past its end.
+                alignas(32) uint8_t raw[32];
+                _mm256_store_si256((__m256i*)raw, mVec);
+                for (uint32_t i = 0; i < 32; i++) {
+                    if (t1 & (1u << i)) raw[i] = p[i];
+                }
+                mVec = _mm256_load_si256((__m256i*)raw);
+            }
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(uint8_t const * p) {
+            mVec = _mm256_load_si256((__m256i *)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<32> const & mask, uint8_t const * p) {
+            // An aligned load never crosses a page boundary, so reading the
+            // inactive elements cannot fault.
+            __m256i t0 = _mm256_load_si256((__m256i*)p);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE uint8_t * store(uint8_t * p) const {
+            _mm256_storeu_si256((__m256i*)p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE uint8_t * store(SIMDVecMask<32> const & mask, uint8_t * p) const {
+            uint32_t t0 = uint32_t(_mm256_movemask_epi8(NARROW_MASK(mask.mMask)));
+            if (t0 == 0xFFFFFFFF) {
+                _mm256_storeu_si256((__m256i*)p, mVec);
+            }
+            else {
+                alignas(32) uint8_t raw[32];
+                _mm256_store_si256((__m256i*)raw, mVec);
+                for (uint32_t i = 0; i < 32; i++) {
+                    if (t0 & (1u << i)) p[i] = raw[i];
+                }
+            }
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE uint8_t * storea(uint8_t * p) const {
+            _mm256_store_si256((__m256i*)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE uint8_t * storea(SIMDVecMask<32> const & mask, uint8_t * p) const {
+            uint32_t t0 = uint32_t(_mm256_movemask_epi8(NARROW_MASK(mask.mMask)));
+            if (t0 == 0xFFFFFFFF) {
+                _mm256_store_si256((__m256i*)p, mVec);
+            }
+            else {
+                alignas(32) uint8_t raw[32];
+                _mm256_store_si256((__m256i*)raw, mVec);
+                for (uint32_t i = 0; i < 32; i++) {
+                    if (t0 & (1u << i)) p[i] = raw[i];
+                }
+            }
+            return p;
+        }
+        // SSTORE
+        UME_FORCE_INLINE uint8_t * sstore(uint8_t * p) const {
+            _mm256_stream_si256((__m256i*)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE uint8_t * sstore(SIMDVecMask<32> const & mask, uint8_t * p) const {
+            return storea(mask, p);
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = BLEND(mVec, b.mVec, mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<32> const & mask, uint8_t b) const {
+            __m256i t0 = BLEND(mVec, _mm256_set1_epi8(b), mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_add_epi8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (SIMDVec_u const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_add_epi8(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_u add(uint8_t b) const {
+            __m256i t0 = _mm256_add_epi8(mVec, _mm256_set1_epi8(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (uint8_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<32> const & mask, uint8_t b) const {
+            __m256i t0 = _mm256_add_epi8(mVec, _mm256_set1_epi8(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVec_u const & b) {
+            mVec = _mm256_add_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (SIMDVec_u const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_add_epi8(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(uint8_t b) {
+            mVec = _mm256_add_epi8(mVec, _mm256_set1_epi8(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (uint8_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<32> const & mask, uint8_t b) {
+            __m256i t0 = _mm256_add_epi8(mVec, _mm256_set1_epi8(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_adds_epu8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_adds_epu8(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint8_t b) const {
+            __m256i t0 = _mm256_adds_epu8(mVec, _mm256_set1_epi8(b));
+            return SIMDVec_u(t0);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<32> const & mask, uint8_t b) const {
+            __m256i t0 = _mm256_adds_epu8(mVec, _mm256_set1_epi8(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = _mm256_adds_epu8(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_adds_epu8(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint8_t b) {
+            mVec = _mm256_adds_epu8(mVec, _mm256_set1_epi8(b));
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<32> const & mask, uint8_t b) {
+            __m256i t0 = _mm256_adds_epu8(mVec, _mm256_set1_epi8(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // POSTINC
+        // MPOSTINC
+        // PREFINC
+        // MPREFINC
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sub_epi8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (SIMDVec_u const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sub_epi8(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_u sub(uint8_t b) const {
+            __m256i t0 = _mm256_sub_epi8(mVec, _mm256_set1_epi8(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (uint8_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<32> const & mask, uint8_t b) const {
+            __m256i t0 = _mm256_sub_epi8(mVec, _mm256_set1_epi8(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVec_u const & b) {
+            mVec = _mm256_sub_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (SIMDVec_u const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_sub_epi8(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(uint8_t b) {
+            mVec = _mm256_sub_epi8(mVec, _mm256_set1_epi8(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (uint8_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<32> const & mask, uint8_t b) {
+            __m256i t0 = _mm256_sub_epi8(mVec, _mm256_set1_epi8(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_subs_epu8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_subs_epu8(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint8_t b) const {
+            __m256i t0 = _mm256_subs_epu8(mVec, _mm256_set1_epi8(b));
+            return SIMDVec_u(t0);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<32> const & mask, uint8_t b) const {
+            __m256i t0 = _mm256_subs_epu8(mVec, _mm256_set1_epi8(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = _mm256_subs_epu8(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_subs_epu8(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint8_t b) {
+            mVec = _mm256_subs_epu8(mVec, _mm256_set1_epi8(b));
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<32> const & mask, uint8_t b) {
+            __m256i t0 = _mm256_subs_epu8(mVec, _mm256_set1_epi8(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBFROMV
+        // MSUBFROMV
+        // SUBFROMS
+        // MSUBFROMS
+        // SUBFROMVA
+        // MSUBFROMVA
+        // SUBFROMSA
+        // MSUBFROMSA
+        // POSTDEC
+        // MPOSTDEC
+        // PREFDEC
+        // MPREFDEC
+        // MULV
+        // MMULV
+        // MULS
+        // MMULS
+        // MULVA
+        // MMULVA
+        // MULSA
+        // MMULSA
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_u mulhi(SIMDVec_u const & b) const {
+            __m256i t0 = MulHighAVX2::mulhiu8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_u divide(SIMDDivider<uint8_t> const & divider) const {
+            __m256i t0 = DivideAVX2::divu8(mVec, divider);
+            return SIMDVec_u(t0);
+        }
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpeq(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi8(mVec, b.mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator== (SIMDVec_u const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<32> cmpeq(uint8_t b) const {
+            __m256i t1 = _mm256_set1_epi8(b);
+            __m256i t0 = _mm256_cmpeq_epi8(mVec, t1);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator== (uint8_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpne(SIMDVec_u const & b) const {
+            __m256i t2 = _mm256_cmpeq_epi8(mVec, b.mVec);
+            __m256i t0 = _mm256_xor_si256(t2, _mm256_set1_epi32(0xFFFFFFFF));
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator!= (SIMDVec_u const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<32> cmpne(uint8_t b) const {
+            __m256i t1 = _mm256_set1_epi8(b);
+            __m256i t2 = _mm256_cmpeq_epi8(mVec, t1);
+            __m256i t0 = _mm256_xor_si256(t2, _mm256_set1_epi32(0xFFFFFFFF));
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator!= (uint8_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpgt(SIMDVec_u const & b) const {
+            __m256i t0 = CMPGT_EPU(mVec, b.mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator> (SIMDVec_u const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<32> cmpgt(uint8_t b) const {
+            __m256i t1 = _mm256_set1_epi8(b);
+            __m256i t0 = CMPGT_EPU(mVec, t1);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator> (uint8_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<32> cmplt(SIMDVec_u const & b) const {
+            __m256i t0 = CMPGT_EPU(b.mVec, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator< (SIMDVec_u const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<32> cmplt(uint8_t b) const {
+            __m256i t1 = _mm256_set1_epi8(b);
+            __m256i t0 = CMPGT_EPU(t1, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator< (uint8_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpge(SIMDVec_u const & b) const {
+            __m256i t2 = _mm256_max_epu8(mVec, b.mVec);
+            __m256i t0 = _mm256_cmpeq_epi8(t2, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator>= (SIMDVec_u const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<32> cmpge(uint8_t b) const {
+            __m256i t1 = _mm256_set1_epi8(b);
+            __m256i t2 = _mm256_max_epu8(mVec, t1);
+            __m256i t0 = _mm256_cmpeq_epi8(t2, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator>= (uint8_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<32> cmple(SIMDVec_u const & b) const {
+            __m256i t2 = _mm256_min_epu8(mVec, b.mVec);
+            __m256i t0 = _mm256_cmpeq_epi8(t2, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator<= (SIMDVec_u const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<32> cmple(uint8_t b) const {
+            __m256i t1 = _mm256_set1_epi8(b);
+            __m256i t2 = _mm256_min_epu8(mVec, t1);
+            __m256i t0 = _mm256_cmpeq_epi8(t2, mVec);
+            return WIDEN_MASK(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator<= (uint8_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        // CMPES
+        // UNIQUE
+        // HADD
+        // MHADD
+        // HADDS
+        // MHADDS
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+        // FMULADDV
+        // MFMULADDV
+        // FMULSUBV
+        // MFMULSUBV
+        // FADDMULV
+        // MFADDMULV
+        // FSUBMULV
+        // MFSUBMULV
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_max_epu8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_max_epu8(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_u max(uint8_t b) const {
+            __m256i t0 = _mm256_max_epu8(mVec, _mm256_set1_epi8(b));
+            return SIMDVec_u(t0);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<32> const & mask, uint8_t b) const {
+            __m256i t0 = _mm256_max_epu8(mVec, _mm256_set1_epi8(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVec_u const & b) {
+            mVec = _mm256_max_epu8(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_max_epu8(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(uint8_t b) {
+            mVec = _mm256_max_epu8(mVec, _mm256_set1_epi8(b));
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<32> const & mask, uint8_t b) {
+            __m256i t0 = _mm256_max_epu8(mVec, _mm256_set1_epi8(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_min_epu8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_min_epu8(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_u min(uint8_t b) const {
+            __m256i t0 = _mm256_min_epu8(mVec, _mm256_set1_epi8(b));
+            return SIMDVec_u(t0);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<32> const & mask, uint8_t b) const {
+            __m256i t0 = _mm256_min_epu8(mVec, _mm256_set1_epi8(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVec_u const & b) {
+            mVec = _mm256_min_epu8(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_min_epu8(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(uint8_t b) {
+            mVec = _mm256_min_epu8(mVec, _mm256_set1_epi8(b));
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<32> const & mask, uint8_t b) {
+            __m256i t0 = _mm256_min_epu8(mVec, _mm256_set1_epi8(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // HMAX
+        // MHMAX
+        // IMAX
+        // MIMAX
+        // HMIN
+        // MHMIN
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (SIMDVec_u const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_u band(uint8_t b) const {
+            __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi8(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (uint8_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<32> const & mask, uint8_t b) const {
+            __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi8(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVec_u const & b) {
+            mVec = _mm256_and_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(uint8_t b) {
+            mVec = _mm256_and_si256(mVec, _mm256_set1_epi8(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (uint8_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<32> const & mask, uint8_t b) {
+            __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi8(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (SIMDVec_u const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_u bor(uint8_t b) const {
+            __m256i t0 = _mm256_or_si256(mVec, _mm256_set1_epi8(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (uint8_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<32> const & mask, uint8_t b) const {
+            __m256i t0 = _mm256_or_si256(mVec, _mm256_set1_epi8(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVec_u const & b) {
+            mVec = _mm256_or_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(uint8_t b) {
+            mVec = _mm256_or_si256(mVec, _mm256_set1_epi8(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (uint8_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<32> const & mask, uint8_t b) {
+            __m256i t0 = _mm256_or_si256(mVec, _mm256_set1_epi8(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SIMDVec_u const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(uint8_t b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi8(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (uint8_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<32> const & mask, uint8_t b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi8(b));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVec_u const & b) {
+            mVec = _mm256_xor_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SIMDVec_u const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(uint8_t b) {
+            mVec = _mm256_xor_si256(mVec, _mm256_set1_epi8(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (uint8_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<32> const & mask, uint8_t b) {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi8(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_u bnot() const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(0xFFFFFFFF));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<32> const & mask) const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(0xFFFFFFFF));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota() {
+            mVec = _mm256_xor_si256(mVec, _mm256_set1_epi32(0xFFFFFFFF));
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota(SIMDVecMask<32> const & mask) {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(0xFFFFFFFF));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_u popcnt() const {
+            __m256i t0 = BitCountAVX2::popcnt8(mVec);
+            return SIMDVec_u(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_u lzcnt() const {
+            __m256i t0 = BitCountAVX2::lzcnt8(mVec);
+            return SIMDVec_u(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_u tzcnt() const {
+            __m256i t0 = BitCountAVX2::tzcnt8(mVec);
+            return SIMDVec_u(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_u bitrev() const {
+            __m256i t0 = BitCountAVX2::bitrev8(mVec);
+            return SIMDVec_u(t0);
+        }
+        // LOOKUP16
+        UME_FORCE_INLINE SIMDVec_u lookup16(uint8_t const * table) const {
+            // Saturating add moves indices above 15 to the range where pshufb
+            // returns 0, and keeps the low nibble of valid indices intact.
+            __m256i t0 = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)table));
+            __m256i t1 = _mm256_adds_epu8(mVec, _mm256_set1_epi8(0x70));
+            __m256i t2 = _mm256_shuffle_epi8(t0, t1);
+            return SIMDVec_u(t2);
+        }
+        // HBAND
+        // MHBAND
+        // HBANDS
+        // MHBANDS
+        // HBOR
+        // MHBOR
+        // HBORS
+        // MHBORS
+        // HBXOR
+        // MHBXOR
+        // HBXORS
+        // MHBXORS
+
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // LSHV
+        // MLSHV
+        // LSHS
+        // MLSHS
+        // LSHVA
+        // MLSHVA
+        // LSHSA
+        // MLSHSA
+        // RSHV
+        // MRSHV
+        // RSHS
+        // MRSHS
+        // RSHVA
+        // MRSHVA
+        // RSHSA
+        // MRSHSA
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+
+        // PACK
+        // PACKLO
+        // PACKHI
+        // UNPACK
+        // UNPACKLO
+        // UNPACKHI
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_u<uint16_t, 32>() const;
+        // DEGRADE
+        // -
+
+        // UTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int8_t, 32>() const;
+        // UTOF
+        // -
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#undef NARROW_MASK
+#undef WIDEN_MASK
+#undef BLEND
+#undef CMPGT_EPU
+
+#endif
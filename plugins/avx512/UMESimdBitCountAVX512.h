@@ -0,0 +1,265 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_BIT_COUNT_AVX512_H_
+#define UME_SIMD_BIT_COUNT_AVX512_H_
+
+#include <immintrin.h>
+#include "../../UMEBasicTypes.h"
+#include "../../UMEInline.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    // Per-lane POPCNT, LZCNT, TZCNT and BITREV of 32 and 64-bit lanes.
+    //
+    // VPOPCNTD/Q (AVX512_VPOPCNTDQ) and VPLZCNTD/Q (AVX512CD) are used when
+    // available. Otherwise bytes are processed with nibble lookup tables
+    // (VPSHUFB, AVX512BW) or, with AVX512F only, with shift and mask
+    // sequences. 128 and 256-bit vectors use the VL forms of the native
+    // instructions, or are processed in a zmm register.
+    class BitCountAVX512 {
+    private:
+#if defined(__AVX512BW__)
+        static UME_FORCE_INLINE __m512i popcnt8(__m512i const & x) {
+            __m512i t0 = _mm512_set4_epi32(0x04030302, 0x03020201, 0x03020201, 0x02010100);
+            __m512i t1 = _mm512_set1_epi8(0x0F);
+            __m512i t2 = _mm512_shuffle_epi8(t0, _mm512_and_si512(x, t1));
+            __m512i t3 = _mm512_shuffle_epi8(t0, _mm512_and_si512(_mm512_srli_epi16(x, 4), t1));
+            return _mm512_add_epi8(t2, t3);
+        }
+        static UME_FORCE_INLINE __m512i bitrev8(__m512i const & x) {
+            __m512i t0 = _mm512_set4_epi32(0xF070B030, 0xD0509010, 0xE060A020, 0xC0408000);
+            __m512i t1 = _mm512_set4_epi32(0x0F070B03, 0x0D050901, 0x0E060A02, 0x0C040800);
+            __m512i t2 = _mm512_set1_epi8(0x0F);
+            __m512i t3 = _mm512_shuffle_epi8(t0, _mm512_and_si512(x, t2));
+            __m512i t4 = _mm512_shuffle_epi8(t1, _mm512_and_si512(_mm512_srli_epi16(x, 4), t2));
+            return _mm512_or_si512(t3, t4);
+        }
+#else
+        // Swap the bit groups selected by 'm' with the groups 'n' bits above.
+        static UME_FORCE_INLINE __m512i swapBits32(__m512i const & x, __m512i const & m, unsigned int n) {
+            __m512i t0 = _mm512_and_si512(_mm512_srli_epi32(x, n), m);
+            __m512i t1 = _mm512_slli_epi32(_mm512_and_si512(x, m), n);
+            return _mm512_or_si512(t0, t1);
+        }
+        static UME_FORCE_INLINE __m512i popcnt32Swar(__m512i const & x) {
+            __m512i t0 = _mm512_sub_epi32(x, _mm512_and_si512(_mm512_srli_epi32(x, 1), _mm512_set1_epi32(0x55555555)));
+            __m512i t1 = _mm512_set1_epi32(0x33333333);
+            __m512i t2 = _mm512_add_epi32(_mm512_and_si512(t0, t1), _mm512_and_si512(_mm512_srli_epi32(t0, 2), t1));
+            __m512i t3 = _mm512_and_si512(_mm512_add_epi32(t2, _mm512_srli_epi32(t2, 4)), _mm512_set1_epi32(0x0F0F0F0F));
+            return _mm512_srli_epi32(_mm512_mullo_epi32(t3, _mm512_set1_epi32(0x01010101)), 24);
+        }
+#endif
+    public:
+        // POPCNT
+        static UME_FORCE_INLINE __m512i popcnt32(__m512i const & x) {
+#if defined(__AVX512VPOPCNTDQ__)
+            return _mm512_popcnt_epi32(x);
+#elif defined(__AVX512BW__)
+            __m512i t0 = _mm512_maddubs_epi16(popcnt8(x), _mm512_set1_epi8(1));
+            return _mm512_madd_epi16(t0, _mm512_set1_epi16(1));
+#else
+            return popcnt32Swar(x);
+#endif
+        }
+        static UME_FORCE_INLINE __m512i popcnt64(__m512i const & x) {
+#if defined(__AVX512VPOPCNTDQ__)
+            return _mm512_popcnt_epi64(x);
+#elif defined(__AVX512BW__)
+            return _mm512_sad_epu8(popcnt8(x), _mm512_setzero_si512());
+#else
+            __m512i t0 = popcnt32Swar(x);
+            return _mm512_and_si512(_mm512_add_epi64(t0, _mm512_srli_epi64(t0, 32)), _mm512_set1_epi64(0x7F));
+#endif
+        }
+
+        // LZCNT
+        static UME_FORCE_INLINE __m512i lzcnt32(__m512i const & x) {
+#if defined(__AVX512CD__)
+            return _mm512_lzcnt_epi32(x);
+#else
+            // Set all bits below the highest set bit and count the zeros left.
+            __m512i t0 = _mm512_or_si512(x, _mm512_srli_epi32(x, 1));
+            t0 = _mm512_or_si512(t0, _mm512_srli_epi32(t0, 2));
+            t0 = _mm512_or_si512(t0, _mm512_srli_epi32(t0, 4));
+            t0 = _mm512_or_si512(t0, _mm512_srli_epi32(t0, 8));
+            t0 = _mm512_or_si512(t0, _mm512_srli_epi32(t0, 16));
+            return _mm512_sub_epi32(_mm512_set1_epi32(32), popcnt32(t0));
+#endif
+        }
+        static UME_FORCE_INLINE __m512i lzcnt64(__m512i const & x) {
+#if defined(__AVX512CD__)
+            return _mm512_lzcnt_epi64(x);
+#else
+            __m512i t0 = _mm512_or_si512(x, _mm512_srli_epi64(x, 1));
+            t0 = _mm512_or_si512(t0, _mm512_srli_epi64(t0, 2));
+            t0 = _mm512_or_si512(t0, _mm512_srli_epi64(t0, 4));
+            t0 = _mm512_or_si512(t0, _mm512_srli_epi64(t0, 8));
+            t0 = _mm512_or_si512(t0, _mm512_srli_epi64(t0, 16));
+            t0 = _mm512_or_si512(t0, _mm512_srli_epi64(t0, 32));
+            return _mm512_sub_epi64(_mm512_set1_epi64(64), popcnt64(t0));
+#endif
+        }
+
+        // TZCNT
+        // Trailing zeros are the set bits of '~x & (x - 1)'. Without a native
+        // population count they are counted as 'width - lzcnt' instead.
+        static UME_FORCE_INLINE __m512i tzcnt32(__m512i const & x) {
+            __m512i t0 = _mm512_andnot_si512(x, _mm512_sub_epi32(x, _mm512_set1_epi32(1)));
+#if defined(__AVX512CD__) && !defined(__AVX512VPOPCNTDQ__)
+            return _mm512_sub_epi32(_mm512_set1_epi32(32), _mm512_lzcnt_epi32(t0));
+#else
+            return popcnt32(t0);
+#endif
+        }
+        static UME_FORCE_INLINE __m512i tzcnt64(__m512i const & x) {
+            __m512i t0 = _mm512_andnot_si512(x, _mm512_sub_epi64(x, _mm512_set1_epi64(1)));
+#if defined(__AVX512CD__) && !defined(__AVX512VPOPCNTDQ__)
+            return _mm512_sub_epi64(_mm512_set1_epi64(64), _mm512_lzcnt_epi64(t0));
+#else
+            return popcnt64(t0);
+#endif
+        }
+
+        // BITREV
+        static UME_FORCE_INLINE __m512i bitrev32(__m512i const & x) {
+#if defined(__AVX512BW__)
+            __m512i t0 = _mm512_set4_epi32(0x0C0D0E0F, 0x08090A0B, 0x04050607, 0x00010203);
+            return _mm512_shuffle_epi8(bitrev8(x), t0);
+#else
+            __m512i t0 = swapBits32(x, _mm512_set1_epi32(0x55555555), 1);
+            t0 = swapBits32(t0, _mm512_set1_epi32(0x33333333), 2);
+            t0 = swapBits32(t0, _mm512_set1_epi32(0x0F0F0F0F), 4);
+            t0 = swapBits32(t0, _mm512_set1_epi32(0x00FF00FF), 8);
+            return _mm512_rol_epi32(t0, 16);
+#endif
+        }
+        static UME_FORCE_INLINE __m512i bitrev64(__m512i const & x) {
+#if defined(__AVX512BW__)
+            __m512i t0 = _mm512_set4_epi32(0x08090A0B, 0x0C0D0E0F, 0x00010203, 0x04050607);
+            return _mm512_shuffle_epi8(bitrev8(x), t0);
+#else
+            // Reverse both 32-bit halves, then swap them.
+            return _mm512_rol_epi64(bitrev32(x), 32);
+#endif
+        }
+
+        // 256-bit vectors
+        static UME_FORCE_INLINE __m256i popcnt32(__m256i const & x) {
+#if defined(__AVX512VPOPCNTDQ__) && defined(__AVX512VL__)
+            return _mm256_popcnt_epi32(x);
+#else
+            return _mm512_castsi512_si256(popcnt32(_mm512_castsi256_si512(x)));
+#endif
+        }
+        static UME_FORCE_INLINE __m256i popcnt64(__m256i const & x) {
+#if defined(__AVX512VPOPCNTDQ__) && defined(__AVX512VL__)
+            return _mm256_popcnt_epi64(x);
+#else
+            return _mm512_castsi512_si256(popcnt64(_mm512_castsi256_si512(x)));
+#endif
+        }
+        static UME_FORCE_INLINE __m256i lzcnt32(__m256i const & x) {
+#if defined(__AVX512CD__) && defined(__AVX512VL__)
+            return _mm256_lzcnt_epi32(x);
+#else
+            return _mm512_castsi512_si256(lzcnt32(_mm512_castsi256_si512(x)));
+#endif
+        }
+        static UME_FORCE_INLINE __m256i lzcnt64(__m256i const & x) {
+#if defined(__AVX512CD__) && defined(__AVX512VL__)
+            return _mm256_lzcnt_epi64(x);
+#else
+            return _mm512_castsi512_si256(lzcnt64(_mm512_castsi256_si512(x)));
+#endif
+        }
+        static UME_FORCE_INLINE __m256i tzcnt32(__m256i const & x) {
+            return _mm512_castsi512_si256(tzcnt32(_mm512_castsi256_si512(x)));
+        }
+        static UME_FORCE_INLINE __m256i tzcnt64(__m256i const & x) {
+            return _mm512_castsi512_si256(tzcnt64(_mm512_castsi256_si512(x)));
+        }
+        static UME_FORCE_INLINE __m256i bitrev32(__m256i const & x) {
+            return _mm512_castsi512_si256(bitrev32(_mm512_castsi256_si512(x)));
+        }
+        static UME_FORCE_INLINE __m256i bitrev64(__m256i const & x) {
+            return _mm512_castsi512_si256(bitrev64(_mm512_castsi256_si512(x)));
+        }
+
+        // 128-bit vectors
+        static UME_FORCE_INLINE __m128i popcnt32(__m128i const & x) {
+#if defined(__AVX512VPOPCNTDQ__) && defined(__AVX512VL__)
+            return _mm_popcnt_epi32(x);
+#else
+            return _mm512_castsi512_si128(popcnt32(_mm512_castsi128_si512(x)));
+#endif
+        }
+        static UME_FORCE_INLINE __m128i popcnt64(__m128i const & x) {
+#if defined(__AVX512VPOPCNTDQ__) && defined(__AVX512VL__)
+            return _mm_popcnt_epi64(x);
+#else
+            return _mm512_castsi512_si128(popcnt64(_mm512_castsi128_si512(x)));
+#endif
+        }
+        static UME_FORCE_INLINE __m128i lzcnt32(__m128i const & x) {
+#if defined(__AVX512CD__) && defined(__AVX512VL__)
+            return _mm_lzcnt_epi32(x);
+#else
+            return _mm512_castsi512_si128(lzcnt32(_mm512_castsi128_si512(x)));
+#endif
+        }
+        static UME_FORCE_INLINE __m128i lzcnt64(__m128i const & x) {
+#if defined(__AVX512CD__) && defined(__AVX512VL__)
+            return _mm_lzcnt_epi64(x);
+#else
+            return _mm512_castsi512_si128(lzcnt64(_mm512_castsi128_si512(x)));
+#endif
+        }
+        static UME_FORCE_INLINE __m128i tzcnt32(__m128i const & x) {
+            return _mm512_castsi512_si128(tzcnt32(_mm512_castsi128_si512(x)));
+        }
+        static UME_FORCE_INLINE __m128i tzcnt64(__m128i const & x) {
+            return _mm512_castsi512_si128(tzcnt64(_mm512_castsi128_si512(x)));
+        }
+        static UME_FORCE_INLINE __m128i bitrev32(__m128i const & x) {
+            return _mm512_castsi512_si128(bitrev32(_mm512_castsi128_si512(x)));
+        }
+        static UME_FORCE_INLINE __m128i bitrev64(__m128i const & x) {
+            return _mm512_castsi512_si128(bitrev64(_mm512_castsi128_si512(x)));
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
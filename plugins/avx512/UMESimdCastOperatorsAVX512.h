@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
     // Operators for non-specialized types require 'template<>' syntax.
     // Compliant compiler will not accept this syntax for non-specialized
     // types, so make sure only proper definitions have it.
@@ -67,15 +68,27 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 16>, int8_t, SIMDVec_u<uint8_t, 16>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
+        return SIMDVec_i<int8_t, 32>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 32>, int8_t, SIMDVec_u<uint8_t, 32>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint8_t, 64>::operator SIMDVec_i<int8_t, 64>() const {
+        return SIMDVec_i<int8_t, 64>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 64>::operator SIMDVec_i<int8_t, 64>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 64>, int8_t, SIMDVec_u<uint8_t, 64>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 128>::operator SIMDVec_i<int8_t, 128>() const {
@@ -102,15 +115,27 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 8>, int16_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
+        return SIMDVec_i<int16_t, 16>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_u<uint16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
+        return SIMDVec_i<int16_t, 32>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 32>, int16_t, SIMDVec_u<uint16_t, 32>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 64>::operator SIMDVec_i<int16_t, 64>() const {
@@ -241,15 +266,27 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 16>, uint8_t, SIMDVec_i<int8_t, 16>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
+        return SIMDVec_u<uint8_t, 32>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 32>, uint8_t, SIMDVec_i<int8_t, 32>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int8_t, 64>::operator SIMDVec_u<uint8_t, 64>() const {
+        return SIMDVec_u<uint8_t, 64>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 64>::operator SIMDVec_u<uint8_t, 64>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 64>, uint8_t, SIMDVec_i<int8_t, 64>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 128>::operator SIMDVec_u<uint8_t, 128>() const {
@@ -276,15 +313,27 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 8>, uint16_t, SIMDVec_i<int16_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
+        return SIMDVec_u<uint16_t, 16>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_i<int16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
+        return SIMDVec_u<uint16_t, 32>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 32>, uint32_t, SIMDVec_i<int16_t, 32>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 64>::operator SIMDVec_u<uint16_t, 64>() const {
@@ -517,23 +566,23 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_f<float, 4>::operator SIMDVec_i<int32_t, 4>() const {
-        __m128i t0 = _mm_cvtps_epi32(mVec);
+        __m128i t0 = _mm_cvttps_epi32(mVec);
         return SIMDVec_i<int32_t, 4>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_f<float, 8>::operator SIMDVec_i<int32_t, 8>() const {
-        __m256i t0 = _mm256_cvtps_epi32(mVec);
+        __m256i t0 = _mm256_cvttps_epi32(mVec);
         return SIMDVec_i<int32_t, 8>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_f<float, 16>::operator SIMDVec_i<int32_t, 16>() const {
-        __m512i t0 = _mm512_cvtps_epi32(mVec);
+        __m512i t0 = _mm512_cvttps_epi32(mVec);
         return SIMDVec_i<int32_t, 16>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_f<float, 32>::operator SIMDVec_i<int32_t, 32>() const {
-        __m512i t0 = _mm512_cvtps_epi32(mVec[0]);
-        __m512i t1 = _mm512_cvtps_epi32(mVec[1]);
+        __m512i t0 = _mm512_cvttps_epi32(mVec[0]);
+        __m512i t1 = _mm512_cvttps_epi32(mVec[1]);
         return SIMDVec_i<int32_t, 32>(t0, t1);
     }
 
@@ -544,11 +593,11 @@ namespace SIMD {
     UME_FORCE_INLINE SIMDVec_f<double, 2>::operator SIMDVec_i<int64_t, 2>() const {
 #if defined(__AVX512DQ__)
 #if defined(__AVX512VL__)
-        __m128i t0 = _mm_cvtpd_epi64(mVec);
+        __m128i t0 = _mm_cvttpd_epi64(mVec);
         return SIMDVec_i<int64_t, 2>(t0);
 #else
-        __m512d t0 = _mm512_castpd128_pd512(mVeC);
-        __m512i t1 = _mm512_cvtpd_epi64(t0);
+        __m512d t0 = _mm512_castpd128_pd512(mVec);
+        __m512i t1 = _mm512_cvttpd_epi64(t0);
         __m128i t2 = _mm512_castsi512_si128(t1);
         return SIMDVec_i<int64_t, 2>(t2);
 #endif
@@ -566,13 +615,13 @@ namespace SIMD {
     UME_FORCE_INLINE SIMDVec_f<double, 4>::operator SIMDVec_i<int64_t, 4>() const {
 #if defined(__AVX512DQ__)
 #if defined(__AVX512VL__)
-        __m256i t0 = _mm256_cvtpd_epi64(mVec);
+        __m256i t0 = _mm256_cvttpd_epi64(mVec);
         return SIMDVec_i<int64_t, 4>(t0);
 #else
-        __m512d t0 = _mm512_castpd256_pd512(mVeC);
-        __m512i t1 = _mm512_cvtpd_epi64(t0);
+        __m512d t0 = _mm512_castpd256_pd512(mVec);
+        __m512i t1 = _mm512_cvttpd_epi64(t0);
         __m256i t2 = _mm512_castsi512_si256(t1);
-        return SIMDVec_t<int64_t, 4>(t2);
+        return SIMDVec_i<int64_t, 4>(t2);
 #endif
 #else
         alignas(32) double raw_64f[4];
@@ -589,7 +638,7 @@ namespace SIMD {
 
     UME_FORCE_INLINE SIMDVec_f<double, 8>::operator SIMDVec_i<int64_t, 8>() const {
 #if defined(__AVX512DQ__)
-        __m512i t0 = _mm512_cvtpd_epi64(mVec);
+        __m512i t0 = _mm512_cvttpd_epi64(mVec);
         return SIMDVec_i<int64_t, 8>(t0);
 #else
         alignas(64) double raw_64f[8];
@@ -610,8 +659,8 @@ namespace SIMD {
 
     UME_FORCE_INLINE SIMDVec_f<double, 16>::operator SIMDVec_i<int64_t, 16>() const {
 #if defined(__AVX512DQ__)
-        __m512i t0 = _mm512_cvtpd_epi64(mVec[0]);
-        __m512i t1 = _mm512_cvtpd_epi64(mVec[1]);
+        __m512i t0 = _mm512_cvttpd_epi64(mVec[0]);
+        __m512i t1 = _mm512_cvttpd_epi64(mVec[1]);
         return SIMDVec_i<int64_t, 16>(t0, t1);
 #else
         alignas(64) double raw_64f[16];
@@ -666,15 +715,28 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_u<uint8_t, 16>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
+        __m512i t0 = _mm512_cvtepu8_epi16(mVec);
+        return SIMDVec_u<uint16_t, 32>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 32>, uint16_t, SIMDVec_u<uint8_t, 32>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint8_t, 64>::operator SIMDVec_u<uint16_t, 64>() const {
+        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 64>, uint16_t, SIMDVec_u<uint8_t, 64>>(*this);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 64>::operator SIMDVec_u<uint16_t, 64>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 64>, uint16_t, SIMDVec_u<uint8_t, 64>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 1>::operator SIMDVec_u<uint32_t, 1>() const {
@@ -696,15 +758,30 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 8>, uint32_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint32_t, 16>() const {
+        __m512i t0 = _mm512_cvtepu16_epi32(mVec);
+        return SIMDVec_u<uint32_t, 16>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint32_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 16>, uint32_t, SIMDVec_u<uint16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint32_t, 32>() const {
+        __m512i t0 = _mm512_cvtepu16_epi32(_mm512_castsi512_si256(mVec));
+        __m512i t1 = _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(mVec, 1));
+        return SIMDVec_u<uint32_t, 32>(t0, t1);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint32_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 32>, uint32_t, SIMDVec_u<uint16_t, 32>>(*this);
     }
+#endif
 
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 1>::operator SIMDVec_u<uint64_t, 1>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint64_t, 1>, uint64_t, SIMDVec_u<uint32_t, 1>>(*this);
@@ -751,15 +828,28 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_i<int8_t, 16>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
+        __m512i t0 = _mm512_cvtepi8_epi16(mVec);
+        return SIMDVec_i<int16_t, 32>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 32>, int16_t, SIMDVec_i<int8_t, 32>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int8_t, 64>::operator SIMDVec_i<int16_t, 64>() const {
+        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 64>, int16_t, SIMDVec_i<int8_t, 64>>(*this);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 64>::operator SIMDVec_i<int16_t, 64>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 64>, int16_t, SIMDVec_i<int8_t, 64>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 1>::operator SIMDVec_i<int32_t, 1>() const {
@@ -781,15 +871,30 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 8>, int32_t, SIMDVec_i<int16_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int32_t, 16>() const {
+        __m512i t0 = _mm512_cvtepi16_epi32(mVec);
+        return SIMDVec_i<int32_t, 16>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int32_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 16>, int32_t, SIMDVec_i<int16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int32_t, 32>() const {
+        __m512i t0 = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(mVec));
+        __m512i t1 = _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(mVec, 1));
+        return SIMDVec_i<int32_t, 32>(t0, t1);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int32_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 32>, int32_t, SIMDVec_i<int16_t, 32>>(*this);
     }
+#endif
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 1>::operator SIMDVec_i<int64_t, 1>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int64_t, 1>, int64_t, SIMDVec_i<int32_t, 1>>(*this);
@@ -851,15 +956,35 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 8>, uint8_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
+        __m128i t0 = _mm256_cvtepi16_epi8(mVec);
+        alignas(16) uint8_t raw[16];
+        _mm_store_si128((__m128i*)raw, t0);
+        return SIMDVec_u<uint8_t, 16>(raw);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 16>, uint8_t, SIMDVec_u<uint16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
+        __m256i t0 = _mm512_cvtepi16_epi8(mVec);
+        return SIMDVec_u<uint8_t, 32>(t0);
+    }
+#elif defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
+        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 32>, uint8_t, SIMDVec_u<uint16_t, 32>>(*this);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 32>, uint8_t, SIMDVec_u<uint16_t, 32>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 64>::operator SIMDVec_u<uint8_t, 64>() const {
@@ -882,13 +1007,29 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 8>, uint16_t, SIMDVec_u<uint32_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint32_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
+        __m256i t0 = _mm512_cvtepi32_epi16(mVec);
+        return SIMDVec_u<uint16_t, 16>(t0);
+    }
+#else
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_u<uint32_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint32_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
+        __m256i t0 = _mm512_cvtepi32_epi16(mVec[0]);
+        __m256i t1 = _mm512_cvtepi32_epi16(mVec[1]);
+        __m512i t2 = _mm512_inserti64x4(_mm512_castsi256_si512(t0), t1, 1);
+        return SIMDVec_u<uint16_t, 32>(t2);
+    }
+#else
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 32>, uint16_t, SIMDVec_u<uint32_t, 32>>(*this);
     }
+#endif
 
     UME_FORCE_INLINE SIMDVec_u<uint64_t, 1>::operator SIMDVec_u<uint32_t, 1>() const {
         return SIMDVec_u<uint32_t, 1>(uint32_t(mVec));
@@ -929,15 +1070,35 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 8>, int8_t, SIMDVec_i<int16_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
+        __m128i t0 = _mm256_cvtepi16_epi8(mVec);
+        alignas(16) int8_t raw[16];
+        _mm_store_si128((__m128i*)raw, t0);
+        return SIMDVec_i<int8_t, 16>(raw);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 16>, int8_t, SIMDVec_i<int16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
+        __m256i t0 = _mm512_cvtepi16_epi8(mVec);
+        return SIMDVec_i<int8_t, 32>(t0);
+    }
+#elif defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
+        return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 32>, int8_t, SIMDVec_i<int16_t, 32>>(*this);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 32>, int8_t, SIMDVec_i<int16_t, 32>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 64>::operator SIMDVec_i<int8_t, 64>() const {
@@ -960,13 +1121,29 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 8>, int16_t, SIMDVec_i<int32_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int32_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
+        __m256i t0 = _mm512_cvtepi32_epi16(mVec);
+        return SIMDVec_i<int16_t, 16>(t0);
+    }
+#else
     UME_FORCE_INLINE SIMDVec_i<int32_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_i<int32_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int32_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
+        __m256i t0 = _mm512_cvtepi32_epi16(mVec[0]);
+        __m256i t1 = _mm512_cvtepi32_epi16(mVec[1]);
+        __m512i t2 = _mm512_inserti64x4(_mm512_castsi256_si512(t0), t1, 1);
+        return SIMDVec_i<int16_t, 32>(t2);
+    }
+#else
     UME_FORCE_INLINE SIMDVec_i<int32_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 32>, int16_t, SIMDVec_i<int32_t, 32>>(*this);
     }
+#endif
 
     UME_FORCE_INLINE SIMDVec_i<int64_t, 1>::operator SIMDVec_i<int32_t, 1>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 1>, int32_t, SIMDVec_i<int64_t, 1>>(*this);
@@ -1011,6 +1188,7 @@ namespace SIMD {
     UME_FORCE_INLINE SIMDVec_f<double, 16>::operator SIMDVec_f<float, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_f<float, 16>, float, SIMDVec_f<double, 16>>(*this);
     }
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -0,0 +1,94 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+#ifndef UME_SIMD_CONFLICT_AVX512_H_
+#define UME_SIMD_CONFLICT_AVX512_H_
+
+#include <immintrin.h>
+#include "../../UMEBasicTypes.h"
+#include "../../UMEInline.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    // CONFLICT of the first 'len' 32 or 64-bit lanes of a zmm register. 'len'
+    // is a power of two; result lanes at and above 'len' are undefined.
+    //
+    // VPCONFLICTD/Q (AVX512CD) is used when available. With AVX512F only,
+    // each element is compared with the element r lanes below it, for every
+    // r in 1..len-1. Lane i of 't1' holds 1 << i shifted right by r, which is
+    // the bit of element i - r, or 0 when r > i.
+    class ConflictAVX512 {
+    public:
+        static UME_FORCE_INLINE __m512i conflict32(__m512i const & x, int len) {
+#if defined(__AVX512CD__)
+            (void)len;
+            return _mm512_conflict_epi32(x);
+#else
+            __m512i t0 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            __m512i t1 = _mm512_sllv_epi32(_mm512_set1_epi32(1), t0);
+            __m512i t2 = _mm512_setzero_si512();
+            __m512i t3 = _mm512_set1_epi32(len - 1);
+            for (int r = 1; r < len; r++) {
+                __m512i t4 = _mm512_and_si512(_mm512_sub_epi32(t0, _mm512_set1_epi32(r)), t3);
+                __mmask16 m0 = _mm512_cmpeq_epi32_mask(x, _mm512_permutexvar_epi32(t4, x));
+                t1 = _mm512_srli_epi32(t1, 1);
+                t2 = _mm512_mask_or_epi32(t2, m0, t2, t1);
+            }
+            return t2;
+#endif
+        }
+        static UME_FORCE_INLINE __m512i conflict64(__m512i const & x, int len) {
+#if defined(__AVX512CD__)
+            (void)len;
+            return _mm512_conflict_epi64(x);
+#else
+            __m512i t0 = _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+            __m512i t1 = _mm512_sllv_epi64(_mm512_set1_epi64(1), t0);
+            __m512i t2 = _mm512_setzero_si512();
+            __m512i t3 = _mm512_set1_epi64(len - 1);
+            for (int r = 1; r < len; r++) {
+                __m512i t4 = _mm512_and_si512(_mm512_sub_epi64(t0, _mm512_set1_epi64(r)), t3);
+                __mmask8 m0 = _mm512_cmpeq_epi64_mask(x, _mm512_permutexvar_epi64(t4, x));
+                t1 = _mm512_srli_epi64(t1, 1);
+                t2 = _mm512_mask_or_epi64(t2, m0, t2, t1);
+            }
+            return t2;
+#endif
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
@@ -49,5 +49,8 @@
 #include "mask/UMESimdMask8.h"
 #include "mask/UMESimdMask16.h"
 #include "mask/UMESimdMask32.h"
+#if defined(__AVX512BW__)
+#include "mask/UMESimdMask64.h"
+#endif
 
 #endif
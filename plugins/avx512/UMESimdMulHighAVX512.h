@@ -0,0 +1,182 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+#ifndef UME_SIMD_MUL_HIGH_AVX512_H_
+#define UME_SIMD_MUL_HIGH_AVX512_H_
+
+#include <immintrin.h>
+#include "../../UMEBasicTypes.h"
+#include "../../UMEInline.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    // High halves of double width integer products. Only 16-bit elements
+    // have a high-half multiply: 8-bit elements are processed as 16-bit
+    // halves, 32-bit ones use the even/odd 32x32->64 products, and 64-bit
+    // ones are assembled from four 32x32->64 partial products. 8-bit
+    // elements in 512-bit registers require AVX512BW. 256 and 128-bit
+    // registers use the AVX2 forms.
+    class MulHighAVX512 {
+    public:
+#if defined(__AVX512BW__)
+        // High halves of 8x8-bit products, computed in 16-bit halves.
+        static UME_FORCE_INLINE __m512i mulhiu8(__m512i const & a, __m512i const & b) {
+            __m512i t0 = _mm512_unpacklo_epi8(a, _mm512_setzero_si512());
+            __m512i t1 = _mm512_unpacklo_epi8(b, _mm512_setzero_si512());
+            __m512i t2 = _mm512_unpackhi_epi8(a, _mm512_setzero_si512());
+            __m512i t3 = _mm512_unpackhi_epi8(b, _mm512_setzero_si512());
+            __m512i t4 = _mm512_srli_epi16(_mm512_mullo_epi16(t0, t1), 8);
+            __m512i t5 = _mm512_srli_epi16(_mm512_mullo_epi16(t2, t3), 8);
+            return _mm512_packus_epi16(t4, t5);
+        }
+        static UME_FORCE_INLINE __m512i mulhis8(__m512i const & a, __m512i const & b) {
+            // Sign extension: the byte goes to the upper half of a 16-bit
+            // element and is shifted back arithmetically.
+            __m512i t0 = _mm512_srai_epi16(_mm512_unpacklo_epi8(_mm512_setzero_si512(), a), 8);
+            __m512i t1 = _mm512_srai_epi16(_mm512_unpacklo_epi8(_mm512_setzero_si512(), b), 8);
+            __m512i t2 = _mm512_srai_epi16(_mm512_unpackhi_epi8(_mm512_setzero_si512(), a), 8);
+            __m512i t3 = _mm512_srai_epi16(_mm512_unpackhi_epi8(_mm512_setzero_si512(), b), 8);
+            __m512i t4 = _mm512_srli_epi16(_mm512_mullo_epi16(t0, t1), 8);
+            __m512i t5 = _mm512_srli_epi16(_mm512_mullo_epi16(t2, t3), 8);
+            return _mm512_packus_epi16(t4, t5);
+        }
+#endif
+        // High halves of 8x8-bit products, computed in 16-bit halves.
+        static UME_FORCE_INLINE __m256i mulhiu8(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_unpacklo_epi8(a, _mm256_setzero_si256());
+            __m256i t1 = _mm256_unpacklo_epi8(b, _mm256_setzero_si256());
+            __m256i t2 = _mm256_unpackhi_epi8(a, _mm256_setzero_si256());
+            __m256i t3 = _mm256_unpackhi_epi8(b, _mm256_setzero_si256());
+            __m256i t4 = _mm256_srli_epi16(_mm256_mullo_epi16(t0, t1), 8);
+            __m256i t5 = _mm256_srli_epi16(_mm256_mullo_epi16(t2, t3), 8);
+            return _mm256_packus_epi16(t4, t5);
+        }
+        static UME_FORCE_INLINE __m256i mulhis8(__m256i const & a, __m256i const & b) {
+            // Sign extension: the byte goes to the upper half of a 16-bit
+            // element and is shifted back arithmetically.
+            __m256i t0 = _mm256_srai_epi16(_mm256_unpacklo_epi8(_mm256_setzero_si256(), a), 8);
+            __m256i t1 = _mm256_srai_epi16(_mm256_unpacklo_epi8(_mm256_setzero_si256(), b), 8);
+            __m256i t2 = _mm256_srai_epi16(_mm256_unpackhi_epi8(_mm256_setzero_si256(), a), 8);
+            __m256i t3 = _mm256_srai_epi16(_mm256_unpackhi_epi8(_mm256_setzero_si256(), b), 8);
+            __m256i t4 = _mm256_srli_epi16(_mm256_mullo_epi16(t0, t1), 8);
+            __m256i t5 = _mm256_srli_epi16(_mm256_mullo_epi16(t2, t3), 8);
+            return _mm256_packus_epi16(t4, t5);
+        }
+        // High halves of 32x32-bit products.
+        static UME_FORCE_INLINE __m512i mulhiu32(__m512i const & a, __m512i const & b) {
+            __m512i t0 = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+            __m512i t1 = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+            return _mm512_mask_blend_epi32(0xAAAA, t0, t1);
+        }
+        static UME_FORCE_INLINE __m512i mulhis32(__m512i const & a, __m512i const & b) {
+            __m512i t0 = _mm512_srli_epi64(_mm512_mul_epi32(a, b), 32);
+            __m512i t1 = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+            return _mm512_mask_blend_epi32(0xAAAA, t0, t1);
+        }
+        static UME_FORCE_INLINE __m256i mulhiu32(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+            __m256i t1 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+            return _mm256_blend_epi32(t0, t1, 0xAA);
+        }
+        static UME_FORCE_INLINE __m256i mulhis32(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+            __m256i t1 = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+            return _mm256_blend_epi32(t0, t1, 0xAA);
+        }
+        static UME_FORCE_INLINE __m128i mulhiu32(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+            __m128i t1 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+            return _mm_blend_epi32(t0, t1, 0xA);
+        }
+        static UME_FORCE_INLINE __m128i mulhis32(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_srli_epi64(_mm_mul_epi32(a, b), 32);
+            __m128i t1 = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+            return _mm_blend_epi32(t0, t1, 0xA);
+        }
+
+        // High halves of 64x64-bit products.
+        static UME_FORCE_INLINE __m512i mulhiu64(__m512i const & a, __m512i const & b) {
+            __m512i aHi = _mm512_srli_epi64(a, 32);
+            __m512i bHi = _mm512_srli_epi64(b, 32);
+            __m512i t0 = _mm512_mul_epu32(a, b);
+            __m512i t1 = _mm512_add_epi64(_mm512_mul_epu32(aHi, b), _mm512_srli_epi64(t0, 32));
+            __m512i t2 = _mm512_and_si512(t1, _mm512_set1_epi64(0xFFFFFFFF));
+            __m512i t3 = _mm512_add_epi64(t2, _mm512_mul_epu32(a, bHi));
+            __m512i t4 = _mm512_add_epi64(_mm512_mul_epu32(aHi, bHi), _mm512_srli_epi64(t1, 32));
+            return _mm512_add_epi64(t4, _mm512_srli_epi64(t3, 32));
+        }
+        static UME_FORCE_INLINE __m512i mulhis64(__m512i const & a, __m512i const & b) {
+            __m512i t0 = mulhiu64(a, b);
+            __m512i t1 = _mm512_and_si512(_mm512_srai_epi64(a, 63), b);
+            __m512i t2 = _mm512_and_si512(_mm512_srai_epi64(b, 63), a);
+            return _mm512_sub_epi64(_mm512_sub_epi64(t0, t1), t2);
+        }
+        static UME_FORCE_INLINE __m256i mulhiu64(__m256i const & a, __m256i const & b) {
+            __m256i aHi = _mm256_srli_epi64(a, 32);
+            __m256i bHi = _mm256_srli_epi64(b, 32);
+            __m256i t0 = _mm256_mul_epu32(a, b);
+            __m256i t1 = _mm256_add_epi64(_mm256_mul_epu32(aHi, b), _mm256_srli_epi64(t0, 32));
+            __m256i t2 = _mm256_and_si256(t1, _mm256_set1_epi64x(0xFFFFFFFF));
+            __m256i t3 = _mm256_add_epi64(t2, _mm256_mul_epu32(a, bHi));
+            __m256i t4 = _mm256_add_epi64(_mm256_mul_epu32(aHi, bHi), _mm256_srli_epi64(t1, 32));
+            return _mm256_add_epi64(t4, _mm256_srli_epi64(t3, 32));
+        }
+        static UME_FORCE_INLINE __m256i mulhis64(__m256i const & a, __m256i const & b) {
+            __m256i t0 = mulhiu64(a, b);
+            __m256i t1 = _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), a), b);
+            __m256i t2 = _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), b), a);
+            return _mm256_sub_epi64(_mm256_sub_epi64(t0, t1), t2);
+        }
+        static UME_FORCE_INLINE __m128i mulhiu64(__m128i const & a, __m128i const & b) {
+            __m128i aHi = _mm_srli_epi64(a, 32);
+            __m128i bHi = _mm_srli_epi64(b, 32);
+            __m128i t0 = _mm_mul_epu32(a, b);
+            __m128i t1 = _mm_add_epi64(_mm_mul_epu32(aHi, b), _mm_srli_epi64(t0, 32));
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi64x(0xFFFFFFFF));
+            __m128i t3 = _mm_add_epi64(t2, _mm_mul_epu32(a, bHi));
+            __m128i t4 = _mm_add_epi64(_mm_mul_epu32(aHi, bHi), _mm_srli_epi64(t1, 32));
+            return _mm_add_epi64(t4, _mm_srli_epi64(t3, 32));
+        }
+        static UME_FORCE_INLINE __m128i mulhis64(__m128i const & a, __m128i const & b) {
+            __m128i t0 = mulhiu64(a, b);
+            __m128i t1 = _mm_and_si128(_mm_cmpgt_epi64(_mm_setzero_si128(), a), b);
+            __m128i t2 = _mm_and_si128(_mm_cmpgt_epi64(_mm_setzero_si128(), b), a);
+            return _mm_sub_epi64(_mm_sub_epi64(t0, t1), t2);
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
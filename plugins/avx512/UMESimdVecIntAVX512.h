@@ -48,6 +48,20 @@
 // ********************************************************************************************
 // SIGNED INTEGER VECTOR SPECIALIZATIONS
 // ********************************************************************************************
+#if defined(__AVX512BW__)
+#if defined(__AVX512VL__)
+#include "int/UMESimdVecInt8_32.h"
+#endif
+#include "int/UMESimdVecInt8_64.h"
+#endif
+
+#if defined(__AVX512BW__)
+#if defined(__AVX512VL__)
+#include "int/UMESimdVecInt16_16.h"
+#endif
+#include "int/UMESimdVecInt16_32.h"
+#endif
+
 #include "int/UMESimdVecInt32_1.h"
 #include "int/UMESimdVecInt32_2.h"
 #include "int/UMESimdVecInt32_4.h"
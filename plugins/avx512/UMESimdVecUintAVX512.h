@@ -38,6 +38,10 @@
 
 #include "UMESimdMaskAVX512.h"
 #include "UMESimdSwizzleAVX512.h"
+#include "UMESimdBitCountAVX512.h"
+#include "UMESimdConflictAVX512.h"
+#include "UMESimdMulHighAVX512.h"
+#include "UMESimdDivideAVX512.h"
 
 // ********************************************************************************************
 // UNSIGNED INTEGER VECTOR TEMPLATE
@@ -47,8 +51,21 @@
 // ********************************************************************************************
 // UNSIGNED INTEGER VECTOR SPECIALIZATIONS
 // ********************************************************************************************
+#if defined(__AVX512BW__)
+#if defined(__AVX512VL__)
+#include "uint/UMESimdVecUint8_32.h"
+#endif
+#include "uint/UMESimdVecUint8_64.h"
+#endif
+
 //#include "uint/UMESimdVecUint16_1.h"
 //#include "uint/UMESimdVecUint16_2.h"
+#if defined(__AVX512BW__)
+#if defined(__AVX512VL__)
+#include "uint/UMESimdVecUint16_16.h"
+#endif
+#include "uint/UMESimdVecUint16_32.h"
+#endif
 
 #include "uint/UMESimdVecUint32_1.h"
 #include "uint/UMESimdVecUint32_2.h"
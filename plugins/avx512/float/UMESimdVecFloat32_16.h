@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<> class SIMDVec_f<double, 16>;
 
@@ -205,6 +206,116 @@ namespace SIMD {
             _mm512_mask_store_ps(p, mask.mMask, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE float* sstore(float * p) const {
+            _mm512_stream_ps(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE float* sstore(SIMDVecMask<16> const & mask, float * p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<16> const & mask) const {
+            __m512 t0 = _mm512_maskz_compress_ps(mask.mMask, mVec);
+            return SIMDVec_f(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<16> const & mask, float * p) const {
+            _mm512_mask_compressstoreu_ps(p, mask.mMask, mVec);
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<16> const & mask, float const * p) {
+            mVec = _mm512_mask_expandloadu_ps(mVec, mask.mMask, p);
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m512 sortNetwork(__m512 const & a, bool descending, bool bitonic) {
+            __m512i t0 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            __mmask16 m0 = descending ? 0xFFFF : 0;
+            __m512 t1 = a;
+            for (int k = bitonic ? 16 : 2; k <= 16; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m512i t2 = _mm512_set1_epi32(j);
+                    __mmask16 m1 = _mm512_test_epi32_mask(t0, t2) ^ _mm512_test_epi32_mask(t0, _mm512_set1_epi32(k)) ^ m0;
+                    __m512 t3 = _mm512_permutexvar_ps(_mm512_xor_si512(t0, t2), t1);
+                    t1 = _mm512_mask_blend_ps(m1, _mm512_min_ps(t1, t3), _mm512_max_ps(t1, t3));
+                }
+            }
+            return t1;
+        }
+        UME_FORCE_INLINE static __m512 sortNetwork(__m512 const & a, __m512i & payload, bool descending, bool bitonic) {
+            __m512i t0 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            __mmask16 m0 = descending ? 0xFFFF : 0;
+            __m512 t1 = a;
+            __m512i t2 = payload;
+            for (int k = bitonic ? 16 : 2; k <= 16; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m512i t3 = _mm512_set1_epi32(j);
+                    __mmask16 m1 = _mm512_test_epi32_mask(t0, t3) ^ _mm512_test_epi32_mask(t0, _mm512_set1_epi32(k)) ^ m0;
+                    __m512i t4 = _mm512_xor_si512(t0, t3);
+                    __m512 t5 = _mm512_permutexvar_ps(t4, t1);
+                    __m512i t6 = _mm512_permutexvar_epi32(t4, t2);
+                    // Take the partner element if it is larger (smaller)
+                    // than the element keeping the maximum (minimum).
+                    __mmask16 m2 = _mm512_mask_cmp_ps_mask(m1, t5, t1, _CMP_GT_OQ) | _mm512_mask_cmp_ps_mask(~m1, t1, t5, _CMP_GT_OQ);
+                    t1 = _mm512_mask_blend_ps(m2, t1, t5);
+                    t2 = _mm512_mask_blend_epi32(m2, t2, t6);
+                }
+            }
+            payload = t2;
+            return t1;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m512 t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m512 t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 16> & payload) const {
+            __m512 t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 16> & payload) const {
+            __m512 t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_f bsorta() const {
+            __m512 t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_f bsortd() const {
+            __m512 t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsorta(SIMDVec_u<uint32_t, 16> & payload) const {
+            __m512 t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsortd(SIMDVec_u<uint32_t, 16> & payload) const {
+            __m512 t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m512 t0 = _mm512_add_ps(mVec, b.mVec);
@@ -785,6 +896,16 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint32_t, 16> const & indices) const {
+            __m512 t0 = _mm512_permutexvar_ps(indices.mVec, mVec);
+            return SIMDVec_f(t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint32_t, 16> const & indices) const {
+            __m512 t0 = _mm512_permutex2var_ps(mVec, indices.mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
         // HADD
         UME_FORCE_INLINE float hadd() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_4)
@@ -1226,6 +1347,16 @@ namespace SIMD {
             mVec = _mm512_mask_i32gather_ps(mVec, m0, indices.mVec, baseAddr, 4);
             return *this;
         }
+#if defined(__AVX512PF__)
+        // PREFETCHGATHER0
+        static UME_FORCE_INLINE void prefetchgather0(float const * baseAddr, SIMDVec_u<uint32_t, 16> const & indices) {
+            _mm512_prefetch_i32gather_ps(indices.mVec, baseAddr, 4, _MM_HINT_T0);
+        }
+        // PREFETCHGATHER1
+        static UME_FORCE_INLINE void prefetchgather1(float const * baseAddr, SIMDVec_u<uint32_t, 16> const & indices) {
+            _mm512_prefetch_i32gather_ps(indices.mVec, baseAddr, 4, _MM_HINT_T1);
+        }
+#endif
         // SCATTERU
         UME_FORCE_INLINE float* scatteru(float* baseAddr, uint32_t stride) const {
             __m512i t0 = _mm512_set1_epi32(stride);
@@ -1386,9 +1517,34 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<16> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float, SIMDVecMask<16>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, float>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m512 t0 = _mm512_roundscale_ps(mVec, 0);
@@ -1630,7 +1786,7 @@ namespace SIMD {
             __m512 t0 = _mm512_exp_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MEXP
@@ -1639,16 +1795,96 @@ namespace SIMD {
             __m512 t0 = _mm512_mask_exp_ps(mVec, mask.mMask, mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
             __m512 t0 = _mm512_log_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MLOG
@@ -1657,20 +1893,52 @@ namespace SIMD {
             __m512 t0 = _mm512_mask_log_ps(mVec, mask.mMask, mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_log2_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        #endif
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<16> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_mask_log2_ps(mVec, mask.mMask, mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        #endif
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_log10_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        #endif
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<16> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_mask_log10_ps(mVec, mask.mMask, mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        #endif
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
             __m512 t0 = _mm512_sin_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(*this);
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MSIN
@@ -1679,7 +1947,7 @@ namespace SIMD {
             __m512 t0 = _mm512_mask_sin_ps(mVec, mask.mMask, mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(mask, *this);
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // COS
@@ -1688,7 +1956,7 @@ namespace SIMD {
             __m512 t0 = _mm512_cos_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(*this);
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MCOS
@@ -1697,7 +1965,7 @@ namespace SIMD {
             __m512 t0 = _mm512_mask_cos_ps(mVec, mask.mMask, mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(mask, *this);
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // SINCOS
@@ -1717,14 +1985,68 @@ namespace SIMD {
             sinvec.mVec = _mm512_mask_sincos_ps((__m512*)raw_cos, mVec, mVec, mask.mMask, mVec);
             cosvec.mVec = _mm512_load_ps(raw_cos);
         #else
-            sinvec = VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(mask, *this);
-            cosvec = VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(mask, *this);
+            sinvec = VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this);
+            cosvec = VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_tan_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(*this);
+        #endif
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<16> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_mask_tan_ps(mVec, mask.mMask, mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        #endif
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<16>>(*this, b);
+        }
+        // MATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<16>>(mask, *this, b);
+        }
+        // ASIN
+        UME_FORCE_INLINE SIMDVec_f asin() const {
+            return VECTOR_EMULATION::asinf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
+        // MASIN
+        UME_FORCE_INLINE SIMDVec_f asin(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::asinf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
+        // ACOS
+        UME_FORCE_INLINE SIMDVec_f acos() const {
+            return VECTOR_EMULATION::acosf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
+        // MACOS
+        UME_FORCE_INLINE SIMDVec_f acos(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::acosf<SIMDVec_f, SIMDVecMask<16>>(mask, *this);
+        }
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 8> const & a, SIMDVec_f<float, 8> const & b) {
 #if defined(__AVX512DQ__)
@@ -1807,6 +2129,7 @@ namespace SIMD {
         // FTOI
         UME_FORCE_INLINE operator SIMDVec_i<int32_t, 16>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
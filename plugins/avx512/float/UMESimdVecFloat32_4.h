@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<> class SIMDVec_f<double, 4>;
 
@@ -183,11 +184,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_loadu_ps(mVec, mask.mMask, p);
 #else
-            __m128 t0 = _mm_loadu_ps(p);
-            __m512 t1 = _mm512_castps128_ps512(mVec);
-            __m512 t2 = _mm512_castps128_ps512(t0);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            mVec = _mm512_castps512_ps128(t3);
+            __m512 t0 = _mm512_castps128_ps512(mVec);
+            __m512 t1 = _mm512_mask_loadu_ps(t0, mask.mMask, p);
+            mVec = _mm512_castps512_ps128(t1);
 #endif
             return *this;
         }
@@ -201,11 +200,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_loadu_ps(mVec, mask.mMask, p);
 #else
-            __m128 t0 = _mm_load_ps(p);
-            __m512 t1 = _mm512_castps128_ps512(mVec);
-            __m512 t2 = _mm512_castps128_ps512(t0);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            mVec = _mm512_castps512_ps128(t3);
+            __m512 t0 = _mm512_castps128_ps512(mVec);
+            __m512 t1 = _mm512_mask_loadu_ps(t0, mask.mMask, p);
+            mVec = _mm512_castps512_ps128(t1);
 #endif
             return *this;
         }
@@ -219,12 +216,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_storeu_ps(p, mask.mMask, mVec);
 #else
-            __m128 t0 = _mm_loadu_ps(p);
-            __m512 t1 = _mm512_castps128_ps512(t0);
-            __m512 t2 = _mm512_castps128_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            __m128 t4 = _mm512_castps512_ps128(t3);
-            _mm_storeu_ps(p, t4);
+            __m512 t0 = _mm512_castps128_ps512(mVec);
+            _mm512_mask_storeu_ps(p, mask.mMask, t0);
 #endif
             return p;
         }
@@ -238,15 +231,49 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_store_ps(p, mask.mMask, mVec);
 #else
-            __m128 t0 = _mm_load_ps(p);
-            __m512 t1 = _mm512_castps128_ps512(t0);
-            __m512 t2 = _mm512_castps128_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            __m128 t4 = _mm512_castps512_ps128(t3);
-            _mm_store_ps(p, t4);
+            __m512 t0 = _mm512_castps128_ps512(mVec);
+            _mm512_mask_storeu_ps(p, mask.mMask, t0);
 #endif
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE float* sstore(float * p) const {
+            _mm_stream_ps(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE float* sstore(SIMDVecMask<4> const & mask, float * p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<4> const & mask) const {
+#if defined(__AVX512VL__)
+            __m128 t0 = _mm_maskz_compress_ps(mask.mMask, mVec);
+#else
+            __m512 t1 = _mm512_maskz_compress_ps(mask.mMask, _mm512_castps128_ps512(mVec));
+            __m128 t0 = _mm512_castps512_ps128(t1);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, float * p) const {
+#if defined(__AVX512VL__)
+            _mm_mask_compressstoreu_ps(p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_ps(p, mask.mMask, _mm512_castps128_ps512(mVec));
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<4> const & mask, float const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm_mask_expandloadu_ps(mVec, mask.mMask, p);
+#else
+            __m512 t0 = _mm512_mask_expandloadu_ps(_mm512_castps128_ps512(mVec), mask.mMask, p);
+            mVec = _mm512_castps512_ps128(t0);
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m128 t0 = _mm_add_ps(this->mVec, b.mVec);
@@ -1147,8 +1174,104 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m128 sortNetwork(__m128 const & a, bool descending, bool bitonic) {
+            __m128 t0 = _mm_shuffle_ps(a, a, 0xB1);
+            __m128i t1 = _mm_setr_epi32(0, -1, -1, 0);
+            __m128 t2 = _mm_min_ps(a, t0);
+            __m128 t3 = _mm_max_ps(a, t0);
+            __m128 t4 = descending ? _mm_blendv_ps(t3, t2, _mm_castsi128_ps(t1)) : _mm_blendv_ps(t2, t3, _mm_castsi128_ps(t1));
+            __m128 t5 = bitonic ? a : t4;
+            __m128 t6 = _mm_shuffle_ps(t5, t5, 0x4E);
+            __m128i t7 = _mm_setr_epi32(0, 0, -1, -1);
+            __m128 t8 = _mm_min_ps(t5, t6);
+            __m128 t9 = _mm_max_ps(t5, t6);
+            __m128 t10 = descending ? _mm_blendv_ps(t9, t8, _mm_castsi128_ps(t7)) : _mm_blendv_ps(t8, t9, _mm_castsi128_ps(t7));
+            __m128 t11 = _mm_shuffle_ps(t10, t10, 0xB1);
+            __m128i t12 = _mm_setr_epi32(0, -1, 0, -1);
+            __m128 t13 = _mm_min_ps(t10, t11);
+            __m128 t14 = _mm_max_ps(t10, t11);
+            __m128 t15 = descending ? _mm_blendv_ps(t14, t13, _mm_castsi128_ps(t12)) : _mm_blendv_ps(t13, t14, _mm_castsi128_ps(t12));
+            return t15;
+        }
+        UME_FORCE_INLINE static __m128 sortNetwork(__m128 const & a, __m128i & payload, bool descending, bool bitonic) {
+            __m128 t0 = _mm_shuffle_ps(a, a, 0xB1);
+            __m128i t1 = _mm_shuffle_epi32(payload, 0xB1);
+            __m128i t2 = _mm_setr_epi32(0, -1, -1, 0);
+            __m128i t3 = _mm_castps_si128(_mm_cmpgt_ps(a, t0));
+            __m128i t4 = _mm_castps_si128(_mm_cmpgt_ps(t0, a));
+            __m128i t5 = descending ? _mm_blendv_epi8(t4, t3, t2) : _mm_blendv_epi8(t3, t4, t2);
+            __m128 t6 = _mm_blendv_ps(a, t0, _mm_castsi128_ps(t5));
+            __m128i t7 = _mm_blendv_epi8(payload, t1, t5);
+            __m128 t8 = bitonic ? a : t6;
+            __m128i t9 = bitonic ? payload : t7;
+            __m128 t10 = _mm_shuffle_ps(t8, t8, 0x4E);
+            __m128i t11 = _mm_shuffle_epi32(t9, 0x4E);
+            __m128i t12 = _mm_setr_epi32(0, 0, -1, -1);
+            __m128i t13 = _mm_castps_si128(_mm_cmpgt_ps(t8, t10));
+            __m128i t14 = _mm_castps_si128(_mm_cmpgt_ps(t10, t8));
+            __m128i t15 = descending ? _mm_blendv_epi8(t14, t13, t12) : _mm_blendv_epi8(t13, t14, t12);
+            __m128 t16 = _mm_blendv_ps(t8, t10, _mm_castsi128_ps(t15));
+            __m128i t17 = _mm_blendv_epi8(t9, t11, t15);
+            __m128 t18 = _mm_shuffle_ps(t16, t16, 0xB1);
+            __m128i t19 = _mm_shuffle_epi32(t17, 0xB1);
+            __m128i t20 = _mm_setr_epi32(0, -1, 0, -1);
+            __m128i t21 = _mm_castps_si128(_mm_cmpgt_ps(t16, t18));
+            __m128i t22 = _mm_castps_si128(_mm_cmpgt_ps(t18, t16));
+            __m128i t23 = descending ? _mm_blendv_epi8(t22, t21, t20) : _mm_blendv_epi8(t21, t22, t20);
+            __m128 t24 = _mm_blendv_ps(t16, t18, _mm_castsi128_ps(t23));
+            __m128i t25 = _mm_blendv_epi8(t17, t19, t23);
+            payload = t25;
+            return t24;
+        }
+    public:
         // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m128 t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_f(t0);
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m128 t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128 t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128 t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_f bsorta() const {
+            __m128 t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_f bsortd() const {
+            __m128 t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsorta(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128 t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsortd(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128 t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_f(t0);
+        }
 
         // HADD
         UME_FORCE_INLINE float hadd() const {
@@ -1893,9 +2016,34 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<4> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float, SIMDVecMask<4>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, float>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m128 t0 = _mm_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT);
@@ -2221,7 +2369,7 @@ namespace SIMD {
             __m128 t0 = _mm_exp_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MEXP
@@ -2232,16 +2380,96 @@ namespace SIMD {
             __m128 t2 = _mm512_castps512_ps128(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
             __m128 t0 = _mm_log_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MLOG
@@ -2252,13 +2480,49 @@ namespace SIMD {
             __m128 t2 = _mm512_castps512_ps128(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+        #if defined(UME_USE_SVML)
+            __m128 t0 = _mm_log2_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        #endif
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_castps128_ps512(mVec);
+            __m512 t1 = _mm512_mask_log2_ps(t0, mask.mMask, t0);
+            __m128 t2 = _mm512_castps512_ps128(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        #endif
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+        #if defined(UME_USE_SVML)
+            __m128 t0 = _mm_log10_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        #endif
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_castps128_ps512(mVec);
+            __m512 t1 = _mm512_mask_log10_ps(t0, mask.mMask, t0);
+            __m128 t2 = _mm512_castps512_ps128(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        #endif
+        }
 
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
@@ -2266,7 +2530,7 @@ namespace SIMD {
             __m128 t0 = _mm_sin_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MSIN
@@ -2277,7 +2541,7 @@ namespace SIMD {
             __m128 t2 = _mm512_castps512_ps128(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // COS
@@ -2286,7 +2550,7 @@ namespace SIMD {
             __m128 t0 = _mm_cos_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MCOS
@@ -2297,7 +2561,7 @@ namespace SIMD {
             __m128 t2 = _mm512_castps512_ps128(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // SINCOS
@@ -2320,14 +2584,69 @@ namespace SIMD {
             sinvec.mVec = _mm512_castps512_ps128(t1);
             cosvec.mVec = _mm_load_ps(raw_cos);
         #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+        #if defined(UME_USE_SVML)
+            __m128 t0 = _mm_tan_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this);
+        #endif
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_castps128_ps512(mVec);
+            __m512 t1 = _mm512_mask_tan_ps(t0, mask.mMask, t0);
+            __m128 t2 = _mm512_castps512_ps128(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        #endif
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
+        // MATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<4>>(mask, *this, b);
+        }
+        // ASIN
+        UME_FORCE_INLINE SIMDVec_f asin() const {
+            return VECTOR_EMULATION::asinf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MASIN
+        UME_FORCE_INLINE SIMDVec_f asin(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::asinf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ACOS
+        UME_FORCE_INLINE SIMDVec_f acos() const {
+            return VECTOR_EMULATION::acosf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MACOS
+        UME_FORCE_INLINE SIMDVec_f acos(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::acosf<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 2> const & a, SIMDVec_f<float, 2> const & b) {
@@ -2390,6 +2709,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_i<int32_t, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
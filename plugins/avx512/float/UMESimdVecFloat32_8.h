@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<> class SIMDVec_f<double, 8>;
 
@@ -186,11 +187,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_loadu_ps(mVec, mask.mMask, p);
 #else
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m512 t1 = _mm512_castps256_ps512(t0);
-            __m512 t2 = _mm512_castps256_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t2, mask.mMask, t1);
-            mVec = _mm512_castps512_ps256(t3);
+            __m512 t0 = _mm512_castps256_ps512(mVec);
+            __m512 t1 = _mm512_mask_loadu_ps(t0, mask.mMask, p);
+            mVec = _mm512_castps512_ps256(t1);
 #endif
             return *this;
         }
@@ -204,11 +203,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_loadu_ps(mVec, mask.mMask, p);
 #else
-            __m256 t0 = _mm256_load_ps(p);
-            __m512 t1 = _mm512_castps256_ps512(t0);
-            __m512 t2 = _mm512_castps256_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t2, mask.mMask, t1);
-            mVec = _mm512_castps512_ps256(t3);
+            __m512 t0 = _mm512_castps256_ps512(mVec);
+            __m512 t1 = _mm512_mask_loadu_ps(t0, mask.mMask, p);
+            mVec = _mm512_castps512_ps256(t1);
 #endif
             return *this;
         }
@@ -222,12 +219,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_storeu_ps(p, mask.mMask, mVec);
 #else
-            __m256 t0 = _mm256_loadu_ps(p);
-            __m512 t1 = _mm512_castps256_ps512(t0);
-            __m512 t2 = _mm512_castps256_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            __m256 t4 = _mm512_castps512_ps256(t3);
-            _mm256_storeu_ps(p, t4);
+            __m512 t0 = _mm512_castps256_ps512(mVec);
+            _mm512_mask_storeu_ps(p, mask.mMask, t0);
 #endif
             return p;
         }
@@ -241,15 +234,49 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_store_ps(p, mask.mMask, mVec);
 #else
-            __m256 t0 = _mm256_load_ps(p);
-            __m512 t1 = _mm512_castps256_ps512(t0);
-            __m512 t2 = _mm512_castps256_ps512(mVec);
-            __m512 t3 = _mm512_mask_mov_ps(t1, mask.mMask, t2);
-            __m256 t4 = _mm512_castps512_ps256(t3);
-            _mm256_store_ps(p, t4);
+            __m512 t0 = _mm512_castps256_ps512(mVec);
+            _mm512_mask_storeu_ps(p, mask.mMask, t0);
 #endif
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE float* sstore(float * p) const {
+            _mm256_stream_ps(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE float* sstore(SIMDVecMask<8> const & mask, float * p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<8> const & mask) const {
+#if defined(__AVX512VL__)
+            __m256 t0 = _mm256_maskz_compress_ps(mask.mMask, mVec);
+#else
+            __m512 t1 = _mm512_maskz_compress_ps(mask.mMask, _mm512_castps256_ps512(mVec));
+            __m256 t0 = _mm512_castps512_ps256(t1);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, float * p) const {
+#if defined(__AVX512VL__)
+            _mm256_mask_compressstoreu_ps(p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_ps(p, mask.mMask, _mm512_castps256_ps512(mVec));
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<8> const & mask, float const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm256_mask_expandloadu_ps(mVec, mask.mMask, p);
+#else
+            __m512 t0 = _mm512_mask_expandloadu_ps(_mm512_castps256_ps512(mVec), mask.mMask, p);
+            mVec = _mm512_castps512_ps256(t0);
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m256 t0 = _mm256_add_ps(mVec, b.mVec);
@@ -1151,8 +1178,117 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint32_t, 8> const & indices) const {
+            __m256 t0 = _mm256_permutevar8x32_ps(mVec, indices.mVec);
+            return SIMDVec_f(t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint32_t, 8> const & indices) const {
+#if defined(__AVX512VL__)
+            __m256 t0 = _mm256_permutex2var_ps(mVec, indices.mVec, b.mVec);
+            return SIMDVec_f(t0);
+#else
+            __m512d t0 = _mm512_castpd256_pd512(_mm256_castps_pd(mVec));
+            __m512 t1 = _mm512_castpd_ps(_mm512_insertf64x4(t0, _mm256_castps_pd(b.mVec), 1));
+            __m512 t2 = _mm512_permutexvar_ps(_mm512_castsi256_si512(indices.mVec), t1);
+            __m256 t3 = _mm512_castps512_ps256(t2);
+            return SIMDVec_f(t3);
+#endif
+        }
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m256 sortNetwork(__m256 const & a, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256 t1 = a;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m256i t2 = _mm256_set1_epi32(j);
+                    __m256i t3 = _mm256_set1_epi32(k);
+                    __m256i t4 = _mm256_xor_si256(
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t2), t2),
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t3), t3));
+                    __m256 t5 = _mm256_permutevar8x32_ps(t1, _mm256_xor_si256(t0, t2));
+                    __m256 t6 = _mm256_min_ps(t1, t5);
+                    __m256 t7 = _mm256_max_ps(t1, t5);
+                    t1 = descending ? _mm256_blendv_ps(t7, t6, _mm256_castsi256_ps(t4)) : _mm256_blendv_ps(t6, t7, _mm256_castsi256_ps(t4));
+                }
+            }
+            return t1;
+        }
+        UME_FORCE_INLINE static __m256 sortNetwork(__m256 const & a, __m256i & payload, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256 t1 = a;
+            __m256i t2 = payload;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m256i t3 = _mm256_set1_epi32(j);
+                    __m256i t4 = _mm256_set1_epi32(k);
+                    __m256i t5 = _mm256_xor_si256(
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t3), t3),
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t4), t4));
+                    __m256i t6 = _mm256_xor_si256(t0, t3);
+                    __m256 t7 = _mm256_permutevar8x32_ps(t1, t6);
+                    __m256i t8 = _mm256_permutevar8x32_epi32(t2, t6);
+                    // Take the partner element if it is larger (smaller)
+                    // than the element keeping the maximum (minimum).
+                    __m256i t9 = _mm256_castps_si256(_mm256_cmp_ps(t1, t7, _CMP_GT_OQ));
+                    __m256i t10 = _mm256_castps_si256(_mm256_cmp_ps(t7, t1, _CMP_GT_OQ));
+                    __m256i t11 = descending ? _mm256_blendv_epi8(t10, t9, t5) : _mm256_blendv_epi8(t9, t10, t5);
+                    t1 = _mm256_blendv_ps(t1, t7, _mm256_castsi256_ps(t11));
+                    t2 = _mm256_blendv_epi8(t2, t8, t11);
+                }
+            }
+            payload = t2;
+            return t1;
+        }
+    public:
         // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m256 t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_f(t0);
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m256 t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256 t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256 t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_f bsorta() const {
+            __m256 t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_f bsortd() const {
+            __m256 t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsorta(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256 t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsortd(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256 t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_f(t0);
+        }
 
         // HADD
         UME_FORCE_INLINE float hadd() const {
@@ -1912,9 +2048,34 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<8> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, float, SIMDVecMask<8>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, float>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT);
@@ -2202,7 +2363,7 @@ namespace SIMD {
             __m256 t0 = _mm256_exp_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MEXP
@@ -2213,16 +2374,96 @@ namespace SIMD {
             __m256 t2 = _mm512_castps512_ps256(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::exp2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::expm1f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log1pf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::sinhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::coshf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tanhf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::erff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::erfcf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::normcdff<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::norminvf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
             __m256 t0 = _mm256_log_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MLOG
@@ -2233,20 +2474,56 @@ namespace SIMD {
             __m256 t2 = _mm512_castps512_ps256(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+        #if defined(UME_USE_SVML)
+            __m256 t0 = _mm256_log2_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        #endif
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_castps256_ps512(mVec);
+            __m512 t1 = _mm512_mask_log2_ps(t0, mask.mMask, t0);
+            __m256 t2 = _mm512_castps512_ps256(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        #endif
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+        #if defined(UME_USE_SVML)
+            __m256 t0 = _mm256_log10_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        #endif
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_castps256_ps512(mVec);
+            __m512 t1 = _mm512_mask_log10_ps(t0, mask.mMask, t0);
+            __m256 t2 = _mm512_castps512_ps256(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        #endif
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
             __m256 t0 = _mm256_sin_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MSIN
@@ -2257,7 +2534,7 @@ namespace SIMD {
             __m256 t2 = _mm512_castps512_ps256(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // COS
@@ -2266,7 +2543,7 @@ namespace SIMD {
             __m256 t0 = _mm256_cos_ps(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MCOS
@@ -2277,7 +2554,7 @@ namespace SIMD {
             __m256 t2 = _mm512_castps512_ps256(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // SINCOS
@@ -2299,14 +2576,69 @@ namespace SIMD {
             sinvec.mVec = _mm512_castps512_ps256(t1);
             cosvec.mVec = _mm256_load_ps(raw_cos);
         #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+        #if defined(UME_USE_SVML)
+            __m256 t0 = _mm256_tan_ps(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        #endif
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512 t0 = _mm512_castps256_ps512(mVec);
+            __m512 t1 = _mm512_mask_tan_ps(t0, mask.mMask, t0);
+            __m256 t2 = _mm512_castps512_ps256(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        #endif
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
+        // MATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(mask, *this, b);
+        }
+        // ASIN
+        UME_FORCE_INLINE SIMDVec_f asin() const {
+            return VECTOR_EMULATION::asinf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MASIN
+        UME_FORCE_INLINE SIMDVec_f asin(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::asinf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ACOS
+        UME_FORCE_INLINE SIMDVec_f acos() const {
+            return VECTOR_EMULATION::acosf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MACOS
+        UME_FORCE_INLINE SIMDVec_f acos(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::acosf<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 4> const & a, SIMDVec_f<float, 4> const & b) {
 /*
@@ -2368,6 +2700,7 @@ namespace SIMD {
         // FTOI
         UME_FORCE_INLINE operator SIMDVec_i<int32_t, 8>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -72,6 +72,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<double, 2> :
@@ -209,8 +210,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(double const * p) {
@@ -223,10 +233,8 @@ namespace SIMD {
             mVec = _mm_mask_loadu_pd(mVec, mask.mMask, p);
 #else
             __m512d t0 = _mm512_castpd128_pd512(mVec);
-            __m128d t1 = _mm_loadu_pd(p);
-            __m512d t2 = _mm512_castpd128_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t0, mask.mMask, t2);
-            mVec = _mm512_castpd512_pd128(t3);
+            __m512d t1 = _mm512_mask_loadu_pd(t0, mask.mMask, p);
+            mVec = _mm512_castpd512_pd128(t1);
 #endif
             return *this;
         }
@@ -241,10 +249,8 @@ namespace SIMD {
             mVec = _mm_mask_load_pd(mVec, mask.mMask, p);
 #else
             __m512d t0 = _mm512_castpd128_pd512(mVec);
-            __m128d t1 = _mm_load_pd(p);
-            __m512d t2 = _mm512_castpd128_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t0, mask.mMask, t2);
-            mVec = _mm512_castpd512_pd128(t3);
+            __m512d t1 = _mm512_mask_loadu_pd(t0, mask.mMask, p);
+            mVec = _mm512_castpd512_pd128(t1);
 #endif
             return *this;
         }
@@ -259,11 +265,7 @@ namespace SIMD {
             _mm_mask_storeu_pd(p, mask.mMask, mVec);
 #else
             __m512d t0 = _mm512_castpd128_pd512(mVec);
-            __m128d t1 = _mm_loadu_pd(p);
-            __m512d t2 = _mm512_castpd128_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t2, mask.mMask, t0);
-            __m128d t4 = _mm512_castpd512_pd128(t3);
-            _mm_storeu_pd(p, t4);
+            _mm512_mask_storeu_pd(p, mask.mMask, t0);
 #endif
             return p;
         }
@@ -278,14 +280,48 @@ namespace SIMD {
              _mm_mask_store_pd(p, mask.mMask, mVec);
 #else
             __m512d t0 = _mm512_castpd128_pd512(mVec);
-            __m128d t1 = _mm_load_pd(p);
-            __m512d t2 = _mm512_castpd128_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t2, mask.mMask, t0);
-            __m128d t4 = _mm512_castpd512_pd128(t3);
-            _mm_store_pd(p, t4);
+            _mm512_mask_storeu_pd(p, mask.mMask, t0);
 #endif
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE double* sstore(double * p) const {
+            _mm_stream_pd(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE double* sstore(SIMDVecMask<2> const & mask, double * p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<2> const & mask) const {
+#if defined(__AVX512VL__)
+            __m128d t0 = _mm_maskz_compress_pd(mask.mMask, mVec);
+#else
+            __m512d t1 = _mm512_maskz_compress_pd(mask.mMask, _mm512_castpd128_pd512(mVec));
+            __m128d t0 = _mm512_castpd512_pd128(t1);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<2> const & mask, double * p) const {
+#if defined(__AVX512VL__)
+            _mm_mask_compressstoreu_pd(p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_pd(p, mask.mMask, _mm512_castpd128_pd512(mVec));
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<2> const & mask, double const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm_mask_expandloadu_pd(mVec, mask.mMask, p);
+#else
+            __m512d t0 = _mm512_mask_expandloadu_pd(_mm512_castpd128_pd512(mVec), mask.mMask, p);
+            mVec = _mm512_castpd512_pd128(t0);
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
@@ -1820,9 +1856,34 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<2> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<2> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double, SIMDVecMask<2>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, double>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m128d t0 = _mm_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT);
@@ -1914,7 +1975,7 @@ namespace SIMD {
             __m128d t0 = _mm_exp_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MEXP
@@ -1925,16 +1986,96 @@ namespace SIMD {
             __m128d t2 = _mm512_castpd512_pd128(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
             __m128d t0 = _mm_log_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MLOG
@@ -1945,20 +2086,56 @@ namespace SIMD {
             __m128d t2 = _mm512_castpd512_pd128(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+        #if defined(UME_USE_SVML)
+            __m128d t0 = _mm_log2_pd(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        #endif
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<2> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_castpd128_pd512(mVec);
+            __m512d t1 = _mm512_mask_log2_pd(t0, mask.mMask, t0);
+            __m128d t2 = _mm512_castpd512_pd128(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        #endif
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+        #if defined(UME_USE_SVML)
+            __m128d t0 = _mm_log10_pd(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        #endif
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<2> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_castpd128_pd512(mVec);
+            __m512d t1 = _mm512_mask_log10_pd(t0, mask.mMask, t0);
+            __m128d t2 = _mm512_castpd512_pd128(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        #endif
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
             __m128d t0 = _mm_sin_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MSIN
@@ -1969,7 +2146,7 @@ namespace SIMD {
             __m128d t2 = _mm512_castpd512_pd128(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // COS
@@ -1978,7 +2155,7 @@ namespace SIMD {
             __m128d t0 = _mm_cos_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MCOS
@@ -1989,7 +2166,7 @@ namespace SIMD {
             __m128d t2 = _mm512_castpd512_pd128(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // SINCOS
@@ -2016,9 +2193,65 @@ namespace SIMD {
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+        #if defined(UME_USE_SVML)
+            __m128d t0 = _mm_tan_pd(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this);
+        #endif
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<2> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_castpd128_pd512(mVec);
+            __m512d t1 = _mm512_mask_tan_pd(t0, mask.mMask, t0);
+            __m128d t2 = _mm512_castpd512_pd128(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        #endif
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<2>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<2>>(*this, b);
+        }
+        // MATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<2>>(mask, *this, b);
+        }
+        // ASIN
+        UME_FORCE_INLINE SIMDVec_f asin() const {
+            return VECTOR_EMULATION::asind<SIMDVec_f, SIMDVecMask<2>>(*this);
+        }
+        // MASIN
+        UME_FORCE_INLINE SIMDVec_f asin(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::asind<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
+        }
+        // ACOS
+        UME_FORCE_INLINE SIMDVec_f acos() const {
+            return VECTOR_EMULATION::acosd<SIMDVec_f, SIMDVecMask<2>>(*this);
+        }
+        // MACOS
+        UME_FORCE_INLINE SIMDVec_f acos(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::acosd<SIMDVec_f, SIMDVecMask<2>>(mask, *this);
+        }
 
         // PACK
         SIMDVec_f & pack(SIMDVec_f<double, 1> const & a, SIMDVec_f<double, 1> const & b) {
@@ -2075,6 +2308,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_i<int64_t, 2>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
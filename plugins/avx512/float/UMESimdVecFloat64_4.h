@@ -72,6 +72,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<double, 4> :
@@ -207,8 +208,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(double const * p) {
@@ -221,10 +231,8 @@ namespace SIMD {
             mVec = _mm256_mask_loadu_pd(mVec, mask.mMask, p);
 #else
             __m512d t0 = _mm512_castpd256_pd512(mVec);
-            __m256d t1 = _mm256_loadu_pd(p);
-            __m512d t2 = _mm512_castpd256_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t0, mask.mMask, t2);
-            mVec = _mm512_castpd512_pd256(t3);
+            __m512d t1 = _mm512_mask_loadu_pd(t0, mask.mMask, p);
+            mVec = _mm512_castpd512_pd256(t1);
 #endif
             return *this;
         }
@@ -239,10 +247,8 @@ namespace SIMD {
             mVec = _mm256_mask_load_pd(mVec, mask.mMask, p);
 #else
             __m512d t0 = _mm512_castpd256_pd512(mVec);
-            __m256d t1 = _mm256_loadu_pd(p);
-            __m512d t2 = _mm512_castpd256_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t0, mask.mMask, t2);
-            mVec = _mm512_castpd512_pd256(t3);
+            __m512d t1 = _mm512_mask_loadu_pd(t0, mask.mMask, p);
+            mVec = _mm512_castpd512_pd256(t1);
 #endif
             return *this;
         }
@@ -257,11 +263,7 @@ namespace SIMD {
             _mm256_mask_storeu_pd(p, mask.mMask, mVec);
 #else
             __m512d t0 = _mm512_castpd256_pd512(mVec);
-            __m256d t1 = _mm256_loadu_pd(p);
-            __m512d t2 = _mm512_castpd256_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t2, mask.mMask, t0);
-            __m256d t4 = _mm512_castpd512_pd256(t3);
-            _mm256_storeu_pd(p, t4);
+            _mm512_mask_storeu_pd(p, mask.mMask, t0);
 #endif
             return p;
         }
@@ -276,14 +278,48 @@ namespace SIMD {
              _mm256_mask_store_pd(p, mask.mMask, mVec);
 #else
             __m512d t0 = _mm512_castpd256_pd512(mVec);
-            __m256d t1 = _mm256_load_pd(p);
-            __m512d t2 = _mm512_castpd256_pd512(t1);
-            __m512d t3 = _mm512_mask_mov_pd(t2, mask.mMask, t0);
-            __m256d t4 = _mm512_castpd512_pd256(t3);
-            _mm256_store_pd(p, t4);
+            _mm512_mask_storeu_pd(p, mask.mMask, t0);
 #endif
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE double* sstore(double * p) const {
+            _mm256_stream_pd(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE double* sstore(SIMDVecMask<4> const & mask, double * p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<4> const & mask) const {
+#if defined(__AVX512VL__)
+            __m256d t0 = _mm256_maskz_compress_pd(mask.mMask, mVec);
+#else
+            __m512d t1 = _mm512_maskz_compress_pd(mask.mMask, _mm512_castpd256_pd512(mVec));
+            __m256d t0 = _mm512_castpd512_pd256(t1);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, double * p) const {
+#if defined(__AVX512VL__)
+            _mm256_mask_compressstoreu_pd(p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_pd(p, mask.mMask, _mm512_castpd256_pd512(mVec));
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<4> const & mask, double const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm256_mask_expandloadu_pd(mVec, mask.mMask, p);
+#else
+            __m512d t0 = _mm512_mask_expandloadu_pd(_mm512_castpd256_pd512(mVec), mask.mMask, p);
+            mVec = _mm512_castpd512_pd256(t0);
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
@@ -312,6 +348,105 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m256d sortNetwork(__m256d const & a, bool descending, bool bitonic) {
+            __m256d t0 = _mm256_permute4x64_pd(a, 0xB1);
+            __m256i t1 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256d t2 = _mm256_min_pd(a, t0);
+            __m256d t3 = _mm256_max_pd(a, t0);
+            __m256d t4 = descending ? _mm256_blendv_pd(t3, t2, _mm256_castsi256_pd(t1)) : _mm256_blendv_pd(t2, t3, _mm256_castsi256_pd(t1));
+            __m256d t5 = bitonic ? a : t4;
+            __m256d t6 = _mm256_permute4x64_pd(t5, 0x4E);
+            __m256i t7 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256d t8 = _mm256_min_pd(t5, t6);
+            __m256d t9 = _mm256_max_pd(t5, t6);
+            __m256d t10 = descending ? _mm256_blendv_pd(t9, t8, _mm256_castsi256_pd(t7)) : _mm256_blendv_pd(t8, t9, _mm256_castsi256_pd(t7));
+            __m256d t11 = _mm256_permute4x64_pd(t10, 0xB1);
+            __m256i t12 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256d t13 = _mm256_min_pd(t10, t11);
+            __m256d t14 = _mm256_max_pd(t10, t11);
+            __m256d t15 = descending ? _mm256_blendv_pd(t14, t13, _mm256_castsi256_pd(t12)) : _mm256_blendv_pd(t13, t14, _mm256_castsi256_pd(t12));
+            return t15;
+        }
+        UME_FORCE_INLINE static __m256d sortNetwork(__m256d const & a, __m256i & payload, bool descending, bool bitonic) {
+            __m256d t0 = _mm256_permute4x64_pd(a, 0xB1);
+            __m256i t1 = _mm256_permute4x64_epi64(payload, 0xB1);
+            __m256i t2 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256i t3 = _mm256_castpd_si256(_mm256_cmp_pd(a, t0, _CMP_GT_OQ));
+            __m256i t4 = _mm256_castpd_si256(_mm256_cmp_pd(t0, a, _CMP_GT_OQ));
+            __m256i t5 = descending ? _mm256_blendv_epi8(t4, t3, t2) : _mm256_blendv_epi8(t3, t4, t2);
+            __m256d t6 = _mm256_blendv_pd(a, t0, _mm256_castsi256_pd(t5));
+            __m256i t7 = _mm256_blendv_epi8(payload, t1, t5);
+            __m256d t8 = bitonic ? a : t6;
+            __m256i t9 = bitonic ? payload : t7;
+            __m256d t10 = _mm256_permute4x64_pd(t8, 0x4E);
+            __m256i t11 = _mm256_permute4x64_epi64(t9, 0x4E);
+            __m256i t12 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256i t13 = _mm256_castpd_si256(_mm256_cmp_pd(t8, t10, _CMP_GT_OQ));
+            __m256i t14 = _mm256_castpd_si256(_mm256_cmp_pd(t10, t8, _CMP_GT_OQ));
+            __m256i t15 = descending ? _mm256_blendv_epi8(t14, t13, t12) : _mm256_blendv_epi8(t13, t14, t12);
+            __m256d t16 = _mm256_blendv_pd(t8, t10, _mm256_castsi256_pd(t15));
+            __m256i t17 = _mm256_blendv_epi8(t9, t11, t15);
+            __m256d t18 = _mm256_permute4x64_pd(t16, 0xB1);
+            __m256i t19 = _mm256_permute4x64_epi64(t17, 0xB1);
+            __m256i t20 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256i t21 = _mm256_castpd_si256(_mm256_cmp_pd(t16, t18, _CMP_GT_OQ));
+            __m256i t22 = _mm256_castpd_si256(_mm256_cmp_pd(t18, t16, _CMP_GT_OQ));
+            __m256i t23 = descending ? _mm256_blendv_epi8(t22, t21, t20) : _mm256_blendv_epi8(t21, t22, t20);
+            __m256d t24 = _mm256_blendv_pd(t16, t18, _mm256_castsi256_pd(t23));
+            __m256i t25 = _mm256_blendv_epi8(t17, t19, t23);
+            payload = t25;
+            return t24;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m256d t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m256d t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256d t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256d t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_f bsorta() const {
+            __m256d t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_f bsortd() const {
+            __m256d t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsorta(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256d t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsortd(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256d t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m256d t0 = _mm256_add_pd(mVec, b.mVec);
@@ -1090,9 +1225,17 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            alignas(16) double raw[2];
-            _mm256_store_pd(raw, mVec);
-            return raw[0] != raw[1];
+            // Rotations by 1 and 2 compare every pair of the 4 elements.
+            __m512d t0 = _mm512_castpd256_pd512(mVec);
+            __m512i t1 = _mm512_setr_epi64(0, 1, 2, 3, 0, 0, 0, 0);
+            __m512i t2 = _mm512_set1_epi64(3);
+            __mmask8 m0 = 0;
+            for (int k = 1; k <= 2; k++) {
+                __m512i t3 = _mm512_and_si512(_mm512_sub_epi64(t1, _mm512_set1_epi64(k)), t2);
+                __m512d t4 = _mm512_permutexvar_pd(t3, t0);
+                m0 |= _mm512_mask_cmp_pd_mask(0x0F, t0, t4, _CMP_EQ_OQ);
+            }
+            return m0 == 0;
         }
         // HADD
         UME_FORCE_INLINE double hadd() const {
@@ -1856,9 +1999,34 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<4> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double, SIMDVecMask<4>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, double>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm256_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT);
@@ -1954,7 +2122,7 @@ namespace SIMD {
             __m256d t0 = _mm256_exp_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MEXP
@@ -1965,16 +2133,96 @@ namespace SIMD {
             __m256d t2 = _mm512_castpd512_pd256(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>> (mask, *this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION> (mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
             __m256d t0 = _mm256_log_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MLOG
@@ -1985,20 +2233,56 @@ namespace SIMD {
             __m256d t2 = _mm512_castpd512_pd256(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+        #if defined(UME_USE_SVML)
+            __m256d t0 = _mm256_log2_pd(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        #endif
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_castpd256_pd512(mVec);
+            __m512d t1 = _mm512_mask_log2_pd(t0, mask.mMask, t0);
+            __m256d t2 = _mm512_castpd512_pd256(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        #endif
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+        #if defined(UME_USE_SVML)
+            __m256d t0 = _mm256_log10_pd(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        #endif
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_castpd256_pd512(mVec);
+            __m512d t1 = _mm512_mask_log10_pd(t0, mask.mMask, t0);
+            __m256d t2 = _mm512_castpd512_pd256(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        #endif
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
             __m256d t0 = _mm256_sin_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MSIN
@@ -2009,7 +2293,7 @@ namespace SIMD {
             __m256d t2 = _mm512_castpd512_pd256(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // COS
@@ -2018,7 +2302,7 @@ namespace SIMD {
             __m256d t0 = _mm256_cos_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MCOS
@@ -2029,7 +2313,7 @@ namespace SIMD {
             __m256d t2 = _mm512_castpd512_pd256(t1);
             return SIMDVec_f(t2);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // SINCOS
@@ -2056,9 +2340,65 @@ namespace SIMD {
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+        #if defined(UME_USE_SVML)
+            __m256d t0 = _mm256_tan_pd(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+        #endif
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_castpd256_pd512(mVec);
+            __m512d t1 = _mm512_mask_tan_pd(t0, mask.mMask, t0);
+            __m256d t2 = _mm512_castpd512_pd256(t1);
+            return SIMDVec_f(t2);
+        #else
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        #endif
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
+        // MATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<4>>(mask, *this, b);
+        }
+        // ASIN
+        UME_FORCE_INLINE SIMDVec_f asin() const {
+            return VECTOR_EMULATION::asind<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MASIN
+        UME_FORCE_INLINE SIMDVec_f asin(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::asind<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
+        // ACOS
+        UME_FORCE_INLINE SIMDVec_f acos() const {
+            return VECTOR_EMULATION::acosd<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // MACOS
+        UME_FORCE_INLINE SIMDVec_f acos(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::acosd<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+        }
 
         // PACK
         SIMDVec_f & pack(SIMDVec_f<double, 2> const & a, SIMDVec_f<double, 2> const & b) {
@@ -2103,6 +2443,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_i<int64_t, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
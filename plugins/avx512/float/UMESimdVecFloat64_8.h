@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<double, 8> :
@@ -161,8 +162,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_f & load(double const * p) {
@@ -204,6 +214,30 @@ namespace SIMD {
              _mm512_mask_store_pd(p, mask.mMask, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE double* sstore(double * p) const {
+            _mm512_stream_pd(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE double* sstore(SIMDVecMask<8> const & mask, double * p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_f compress(SIMDVecMask<8> const & mask) const {
+            __m512d t0 = _mm512_maskz_compress_pd(mask.mMask, mVec);
+            return SIMDVec_f(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, double * p) const {
+            _mm512_mask_compressstoreu_pd(p, mask.mMask, mVec);
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<8> const & mask, double const * p) {
+            mVec = _mm512_mask_expandloadu_pd(mVec, mask.mMask, p);
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
         
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
@@ -234,6 +268,102 @@ namespace SIMD {
             mVec = _mm512_permutexvar_pd(t0, mVec);
             return *this;
         }
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_f permute(SIMDVec_u<uint64_t, 8> const & indices) const {
+            __m512d t0 = _mm512_permutexvar_pd(indices.mVec, mVec);
+            return SIMDVec_f(t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_f permute2(SIMDVec_f const & b, SIMDVec_u<uint64_t, 8> const & indices) const {
+            __m512d t0 = _mm512_permutex2var_pd(mVec, indices.mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m512d sortNetwork(__m512d const & a, bool descending, bool bitonic) {
+            __m512i t0 = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+            __mmask8 m0 = descending ? 0xFF : 0;
+            __m512d t1 = a;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m512i t2 = _mm512_set1_epi64(j);
+                    __mmask8 m1 = _mm512_test_epi64_mask(t0, t2) ^ _mm512_test_epi64_mask(t0, _mm512_set1_epi64(k)) ^ m0;
+                    __m512d t3 = _mm512_permutexvar_pd(_mm512_xor_si512(t0, t2), t1);
+                    t1 = _mm512_mask_blend_pd(m1, _mm512_min_pd(t1, t3), _mm512_max_pd(t1, t3));
+                }
+            }
+            return t1;
+        }
+        UME_FORCE_INLINE static __m512d sortNetwork(__m512d const & a, __m512i & payload, bool descending, bool bitonic) {
+            __m512i t0 = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+            __mmask8 m0 = descending ? 0xFF : 0;
+            __m512d t1 = a;
+            __m512i t2 = payload;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m512i t3 = _mm512_set1_epi64(j);
+                    __mmask8 m1 = _mm512_test_epi64_mask(t0, t3) ^ _mm512_test_epi64_mask(t0, _mm512_set1_epi64(k)) ^ m0;
+                    __m512i t4 = _mm512_xor_si512(t0, t3);
+                    __m512d t5 = _mm512_permutexvar_pd(t4, t1);
+                    __m512i t6 = _mm512_permutexvar_epi64(t4, t2);
+                    // Take the partner element if it is larger (smaller)
+                    // than the element keeping the maximum (minimum).
+                    __mmask8 m2 = _mm512_mask_cmp_pd_mask(m1, t5, t1, _CMP_GT_OQ) | _mm512_mask_cmp_pd_mask(~m1, t1, t5, _CMP_GT_OQ);
+                    t1 = _mm512_mask_blend_pd(m2, t1, t5);
+                    t2 = _mm512_mask_blend_epi64(m2, t2, t6);
+                }
+            }
+            payload = t2;
+            return t1;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m512d t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m512d t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f sorta(SIMDVec_u<uint64_t, 8> & payload) const {
+            __m512d t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_f(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f sortd(SIMDVec_u<uint64_t, 8> & payload) const {
+            __m512d t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_f bsorta() const {
+            __m512d t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_f bsortd() const {
+            __m512d t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsorta(SIMDVec_u<uint64_t, 8> & payload) const {
+            __m512d t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_f(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_f bsortd(SIMDVec_u<uint64_t, 8> & payload) const {
+            __m512d t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_f(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
@@ -784,9 +914,16 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            alignas(16) double raw[2];
-            _mm512_store_pd(raw, mVec);
-            return raw[0] != raw[1];
+            // Any two elements are at most 4 positions apart in one of the
+            // rotations, so comparing with 4 rotations covers every pair.
+            __m512i t0 = _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+            __mmask8 m0 = 0;
+            for (int k = 1; k <= 4; k++) {
+                __m512i t1 = _mm512_sub_epi64(t0, _mm512_set1_epi64(k));
+                __m512d t2 = _mm512_permutexvar_pd(t1, mVec);
+                m0 |= _mm512_cmp_pd_mask(mVec, t2, _CMP_EQ_OQ);
+            }
+            return m0 == 0;
         }
         // HADD
         UME_FORCE_INLINE double hadd() const {
@@ -1168,6 +1305,16 @@ namespace SIMD {
             mVec = _mm512_mask_i64gather_pd(mVec, m0, indices.mVec, baseAddr, 8);
             return *this;
         }
+#if defined(__AVX512PF__)
+        // PREFETCHGATHER0
+        static UME_FORCE_INLINE void prefetchgather0(double const * baseAddr, SIMDVec_u<uint64_t, 8> const & indices) {
+            _mm512_prefetch_i64gather_pd(indices.mVec, baseAddr, 8, _MM_HINT_T0);
+        }
+        // PREFETCHGATHER1
+        static UME_FORCE_INLINE void prefetchgather1(double const * baseAddr, SIMDVec_u<uint64_t, 8> const & indices) {
+            _mm512_prefetch_i64gather_pd(indices.mVec, baseAddr, 8, _MM_HINT_T1);
+        }
+#endif
         // SCATTERU
         UME_FORCE_INLINE double* scatteru(double* baseAddr, uint64_t stride) const {
 #if defined (__AVX512DQ__)
@@ -1401,9 +1548,34 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<8> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double, SIMDVecMask<8>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, double>(*this);
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm512_extractf64x4_pd(mVec, 0);
@@ -1506,7 +1678,7 @@ namespace SIMD {
             __m512d t0 = _mm512_exp_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MEXP
@@ -1515,16 +1687,96 @@ namespace SIMD {
             __m512d t0 = _mm512_mask_exp_pd(mVec, mask.mMask, mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG
         UME_FORCE_INLINE SIMDVec_f log() const {
         #if defined(UME_USE_SVML)
             __m512d t0 = _mm512_log_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MLOG
@@ -1533,20 +1785,52 @@ namespace SIMD {
             __m512d t0 = _mm512_mask_log_pd(mVec, mask.mMask, mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_log2_pd(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        #endif
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_mask_log2_pd(mVec, mask.mMask, mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        #endif
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_log10_pd(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        #endif
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_mask_log10_pd(mVec, mask.mMask, mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        #endif
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
             __m512d t0 = _mm512_sin_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MSIN
@@ -1555,7 +1839,7 @@ namespace SIMD {
             __m512d t0 = _mm512_mask_sin_pd(mVec, mask.mMask, mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // COS
@@ -1564,7 +1848,7 @@ namespace SIMD {
             __m512d t0 = _mm512_cos_pd(mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(*this);
         #endif
         }
         // MCOS
@@ -1573,7 +1857,7 @@ namespace SIMD {
             __m512d t0 = _mm512_mask_cos_pd(mVec, mask.mMask, mVec);
             return SIMDVec_f(t0);
         #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>, DEFAULT_PRECISION>(mask, *this);
         #endif
         }
         // SINCOS
@@ -1598,9 +1882,63 @@ namespace SIMD {
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_tan_pd(mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+        #endif
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+        #if defined(UME_USE_SVML)
+            __m512d t0 = _mm512_mask_tan_pd(mVec, mask.mMask, mVec);
+            return SIMDVec_f(t0);
+        #else
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        #endif
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MATAN
+        UME_FORCE_INLINE SIMDVec_f atan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
+        // MATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<8>>(mask, *this, b);
+        }
+        // ASIN
+        UME_FORCE_INLINE SIMDVec_f asin() const {
+            return VECTOR_EMULATION::asind<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MASIN
+        UME_FORCE_INLINE SIMDVec_f asin(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::asind<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
+        // ACOS
+        UME_FORCE_INLINE SIMDVec_f acos() const {
+            return VECTOR_EMULATION::acosd<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // MACOS
+        UME_FORCE_INLINE SIMDVec_f acos(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::acosd<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+        }
 
         // PACK
         SIMDVec_f & pack(SIMDVec_f<double, 4> const & a, SIMDVec_f<double, 4> const & b) {
@@ -1645,6 +1983,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_i<int64_t, 8>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 16> :
@@ -56,6 +57,7 @@ namespace SIMD {
         friend class SIMDVec_u<uint32_t, 16>;
         friend class SIMDVec_f<float, 16>;
         friend class SIMDVec_f<double, 16>;
+        friend class SIMDVec_i<int16_t, 16>;
 
         friend class SIMDVec_i<int32_t, 32>;
     private:
@@ -158,8 +160,17 @@ namespace SIMD {
             return *this;
         }
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
             mVec = _mm512_loadu_si512(p);
@@ -200,6 +211,30 @@ namespace SIMD {
             _mm512_mask_store_epi32(p, mask.mMask, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int32_t * sstore(int32_t * addrAligned) {
+            _mm512_stream_si512((__m512i*)addrAligned, mVec);
+            return addrAligned;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int32_t * sstore(SIMDVecMask<16> const & mask, int32_t * p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<16> const & mask) const {
+            __m512i t0 = _mm512_maskz_compress_epi32(mask.mMask, mVec);
+            return SIMDVec_i(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<16> const & mask, int32_t * p) const {
+            _mm512_mask_compressstoreu_epi32(p, mask.mMask, mVec);
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<16> const & mask, int32_t const * p) {
+            mVec = _mm512_mask_expandloadu_epi32(mVec, mask.mMask, p);
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
             __m512i t0 = _mm512_mask_mov_epi32(mVec, mask.mMask, b.mVec);
@@ -213,6 +248,102 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint32_t, 16> const & indices) const {
+            __m512i t0 = _mm512_permutexvar_epi32(indices.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint32_t, 16> const & indices) const {
+            __m512i t0 = _mm512_permutex2var_epi32(mVec, indices.mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m512i sortNetwork(__m512i const & a, bool descending, bool bitonic) {
+            __m512i t0 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            __mmask16 m0 = descending ? 0xFFFF : 0;
+            __m512i t1 = a;
+            for (int k = bitonic ? 16 : 2; k <= 16; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m512i t2 = _mm512_set1_epi32(j);
+                    __mmask16 m1 = _mm512_test_epi32_mask(t0, t2) ^ _mm512_test_epi32_mask(t0, _mm512_set1_epi32(k)) ^ m0;
+                    __m512i t3 = _mm512_permutexvar_epi32(_mm512_xor_si512(t0, t2), t1);
+                    t1 = _mm512_mask_blend_epi32(m1, _mm512_min_epi32(t1, t3), _mm512_max_epi32(t1, t3));
+                }
+            }
+            return t1;
+        }
+        UME_FORCE_INLINE static __m512i sortNetwork(__m512i const & a, __m512i & payload, bool descending, bool bitonic) {
+            __m512i t0 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            __mmask16 m0 = descending ? 0xFFFF : 0;
+            __m512i t1 = a;
+            __m512i t2 = payload;
+            for (int k = bitonic ? 16 : 2; k <= 16; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m512i t3 = _mm512_set1_epi32(j);
+                    __mmask16 m1 = _mm512_test_epi32_mask(t0, t3) ^ _mm512_test_epi32_mask(t0, _mm512_set1_epi32(k)) ^ m0;
+                    __m512i t4 = _mm512_xor_si512(t0, t3);
+                    __m512i t5 = _mm512_permutexvar_epi32(t4, t1);
+                    __m512i t6 = _mm512_permutexvar_epi32(t4, t2);
+                    // Take the partner element if it is larger (smaller)
+                    // than the element keeping the maximum (minimum).
+                    __mmask16 m2 = _mm512_mask_cmpgt_epi32_mask(m1, t5, t1) | _mm512_mask_cmpgt_epi32_mask(~m1, t1, t5);
+                    t1 = _mm512_mask_blend_epi32(m2, t1, t5);
+                    t2 = _mm512_mask_blend_epi32(m2, t2, t6);
+                }
+            }
+            payload = t2;
+            return t1;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m512i t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m512i t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 16> & payload) const {
+            __m512i t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 16> & payload) const {
+            __m512i t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_i bsorta() const {
+            __m512i t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_i bsortd() const {
+            __m512i t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsorta(SIMDVec_u<uint32_t, 16> & payload) const {
+            __m512i t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsortd(SIMDVec_u<uint32_t, 16> & payload) const {
+            __m512i t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             __m512i t0 = _mm512_add_epi32(mVec, b.mVec);
@@ -500,6 +631,11 @@ namespace SIMD {
             mVec = _mm512_mask_mullo_epi32(mVec, mask.mMask, mVec, t0);
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            __m512i t0 = MulHighAVX512::mulhis32(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // DIVV
         // MDIVV
         // DIVS
@@ -508,6 +644,11 @@ namespace SIMD {
         // MDIVVA
         // DIVSA
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int32_t> const & divider) const {
+            __m512i t0 = DivideAVX512::divs32(mVec, divider);
+            return SIMDVec_i(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -648,9 +789,13 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            __m512i t0 = _mm512_conflict_epi32(mVec);
-            __mmask16 t1 = _mm512_cmpeq_epi32_mask(t0, _mm512_set1_epi32(1));
-            return (t1 == 0x0000);
+            __m512i t0 = ConflictAVX512::conflict32(mVec, 16);
+            return _mm512_test_epi32_mask(t0, t0) == 0;
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_i conflict() const {
+            __m512i t0 = ConflictAVX512::conflict32(mVec, 16);
+            return SIMDVec_i(t0);
         }
         // HADD
         UME_FORCE_INLINE int32_t hadd() const {
@@ -1254,6 +1399,26 @@ namespace SIMD {
             mVec = _mm512_mask_andnot_epi32(mVec, mask.mMask, mVec, t0);
             return *this;
         }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_i popcnt() const {
+            __m512i t0 = BitCountAVX512::popcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_i lzcnt() const {
+            __m512i t0 = BitCountAVX512::lzcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_i tzcnt() const {
+            __m512i t0 = BitCountAVX512::tzcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_i bitrev() const {
+            __m512i t0 = BitCountAVX512::bitrev32(mVec);
+            return SIMDVec_i(t0);
+        }
         // HBAND
         UME_FORCE_INLINE int32_t hband() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_4)
@@ -1528,6 +1693,16 @@ namespace SIMD {
             mVec = _mm512_mask_i32gather_epi32(mVec, mask.mMask, indices.mVec, baseAddr, 4);
             return *this;
         }
+#if defined(__AVX512PF__)
+        // PREFETCHGATHER0
+        static UME_FORCE_INLINE void prefetchgather0(int32_t const * baseAddr, SIMDVec_u<uint32_t, 16> const & indices) {
+            _mm512_prefetch_i32gather_ps(indices.mVec, baseAddr, 4, _MM_HINT_T0);
+        }
+        // PREFETCHGATHER1
+        static UME_FORCE_INLINE void prefetchgather1(int32_t const * baseAddr, SIMDVec_u<uint32_t, 16> const & indices) {
+            _mm512_prefetch_i32gather_ps(indices.mVec, baseAddr, 4, _MM_HINT_T1);
+        }
+#endif
         // SCATTERU
         UME_FORCE_INLINE int32_t* scatteru(int32_t* baseAddr, uint32_t stride) const {
             __m512i t0 = _mm512_set1_epi32(stride);
@@ -1796,6 +1971,7 @@ namespace SIMD {
 
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 4> :
@@ -168,8 +169,17 @@ namespace SIMD {
             return *this;
         }
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
 #if defined(__AVX512VL__)
@@ -184,11 +194,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_loadu_epi32(mVec, mask.mMask, p);
 #else
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(mVec);
-            __m512i t2 = _mm512_castsi128_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si128(t3);
+            __m512i t0 = _mm512_castsi128_si512(mVec);
+            __m512i t1 = _mm512_mask_loadu_epi32(t0, mask.mMask, p);
+            mVec = _mm512_castsi512_si128(t1);
 #endif
             return *this;
         }
@@ -202,11 +210,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_load_epi32(mVec, mask.mMask, p);
 #else
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(mVec);
-            __m512i t2 = _mm512_castsi128_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si128(t3);
+            __m512i t0 = _mm512_castsi128_si512(mVec);
+            __m512i t1 = _mm512_mask_loadu_epi32(t0, mask.mMask, p);
+            mVec = _mm512_castsi512_si128(t1);
 #endif
             return *this;
         }
@@ -220,12 +226,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_storeu_epi32(p, mask.mMask, mVec);
 #else
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(t0);
-            __m512i t2 = _mm512_castsi128_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m128i t4 = _mm512_castsi512_si128(t3);
-            _mm_storeu_si128((__m128i*)p, t4);
+            __m512i t0 = _mm512_castsi128_si512(mVec);
+            _mm512_mask_storeu_epi32(p, mask.mMask, t0);
 #endif
             return p;
         }
@@ -239,15 +241,49 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_store_epi32(p, mask.mMask, mVec);
 #else
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(t0);
-            __m512i t2 = _mm512_castsi128_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m128i t4 = _mm512_castsi512_si128(t3);
-            _mm_store_si128((__m128i*)p, t4);
+            __m512i t0 = _mm512_castsi128_si512(mVec);
+            _mm512_mask_storeu_epi32(p, mask.mMask, t0);
 #endif
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int32_t * sstore(int32_t * p) const {
+            _mm_stream_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int32_t * sstore(SIMDVecMask<4> const & mask, int32_t * p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<4> const & mask) const {
+#if defined(__AVX512VL__)
+            __m128i t0 = _mm_maskz_compress_epi32(mask.mMask, mVec);
+#else
+            __m512i t1 = _mm512_maskz_compress_epi32(mask.mMask, _mm512_castsi128_si512(mVec));
+            __m128i t0 = _mm512_castsi512_si128(t1);
+#endif
+            return SIMDVec_i(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, int32_t * p) const {
+#if defined(__AVX512VL__)
+            _mm_mask_compressstoreu_epi32(p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_epi32(p, mask.mMask, _mm512_castsi128_si512(mVec));
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<4> const & mask, int32_t const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm_mask_expandloadu_epi32(mVec, mask.mMask, p);
+#else
+            __m512i t0 = _mm512_mask_expandloadu_epi32(_mm512_castsi128_si512(mVec), mask.mMask, p);
+            mVec = _mm512_castsi512_si128(t0);
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
 #if defined(__AVX512VL__)
@@ -277,6 +313,105 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m128i sortNetwork(__m128i const & a, bool descending, bool bitonic) {
+            __m128i t0 = _mm_shuffle_epi32(a, 0xB1);
+            __m128i t1 = _mm_setr_epi32(0, -1, -1, 0);
+            __m128i t2 = _mm_min_epi32(a, t0);
+            __m128i t3 = _mm_max_epi32(a, t0);
+            __m128i t4 = descending ? _mm_blendv_epi8(t3, t2, t1) : _mm_blendv_epi8(t2, t3, t1);
+            __m128i t5 = bitonic ? a : t4;
+            __m128i t6 = _mm_shuffle_epi32(t5, 0x4E);
+            __m128i t7 = _mm_setr_epi32(0, 0, -1, -1);
+            __m128i t8 = _mm_min_epi32(t5, t6);
+            __m128i t9 = _mm_max_epi32(t5, t6);
+            __m128i t10 = descending ? _mm_blendv_epi8(t9, t8, t7) : _mm_blendv_epi8(t8, t9, t7);
+            __m128i t11 = _mm_shuffle_epi32(t10, 0xB1);
+            __m128i t12 = _mm_setr_epi32(0, -1, 0, -1);
+            __m128i t13 = _mm_min_epi32(t10, t11);
+            __m128i t14 = _mm_max_epi32(t10, t11);
+            __m128i t15 = descending ? _mm_blendv_epi8(t14, t13, t12) : _mm_blendv_epi8(t13, t14, t12);
+            return t15;
+        }
+        UME_FORCE_INLINE static __m128i sortNetwork(__m128i const & a, __m128i & payload, bool descending, bool bitonic) {
+            __m128i t0 = _mm_shuffle_epi32(a, 0xB1);
+            __m128i t1 = _mm_shuffle_epi32(payload, 0xB1);
+            __m128i t2 = _mm_setr_epi32(0, -1, -1, 0);
+            __m128i t3 = _mm_cmpgt_epi32(a, t0);
+            __m128i t4 = _mm_cmpgt_epi32(t0, a);
+            __m128i t5 = descending ? _mm_blendv_epi8(t4, t3, t2) : _mm_blendv_epi8(t3, t4, t2);
+            __m128i t6 = _mm_blendv_epi8(a, t0, t5);
+            __m128i t7 = _mm_blendv_epi8(payload, t1, t5);
+            __m128i t8 = bitonic ? a : t6;
+            __m128i t9 = bitonic ? payload : t7;
+            __m128i t10 = _mm_shuffle_epi32(t8, 0x4E);
+            __m128i t11 = _mm_shuffle_epi32(t9, 0x4E);
+            __m128i t12 = _mm_setr_epi32(0, 0, -1, -1);
+            __m128i t13 = _mm_cmpgt_epi32(t8, t10);
+            __m128i t14 = _mm_cmpgt_epi32(t10, t8);
+            __m128i t15 = descending ? _mm_blendv_epi8(t14, t13, t12) : _mm_blendv_epi8(t13, t14, t12);
+            __m128i t16 = _mm_blendv_epi8(t8, t10, t15);
+            __m128i t17 = _mm_blendv_epi8(t9, t11, t15);
+            __m128i t18 = _mm_shuffle_epi32(t16, 0xB1);
+            __m128i t19 = _mm_shuffle_epi32(t17, 0xB1);
+            __m128i t20 = _mm_setr_epi32(0, -1, 0, -1);
+            __m128i t21 = _mm_cmpgt_epi32(t16, t18);
+            __m128i t22 = _mm_cmpgt_epi32(t18, t16);
+            __m128i t23 = descending ? _mm_blendv_epi8(t22, t21, t20) : _mm_blendv_epi8(t21, t22, t20);
+            __m128i t24 = _mm_blendv_epi8(t16, t18, t23);
+            __m128i t25 = _mm_blendv_epi8(t17, t19, t23);
+            payload = t25;
+            return t24;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m128i t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m128i t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128i t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128i t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_i bsorta() const {
+            __m128i t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_i bsortd() const {
+            __m128i t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsorta(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128i t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsortd(SIMDVec_u<uint32_t, 4> & payload) const {
+            __m128i t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             __m128i t0 = _mm_add_epi32(mVec, b.mVec);
@@ -713,6 +848,11 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            __m128i t0 = MulHighAVX512::mulhis32(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // DIVV
         // MDIVV
         // DIVS
@@ -721,6 +861,11 @@ namespace SIMD {
         // MDIVVA
         // DIVSA
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int32_t> const & divider) const {
+            __m128i t0 = DivideAVX512::divs32(mVec, divider);
+            return SIMDVec_i(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -963,13 +1108,26 @@ namespace SIMD {
             return (m0 == 0x0F);
         }
         // UNIQUE
-#if defined(__AVX512VL__) && defined(__AVX512CD__)
         UME_FORCE_INLINE bool unique() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
             __m128i t0 = _mm_conflict_epi32(mVec);
-            __mmask8 m0 = _mm_cmpeq_epi32_mask(t0, _mm_setzero_si128());
-            return (m0 == 0xF);
+            return _mm_test_epi32_mask(t0, t0) == 0;
+#else
+            // Conflicts of the lower elements do not depend on the upper ones.
+            __m512i t0 = ConflictAVX512::conflict32(_mm512_castsi128_si512(mVec), 4);
+            return _mm512_mask_test_epi32_mask(0x000F, t0, t0) == 0;
+#endif
         }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_i conflict() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+            __m128i t0 = _mm_conflict_epi32(mVec);
+#else
+            __m512i t1 = ConflictAVX512::conflict32(_mm512_castsi128_si512(mVec), 4);
+            __m128i t0 = _mm512_castsi512_si128(t1);
 #endif
+            return SIMDVec_i(t0);
+        }
         // HADD
         UME_FORCE_INLINE int32_t hadd() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_4)
@@ -1711,6 +1869,26 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_i popcnt() const {
+            __m128i t0 = BitCountAVX512::popcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_i lzcnt() const {
+            __m128i t0 = BitCountAVX512::lzcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_i tzcnt() const {
+            __m128i t0 = BitCountAVX512::tzcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_i bitrev() const {
+            __m128i t0 = BitCountAVX512::bitrev32(mVec);
+            return SIMDVec_i(t0);
+        }
         // HBAND
         UME_FORCE_INLINE int32_t hband() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_4)
@@ -2414,6 +2592,7 @@ namespace SIMD {
         UME_FORCE_INLINE  operator SIMDVec_f<float, 4> () const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
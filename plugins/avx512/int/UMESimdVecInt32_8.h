@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 8> :
@@ -169,8 +170,17 @@ namespace SIMD {
             return *this;
         }
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
             mVec = _mm256_loadu_si256((__m256i*)p);
@@ -181,11 +191,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_loadu_epi32(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, (__mmask16)mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            __m512i t1 = _mm512_mask_loadu_epi32(t0, mask.mMask, p);
+            mVec = _mm512_castsi512_si256(t1);
 #endif
             return *this;
         }
@@ -199,11 +207,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_load_epi32(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, (__mmask16)mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            __m512i t1 = _mm512_mask_loadu_epi32(t0, mask.mMask, p);
+            mVec = _mm512_castsi512_si256(t1);
 #endif
             return *this;
         }
@@ -221,12 +227,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_storeu_epi32(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_storeu_si256((__m256i*)p, t4);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            _mm512_mask_storeu_epi32(p, mask.mMask, t0);
 #endif
             return p;
         }
@@ -240,15 +242,49 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_store_epi32(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi32(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_store_si256((__m256i*)p, t4);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            _mm512_mask_storeu_epi32(p, mask.mMask, t0);
 #endif
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int32_t * sstore(int32_t * addrAligned) {
+            _mm256_stream_si256((__m256i*)addrAligned, mVec);
+            return addrAligned;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int32_t * sstore(SIMDVecMask<8> const & mask, int32_t * p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<8> const & mask) const {
+#if defined(__AVX512VL__)
+            __m256i t0 = _mm256_maskz_compress_epi32(mask.mMask, mVec);
+#else
+            __m512i t1 = _mm512_maskz_compress_epi32(mask.mMask, _mm512_castsi256_si512(mVec));
+            __m256i t0 = _mm512_castsi512_si256(t1);
+#endif
+            return SIMDVec_i(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, int32_t * p) const {
+#if defined(__AVX512VL__)
+            _mm256_mask_compressstoreu_epi32(p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_epi32(p, mask.mMask, _mm512_castsi256_si512(mVec));
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<8> const & mask, int32_t const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm256_mask_expandloadu_epi32(mVec, mask.mMask, p);
+#else
+            __m512i t0 = _mm512_mask_expandloadu_epi32(_mm512_castsi256_si512(mVec), mask.mMask, p);
+            mVec = _mm512_castsi512_si256(t0);
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
 #if defined(__AVX512VL__)
@@ -278,8 +314,116 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint32_t, 8> const & indices) const {
+            __m256i t0 = _mm256_permutevar8x32_epi32(mVec, indices.mVec);
+            return SIMDVec_i(t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint32_t, 8> const & indices) const {
+#if defined(__AVX512VL__)
+            __m256i t0 = _mm256_permutex2var_epi32(mVec, indices.mVec, b.mVec);
+            return SIMDVec_i(t0);
+#else
+            __m512i t0 = _mm512_inserti64x4(_mm512_castsi256_si512(mVec), b.mVec, 1);
+            __m512i t1 = _mm512_permutexvar_epi32(_mm512_castsi256_si512(indices.mVec), t0);
+            __m256i t2 = _mm512_castsi512_si256(t1);
+            return SIMDVec_i(t2);
+#endif
+        }
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256i t1 = a;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m256i t2 = _mm256_set1_epi32(j);
+                    __m256i t3 = _mm256_set1_epi32(k);
+                    __m256i t4 = _mm256_xor_si256(
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t2), t2),
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t3), t3));
+                    __m256i t5 = _mm256_permutevar8x32_epi32(t1, _mm256_xor_si256(t0, t2));
+                    __m256i t6 = _mm256_min_epi32(t1, t5);
+                    __m256i t7 = _mm256_max_epi32(t1, t5);
+                    t1 = descending ? _mm256_blendv_epi8(t7, t6, t4) : _mm256_blendv_epi8(t6, t7, t4);
+                }
+            }
+            return t1;
+        }
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, __m256i & payload, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256i t1 = a;
+            __m256i t2 = payload;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m256i t3 = _mm256_set1_epi32(j);
+                    __m256i t4 = _mm256_set1_epi32(k);
+                    __m256i t5 = _mm256_xor_si256(
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t3), t3),
+                        _mm256_cmpeq_epi32(_mm256_and_si256(t0, t4), t4));
+                    __m256i t6 = _mm256_xor_si256(t0, t3);
+                    __m256i t7 = _mm256_permutevar8x32_epi32(t1, t6);
+                    __m256i t8 = _mm256_permutevar8x32_epi32(t2, t6);
+                    // Take the partner element if it is larger (smaller)
+                    // than the element keeping the maximum (minimum).
+                    __m256i t9 = _mm256_cmpgt_epi32(t1, t7);
+                    __m256i t10 = _mm256_cmpgt_epi32(t7, t1);
+                    __m256i t11 = descending ? _mm256_blendv_epi8(t10, t9, t5) : _mm256_blendv_epi8(t9, t10, t5);
+                    t1 = _mm256_blendv_epi8(t1, t7, t11);
+                    t2 = _mm256_blendv_epi8(t2, t8, t11);
+                }
+            }
+            payload = t2;
+            return t1;
+        }
+    public:
         // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m256i t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_i(t0);
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m256i t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_i bsorta() const {
+            __m256i t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_i bsortd() const {
+            __m256i t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsorta(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsortd(SIMDVec_u<uint32_t, 8> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_i(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -708,6 +852,11 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            __m256i t0 = MulHighAVX512::mulhis32(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // DIVV
         // MDIVV
         // DIVS
@@ -716,6 +865,11 @@ namespace SIMD {
         // MDIVVA
         // DIVSA
         // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int32_t> const & divider) const {
+            __m256i t0 = DivideAVX512::divs32(mVec, divider);
+            return SIMDVec_i(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -961,9 +1115,24 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
             __m256i t0 = _mm256_conflict_epi32(mVec);
-            __mmask8 t1 = _mm256_cmpeq_epi32_mask(t0, _mm256_set1_epi32(1));
-            return (t1 == 0x00);
+            return _mm256_test_epi32_mask(t0, t0) == 0;
+#else
+            // Conflicts of the lower elements do not depend on the upper ones.
+            __m512i t0 = ConflictAVX512::conflict32(_mm512_castsi256_si512(mVec), 8);
+            return _mm512_mask_test_epi32_mask(0x00FF, t0, t0) == 0;
+#endif
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_i conflict() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+            __m256i t0 = _mm256_conflict_epi32(mVec);
+#else
+            __m512i t1 = ConflictAVX512::conflict32(_mm512_castsi256_si512(mVec), 8);
+            __m256i t0 = _mm512_castsi512_si256(t1);
+#endif
+            return SIMDVec_i(t0);
         }
         // HADD
         UME_FORCE_INLINE int32_t hadd() const {
@@ -1701,6 +1870,26 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_i popcnt() const {
+            __m256i t0 = BitCountAVX512::popcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_i lzcnt() const {
+            __m256i t0 = BitCountAVX512::lzcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_i tzcnt() const {
+            __m256i t0 = BitCountAVX512::tzcnt32(mVec);
+            return SIMDVec_i(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_i bitrev() const {
+            __m256i t0 = BitCountAVX512::bitrev32(mVec);
+            return SIMDVec_i(t0);
+        }
         // HBAND
         UME_FORCE_INLINE int32_t hband() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_4)
@@ -2349,6 +2538,7 @@ namespace SIMD {
 
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int64_t, 16> :
@@ -178,8 +179,20 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+            _mm_prefetch((const char *)(p + 8), _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+            _mm_prefetch((const char *)(p + 8), _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+            _mm_prefetch((const char *)(p + 8), _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const *p) {
@@ -229,6 +242,16 @@ namespace SIMD {
             _mm512_mask_store_epi64(p + 8, ((mask.mMask & 0xFF00) >> 8), mVec[1]);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int64_t* sstore(int64_t* p) const {
+            _mm512_stream_si512((__m512i *)p, mVec[0]);
+            _mm512_stream_si512((__m512i *)(p + 8), mVec[1]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int64_t* sstore(SIMDVecMask<16> const & mask, int64_t* p) const {
+            return storea(mask, p);
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
@@ -2343,8 +2366,8 @@ namespace SIMD {
             mVec[0] = _mm512_i64gather_epi64(t3, (const long long int*)baseAddr, 8);
             mVec[1] = _mm512_i64gather_epi64(t4, (const long long int*)baseAddr, 8);
 #else
-            mVec[0] = _mm512_i64gather_epi64(t3, (int64_t const*)baseAddr, 8);
-            mVec[1] = _mm512_i64gather_epi64(t4, (int64_t const*)baseAddr, 8);
+            mVec[0] = _mm512_i64gather_epi64(t3, (long long const*)baseAddr, 8);
+            mVec[1] = _mm512_i64gather_epi64(t4, (long long const*)baseAddr, 8);
 #endif
             return *this;
         }
@@ -2367,8 +2390,8 @@ namespace SIMD {
             mVec[0] = _mm512_mask_i64gather_epi64(mVec[0], m0, t3, (const long long int*)baseAddr, 8);
             mVec[1] = _mm512_mask_i64gather_epi64(mVec[1], m1, t4, (const long long int*)baseAddr, 8);
 #else
-            mVec[0] = _mm512_mask_i64gather_epi64(mVec[0], m0, t3, (int64_t const*)baseAddr, 8);
-            mVec[1] = _mm512_mask_i64gather_epi64(mVec[1], m1, t4, (int64_t const*)baseAddr, 8);
+            mVec[0] = _mm512_mask_i64gather_epi64(mVec[0], m0, t3, (long long const*)baseAddr, 8);
+            mVec[1] = _mm512_mask_i64gather_epi64(mVec[1], m1, t4, (long long const*)baseAddr, 8);
 #endif
             return *this;
         }
@@ -2381,8 +2404,8 @@ namespace SIMD {
             mVec[0] = _mm512_i64gather_epi64(t0, (const long long int*)baseAddr, 8);
             mVec[1] = _mm512_i64gather_epi64(t1, (const long long int*)baseAddr, 8);
 #else
-            mVec[0] = _mm512_i64gather_epi64(t0, (int64_t const*)baseAddr, 8);
-            mVec[1] = _mm512_i64gather_epi64(t1, (int64_t const*)baseAddr, 8);
+            mVec[0] = _mm512_i64gather_epi64(t0, (long long const*)baseAddr, 8);
+            mVec[1] = _mm512_i64gather_epi64(t1, (long long const*)baseAddr, 8);
 #endif
             return *this;
         }
@@ -2395,8 +2418,8 @@ namespace SIMD {
             __m512i t2 = _mm512_i64gather_epi64(t0, (const long long int*)baseAddr, 8);
             __m512i t3 = _mm512_i64gather_epi64(t1, (const long long int*)baseAddr, 8);
 #else
-            __m512i t2 = _mm512_i64gather_epi64(t0, (int64_t const*)baseAddr, 8);
-            __m512i t3 = _mm512_i64gather_epi64(t1, (int64_t const*)baseAddr, 8);
+            __m512i t2 = _mm512_i64gather_epi64(t0, (long long const*)baseAddr, 8);
+            __m512i t3 = _mm512_i64gather_epi64(t1, (long long const*)baseAddr, 8);
 #endif
             mVec[0] = _mm512_mask_mov_epi64(mVec[0], mask.mMask & 0xFF, t2);
             mVec[1] = _mm512_mask_mov_epi64(mVec[1], ((mask.mMask & 0xFF00) >> 8), t3);
@@ -2409,8 +2432,8 @@ namespace SIMD {
             mVec[0] = _mm512_i64gather_epi64(indices.mVec[0], (const long long int*)baseAddr, 8);
             mVec[1] = _mm512_i64gather_epi64(indices.mVec[1], (const long long int*)baseAddr, 8);
 #else
-            mVec[0] = _mm512_i64gather_epi64(indices.mVec[0], (int64_t const*)baseAddr, 8);
-            mVec[1] = _mm512_i64gather_epi64(indices.mVec[1], (int64_t const*)baseAddr, 8);
+            mVec[0] = _mm512_i64gather_epi64(indices.mVec[0], (long long const*)baseAddr, 8);
+            mVec[1] = _mm512_i64gather_epi64(indices.mVec[1], (long long const*)baseAddr, 8);
 #endif
             return *this;
         }
@@ -2421,8 +2444,8 @@ namespace SIMD {
             __m512i t0 = _mm512_i64gather_epi64(indices.mVec[0], (const long long int*)baseAddr, 8);
             __m512i t1 = _mm512_i64gather_epi64(indices.mVec[1], (const long long int*)baseAddr, 8);
 #else
-            __m512i t0 = _mm512_i64gather_epi64(indices.mVec[0], (int64_t const*)baseAddr, 8);
-            __m512i t1 = _mm512_i64gather_epi64(indices.mVec[1], (int64_t const*)baseAddr, 8);
+            __m512i t0 = _mm512_i64gather_epi64(indices.mVec[0], (long long const*)baseAddr, 8);
+            __m512i t1 = _mm512_i64gather_epi64(indices.mVec[1], (long long const*)baseAddr, 8);
 #endif
             mVec[0] = _mm512_mask_mov_epi64(mVec[0], mask.mMask & 0xFF, t0);
             mVec[1] = _mm512_mask_mov_epi64(mVec[1], ((mask.mMask & 0xFF00) >> 8), t1);
@@ -2720,6 +2743,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<double, 16>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
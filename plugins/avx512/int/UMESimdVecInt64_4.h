@@ -74,6 +74,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int64_t, 4> :
@@ -206,8 +207,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const *p) {
@@ -219,11 +229,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_loadu_epi64(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            __m512i t1 = _mm512_mask_loadu_epi64(t0, mask.mMask, p);
+            mVec = _mm512_castsi512_si256(t1);
 #endif
             return *this;
         }
@@ -237,11 +245,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_load_epi64(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            __m512i t1 = _mm512_mask_loadu_epi64(t0, mask.mMask, p);
+            mVec = _mm512_castsi512_si256(t1);
 #endif
             return *this;
         }
@@ -255,12 +261,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_storeu_epi64(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_storeu_si256((__m256i*)p, t4);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            _mm512_mask_storeu_epi64(p, mask.mMask, t0);
 #endif
             return p;
         }
@@ -274,15 +276,49 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_store_epi64(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_store_si256((__m256i*)p, t4);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            _mm512_mask_storeu_epi64(p, mask.mMask, t0);
 #endif
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int64_t* sstore(int64_t* p) const {
+            _mm256_stream_si256((__m256i *)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int64_t* sstore(SIMDVecMask<4> const & mask, int64_t* p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<4> const & mask) const {
+#if defined(__AVX512VL__)
+            __m256i t0 = _mm256_maskz_compress_epi64(mask.mMask, mVec);
+#else
+            __m512i t1 = _mm512_maskz_compress_epi64(mask.mMask, _mm512_castsi256_si512(mVec));
+            __m256i t0 = _mm512_castsi512_si256(t1);
+#endif
+            return SIMDVec_i(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, int64_t * p) const {
+#if defined(__AVX512VL__)
+            _mm256_mask_compressstoreu_epi64(p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_epi64(p, mask.mMask, _mm512_castsi256_si512(mVec));
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<4> const & mask, int64_t const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm256_mask_expandloadu_epi64(mVec, mask.mMask, p);
+#else
+            __m512i t0 = _mm512_mask_expandloadu_epi64(_mm512_castsi256_si512(mVec), mask.mMask, p);
+            mVec = _mm512_castsi512_si256(t0);
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
@@ -313,8 +349,105 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_permute4x64_epi64(a, 0xB1);
+            __m256i t1 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256i t2 = _mm256_cmpgt_epi64(a, t0);
+            __m256i t3 = _mm256_xor_si256(t2, t1);
+            __m256i t4 = descending ? _mm256_blendv_epi8(t0, a, t3) : _mm256_blendv_epi8(a, t0, t3);
+            __m256i t5 = bitonic ? a : t4;
+            __m256i t6 = bitonic ? a : t5;
+            __m256i t7 = _mm256_permute4x64_epi64(t6, 0x4E);
+            __m256i t8 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256i t9 = _mm256_cmpgt_epi64(t6, t7);
+            __m256i t10 = _mm256_xor_si256(t9, t8);
+            __m256i t11 = descending ? _mm256_blendv_epi8(t7, t6, t10) : _mm256_blendv_epi8(t6, t7, t10);
+            __m256i t12 = _mm256_permute4x64_epi64(t11, 0xB1);
+            __m256i t13 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256i t14 = _mm256_cmpgt_epi64(t11, t12);
+            __m256i t15 = _mm256_xor_si256(t14, t13);
+            __m256i t16 = descending ? _mm256_blendv_epi8(t12, t11, t15) : _mm256_blendv_epi8(t11, t12, t15);
+            return t16;
+        }
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, __m256i & payload, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_permute4x64_epi64(a, 0xB1);
+            __m256i t1 = _mm256_permute4x64_epi64(payload, 0xB1);
+            __m256i t2 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256i t3 = _mm256_cmpgt_epi64(a, t0);
+            __m256i t4 = _mm256_cmpgt_epi64(t0, a);
+            __m256i t5 = descending ? _mm256_blendv_epi8(t4, t3, t2) : _mm256_blendv_epi8(t3, t4, t2);
+            __m256i t6 = _mm256_blendv_epi8(a, t0, t5);
+            __m256i t7 = _mm256_blendv_epi8(payload, t1, t5);
+            __m256i t8 = bitonic ? a : t6;
+            __m256i t9 = bitonic ? payload : t7;
+            __m256i t10 = _mm256_permute4x64_epi64(t8, 0x4E);
+            __m256i t11 = _mm256_permute4x64_epi64(t9, 0x4E);
+            __m256i t12 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256i t13 = _mm256_cmpgt_epi64(t8, t10);
+            __m256i t14 = _mm256_cmpgt_epi64(t10, t8);
+            __m256i t15 = descending ? _mm256_blendv_epi8(t14, t13, t12) : _mm256_blendv_epi8(t13, t14, t12);
+            __m256i t16 = _mm256_blendv_epi8(t8, t10, t15);
+            __m256i t17 = _mm256_blendv_epi8(t9, t11, t15);
+            __m256i t18 = _mm256_permute4x64_epi64(t16, 0xB1);
+            __m256i t19 = _mm256_permute4x64_epi64(t17, 0xB1);
+            __m256i t20 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256i t21 = _mm256_cmpgt_epi64(t16, t18);
+            __m256i t22 = _mm256_cmpgt_epi64(t18, t16);
+            __m256i t23 = descending ? _mm256_blendv_epi8(t22, t21, t20) : _mm256_blendv_epi8(t21, t22, t20);
+            __m256i t24 = _mm256_blendv_epi8(t16, t18, t23);
+            __m256i t25 = _mm256_blendv_epi8(t17, t19, t23);
+            payload = t25;
+            return t24;
+        }
+    public:
         // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m256i t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_i(t0);
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m256i t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_i bsorta() const {
+            __m256i t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_i bsortd() const {
+            __m256i t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsorta(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsortd(SIMDVec_u<uint64_t, 4> & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_i(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -797,6 +930,11 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            __m256i t0 = MulHighAVX512::mulhis64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // DIVV
         /*UME_FORCE_INLINE SIMDVec_i div(SIMDVec_i const & b) const {
             int64_t t0 = mVec[0] / b.mVec[0];
@@ -857,6 +995,11 @@ namespace SIMD {
             mVec[1] = mask.mMask[1] ? mVec[1] / b : mVec[1];
             return *this;
         }*/
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int64_t> const & divider) const {
+            __m256i t0 = DivideAVX512::divs64(mVec, divider);
+            return SIMDVec_i(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1080,6 +1223,26 @@ namespace SIMD {
             return m0 == 0x03;
         }
         // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+            __m256i t0 = _mm256_conflict_epi64(mVec);
+            return _mm256_test_epi64_mask(t0, t0) == 0;
+#else
+            // Conflicts of the lower elements do not depend on the upper ones.
+            __m512i t0 = ConflictAVX512::conflict64(_mm512_castsi256_si512(mVec), 4);
+            return _mm512_mask_test_epi64_mask(0x0F, t0, t0) == 0;
+#endif
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_i conflict() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+            __m256i t0 = _mm256_conflict_epi64(mVec);
+#else
+            __m512i t1 = ConflictAVX512::conflict64(_mm512_castsi256_si512(mVec), 4);
+            __m256i t0 = _mm512_castsi512_si256(t1);
+#endif
+            return SIMDVec_i(t0);
+        }
         // HADD
         UME_FORCE_INLINE int64_t hadd() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_4)
@@ -1710,6 +1873,26 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_i popcnt() const {
+            __m256i t0 = BitCountAVX512::popcnt64(mVec);
+            return SIMDVec_i(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_i lzcnt() const {
+            __m256i t0 = BitCountAVX512::lzcnt64(mVec);
+            return SIMDVec_i(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_i tzcnt() const {
+            __m256i t0 = BitCountAVX512::tzcnt64(mVec);
+            return SIMDVec_i(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_i bitrev() const {
+            __m256i t0 = BitCountAVX512::bitrev64(mVec);
+            return SIMDVec_i(t0);
+        }
         // HBAND
         UME_FORCE_INLINE int64_t hband() const {
             alignas(32) int64_t raw[4];
@@ -1820,7 +2003,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm256_i64gather_epi64((const long long int*)baseAddr, t2, 8);
 #else
-            mVec = _mm256_i64gather_epi64((int64_t const*)baseAddr, t2, 8);
+            mVec = _mm256_i64gather_epi64((long long const*)baseAddr, t2, 8);
 #endif
             return *this;
         }
@@ -1837,7 +2020,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m256i t3 = _mm256_i64gather_epi64((const long long int*)baseAddr, t2, 8);
 #else
-            __m256i t3 = _mm256_i64gather_epi64((int64_t const*)baseAddr, t2, 8);
+            __m256i t3 = _mm256_i64gather_epi64((long long const*)baseAddr, t2, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_mov_epi64(mVec, mask.mMask, t3);
@@ -1857,7 +2040,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm256_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            mVec = _mm256_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            mVec = _mm256_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
             return *this;
         }
@@ -1868,7 +2051,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m256i t1 = _mm256_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            __m256i t1 = _mm256_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            __m256i t1 = _mm256_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_mov_epi64(mVec, mask.mMask, t1);
@@ -1887,7 +2070,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm256_i64gather_epi64((const long long int*)baseAddr, indices.mVec, 8);
 #else
-            mVec = _mm256_i64gather_epi64((int64_t const*)baseAddr, indices.mVec, 8);
+            mVec = _mm256_i64gather_epi64((long long const*)baseAddr, indices.mVec, 8);
 #endif
             return *this;
         }
@@ -1897,7 +2080,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m256i t0 = _mm256_i64gather_epi64((const long long int*)baseAddr, indices.mVec, 8);
 #else
-            __m256i t0 = _mm256_i64gather_epi64((int64_t const*)baseAddr, indices.mVec, 8);
+            __m256i t0 = _mm256_i64gather_epi64((long long const*)baseAddr, indices.mVec, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_mov_epi64(mVec, mask.mMask, t0);
@@ -2322,6 +2505,7 @@ namespace SIMD {
 #undef EXPAND_CALL_BINARY_MASK
 #undef EXPAND_CALL_BINARY_SCALAR_MASK
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
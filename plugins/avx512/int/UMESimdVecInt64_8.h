@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int64_t, 8> :
@@ -158,8 +159,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_i & load(int64_t const *p) {
@@ -201,6 +211,30 @@ namespace SIMD {
             _mm512_mask_store_epi64(p, mask.mMask, mVec);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE int64_t* sstore(int64_t* p) const {
+            _mm512_stream_si512((__m512i *)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int64_t* sstore(SIMDVecMask<8> const & mask, int64_t* p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_i compress(SIMDVecMask<8> const & mask) const {
+            __m512i t0 = _mm512_maskz_compress_epi64(mask.mMask, mVec);
+            return SIMDVec_i(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<8> const & mask, int64_t * p) const {
+            _mm512_mask_compressstoreu_epi64(p, mask.mMask, mVec);
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<8> const & mask, int64_t const * p) {
+            mVec = _mm512_mask_expandloadu_epi64(mVec, mask.mMask, p);
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
@@ -214,6 +248,102 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // PERMUTEV
+        UME_FORCE_INLINE SIMDVec_i permute(SIMDVec_u<uint64_t, 8> const & indices) const {
+            __m512i t0 = _mm512_permutexvar_epi64(indices.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
+        // PERMUTE2V
+        UME_FORCE_INLINE SIMDVec_i permute2(SIMDVec_i const & b, SIMDVec_u<uint64_t, 8> const & indices) const {
+            __m512i t0 = _mm512_permutex2var_epi64(mVec, indices.mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m512i sortNetwork(__m512i const & a, bool descending, bool bitonic) {
+            __m512i t0 = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+            __mmask8 m0 = descending ? 0xFF : 0;
+            __m512i t1 = a;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m512i t2 = _mm512_set1_epi64(j);
+                    __mmask8 m1 = _mm512_test_epi64_mask(t0, t2) ^ _mm512_test_epi64_mask(t0, _mm512_set1_epi64(k)) ^ m0;
+                    __m512i t3 = _mm512_permutexvar_epi64(_mm512_xor_si512(t0, t2), t1);
+                    t1 = _mm512_mask_blend_epi64(m1, _mm512_min_epi64(t1, t3), _mm512_max_epi64(t1, t3));
+                }
+            }
+            return t1;
+        }
+        UME_FORCE_INLINE static __m512i sortNetwork(__m512i const & a, __m512i & payload, bool descending, bool bitonic) {
+            __m512i t0 = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+            __mmask8 m0 = descending ? 0xFF : 0;
+            __m512i t1 = a;
+            __m512i t2 = payload;
+            for (int k = bitonic ? 8 : 2; k <= 8; k <<= 1) {
+                for (int j = k >> 1; j > 0; j >>= 1) {
+                    __m512i t3 = _mm512_set1_epi64(j);
+                    __mmask8 m1 = _mm512_test_epi64_mask(t0, t3) ^ _mm512_test_epi64_mask(t0, _mm512_set1_epi64(k)) ^ m0;
+                    __m512i t4 = _mm512_xor_si512(t0, t3);
+                    __m512i t5 = _mm512_permutexvar_epi64(t4, t1);
+                    __m512i t6 = _mm512_permutexvar_epi64(t4, t2);
+                    // Take the partner element if it is larger (smaller)
+                    // than the element keeping the maximum (minimum).
+                    __mmask8 m2 = _mm512_mask_cmpgt_epi64_mask(m1, t5, t1) | _mm512_mask_cmpgt_epi64_mask(~m1, t1, t5);
+                    t1 = _mm512_mask_blend_epi64(m2, t1, t5);
+                    t2 = _mm512_mask_blend_epi64(m2, t2, t6);
+                }
+            }
+            payload = t2;
+            return t1;
+        }
+    public:
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m512i t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m512i t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i sorta(SIMDVec_u<uint64_t, 8> & payload) const {
+            __m512i t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_i(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i sortd(SIMDVec_u<uint64_t, 8> & payload) const {
+            __m512i t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_i bsorta() const {
+            __m512i t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_i bsortd() const {
+            __m512i t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsorta(SIMDVec_u<uint64_t, 8> & payload) const {
+            __m512i t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_i(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_i bsortd(SIMDVec_u<uint64_t, 8> & payload) const {
+            __m512i t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_i(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -788,6 +918,11 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            __m512i t0 = MulHighAVX512::mulhis64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // DIVV
         /*UME_FORCE_INLINE SIMDVec_i div(SIMDVec_i const & b) const {
             int64_t t0 = mVec[0] / b.mVec[0];
@@ -848,6 +983,11 @@ namespace SIMD {
             mVec[1] = mask.mMask[1] ? mVec[1] / b : mVec[1];
             return *this;
         }*/
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int64_t> const & divider) const {
+            __m512i t0 = DivideAVX512::divs64(mVec, divider);
+            return SIMDVec_i(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -987,6 +1127,15 @@ namespace SIMD {
             return m0 == 0x03;
         }
         // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            __m512i t0 = ConflictAVX512::conflict64(mVec, 8);
+            return _mm512_test_epi64_mask(t0, t0) == 0;
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_i conflict() const {
+            __m512i t0 = ConflictAVX512::conflict64(mVec, 8);
+            return SIMDVec_i(t0);
+        }
         // HADD
         UME_FORCE_INLINE int64_t hadd() const {
 #if defined(WA_GCC_INTR_SUPPORT_6_4)
@@ -1505,6 +1654,26 @@ namespace SIMD {
             mVec = _mm512_mask_xor_epi64(mVec, mask.mMask, mVec, t0);
             return *this;
         }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_i popcnt() const {
+            __m512i t0 = BitCountAVX512::popcnt64(mVec);
+            return SIMDVec_i(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_i lzcnt() const {
+            __m512i t0 = BitCountAVX512::lzcnt64(mVec);
+            return SIMDVec_i(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_i tzcnt() const {
+            __m512i t0 = BitCountAVX512::tzcnt64(mVec);
+            return SIMDVec_i(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_i bitrev() const {
+            __m512i t0 = BitCountAVX512::bitrev64(mVec);
+            return SIMDVec_i(t0);
+        }
 
         //HBAND
         UME_FORCE_INLINE int64_t hband() const {
@@ -1684,7 +1853,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm512_i64gather_epi64(t2, (const long long int*)baseAddr, 8);
 #else
-            mVec = _mm512_i64gather_epi64(t2, (int64_t const*)baseAddr, 8);
+            mVec = _mm512_i64gather_epi64(t2, (long long const*)baseAddr, 8);
 #endif
             return *this;
         }
@@ -1701,7 +1870,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m512i t3 = _mm512_i64gather_epi64(t2, (const long long int*)baseAddr, 8);
 #else
-            __m512i t3 = _mm512_i64gather_epi64(t2, (int64_t const*)baseAddr, 8);
+            __m512i t3 = _mm512_i64gather_epi64(t2, (long long const*)baseAddr, 8);
 #endif
             mVec = _mm512_mask_mov_epi64(mVec, mask.mMask, t3);
             return *this;
@@ -1713,7 +1882,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm512_i64gather_epi64(t0, (const long long int*)baseAddr, 8);
 #else
-            mVec = _mm512_i64gather_epi64(t0, (int64_t const*)baseAddr, 8);
+            mVec = _mm512_i64gather_epi64(t0, (long long const*)baseAddr, 8);
 #endif
             return *this;
         }
@@ -1724,7 +1893,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m512i t1 = _mm512_i64gather_epi64(t0, (const long long int*)baseAddr, 8);
 #else
-            __m512i t1 = _mm512_i64gather_epi64(t0, (int64_t const*)baseAddr, 8);
+            __m512i t1 = _mm512_i64gather_epi64(t0, (long long const*)baseAddr, 8);
 #endif
             mVec = _mm512_mask_mov_epi64(mVec, mask.mMask, t1);
             return *this;
@@ -1735,7 +1904,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm512_i64gather_epi64(indices.mVec, (const long long int*)baseAddr, 8);
 #else
-            mVec = _mm512_i64gather_epi64(indices.mVec, (int64_t const*)baseAddr, 8);
+            mVec = _mm512_i64gather_epi64(indices.mVec, (long long const*)baseAddr, 8);
 #endif
             return *this;
         }
@@ -1745,11 +1914,21 @@ namespace SIMD {
             // g++ has some interface issues.
             __m512i t0 = _mm512_i64gather_epi64(indices.mVec, (const long long int*)baseAddr, 8);
 #else
-            __m512i t0 = _mm512_i64gather_epi64(indices.mVec, (int64_t const*)baseAddr, 8);
+            __m512i t0 = _mm512_i64gather_epi64(indices.mVec, (long long const*)baseAddr, 8);
 #endif
             mVec = _mm512_mask_mov_epi64(mVec, mask.mMask, t0);
             return *this;
         }
+#if defined(__AVX512PF__)
+        // PREFETCHGATHER0
+        static UME_FORCE_INLINE void prefetchgather0(int64_t const * baseAddr, SIMDVec_u<uint64_t, 8> const & indices) {
+            _mm512_prefetch_i64gather_pd(indices.mVec, baseAddr, 8, _MM_HINT_T0);
+        }
+        // PREFETCHGATHER1
+        static UME_FORCE_INLINE void prefetchgather1(int64_t const * baseAddr, SIMDVec_u<uint64_t, 8> const & indices) {
+            _mm512_prefetch_i64gather_pd(indices.mVec, baseAddr, 8, _MM_HINT_T1);
+        }
+#endif
         // SCATTERU
         UME_FORCE_INLINE int64_t* scatteru(int64_t* baseAddr, uint64_t stride) const {
 #if defined (__AVX512DQ__)
@@ -2027,6 +2206,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<double, 8>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -0,0 +1,1071 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_INT8_64_H_
+#define UME_SIMD_VEC_INT8_64_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    template<>
+    class SIMDVec_i<int8_t, 64> :
+        public SIMDVecSignedInterface<
+            SIMDVec_i<int8_t, 64>,
+            SIMDVec_u<uint8_t, 64>,
+            int8_t,
+            64,
+            uint8_t,
+            SIMDVecMask<64>,
+            SIMDSwizzle<64>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_i<int8_t, 64>,
+            SIMDVec_i<int8_t, 32>>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_u<uint8_t, 64>;
+        friend class SIMDVec_i<int16_t, 64>;
+    private:
+        __m512i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_i(__m512i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_i(const __m512i & x) { mVec = x; }
+    public:
+
+        constexpr static uint32_t length() { return 64; }
+        constexpr static uint32_t alignment() { return 64; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_i() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int8_t i) {
+            mVec = _mm512_set1_epi8(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_i(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, int8_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_i(static_cast<int8_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_i(int8_t const *p) { load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(
+            int8_t i0, int8_t i1, int8_t i2, int8_t i3,
+            int8_t i4, int8_t i5, int8_t i6, int8_t i7,
+            int8_t i8, int8_t i9, int8_t i10, int8_t i11,
+            int8_t i12, int8_t i13, int8_t i14, int8_t i15,
+            int8_t i16, int8_t i17, int8_t i18, int8_t i19,
+            int8_t i20, int8_t i21, int8_t i22, int8_t i23,
+            int8_t i24, int8_t i25, int8_t i26, int8_t i27,
+            int8_t i28, int8_t i29, int8_t i30, int8_t i31,
+            int8_t i32, int8_t i33, int8_t i34, int8_t i35,
+            int8_t i36, int8_t i37, int8_t i38, int8_t i39,
+            int8_t i40, int8_t i41, int8_t i42, int8_t i43,
+            int8_t i44, int8_t i45, int8_t i46, int8_t i47,
+            int8_t i48, int8_t i49, int8_t i50, int8_t i51,
+            int8_t i52, int8_t i53, int8_t i54, int8_t i55,
+            int8_t i56, int8_t i57, int8_t i58, int8_t i59,
+            int8_t i60, int8_t i61, int8_t i62, int8_t i63)
+        {
+            alignas(64) int8_t raw[64] = {
+                i0, i1, i2, i3, i4, i5, i6, i7,
+                i8, i9, i10, i11, i12, i13, i14, i15,
+                i16, i17, i18, i19, i20, i21, i22, i23,
+                i24, i25, i26, i27, i28, i29, i30, i31,
+                i32, i33, i34, i35, i36, i37, i38, i39,
+                i40, i41, i42, i43, i44, i45, i46, i47,
+                i48, i49, i50, i51, i52, i53, i54, i55,
+                i56, i57, i58, i59, i60, i61, i62, i63 };
+            mVec = _mm512_load_si512((__m512i*)raw);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE int8_t extract(uint32_t index) const {
+            alignas(64) int8_t raw[64];
+            _mm512_store_si512((__m512i*)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE int8_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_i & insert(uint32_t index, int8_t value) {
+            __mmask64 t0 = __mmask64(1ULL << index);
+            mVec = _mm512_mask_set1_epi8(mVec, t0, value);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_i, int8_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_i, int8_t>(index, static_cast<SIMDVec_i &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<64>> operator() (SIMDVecMask<64> const & mask) {
+            return IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<64>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<64>> operator[] (SIMDVecMask<64> const & mask) {
+            return IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<64>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVec_i const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (SIMDVec_i const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, b.mVec);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(int8_t b) {
+            mVec = _mm512_set1_epi8(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (int8_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<64> const & mask, int8_t b) {
+            mVec = _mm512_mask_set1_epi8(mVec, mask.mMask, b);
+            return *this;
+        }
+
+        // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(int8_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
+        // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(int8_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
+        // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(int8_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_i & load(int8_t const * p) {
+            mVec = _mm512_loadu_si512((__m512i*)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<64> const & mask, int8_t const * p) {
+            mVec = _mm512_mask_loadu_epi8(mVec, mask.mMask, p);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(int8_t const * p) {
+            mVec = _mm512_load_si512((__m512i*)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<64> const & mask, int8_t const * p) {
+            mVec = _mm512_mask_loadu_epi8(mVec, mask.mMask, p);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE int8_t * store(int8_t * p) const {
+            _mm512_storeu_si512((__m512i*)p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE int8_t * store(SIMDVecMask<64> const & mask, int8_t * p) const {
+            _mm512_mask_storeu_epi8(p, mask.mMask, mVec);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE int8_t * storea(int8_t * p) const {
+            _mm512_store_si512((__m512i*)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE int8_t * storea(SIMDVecMask<64> const & mask, int8_t * p) const {
+            _mm512_mask_storeu_epi8(p, mask.mMask, mVec);
+            return p;
+        }
+        // SSTORE
+        UME_FORCE_INLINE int8_t * sstore(int8_t * p) const {
+            _mm512_stream_si512((__m512i*)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int8_t * sstore(SIMDVecMask<64> const & mask, int8_t * p) const {
+            return storea(mask, p);
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_blend_epi8(mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_mask_set1_epi8(mVec, mask.mMask, b);
+            return SIMDVec_i(t0);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_add_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SIMDVec_i const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_add_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_i add(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_add_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (int8_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_add_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVec_i const & b) {
+            mVec = _mm512_add_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SIMDVec_i const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_add_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_add_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (int8_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_add_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_adds_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_adds_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_adds_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_adds_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = _mm512_adds_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_adds_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_adds_epi8(mVec, t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_adds_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // POSTINC
+        // MPOSTINC
+        // PREFINC
+        // MPREFINC
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_sub_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SIMDVec_i const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_sub_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_i sub(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_sub_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (int8_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_sub_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVec_i const & b) {
+            mVec = _mm512_sub_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SIMDVec_i const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_sub_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_sub_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (int8_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_sub_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_subs_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_subs_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_subs_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_subs_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = _mm512_subs_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_subs_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_subs_epi8(mVec, t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_subs_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // SUBFROMV
+        // MSUBFROMV
+        // SUBFROMS
+        // MSUBFROMS
+        // SUBFROMVA
+        // MSUBFROMVA
+        // SUBFROMSA
+        // MSUBFROMSA
+        // POSTDEC
+        // MPOSTDEC
+        // PREFDEC
+        // MPREFDEC
+        // MULV
+        // MMULV
+        // MULS
+        // MMULS
+        // MULVA
+        // MMULVA
+        // MULSA
+        // MMULSA
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_i mulhi(SIMDVec_i const & b) const {
+            __m512i t0 = MulHighAVX512::mulhis8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_i divide(SIMDDivider<int8_t> const & divider) const {
+            __m512i t0 = DivideAVX512::divs8(mVec, divider);
+            return SIMDVec_i(t0);
+        }
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<64> cmpeq(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmpeq_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<64> cmpeq(int8_t b) const {
+            __mmask64 t0 = _mm512_cmpeq_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator== (int8_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<64> cmpne(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmpneq_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<64> cmpne(int8_t b) const {
+            __mmask64 t0 = _mm512_cmpneq_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator!= (int8_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<64> cmpgt(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmpgt_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<64> cmpgt(int8_t b) const {
+            __mmask64 t0 = _mm512_cmpgt_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator> (int8_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<64> cmplt(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmplt_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<64> cmplt(int8_t b) const {
+            __mmask64 t0 = _mm512_cmplt_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator< (int8_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<64> cmpge(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmpge_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<64> cmpge(int8_t b) const {
+            __mmask64 t0 = _mm512_cmpge_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator>= (int8_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<64> cmple(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmple_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<64> cmple(int8_t b) const {
+            __mmask64 t0 = _mm512_cmple_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator<= (int8_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmpneq_epi8_mask(mVec, b.mVec);
+            return t0 == 0;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(int8_t b) const {
+            __mmask64 t0 = _mm512_cmpneq_epi8_mask(mVec, _mm512_set1_epi8(b));
+            return t0 == 0;
+        }
+        // UNIQUE
+        // HADD
+        // MHADD
+        // HADDS
+        // MHADDS
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+        // FMULADDV
+        // MFMULADDV
+        // FMULSUBV
+        // MFMULSUBV
+        // FADDMULV
+        // MFADDMULV
+        // FSUBMULV
+        // MFSUBMULV
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_max_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_max_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_max_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_max_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            mVec = _mm512_max_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_max_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_max_epi8(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_max_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_min_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_min_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_i min(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_min_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_min_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            mVec = _mm512_min_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_min_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_min_epi8(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_min_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // HMAX
+        // MHMAX
+        // IMAX
+        // MIMAX
+        // HMIN
+        // MHMIN
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_and_si512(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_and_si512(mVec, b.mVec));
+            return SIMDVec_i(t0);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_and_si512(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (int8_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_and_si512(mVec, t0));
+            return SIMDVec_i(t1);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec = _mm512_and_si512(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_and_si512(mVec, b.mVec));
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_and_si512(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int8_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_and_si512(mVec, t0));
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_or_si512(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_or_si512(mVec, b.mVec));
+            return SIMDVec_i(t0);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_or_si512(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (int8_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_or_si512(mVec, t0));
+            return SIMDVec_i(t1);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec = _mm512_or_si512(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_or_si512(mVec, b.mVec));
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_or_si512(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int8_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_or_si512(mVec, t0));
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_xor_si512(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_xor_si512(mVec, b.mVec));
+            return SIMDVec_i(t0);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_xor_si512(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int8_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_xor_si512(mVec, t0));
+            return SIMDVec_i(t1);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec = _mm512_xor_si512(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_xor_si512(mVec, b.mVec));
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_xor_si512(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int8_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_xor_si512(mVec, t0));
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m512i t0 = _mm512_xor_si512(mVec, _mm512_set1_epi32(0xFFFFFFFF));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_xor_si512(mVec, _mm512_set1_epi32(0xFFFFFFFF));
+            __m512i t1 = _mm512_mask_mov_epi8(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            mVec = _mm512_xor_si512(mVec, _mm512_set1_epi32(0xFFFFFFFF));
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota(SIMDVecMask<64> const & mask) {
+            __m512i t0 = _mm512_xor_si512(mVec, _mm512_set1_epi32(0xFFFFFFFF));
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t0);
+            return *this;
+        }
+        // LOOKUP16
+        UME_FORCE_INLINE SIMDVec_i lookup16(int8_t const * table) const {
+            // Saturating add moves indices above 15 to the range where pshufb
+            // returns 0, and keeps the low nibble of valid indices intact.
+            __m512i t0 = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const *)table));
+            __m512i t1 = _mm512_adds_epu8(mVec, _mm512_set1_epi8(0x70));
+            __m512i t2 = _mm512_shuffle_epi8(t0, t1);
+            return SIMDVec_i(t2);
+        }
+        // HBAND
+        // MHBAND
+        // HBANDS
+        // MHBANDS
+        // HBOR
+        // MHBOR
+        // HBORS
+        // MHBORS
+        // HBXOR
+        // MHBXOR
+        // HBXORS
+        // MHBXORS
+
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // LSHV
+        // MLSHV
+        // LSHS
+        // MLSHS
+        // LSHVA
+        // MLSHVA
+        // LSHSA
+        // MLSHSA
+        // RSHV
+        // MRSHV
+        // RSHS
+        // MRSHS
+        // RSHVA
+        // MRSHVA
+        // RSHSA
+        // MRSHSA
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_i neg() const {
+            __m512i t0 = _mm512_sub_epi8(_mm512_setzero_si512(), mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_i neg(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_mask_sub_epi8(mVec, mask.mMask, _mm512_setzero_si512(), mVec);
+            return SIMDVec_i(t0);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_i & nega() {
+            mVec = _mm512_sub_epi8(_mm512_setzero_si512(), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_i & nega(SIMDVecMask<64> const & mask) {
+            mVec = _mm512_mask_sub_epi8(mVec, mask.mMask, _mm512_setzero_si512(), mVec);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m512i t0 = _mm512_abs_epi8(mVec);
+            return SIMDVec_i(t0);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_mask_abs_epi8(mVec, mask.mMask, mVec);
+            return SIMDVec_i(t0);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            mVec = _mm512_abs_epi8(mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<64> const & mask) {
+            mVec = _mm512_mask_abs_epi8(mVec, mask.mMask, mVec);
+            return *this;
+        }
+
+        // PACK
+        // PACKLO
+        // PACKHI
+        // UNPACK
+        // UNPACKLO
+        // UNPACKHI
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_i<int16_t, 64>() const;
+        // DEGRADE
+        // -
+
+        // ITOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint8_t, 64>() const;
+        // ITOF
+        // -
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
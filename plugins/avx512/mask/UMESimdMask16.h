@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<16> :
@@ -71,6 +72,22 @@ namespace SIMD {
             if (m == true) mMask = 0xFFFF;
             else mMask = 0x0000;
         }
+        // FIRSTN
+        static UME_FORCE_INLINE SIMDVecMask firstN(uint32_t count) {
+            SIMDVecMask retval;
+            retval.mMask = (count < 16) ? __mmask16((1 << count) - 1) : __mmask16(0xFFFF);
+            return retval;
+        }
+        // TOBITMASK
+        UME_FORCE_INLINE uint64_t toBitmask() const {
+            return uint64_t(mMask);
+        }
+        // FROMBITMASK
+        static UME_FORCE_INLINE SIMDVecMask fromBitmask(uint64_t bits) {
+            SIMDVecMask retval;
+            retval.mMask = __mmask16(bits);
+            return retval;
+        }
         // LOAD-CONSTR
         UME_FORCE_INLINE explicit SIMDVecMask(bool const *p) {
             mMask = 0x0000;
@@ -453,6 +470,7 @@ namespace SIMD {
         }
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
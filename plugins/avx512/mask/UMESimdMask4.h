@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<4> :
@@ -76,6 +77,22 @@ namespace SIMD {
             else mMask = 0x00;
         }
         
+        // FIRSTN
+        static UME_FORCE_INLINE SIMDVecMask firstN(uint32_t count) {
+            SIMDVecMask retval;
+            retval.mMask = (count < 4) ? __mmask8((1 << count) - 1) : __mmask8(0xF);
+            return retval;
+        }
+        // TOBITMASK
+        UME_FORCE_INLINE uint64_t toBitmask() const {
+            return uint64_t(mMask & 0xF);
+        }
+        // FROMBITMASK
+        static UME_FORCE_INLINE SIMDVecMask fromBitmask(uint64_t bits) {
+            SIMDVecMask retval;
+            retval.mMask = __mmask8(bits & 0xF);
+            return retval;
+        }
         // LOAD-CONSTR
         UME_FORCE_INLINE explicit SIMDVecMask(bool const *p) {
             mMask = 0x0;
@@ -369,6 +386,7 @@ namespace SIMD {
             return (mMask & 0xF) == (b ? 0xF : 0);
         }
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
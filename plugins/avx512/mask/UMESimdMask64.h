@@ -0,0 +1,385 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_MASK_64_H_
+#define UME_SIMD_MASK_64_H_
+
+#include "UMESimdMaskPrototype.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    template<>
+    class SIMDVecMask<64> :
+        public SIMDMaskBaseInterface<
+           SIMDVecMask<64>,
+           uint32_t,
+           64>
+    {
+        friend class SIMDVec_u<uint8_t, 64>;
+        friend class SIMDVec_u<uint16_t, 64>;
+        friend class SIMDVec_u<uint32_t, 64>;
+        friend class SIMDVec_u<uint64_t, 64>;
+        friend class SIMDVec_i<int8_t, 64>;
+        friend class SIMDVec_i<int16_t, 64>;
+        friend class SIMDVec_i<int32_t, 64>;
+        friend class SIMDVec_i<int64_t, 64>;
+        friend class SIMDVec_f<float, 64>;
+        friend class SIMDVec_f<double, 64>;
+    private:
+        __mmask64 mMask;
+
+    public:
+        UME_FORCE_INLINE SIMDVecMask() {}
+
+        // Regardless of the mask representation, the interface should only allow initialization using 
+        // standard bool or using equivalent mask
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVecMask(bool m) {
+            if (m == true) mMask = 0xFFFFFFFFFFFFFFFFULL;
+            else mMask = 0x0;
+        }
+        // FIRSTN
+        static UME_FORCE_INLINE SIMDVecMask firstN(uint32_t count) {
+            SIMDVecMask retval;
+            retval.mMask = (count < 64) ? __mmask64((1ULL << count) - 1) : __mmask64(0xFFFFFFFFFFFFFFFFULL);
+            return retval;
+        }
+        // TOBITMASK
+        UME_FORCE_INLINE uint64_t toBitmask() const {
+            return uint64_t(mMask);
+        }
+        // FROMBITMASK
+        static UME_FORCE_INLINE SIMDVecMask fromBitmask(uint64_t bits) {
+            SIMDVecMask retval;
+            retval.mMask = __mmask64(bits);
+            return retval;
+        }
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVecMask(bool const *p) {
+            load(p);
+        }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVecMask(
+            bool m0, bool m1, bool m2, bool m3, bool m4, bool m5, bool m6, bool m7,
+            bool m8, bool m9, bool m10, bool m11, bool m12, bool m13, bool m14, bool m15,
+            bool m16, bool m17, bool m18, bool m19, bool m20, bool m21, bool m22, bool m23,
+            bool m24, bool m25, bool m26, bool m27, bool m28, bool m29, bool m30, bool m31,
+            bool m32, bool m33, bool m34, bool m35, bool m36, bool m37, bool m38, bool m39,
+            bool m40, bool m41, bool m42, bool m43, bool m44, bool m45, bool m46, bool m47,
+            bool m48, bool m49, bool m50, bool m51, bool m52, bool m53, bool m54, bool m55,
+            bool m56, bool m57, bool m58, bool m59, bool m60, bool m61, bool m62, bool m63)
+        {
+            bool const t0[64] = {
+                m0, m1, m2, m3, m4, m5, m6, m7,
+                m8, m9, m10, m11, m12, m13, m14, m15,
+                m16, m17, m18, m19, m20, m21, m22, m23,
+                m24, m25, m26, m27, m28, m29, m30, m31,
+                m32, m33, m34, m35, m36, m37, m38, m39,
+                m40, m41, m42, m43, m44, m45, m46, m47,
+                m48, m49, m50, m51, m52, m53, m54, m55,
+                m56, m57, m58, m59, m60, m61, m62, m63 };
+            load(t0);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE bool extract(uint32_t index) const {
+            bool t0 = ((mMask & (1ULL << index)) != 0);
+            return t0;
+        }
+
+        // A non-modifying element-wise access operator
+        UME_FORCE_INLINE bool operator[] (uint32_t index) const {
+            return extract(index);
+        }
+        // INSERT
+        UME_FORCE_INLINE void insert(uint32_t index, bool x) {
+            if (x == true) mMask |= 1ULL << index;
+            else mMask &= ~(1ULL << index);
+        }
+        // LOAD
+        UME_FORCE_INLINE SIMDVecMask & load(bool const * p) {
+            mMask = 0x0;
+            for (int i = 0; i < 64; i++) {
+                if (p[i] == true) mMask |= (1ULL << i);
+            }
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVecMask & loada(bool const * p) {
+            return load(p);
+        }
+        // STORE
+        UME_FORCE_INLINE bool* store(bool * p) const {
+            for (int i = 0; i < 64; i++) {
+                p[i] = ((mMask & (1ULL << i)) != 0);
+            }
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE bool* storea(bool * p) const {
+            return store(p);
+        }
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVecMask & assign(SIMDVecMask const & b) {
+            mMask = b.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator= (SIMDVecMask const & b) {
+            mMask = b.mMask;
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVecMask & assign(bool b) {
+            mMask = b ? 0xFFFFFFFFFFFFFFFFULL : 0;
+            return *this;
+        }
+        // LANDV
+        UME_FORCE_INLINE SIMDVecMask land(SIMDVecMask const & b) const {
+            __mmask64 t0 = mMask & b.mMask;
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator&& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        // LANDS
+        UME_FORCE_INLINE SIMDVecMask land(bool b) const {
+            __mmask64 t0 = mMask & (b ? 0xFFFFFFFFFFFFFFFFULL : 0x0);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator& (bool b) const {
+            return land(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator&& (bool b) const {
+            return land(b);
+        }
+        // LANDVA
+        UME_FORCE_INLINE SIMDVecMask & landa(SIMDVecMask const & b) {
+            mMask &= b.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator&= (SIMDVecMask const & b) {
+            return landa(b);
+        }
+        // LANDSA
+        UME_FORCE_INLINE SIMDVecMask & landa(bool b) {
+            mMask &= (b ? 0xFFFFFFFFFFFFFFFFULL : 0x0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator&= (bool b) {
+            return landa(b);
+        }
+        // LORV
+        UME_FORCE_INLINE SIMDVecMask lor(SIMDVecMask const & b) const {
+            __mmask64 t0 = mMask | b.mMask;
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator|| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        // LORS
+        UME_FORCE_INLINE SIMDVecMask lor(bool b) const {
+            __mmask64 t0 = mMask | (b ? 0xFFFFFFFFFFFFFFFFULL : 0x0);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator| (bool b) const {
+            return lor(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator|| (bool b) const {
+            return lor(b);
+        }
+        // LORVA
+        UME_FORCE_INLINE SIMDVecMask & lora(SIMDVecMask const & b) {
+            mMask |= b.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator|= (SIMDVecMask const & b) {
+            return lora(b);
+        }
+        // LORSA
+        UME_FORCE_INLINE SIMDVecMask & lora(bool b) {
+            mMask |= (b ? 0xFFFFFFFFFFFFFFFFULL : 0x0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator|= (bool b) {
+            return lora(b);
+        }
+        // LXORV
+        UME_FORCE_INLINE SIMDVecMask lxor(SIMDVecMask const & b) const {
+            __mmask64 t0 = mMask ^ b.mMask;
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator^ (SIMDVecMask const & b) const {
+            return lxor(b);
+        }
+        // LXORS
+        UME_FORCE_INLINE SIMDVecMask lxor(bool b) const {
+            __mmask64 t0 = mMask ^ (b ? 0xFFFFFFFFFFFFFFFFULL : 0x0);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator^ (bool b) const {
+            return lxor(b);
+        }
+        // LXORVA
+        UME_FORCE_INLINE SIMDVecMask & lxora(SIMDVecMask const & b) {
+            mMask ^= b.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator^= (SIMDVecMask const & b) {
+            return lxora(b);
+        }
+        // LXORSA
+        UME_FORCE_INLINE SIMDVecMask & lxora(bool b) {
+            mMask ^= (b ? 0xFFFFFFFFFFFFFFFFULL : 0x0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator^= (bool b) {
+            return lxora(b);
+        }
+        // LNOT
+        UME_FORCE_INLINE SIMDVecMask lnot() const {
+            __mmask64 t0 = ~mMask;
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator! () const {
+            return lnot();
+        }
+        // LNOTA
+        UME_FORCE_INLINE SIMDVecMask & lnota() {
+            mMask = ~mMask;
+            return *this;
+        }
+        // LANDNOTV
+        UME_FORCE_INLINE SIMDVecMask landnot(SIMDVecMask const & b) const {
+            __mmask64 t0 = ~mMask & b.mMask;
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        // LANDNOTS
+        UME_FORCE_INLINE SIMDVecMask landnot(bool b) const {
+            __mmask64 t0 = ~mMask & (b ? 0xFFFFFFFFFFFFFFFFULL : 0);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask cmpeq(SIMDVecMask const & b) const {
+            __mmask64 t0 = 0xFFFFFFFFFFFFFFFFULL & ~(mMask ^ b.mMask);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator== (SIMDVecMask const & b) const {
+            return cmpeq(b);
+        }        
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask cmpeq(bool b) const {
+            __mmask64 t0 = 0xFFFFFFFFFFFFFFFFULL & ~(mMask ^ (b ? 0xFFFFFFFFFFFFFFFFULL : 0));
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator== (bool b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask cmpne(SIMDVecMask const & b) const {
+            __mmask64 t0 = 0xFFFFFFFFFFFFFFFFULL & (mMask ^ b.mMask);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator!= (SIMDVecMask const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask cmpne(bool b) const {
+            __mmask64 t0 = 0xFFFFFFFFFFFFFFFFULL & (mMask ^ (b ? 0xFFFFFFFFFFFFFFFFULL : 0));
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator!= (bool b) const {
+            return cmpne(b);
+        }
+        // HLAND
+        UME_FORCE_INLINE bool hland() const {
+            return ((mMask & 0xFFFFFFFFFFFFFFFFULL) == 0xFFFFFFFFFFFFFFFFULL);
+        }
+        // HLOR
+        UME_FORCE_INLINE bool hlor() const {
+            return ((mMask & 0xFFFFFFFFFFFFFFFFULL) != 0x0);
+        }
+        // HLXOR
+        UME_FORCE_INLINE bool hlxor() const {
+            uint64_t t0 = mMask ^ (mMask >> 32);
+            uint64_t t1 = t0 ^ (t0 >> 16);
+            uint64_t t2 = t1 ^ (t1 >> 8);
+            uint64_t t3 = t2 ^ (t2 >> 4);
+            uint64_t t4 = t3 ^ (t3 >> 2);
+            uint64_t t5 = t4 ^ (t4 >> 1);
+            return (t5 & 0x1) != 0;
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVecMask const & b) const {
+            return mMask == b.mMask;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(bool b) const {
+            return mMask == (b ? 0xFFFFFFFFFFFFFFFFULL : 0);
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<8> :
@@ -74,6 +75,22 @@ namespace SIMD {
             if (m == true) mMask = 0xFF;
             else mMask = 0x00;
         }
+        // FIRSTN
+        static UME_FORCE_INLINE SIMDVecMask firstN(uint32_t count) {
+            SIMDVecMask retval;
+            retval.mMask = (count < 8) ? __mmask8((1 << count) - 1) : __mmask8(0xFF);
+            return retval;
+        }
+        // TOBITMASK
+        UME_FORCE_INLINE uint64_t toBitmask() const {
+            return uint64_t(mMask);
+        }
+        // FROMBITMASK
+        static UME_FORCE_INLINE SIMDVecMask fromBitmask(uint64_t bits) {
+            SIMDVecMask retval;
+            retval.mMask = __mmask8(bits);
+            return retval;
+        }
         // LOAD-CONSTR
         UME_FORCE_INLINE explicit SIMDVecMask(bool const *p) {
             mMask = 0x0;
@@ -396,6 +413,7 @@ namespace SIMD {
             return (mMask & 0xFF) == (b ? 0xFF : 0);
         }
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
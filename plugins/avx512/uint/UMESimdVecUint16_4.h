@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint32_t, 4> :
@@ -191,8 +192,17 @@ namespace SIMD {
             return *this;
         }
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
 #if defined(__AVX512VL__)
@@ -271,6 +281,15 @@ namespace SIMD {
 #endif
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE uint32_t * sstore(uint32_t * p) const {
+            _mm_stream_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE uint32_t * sstore(SIMDVecMask<4> const & mask, uint32_t * p) const {
+            return storea(mask, p);
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
 #if defined(__AVX512VL__)
@@ -2207,6 +2226,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<float, 4>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint32_t, 32> :
@@ -53,6 +54,7 @@ namespace SIMD {
     {
         friend class SIMDVec_i<int32_t, 32>;
         friend class SIMDVec_f<float, 32>;
+        friend class SIMDVec_u<uint16_t, 32>;
 
     private:
         __m512i mVec[2];
@@ -199,8 +201,20 @@ namespace SIMD {
             return *this;
         }
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+            _mm_prefetch((const char *)(p + 16), _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+            _mm_prefetch((const char *)(p + 16), _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint32_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+            _mm_prefetch((const char *)(p + 16), _MM_HINT_T2);
+        }
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
             mVec[0] = _mm512_loadu_si512(p);
@@ -257,6 +271,16 @@ namespace SIMD {
             _mm512_mask_store_epi32(p + 16, m1, mVec[1]);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE uint32_t * sstore(uint32_t * p) {
+            _mm512_stream_si512((__m512i*)p, mVec[0]);
+            _mm512_stream_si512((__m512i*)(p + 16), mVec[1]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE uint32_t * sstore(SIMDVecMask<32> const & mask, uint32_t * p) const {
+            return storea(mask, p);
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
             __mmask16 m0 = mask.mMask & 0x0000FFFF;
@@ -845,19 +869,34 @@ namespace SIMD {
         }
         // UNIQUE
         UME_FORCE_INLINE bool unique() const {
-            alignas(64) uint32_t raw[32];
-            _mm512_store_si512(raw, mVec[0]);
-            _mm512_store_si512(raw + 16, mVec[1]);
-
-            for (int i = 0; i < 31; i++) {
-                for (int j = i; j < 32; j++) {
-                    if (raw[i] == raw[j]) {
-                        return false;
-                    }
-                }
+            __m512i t0 = ConflictAVX512::conflict32(mVec[0], 16);
+            __m512i t1 = ConflictAVX512::conflict32(mVec[1], 16);
+            __mmask16 m0 = _mm512_test_epi32_mask(_mm512_or_si512(t0, t1), _mm512_or_si512(t0, t1));
+            // Compare the upper half with every rotation of the lower half.
+            __m512i t2 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            for (int k = 0; k < 16; k++) {
+                __m512i t3 = _mm512_add_epi32(t2, _mm512_set1_epi32(k));
+                __m512i t4 = _mm512_permutexvar_epi32(t3, mVec[0]);
+                m0 |= _mm512_cmpeq_epi32_mask(mVec[1], t4);
             }
-
-            return true;
+            return (m0 == 0);
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+            __m512i t0 = ConflictAVX512::conflict32(mVec[0], 16);
+            __m512i t1 = _mm512_slli_epi32(ConflictAVX512::conflict32(mVec[1], 16), 16);
+            // Element i of the upper half is compared with element
+            // (i + k) % 16 of the lower half and sets that bit on a match.
+            __m512i t2 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            __m512i t3 = _mm512_set1_epi32(1);
+            __m512i t4 = _mm512_set1_epi32(15);
+            for (int k = 0; k < 16; k++) {
+                __m512i t5 = _mm512_and_si512(_mm512_add_epi32(t2, _mm512_set1_epi32(k)), t4);
+                __m512i t6 = _mm512_permutexvar_epi32(t5, mVec[0]);
+                __mmask16 m0 = _mm512_cmpeq_epi32_mask(mVec[1], t6);
+                t1 = _mm512_mask_or_epi32(t1, m0, t1, _mm512_sllv_epi32(t3, t5));
+            }
+            return SIMDVec_u(t0, t1);
         }
         // HADD
         UME_FORCE_INLINE uint32_t hadd() const {
@@ -2352,6 +2391,7 @@ namespace SIMD {
 
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint64_t, 16> :
@@ -175,8 +176,20 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+            _mm_prefetch((const char *)(p + 8), _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+            _mm_prefetch((const char *)(p + 8), _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+            _mm_prefetch((const char *)(p + 8), _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint64_t const *p) {
@@ -234,6 +247,16 @@ namespace SIMD {
             _mm512_mask_store_epi64(p + 8, t1, mVec[1]);
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE uint64_t* sstore(uint64_t* p) const {
+            _mm512_stream_si512((__m512i *)p, mVec[0]);
+            _mm512_stream_si512((__m512i *) (p + 8), mVec[1]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE uint64_t* sstore(SIMDVecMask<16> const & mask, uint64_t* p) const {
+            return storea(mask, p);
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
@@ -1979,8 +2002,8 @@ namespace SIMD {
             mVec[0] = _mm512_i64gather_epi64(t3, (const long long int*)baseAddr, 8);
             mVec[1] = _mm512_i64gather_epi64(t4, (const long long int*)baseAddr, 8);
 #else
-            mVec[0] = _mm512_i64gather_epi64(t3, (int64_t const*)baseAddr, 8);
-            mVec[1] = _mm512_i64gather_epi64(t4, (int64_t const*)baseAddr, 8);
+            mVec[0] = _mm512_i64gather_epi64(t3, (long long const*)baseAddr, 8);
+            mVec[1] = _mm512_i64gather_epi64(t4, (long long const*)baseAddr, 8);
 #endif
             return *this;
         }
@@ -2003,8 +2026,8 @@ namespace SIMD {
             __m512i t5 = _mm512_i64gather_epi64(t3, (const long long int*)baseAddr, 8);
             __m512i t6 = _mm512_i64gather_epi64(t4, (const long long int*)baseAddr, 8);
 #else
-            __m512i t5 = _mm512_i64gather_epi64(t3, (int64_t const*)baseAddr, 8);
-            __m512i t6 = _mm512_i64gather_epi64(t4, (int64_t const*)baseAddr, 8);
+            __m512i t5 = _mm512_i64gather_epi64(t3, (long long const*)baseAddr, 8);
+            __m512i t6 = _mm512_i64gather_epi64(t4, (long long const*)baseAddr, 8);
 #endif
             mVec[0] = _mm512_mask_mov_epi64(mVec[0], m0, t5);
             mVec[1] = _mm512_mask_mov_epi64(mVec[1], m1, t6);
@@ -2019,8 +2042,8 @@ namespace SIMD {
             mVec[0] = _mm512_i64gather_epi64(t0, (const long long int*)baseAddr, 8);
             mVec[1] = _mm512_i64gather_epi64(t1, (const long long int*)baseAddr, 8);
 #else
-            mVec[0] = _mm512_i64gather_epi64(t0, (int64_t const*)baseAddr, 8);
-            mVec[1] = _mm512_i64gather_epi64(t1, (int64_t const*)baseAddr, 8);
+            mVec[0] = _mm512_i64gather_epi64(t0, (long long const*)baseAddr, 8);
+            mVec[1] = _mm512_i64gather_epi64(t1, (long long const*)baseAddr, 8);
 #endif
             return *this;
         }
@@ -2035,8 +2058,8 @@ namespace SIMD {
             __m512i t4 = _mm512_i64gather_epi64(t2, (const long long int*)baseAddr, 8);
             __m512i t5 = _mm512_i64gather_epi64(t3, (const long long int*)baseAddr, 8);
 #else
-            __m512i t4 = _mm512_i64gather_epi64(t2, (int64_t const*)baseAddr, 8);
-            __m512i t5 = _mm512_i64gather_epi64(t3, (int64_t const*)baseAddr, 8);
+            __m512i t4 = _mm512_i64gather_epi64(t2, (long long const*)baseAddr, 8);
+            __m512i t5 = _mm512_i64gather_epi64(t3, (long long const*)baseAddr, 8);
 #endif
             mVec[0] = _mm512_mask_mov_epi64(mVec[0], t0, t4);
             mVec[1] = _mm512_mask_mov_epi64(mVec[1], t1, t5);
@@ -2049,8 +2072,8 @@ namespace SIMD {
             mVec[0] = _mm512_i64gather_epi64(indices.mVec[0], (const long long int*)baseAddr, 8);
             mVec[1] = _mm512_i64gather_epi64(indices.mVec[1], (const long long int*)baseAddr, 8);
 #else
-            mVec[0] = _mm512_i64gather_epi64(indices.mVec[0], (int64_t const*)baseAddr, 8);
-            mVec[1] = _mm512_i64gather_epi64(indices.mVec[1], (int64_t const*)baseAddr, 8);
+            mVec[0] = _mm512_i64gather_epi64(indices.mVec[0], (long long const*)baseAddr, 8);
+            mVec[1] = _mm512_i64gather_epi64(indices.mVec[1], (long long const*)baseAddr, 8);
 #endif
             return *this;
         }
@@ -2063,8 +2086,8 @@ namespace SIMD {
             __m512i t2 = _mm512_i64gather_epi64(indices.mVec[0], (const long long int*)baseAddr, 8);
             __m512i t3 = _mm512_i64gather_epi64(indices.mVec[1], (const long long int*)baseAddr, 8);
 #else
-            __m512i t2 = _mm512_i64gather_epi64(indices.mVec[0], (int64_t const*)baseAddr, 8);
-            __m512i t3 = _mm512_i64gather_epi64(indices.mVec[1], (int64_t const*)baseAddr, 8);
+            __m512i t2 = _mm512_i64gather_epi64(indices.mVec[0], (long long const*)baseAddr, 8);
+            __m512i t3 = _mm512_i64gather_epi64(indices.mVec[1], (long long const*)baseAddr, 8);
 #endif
             mVec[0] = _mm512_mask_mov_epi64(mVec[0], t0, t2);
             mVec[1] = _mm512_mask_mov_epi64(mVec[1], t1, t3);
@@ -2350,6 +2373,7 @@ namespace SIMD {
         UME_FORCE_INLINE operator SIMDVec_f<double, 16>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
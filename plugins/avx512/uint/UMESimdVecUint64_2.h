@@ -62,6 +62,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint64_t, 2> :
@@ -197,8 +198,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint64_t const *p) {
@@ -210,11 +220,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_loadu_epi64(mVec, mask.mMask, p);
 #else
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(mVec);
-            __m512i t2 = _mm512_castsi128_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si128(t3);
+            __m512i t0 = _mm512_castsi128_si512(mVec);
+            __m512i t1 = _mm512_mask_loadu_epi64(t0, mask.mMask, p);
+            mVec = _mm512_castsi512_si128(t1);
 #endif
             return *this;
         }
@@ -228,11 +236,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm_mask_load_epi64(mVec, mask.mMask, p);
 #else
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(mVec);
-            __m512i t2 = _mm512_castsi128_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si128(t3);
+            __m512i t0 = _mm512_castsi128_si512(mVec);
+            __m512i t1 = _mm512_mask_loadu_epi64(t0, mask.mMask, p);
+            mVec = _mm512_castsi512_si128(t1);
 #endif
             return *this;
         }
@@ -246,12 +252,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_storeu_epi64(p, mask.mMask, mVec);
 #else
-            __m128i t0 = _mm_loadu_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(t0);
-            __m512i t2 = _mm512_castsi128_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            __m128i t4 = _mm512_castsi512_si128(t3);
-            _mm_storeu_si128((__m128i*)p, t4);
+            __m512i t0 = _mm512_castsi128_si512(mVec);
+            _mm512_mask_storeu_epi64(p, mask.mMask, t0);
 #endif
             return p;
         }
@@ -265,15 +267,49 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm_mask_store_epi64(p, mask.mMask, mVec);
 #else
-            __m128i t0 = _mm_load_si128((__m128i*)p);
-            __m512i t1 = _mm512_castsi128_si512(t0);
-            __m512i t2 = _mm512_castsi128_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            __m128i t4 = _mm512_castsi512_si128(t3);
-            _mm_store_si128((__m128i*)p, t4);
+            __m512i t0 = _mm512_castsi128_si512(mVec);
+            _mm512_mask_storeu_epi64(p, mask.mMask, t0);
 #endif
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE uint64_t* sstore(uint64_t* p) const {
+            _mm_stream_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE uint64_t* sstore(SIMDVecMask<2> const & mask, uint64_t* p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_u compress(SIMDVecMask<2> const & mask) const {
+#if defined(__AVX512VL__)
+            __m128i t0 = _mm_maskz_compress_epi64(mask.mMask, mVec);
+#else
+            __m512i t1 = _mm512_maskz_compress_epi64(mask.mMask, _mm512_castsi128_si512(mVec));
+            __m128i t0 = _mm512_castsi512_si128(t1);
+#endif
+            return SIMDVec_u(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<2> const & mask, uint64_t * p) const {
+#if defined(__AVX512VL__)
+            _mm_mask_compressstoreu_epi64(p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_epi64(p, mask.mMask, _mm512_castsi128_si512(mVec));
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<2> const & mask, uint64_t const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm_mask_expandloadu_epi64(mVec, mask.mMask, p);
+#else
+            __m512i t0 = _mm512_mask_expandloadu_epi64(_mm512_castsi128_si512(mVec), mask.mMask, p);
+            mVec = _mm512_castsi512_si128(t0);
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
@@ -748,6 +784,11 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_u mulhi(SIMDVec_u const & b) const {
+            __m128i t0 = MulHighAVX512::mulhiu64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // DIVV
         /*UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
             uint64_t t0 = mVec[0] / b.mVec[0];
@@ -808,6 +849,11 @@ namespace SIMD {
             mVec[1] = (mask.mMask & 0x2) ? mVec[1] / b : mVec[1];
             return *this;
         }*/
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_u divide(SIMDDivider<uint64_t> const & divider) const {
+            __m128i t0 = DivideAVX512::divu64(mVec, divider);
+            return SIMDVec_u(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1031,6 +1077,26 @@ namespace SIMD {
             return m0 == 0x03;
         }
         // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+            __m128i t0 = _mm_conflict_epi64(mVec);
+            return _mm_test_epi64_mask(t0, t0) == 0;
+#else
+            // Conflicts of the lower elements do not depend on the upper ones.
+            __m512i t0 = ConflictAVX512::conflict64(_mm512_castsi128_si512(mVec), 2);
+            return _mm512_mask_test_epi64_mask(0x03, t0, t0) == 0;
+#endif
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+            __m128i t0 = _mm_conflict_epi64(mVec);
+#else
+            __m512i t1 = ConflictAVX512::conflict64(_mm512_castsi128_si512(mVec), 2);
+            __m128i t0 = _mm512_castsi512_si128(t1);
+#endif
+            return SIMDVec_u(t0);
+        }
         // HADD
         UME_FORCE_INLINE uint64_t hadd() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_4)
@@ -1625,6 +1691,26 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_u popcnt() const {
+            __m128i t0 = BitCountAVX512::popcnt64(mVec);
+            return SIMDVec_u(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_u lzcnt() const {
+            __m128i t0 = BitCountAVX512::lzcnt64(mVec);
+            return SIMDVec_u(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_u tzcnt() const {
+            __m128i t0 = BitCountAVX512::tzcnt64(mVec);
+            return SIMDVec_u(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_u bitrev() const {
+            __m128i t0 = BitCountAVX512::bitrev64(mVec);
+            return SIMDVec_u(t0);
+        }
         // HBAND
         UME_FORCE_INLINE uint64_t hband() const {
             alignas(16) uint64_t raw[2];
@@ -1717,7 +1803,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            mVec = _mm_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            mVec = _mm_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
             return *this;
         }
@@ -1728,7 +1814,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m128i t1 = _mm_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            __m128i t1 = _mm_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            __m128i t1 = _mm_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
@@ -1748,7 +1834,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            mVec = _mm_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            mVec = _mm_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
             return *this;
         }
@@ -1759,7 +1845,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m128i t1 = _mm_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            __m128i t1 = _mm_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            __m128i t1 = _mm_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
@@ -1778,7 +1864,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm_i64gather_epi64((const long long int*)baseAddr, indices.mVec, 8);
 #else
-            mVec = _mm_i64gather_epi64((int64_t const*)baseAddr, indices.mVec, 8);
+            mVec = _mm_i64gather_epi64((long long const*)baseAddr, indices.mVec, 8);
 #endif
             return *this;
         }
@@ -1788,7 +1874,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m128i t0 = _mm_i64gather_epi64((const long long int*)baseAddr, indices.mVec, 8);
 #else
-            __m128i t0 = _mm_i64gather_epi64((int64_t const*)baseAddr, indices.mVec, 8);
+            __m128i t0 = _mm_i64gather_epi64((long long const*)baseAddr, indices.mVec, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm_mask_mov_epi64(mVec, mask.mMask, t0);
@@ -2182,6 +2268,7 @@ namespace SIMD {
 #undef EXPAND_CALL_BINARY_MASK
 #undef EXPAND_CALL_BINARY_SCALAR_MASK
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
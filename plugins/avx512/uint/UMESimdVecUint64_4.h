@@ -62,6 +62,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint64_t, 4> :
@@ -192,8 +193,17 @@ namespace SIMD {
         }
 
         // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
         // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
         // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(uint64_t const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
 
         // LOAD
         UME_FORCE_INLINE SIMDVec_u & load(uint64_t const *p) {
@@ -205,11 +215,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_loadu_epi64(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            __m512i t1 = _mm512_mask_loadu_epi64(t0, mask.mMask, p);
+            mVec = _mm512_castsi512_si256(t1);
 #endif
             return *this;
         }
@@ -223,11 +231,9 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_load_epi64(mVec, mask.mMask, p);
 #else
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_castsi256_si512(t0);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            mVec = _mm512_castsi512_si256(t3);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            __m512i t1 = _mm512_mask_loadu_epi64(t0, mask.mMask, p);
+            mVec = _mm512_castsi512_si256(t1);
 #endif
             return *this;
         }
@@ -241,12 +247,8 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_storeu_epi64(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_storeu_si256((__m256i*)p, t4);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            _mm512_mask_storeu_epi64(p, mask.mMask, t0);
 #endif
             return p;
         }
@@ -260,15 +262,49 @@ namespace SIMD {
 #if defined(__AVX512VL__)
             _mm256_mask_store_epi64(p, mask.mMask, mVec);
 #else
-            __m256i t0 = _mm256_load_si256((__m256i*)p);
-            __m512i t1 = _mm512_castsi256_si512(t0);
-            __m512i t2 = _mm512_castsi256_si512(mVec);
-            __m512i t3 = _mm512_mask_mov_epi64(t1, mask.mMask, t2);
-            __m256i t4 = _mm512_castsi512_si256(t3);
-            _mm256_store_si256((__m256i*)p, t4);
+            __m512i t0 = _mm512_castsi256_si512(mVec);
+            _mm512_mask_storeu_epi64(p, mask.mMask, t0);
 #endif
             return p;
         }
+        // SSTORE
+        UME_FORCE_INLINE uint64_t* sstore(uint64_t* p) const {
+            _mm256_stream_si256((__m256i *)p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE uint64_t* sstore(SIMDVecMask<4> const & mask, uint64_t* p) const {
+            return storea(mask, p);
+        }
+        // COMPRESS
+        UME_FORCE_INLINE SIMDVec_u compress(SIMDVecMask<4> const & mask) const {
+#if defined(__AVX512VL__)
+            __m256i t0 = _mm256_maskz_compress_epi64(mask.mMask, mVec);
+#else
+            __m512i t1 = _mm512_maskz_compress_epi64(mask.mMask, _mm512_castsi256_si512(mVec));
+            __m256i t0 = _mm512_castsi512_si256(t1);
+#endif
+            return SIMDVec_u(t0);
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressStore(SIMDVecMask<4> const & mask, uint64_t * p) const {
+#if defined(__AVX512VL__)
+            _mm256_mask_compressstoreu_epi64(p, mask.mMask, mVec);
+#else
+            _mm512_mask_compressstoreu_epi64(p, mask.mMask, _mm512_castsi256_si512(mVec));
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
+        // EXPANDLOAD
+        UME_FORCE_INLINE uint32_t expandLoad(SIMDVecMask<4> const & mask, uint64_t const * p) {
+#if defined(__AVX512VL__)
+            mVec = _mm256_mask_expandloadu_epi64(mVec, mask.mMask, p);
+#else
+            __m512i t0 = _mm512_mask_expandloadu_epi64(_mm512_castsi256_si512(mVec), mask.mMask, p);
+            mVec = _mm512_castsi512_si256(t0);
+#endif
+            return uint32_t(_mm_popcnt_u32(uint32_t(mask.mMask)));
+        }
 
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
@@ -299,8 +335,107 @@ namespace SIMD {
         // SWIZZLE
         // SWIZZLEA
 
+    private:
+        // Bitonic sorting network. In the stage comparing element i with
+        // element i ^ j inside blocks of k elements, element i keeps the
+        // larger value of the pair when bits j and k of i differ. Descending
+        // order flips that choice. A bitonic input only needs the stages of
+        // the last block (k equal to the vector length). The key-value
+        // variant moves the payload along with the keys; equal keys may come
+        // out in any order.
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_set1_epi64x(0x8000000000000000);
+            __m256i t1 = _mm256_permute4x64_epi64(a, 0xB1);
+            __m256i t2 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256i t3 = _mm256_cmpgt_epi64(_mm256_xor_si256(a, t0), _mm256_xor_si256(t1, t0));
+            __m256i t4 = _mm256_xor_si256(t3, t2);
+            __m256i t5 = descending ? _mm256_blendv_epi8(t1, a, t4) : _mm256_blendv_epi8(a, t1, t4);
+            __m256i t6 = bitonic ? a : t5;
+            __m256i t7 = bitonic ? a : t6;
+            __m256i t8 = _mm256_permute4x64_epi64(t7, 0x4E);
+            __m256i t9 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256i t10 = _mm256_cmpgt_epi64(_mm256_xor_si256(t7, t0), _mm256_xor_si256(t8, t0));
+            __m256i t11 = _mm256_xor_si256(t10, t9);
+            __m256i t12 = descending ? _mm256_blendv_epi8(t8, t7, t11) : _mm256_blendv_epi8(t7, t8, t11);
+            __m256i t13 = _mm256_permute4x64_epi64(t12, 0xB1);
+            __m256i t14 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256i t15 = _mm256_cmpgt_epi64(_mm256_xor_si256(t12, t0), _mm256_xor_si256(t13, t0));
+            __m256i t16 = _mm256_xor_si256(t15, t14);
+            __m256i t17 = descending ? _mm256_blendv_epi8(t13, t12, t16) : _mm256_blendv_epi8(t12, t13, t16);
+            return t17;
+        }
+        UME_FORCE_INLINE static __m256i sortNetwork(__m256i const & a, __m256i & payload, bool descending, bool bitonic) {
+            __m256i t0 = _mm256_set1_epi64x(0x8000000000000000);
+            __m256i t1 = _mm256_permute4x64_epi64(a, 0xB1);
+            __m256i t2 = _mm256_permute4x64_epi64(payload, 0xB1);
+            __m256i t3 = _mm256_setr_epi64x(0, -1, -1, 0);
+            __m256i t4 = _mm256_cmpgt_epi64(_mm256_xor_si256(a, t0), _mm256_xor_si256(t1, t0));
+            __m256i t5 = _mm256_cmpgt_epi64(_mm256_xor_si256(t1, t0), _mm256_xor_si256(a, t0));
+            __m256i t6 = descending ? _mm256_blendv_epi8(t5, t4, t3) : _mm256_blendv_epi8(t4, t5, t3);
+            __m256i t7 = _mm256_blendv_epi8(a, t1, t6);
+            __m256i t8 = _mm256_blendv_epi8(payload, t2, t6);
+            __m256i t9 = bitonic ? a : t7;
+            __m256i t10 = bitonic ? payload : t8;
+            __m256i t11 = _mm256_permute4x64_epi64(t9, 0x4E);
+            __m256i t12 = _mm256_permute4x64_epi64(t10, 0x4E);
+            __m256i t13 = _mm256_setr_epi64x(0, 0, -1, -1);
+            __m256i t14 = _mm256_cmpgt_epi64(_mm256_xor_si256(t9, t0), _mm256_xor_si256(t11, t0));
+            __m256i t15 = _mm256_cmpgt_epi64(_mm256_xor_si256(t11, t0), _mm256_xor_si256(t9, t0));
+            __m256i t16 = descending ? _mm256_blendv_epi8(t15, t14, t13) : _mm256_blendv_epi8(t14, t15, t13);
+            __m256i t17 = _mm256_blendv_epi8(t9, t11, t16);
+            __m256i t18 = _mm256_blendv_epi8(t10, t12, t16);
+            __m256i t19 = _mm256_permute4x64_epi64(t17, 0xB1);
+            __m256i t20 = _mm256_permute4x64_epi64(t18, 0xB1);
+            __m256i t21 = _mm256_setr_epi64x(0, -1, 0, -1);
+            __m256i t22 = _mm256_cmpgt_epi64(_mm256_xor_si256(t17, t0), _mm256_xor_si256(t19, t0));
+            __m256i t23 = _mm256_cmpgt_epi64(_mm256_xor_si256(t19, t0), _mm256_xor_si256(t17, t0));
+            __m256i t24 = descending ? _mm256_blendv_epi8(t23, t22, t21) : _mm256_blendv_epi8(t22, t23, t21);
+            __m256i t25 = _mm256_blendv_epi8(t17, t19, t24);
+            __m256i t26 = _mm256_blendv_epi8(t18, t20, t24);
+            payload = t26;
+            return t25;
+        }
+    public:
         // SORTA
+        UME_FORCE_INLINE SIMDVec_u sorta() const {
+            __m256i t0 = sortNetwork(mVec, false, false);
+            return SIMDVec_u(t0);
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_u sortd() const {
+            __m256i t0 = sortNetwork(mVec, true, false);
+            return SIMDVec_u(t0);
+        }
+        // SORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_u sorta(SIMDVec_u & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, false);
+            return SIMDVec_u(t0);
+        }
+        // SORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_u sortd(SIMDVec_u & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, false);
+            return SIMDVec_u(t0);
+        }
+        // BSORTA
+        UME_FORCE_INLINE SIMDVec_u bsorta() const {
+            __m256i t0 = sortNetwork(mVec, false, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTD
+        UME_FORCE_INLINE SIMDVec_u bsortd() const {
+            __m256i t0 = sortNetwork(mVec, true, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTA (key-value)
+        UME_FORCE_INLINE SIMDVec_u bsorta(SIMDVec_u & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, false, true);
+            return SIMDVec_u(t0);
+        }
+        // BSORTD (key-value)
+        UME_FORCE_INLINE SIMDVec_u bsortd(SIMDVec_u & payload) const {
+            __m256i t0 = sortNetwork(mVec, payload.mVec, true, true);
+            return SIMDVec_u(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
@@ -783,6 +918,11 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // MULHIV
+        UME_FORCE_INLINE SIMDVec_u mulhi(SIMDVec_u const & b) const {
+            __m256i t0 = MulHighAVX512::mulhiu64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // DIVV
         /*UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
             uint64_t t0 = mVec[0] / b.mVec[0];
@@ -843,6 +983,11 @@ namespace SIMD {
             mVec[1] = mask.mMask[1] ? mVec[1] / b : mVec[1];
             return *this;
         }*/
+        // DIVINV
+        UME_FORCE_INLINE SIMDVec_u divide(SIMDDivider<uint64_t> const & divider) const {
+            __m256i t0 = DivideAVX512::divu64(mVec, divider);
+            return SIMDVec_u(t0);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1066,6 +1211,26 @@ namespace SIMD {
             return m0 == 0x03;
         }
         // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+            __m256i t0 = _mm256_conflict_epi64(mVec);
+            return _mm256_test_epi64_mask(t0, t0) == 0;
+#else
+            // Conflicts of the lower elements do not depend on the upper ones.
+            __m512i t0 = ConflictAVX512::conflict64(_mm512_castsi256_si512(mVec), 4);
+            return _mm512_mask_test_epi64_mask(0x0F, t0, t0) == 0;
+#endif
+        }
+        // CONFLICT
+        UME_FORCE_INLINE SIMDVec_u conflict() const {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+            __m256i t0 = _mm256_conflict_epi64(mVec);
+#else
+            __m512i t1 = ConflictAVX512::conflict64(_mm512_castsi256_si512(mVec), 4);
+            __m256i t0 = _mm512_castsi512_si256(t1);
+#endif
+            return SIMDVec_u(t0);
+        }
         // HADD
         UME_FORCE_INLINE uint64_t hadd() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_4)
@@ -1696,6 +1861,26 @@ namespace SIMD {
 #endif
             return *this;
         }
+        // POPCNT
+        UME_FORCE_INLINE SIMDVec_u popcnt() const {
+            __m256i t0 = BitCountAVX512::popcnt64(mVec);
+            return SIMDVec_u(t0);
+        }
+        // LZCNT
+        UME_FORCE_INLINE SIMDVec_u lzcnt() const {
+            __m256i t0 = BitCountAVX512::lzcnt64(mVec);
+            return SIMDVec_u(t0);
+        }
+        // TZCNT
+        UME_FORCE_INLINE SIMDVec_u tzcnt() const {
+            __m256i t0 = BitCountAVX512::tzcnt64(mVec);
+            return SIMDVec_u(t0);
+        }
+        // BITREV
+        UME_FORCE_INLINE SIMDVec_u bitrev() const {
+            __m256i t0 = BitCountAVX512::bitrev64(mVec);
+            return SIMDVec_u(t0);
+        }
         // HBAND
         UME_FORCE_INLINE uint64_t hband() const {
             alignas(32) uint64_t raw[4];
@@ -1806,7 +1991,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm256_i64gather_epi64((const long long int*)baseAddr, t2, 8);
 #else
-            mVec = _mm256_i64gather_epi64((int64_t const*)baseAddr, t2, 8);
+            mVec = _mm256_i64gather_epi64((long long const*)baseAddr, t2, 8);
 #endif
             return *this;
         }
@@ -1823,7 +2008,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m256i t3 = _mm256_i64gather_epi64((const long long int*)baseAddr, t2, 8);
 #else
-            __m256i t3 = _mm256_i64gather_epi64((int64_t const*)baseAddr, t2, 8);
+            __m256i t3 = _mm256_i64gather_epi64((long long const*)baseAddr, t2, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_mov_epi64(mVec, mask.mMask, t3);
@@ -1843,7 +2028,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm256_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            mVec = _mm256_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            mVec = _mm256_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
             return *this;
         }
@@ -1854,7 +2039,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m256i t1 = _mm256_i64gather_epi64((const long long int*)baseAddr, t0, 8);
 #else
-            __m256i t1 = _mm256_i64gather_epi64((int64_t const*)baseAddr, t0, 8);
+            __m256i t1 = _mm256_i64gather_epi64((long long const*)baseAddr, t0, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_mov_epi64(mVec, mask.mMask, t1);
@@ -1873,7 +2058,7 @@ namespace SIMD {
             // g++ has some interface issues.
             mVec = _mm256_i64gather_epi64((const long long int*)baseAddr, indices.mVec, 8);
 #else
-            mVec = _mm256_i64gather_epi64((int64_t const*)baseAddr, indices.mVec, 8);
+            mVec = _mm256_i64gather_epi64((long long const*)baseAddr, indices.mVec, 8);
 #endif
             return *this;
         }
@@ -1883,7 +2068,7 @@ namespace SIMD {
             // g++ has some interface issues.
             __m256i t0 = _mm256_i64gather_epi64((const long long int*)baseAddr, indices.mVec, 8);
 #else
-            __m256i t0 = _mm256_i64gather_epi64((int64_t const*)baseAddr, indices.mVec, 8);
+            __m256i t0 = _mm256_i64gather_epi64((long long const*)baseAddr, indices.mVec, 8);
 #endif
 #if defined(__AVX512VL__)
             mVec = _mm256_mask_mov_epi64(mVec, mask.mMask, t0);
@@ -2269,6 +2454,7 @@ namespace SIMD {
 #undef EXPAND_CALL_BINARY_MASK
 #undef EXPAND_CALL_BINARY_SCALAR_MASK
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
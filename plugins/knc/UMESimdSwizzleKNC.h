@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
     // ********************************************************************************************
     // SWIZZLE MASKS
     // ********************************************************************************************
@@ -91,6 +92,7 @@ namespace SIMD {
             }
         }
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
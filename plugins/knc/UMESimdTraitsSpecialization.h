@@ -3,6 +3,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     // This class provides traits specialization required by ISATraits
     class PluginTraits {
@@ -67,6 +68,7 @@ namespace SIMD {
     UME_FORCE_INLINE constexpr unsigned int PluginTraits::NativeLength<double> () {
         return 8;
     }
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 #endif
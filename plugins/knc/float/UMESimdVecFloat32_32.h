@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<float, 32> :
@@ -540,6 +541,7 @@ namespace SIMD {
         inline operator SIMDVec_i<int32_t, 32>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<float, 8> :
@@ -621,6 +622,7 @@ namespace SIMD {
         // FTOI
         inline operator SIMDVec_i<int32_t, 8>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
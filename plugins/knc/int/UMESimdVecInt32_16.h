@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_i<int32_t, 16> :
@@ -1173,6 +1174,7 @@ namespace SIMD {
         // ITOF
         inline  operator SIMDVec_f<float, 16> () const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -35,6 +35,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVecMask<32> :
@@ -224,6 +225,7 @@ namespace SIMD {
         // HLXOR
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
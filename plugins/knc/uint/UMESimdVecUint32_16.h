@@ -38,6 +38,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_u<uint32_t, 16> :
@@ -149,6 +150,7 @@ namespace SIMD {
         // UTOF
         inline operator SIMDVec_f<float, 16>() const;
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
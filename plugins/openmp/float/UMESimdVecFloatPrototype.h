@@ -41,6 +41,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<typename SCALAR_FLOAT_TYPE, uint32_t VEC_LEN>
     struct SIMDVec_f_traits {
@@ -2365,6 +2366,7 @@ namespace SIMD {
         SIMDVec_f() {}
         ~SIMDVec_f() {}
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -40,6 +40,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
     // ********************************************************************************************
     // UNSIGNED INTEGER VECTORS
     // ********************************************************************************************
@@ -3191,6 +3192,7 @@ namespace SIMD {
         SIMDVec_u() {}
         ~SIMDVec_u() {}
     };
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
@@ -37,6 +37,7 @@
 
 namespace UME {
 namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
 
     template<>
     class SIMDVec_f<float, 1> :
@@ -1079,6 +1080,7 @@ namespace SIMD {
         UME_FUNC_ATTRIB operator SIMDVec_i<int32_t, 1>() const;
     };
 
+UME_SIMD_END_PLUGIN_NAMESPACE
 }
 }
 
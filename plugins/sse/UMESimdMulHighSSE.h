@@ -0,0 +1,67 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+#ifndef UME_SIMD_MUL_HIGH_SSE_H_
+#define UME_SIMD_MUL_HIGH_SSE_H_
+
+#include <immintrin.h>
+#include "../../UMEBasicTypes.h"
+#include "../../UMEInline.h"
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    // High halves of 32x32-bit products, taken from the even/odd
+    // 32x32->64 unsigned multiplies so that only SSE2 is required. The
+    // signed high half is corrected from the unsigned one.
+    class MulHighSSE {
+    public:
+        static UME_FORCE_INLINE __m128i mulhiu32(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_mul_epu32(a, b);
+            __m128i t1 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+            __m128i t2 = _mm_shuffle_epi32(t0, _MM_SHUFFLE(3, 1, 3, 1));
+            __m128i t3 = _mm_shuffle_epi32(t1, _MM_SHUFFLE(3, 1, 3, 1));
+            return _mm_unpacklo_epi32(t2, t3);
+        }
+        static UME_FORCE_INLINE __m128i mulhis32(__m128i const & a, __m128i const & b) {
+            __m128i t0 = mulhiu32(a, b);
+            __m128i t1 = _mm_and_si128(_mm_srai_epi32(a, 31), b);
+            __m128i t2 = _mm_and_si128(_mm_srai_epi32(b, 31), a);
+            return _mm_sub_epi32(_mm_sub_epi32(t0, t1), t2);
+        }
+    };
+
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#endif
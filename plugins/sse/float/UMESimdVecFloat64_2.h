@@ -0,0 +1,1390 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_FLOAT64_2_H_
+#define UME_SIMD_VEC_FLOAT64_2_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+// SIMDVecMask<2> is shared with the scalar 2-lane types and stores one bool
+// per lane, so it has to be expanded to a full-width selector before blending.
+#define EXPAND_MASK(mask) \
+    _mm_castsi128_pd(_mm_set_epi64x(-int64_t(mask[1]), -int64_t(mask[0])))
+
+#if defined(__SSE4_1__)
+#define BLEND(a, b, mask) _mm_blendv_pd(a, b, EXPAND_MASK(mask))
+#else
+#define BLEND(a, b, mask) \
+    _mm_or_pd( \
+        _mm_andnot_pd(EXPAND_MASK(mask), a), \
+        _mm_and_pd(EXPAND_MASK(mask), b))
+#endif
+
+namespace UME {
+namespace SIMD {
+UME_SIMD_BEGIN_PLUGIN_NAMESPACE
+
+    template<>
+    class SIMDVec_f<double, 2> :
+        public SIMDVecFloatInterface<
+            SIMDVec_f<double, 2>,
+            SIMDVec_u<uint64_t, 2>,
+            SIMDVec_i<int64_t, 2>,
+            double,
+            2,
+            uint64_t,
+            int64_t,
+            SIMDVecMask<2>,
+            SIMDSwizzle<2>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_f<double, 2>,
+            SIMDVec_f<double, 1>>
+    {
+        friend class SIMDVec_u<uint64_t, 2>;
+        friend class SIMDVec_i<int64_t, 2>;
+        friend class SIMDVec_f<float, 2>;
+
+        friend class SIMDVec_f<double, 4>;
+    private:
+        __m128d mVec;
+
+        UME_FORCE_INLINE SIMDVec_f(__m128d const & x) {
+            this->mVec = x;
+        }
+
+    public:
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_f() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_f(double f) {
+            mVec = _mm_set1_pd(f);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_f(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, double>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_f(static_cast<double>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_f(double const * p) {
+            mVec = _mm_loadu_pd(p);
+        }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_f(double f0, double f1) {
+            mVec = _mm_setr_pd(f0, f1);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE double extract(uint32_t index) const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE double operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_f & insert(uint32_t index, double value) {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_pd(raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_f, double> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_f, double>(index, static_cast<SIMDVec_f &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, double, SIMDVecMask<2>> operator() (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_f, double, SIMDVecMask<2>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, double, SIMDVecMask<2>> operator[] (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_f, double, SIMDVecMask<2>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVec_f const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (SIMDVec_f const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            mVec = BLEND(mVec, b.mVec, mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(double b) {
+            mVec = _mm_set1_pd(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (double b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+
+        // PREFETCH0
+        static UME_FORCE_INLINE void prefetch0(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T0);
+        }
+        // PREFETCH1
+        static UME_FORCE_INLINE void prefetch1(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T1);
+        }
+        // PREFETCH2
+        static UME_FORCE_INLINE void prefetch2(double const *p) {
+            _mm_prefetch((const char *)p, _MM_HINT_T2);
+        }
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_f & load(double const * p) {
+            mVec = _mm_loadu_pd(p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<2> const & mask, double const * p) {
+            if (mask.mMask[0] == true) mVec = _mm_loadl_pd(mVec, p);
+            if (mask.mMask[1] == true) mVec = _mm_loadh_pd(mVec, p + 1);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(double const * p) {
+            mVec = _mm_load_pd(p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<2> const & mask, double const * p) {
+            __m128d t0 = _mm_load_pd(p);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE double* store(double* p) const {
+            _mm_storeu_pd(p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE double* store(SIMDVecMask<2> const & mask, double * p) const {
+            if (mask.mMask[0] == true) _mm_storel_pd(p, mVec);
+            if (mask.mMask[1] == true) _mm_storeh_pd(p + 1, mVec);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE double* storea(double * p) const {
+            _mm_store_pd(p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE double* storea(SIMDVecMask<2> const & mask, double * p) const {
+            if (mask.mMask[0] == true) _mm_storel_pd(p, mVec);
+            if (mask.mMask[1] == true) _mm_storeh_pd(p + 1, mVec);
+            return p;
+        }
+        // SSTORE
+        UME_FORCE_INLINE double* sstore(double * p) const {
+            _mm_stream_pd(p, mVec);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE double* sstore(SIMDVecMask<2> const & mask, double * p) const {
+            return storea(mask, p);
+        }
+
+        // BLENDV
+        // BLENDS
+        // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_f swizzle(SIMDSwizzle<2> const & sMask) const {
+            return SCALAR_EMULATION::swizzle<SIMDVec_f, SIMDSwizzle<2>>(sMask, *this);
+        }
+        template<int i0, int i1>
+        UME_FORCE_INLINE SIMDVec_f swizzle() {
+            const int index = i0 | (i1 << 1);
+            __m128d t0 = _mm_shuffle_pd(mVec, mVec, index);
+            return SIMDVec_f(t0);
+        }
+        // SWIZZLEA
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_add_pd(this->mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_add_pd(this->mVec, b.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_f add(double b) const {
+            __m128d t0 = _mm_add_pd(this->mVec, _mm_set1_pd(b));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (double b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_add_pd(this->mVec, _mm_set1_pd(b));
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVec_f const & b) {
+            mVec = _mm_add_pd(this->mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_add_pd(this->mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(double b) {
+            mVec = _mm_add_pd(this->mVec, _mm_set1_pd(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (double b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_add_pd(this->mVec, _mm_set1_pd(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDV
+        // MSADDV
+        // SADDS
+        // MSADDS
+        // SADDVA
+        // MSADDVA
+        // SADDSA
+        // MSADDSA
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc() {
+            __m128d t0 = mVec;
+            mVec = _mm_add_pd(mVec, _mm_set1_pd(1.0));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc(SIMDVecMask<2> const & mask) {
+            __m128d t0 = mVec;
+            __m128d t1 = _mm_add_pd(mVec, _mm_set1_pd(1.0));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc() {
+            mVec = _mm_add_pd(mVec, _mm_set1_pd(1.0));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator++ () {
+            mVec = _mm_add_pd(mVec, _mm_set1_pd(1.0));
+            return *this;
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_add_pd(mVec, _mm_set1_pd(1.0));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(mVec, b.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_f sub(double b) const {
+            __m128d t0 = _mm_sub_pd(mVec, _mm_set1_pd(b));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (double b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_sub_pd(mVec, _mm_set1_pd(b));
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVec_f const & b) {
+            mVec = _mm_sub_pd(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-=(SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_sub_pd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(double b) {
+            mVec = _mm_sub_pd(mVec, _mm_set1_pd(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-= (double b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_sub_pd(mVec, _mm_set1_pd(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBV
+        // MSSUBV
+        // SSUBS
+        // MSSUBS
+        // SSUBVA
+        // MSSUBVA
+        // SSUBSA
+        // MSSUBSA
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(b.mVec, mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(b.mVec, mVec);
+            __m128d t1 = BLEND(b.mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(double b) const {
+            __m128d t0 = _mm_sub_pd(_mm_set1_pd(b), mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_sub_pd(t0, mVec);
+            __m128d t2 = BLEND(t0, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVec_f const & b) {
+            mVec = _mm_sub_pd(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_sub_pd(b.mVec, mVec);
+            mVec = BLEND(b.mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = _mm_sub_pd(t0, mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_sub_pd(t0, mVec);
+            mVec = BLEND(t0, t1, mask.mMask);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec() {
+            __m128d t0 = mVec;
+            mVec = _mm_sub_pd(mVec, _mm_set1_pd(1.0));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec(SIMDVecMask<2> const & mask) {
+            __m128d t0 = mVec;
+            __m128d t1 = _mm_sub_pd(mVec, _mm_set1_pd(1.0));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec() {
+            mVec = _mm_sub_pd(mVec, _mm_set1_pd(1.0));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_sub_pd(mVec, _mm_set1_pd(1.0));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_mul_pd(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (SIMDVec_f const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_mul_pd(mVec, b.mVec);
+            __m128d t2 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_f mul(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_mul_pd(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (double b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_mul_pd(mVec, t0);
+            __m128d t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVec_f const & b) {
+            mVec = _mm_mul_pd(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (SIMDVec_f const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_mul_pd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = _mm_mul_pd(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (double b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_mul_pd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_div_pd(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (SIMDVec_f const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_div_pd(mVec, b.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_f div(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_div_pd(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (double b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_div_pd(mVec, t0);
+            __m128d t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // DIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVec_f const & b) {
+            mVec = _mm_div_pd(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (SIMDVec_f const & b) {
+            return diva(b);
+        }
+        // MDIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_div_pd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // DIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = _mm_div_pd(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (double b) {
+            return diva(b);
+        }
+        // MDIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_div_pd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // RCP
+        UME_FORCE_INLINE SIMDVec_f rcp() const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            return SIMDVec_f(t0);
+        }
+        // MRCP
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // RCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(double b) const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            __m128d t1 = _mm_set1_pd(b);
+            __m128d t2 = _mm_mul_pd(t0, t1);
+            return SIMDVec_f(t2);
+        }
+        // MRCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            __m128d t1 = _mm_set1_pd(b);
+            __m128d t2 = _mm_mul_pd(t0, t1);
+            __m128d t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_f(t3);
+        }
+        // RCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa() {
+            mVec = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            return *this;
+        }
+        // MRCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(double b) {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            __m128d t1 = _mm_set1_pd(b);
+            mVec = _mm_mul_pd(t0, t1);
+            return *this;
+        }
+        // MRCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec);
+            __m128d t1 = _mm_set1_pd(b);
+            __m128d t2 = _mm_mul_pd(t0, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(SIMDVec_f const & b) const {
+            int m0 = _mm_movemask_pd(_mm_cmpeq_pd(mVec, b.mVec));
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (SIMDVec_f const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            int m0 = _mm_movemask_pd(_mm_cmpeq_pd(mVec, t0));
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (double b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(SIMDVec_f const & b) const {
+            int m0 = _mm_movemask_pd(_mm_cmpneq_pd(mVec, b.mVec));
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (SIMDVec_f const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            int m0 = _mm_movemask_pd(_mm_cmpneq_pd(mVec, t0));
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (double b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(SIMDVec_f const & b) const {
+            int m0 = _mm_movemask_pd(_mm_cmpgt_pd(mVec, b.mVec));
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (SIMDVec_f const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            int m0 = _mm_movemask_pd(_mm_cmpgt_pd(mVec, t0));
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (double b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmplt_pd(mVec, b.mVec);
+            int m0 = _mm_movemask_pd(t0);
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (SIMDVec_f const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(double b) const {
+            __m128d t0 = _mm_cmplt_pd(mVec, _mm_set1_pd(b));
+            int m0 = _mm_movemask_pd(t0);
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (double b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmpge_pd(mVec, b.mVec);
+            int m0 = _mm_movemask_pd(t0);
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (SIMDVec_f const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(double b) const {
+            __m128d t0 = _mm_cmpge_pd(mVec, _mm_set1_pd(b));
+            int m0 = _mm_movemask_pd(t0);
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (double b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmple_pd(mVec, b.mVec);
+            int m0 = _mm_movemask_pd(t0);
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (SIMDVec_f const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(double b) const {
+            __m128d t0 = _mm_cmple_pd(mVec, _mm_set1_pd(b));
+            int m0 = _mm_movemask_pd(t0);
+            return SIMDVecMask<2>((m0 & 1) != 0, (m0 & 2) != 0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (double b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_f const & b) const {
+            __m128d m0 = _mm_cmpeq_pd(mVec, b.mVec);
+            return _mm_movemask_pd(m0) == 0x3;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(double b) const {
+            __m128d m0 = _mm_cmpeq_pd(mVec, _mm_set1_pd(b));
+            return _mm_movemask_pd(m0) == 0x3;
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = BLEND(mVec, b.mVec, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = BLEND(mVec, _mm_set1_pd(b), mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // HADD
+        UME_FORCE_INLINE double hadd() const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return raw[0] + raw[1];
+        }
+        // MHADD
+        UME_FORCE_INLINE double hadd(SIMDVecMask<2> const & mask) const {
+            alignas(16) double raw[2];
+            __m128d t0 = BLEND(_mm_set1_pd(0.0), mVec, mask.mMask);
+            _mm_store_pd(raw, t0);
+            return raw[0] + raw[1];
+        }
+        // HADDS
+        UME_FORCE_INLINE double hadd(double b) const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return raw[0] + raw[1] + b;
+        }
+        // MHADDS
+        UME_FORCE_INLINE double hadd(SIMDVecMask<2> const & mask, double b) const {
+            alignas(16) double raw[2];
+            __m128d t0 = BLEND(_mm_set1_pd(0.0), mVec, mask.mMask);
+            _mm_store_pd(raw, t0);
+            return raw[0] + raw[1] + b;
+        }
+        // HMUL
+        UME_FORCE_INLINE double hmul() const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return raw[0] * raw[1];
+        }
+        // MHMUL
+        UME_FORCE_INLINE double hmul(SIMDVecMask<2> const & mask) const {
+            alignas(16) double raw[2];
+            __m128d t0 = BLEND(_mm_set1_pd(1.0), mVec, mask.mMask);
+            _mm_store_pd(raw, t0);
+            return raw[0] * raw[1];
+        }
+        // HMULS
+        UME_FORCE_INLINE double hmul(double b) const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return raw[0] * raw[1] * b;
+        }
+        // MHMULS
+        UME_FORCE_INLINE double hmul(SIMDVecMask<2> const & mask, double b) const {
+            alignas(16) double raw[2];
+            __m128d t0 = BLEND(_mm_set1_pd(1.0), mVec, mask.mMask);
+            _mm_store_pd(raw, t0);
+            return raw[0] * raw[1] * b;
+        }
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#ifdef FMA
+            __m128d t0 = _mm_fmadd_pd(mVec, b.mVec, c.mVec);
+#else
+            __m128d t0 = _mm_add_pd(_mm_mul_pd(mVec, b.mVec), c.mVec);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#ifdef FMA
+            __m128d t0 = _mm_fmadd_pd(mVec, b.mVec, c.mVec);
+#else
+            __m128d t0 = _mm_add_pd(_mm_mul_pd(mVec, b.mVec), c.mVec);
+#endif
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_sub_pd(_mm_mul_pd(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_sub_pd(_mm_mul_pd(mVec, b.mVec), c.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_mul_pd(_mm_add_pd(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_mul_pd(_mm_add_pd(mVec, b.mVec), c.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_mul_pd(_mm_sub_pd(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVecMask<2> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128d t0 = _mm_mul_pd(_mm_sub_pd(mVec, b.mVec), c.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_max_pd(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_max_pd(mVec, b.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_f max(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_max_pd(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_max_pd(mVec, t0);
+            __m128d t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVec_f const & b) {
+            mVec = _mm_max_pd(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_max_pd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = _mm_max_pd(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_max_pd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_min_pd(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_min_pd(mVec, b.mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_f min(double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_min_pd(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<2> const & mask, double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_min_pd(mVec, t0);
+            __m128d t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVec_f const & b) {
+            mVec = _mm_min_pd(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_min_pd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            mVec = _mm_min_pd(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<2> const & mask, double b) {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = _mm_min_pd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE double hmax() const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return (raw[0] > raw[1]) ? raw[0] : raw[1];
+        }
+        // MHMAX
+        UME_FORCE_INLINE double hmax(SIMDVecMask<2> const & mask) const {
+            alignas(16) double raw[2];
+            __m128d t0 = _mm_set1_pd(std::numeric_limits<double>::lowest());
+            __m128d t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_pd(raw, t1);
+            return (raw[0] > raw[1]) ? raw[0] : raw[1];
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE double hmin() const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return (raw[0] < raw[1]) ? raw[0] : raw[1];
+        }
+        // MHMIN
+        UME_FORCE_INLINE double hmin(SIMDVecMask<2> const & mask) const {
+            alignas(16) double raw[2];
+            __m128d t0 = _mm_set1_pd(std::numeric_limits<double>::max());
+            __m128d t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_pd(raw, t1);
+            return (raw[0] < raw[1]) ? raw[0] : raw[1];
+        }
+        // IMIN
+        // MIMIN
+
+        // GATHERS
+        UME_FORCE_INLINE SIMDVec_f & gather(double const * baseAddr, uint64_t const * indices) {
+            mVec = _mm_setr_pd(baseAddr[indices[0]], baseAddr[indices[1]]);
+            return *this;
+        }
+        // MGATHERS
+        UME_FORCE_INLINE SIMDVec_f & gather(SIMDVecMask<2> const & mask, double const * baseAddr, uint64_t const * indices) {
+            __m128d t0 = _mm_setr_pd(
+                mask.mMask[0] ? baseAddr[indices[0]] : 0.0,
+                mask.mMask[1] ? baseAddr[indices[1]] : 0.0);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // GATHERV
+        UME_FORCE_INLINE SIMDVec_f & gather(double const * baseAddr, SIMDVec_u<uint64_t, 2> const & indices) {
+            mVec = _mm_setr_pd(baseAddr[indices[0]], baseAddr[indices[1]]);
+            return *this;
+        }
+        // MGATHERV
+        UME_FORCE_INLINE SIMDVec_f & gather(SIMDVecMask<2> const & mask, double const * baseAddr, SIMDVec_u<uint64_t, 2> const & indices) {
+            __m128d t0 = _mm_setr_pd(
+                mask.mMask[0] ? baseAddr[indices[0]] : 0.0,
+                mask.mMask[1] ? baseAddr[indices[1]] : 0.0);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_f neg() const {
+            __m128d t0 = _mm_sub_pd(_mm_set1_pd(0.0), mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_f neg(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_sub_pd(_mm_set1_pd(0.0), mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_f & nega() {
+            mVec = _mm_sub_pd(_mm_set1_pd(0.0), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_f & nega(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_sub_pd(_mm_set1_pd(0.0), mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_f abs() const {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFF);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            __m128d t2 = _mm_and_pd(t1, mVec);
+            return SIMDVec_f(t2);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_f abs(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFF);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            __m128d t2 = _mm_and_pd(t1, mVec);
+            __m128d t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_f(t3);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_f & absa() {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFF);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            mVec = _mm_and_pd(t1, mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_f & absa(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFF);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            __m128d t2 = _mm_and_pd(t1, mVec);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
+        // CMPEQRV
+        // CMPEQRS
+
+        // SQR
+        UME_FORCE_INLINE SIMDVec_f sqr() const {
+            __m128d t0 = _mm_mul_pd(mVec, mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSQR
+        UME_FORCE_INLINE SIMDVec_f sqr(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_mul_pd(mVec, mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra() {
+            mVec = _mm_mul_pd(mVec, mVec);
+            return *this;
+        }
+        // MSQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_mul_pd(mVec, mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt() const {
+            __m128d t0 = _mm_sqrt_pd(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_sqrt_pd(mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta() {
+            mVec = _mm_sqrt_pd(mVec);
+            return *this;
+        }
+        // MSQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta(SIMDVecMask<2> const & mask) {
+            __m128d t0 = _mm_sqrt_pd(mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<2> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(mask, *this, SIMDVec_f(b));
+        }
+        // POWI
+        UME_FORCE_INLINE SIMDVec_f powi(int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double>(*this, n);
+        }
+        // MPOWI
+        UME_FORCE_INLINE SIMDVec_f powi(SIMDVecMask<2> const & mask, int n) const {
+            return VECTOR_EMULATION::powi<SIMDVec_f, double, SIMDVecMask<2>>(mask, *this, n);
+        }
+        // POWN
+        template<int N>
+        UME_FORCE_INLINE SIMDVec_f pow() const {
+            return VECTOR_EMULATION::powi<N, SIMDVec_f, double>(*this);
+        }
+#if defined(__SSE4_1__)
+        // ROUND
+        UME_FORCE_INLINE SIMDVec_f round() const {
+            __m128d t0 = _mm_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT);
+            return SIMDVec_f(t0);
+        }
+        // MROUND
+        UME_FORCE_INLINE SIMDVec_f round(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+#endif
+        // TRUNC
+        SIMDVec_i<int64_t, 2> trunc() const {
+            alignas(16) double raw[2];
+            _mm_store_pd(raw, mVec);
+            return SIMDVec_i<int64_t, 2>(int64_t(raw[0]), int64_t(raw[1]));
+        }
+        // MTRUNC
+        SIMDVec_i<int64_t, 2> trunc(SIMDVecMask<2> const & mask) const {
+            alignas(16) double raw[2];
+            __m128d t0 = _mm_setzero_pd();
+            _mm_store_pd(raw, BLEND(t0, mVec, mask.mMask));
+            return SIMDVec_i<int64_t, 2>(int64_t(raw[0]), int64_t(raw[1]));
+        }
+#if defined(__SSE4_1__)
+        // FLOOR
+        UME_FORCE_INLINE SIMDVec_f floor() const {
+            __m128d t0 = _mm_floor_pd(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFLOOR
+        UME_FORCE_INLINE SIMDVec_f floor(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_floor_pd(mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // CEIL
+        UME_FORCE_INLINE SIMDVec_f ceil() const {
+            __m128d t0 = _mm_ceil_pd(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MCEIL
+        UME_FORCE_INLINE SIMDVec_f ceil(SIMDVecMask<2> const & mask) const {
+            __m128d t0 = _mm_ceil_pd(mVec);
+            __m128d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+#endif
+        // ISFIN
+        // ISINF
+        // ISAN
+        // ISNAN
+        // ISSUB
+        // ISZERO
+        // ISZEROSUB
+
+        // EXP
+        UME_FORCE_INLINE SIMDVec_f exp() const {
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, DEFAULT_PRECISION>(*this);
+        }
+        // MEXP
+        UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>, DEFAULT_PRECISION>(mask, *this);
+        }
+        // EXP2
+        UME_FORCE_INLINE SIMDVec_f exp2() const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
+        // MEXP2
+        UME_FORCE_INLINE SIMDVec_f exp2(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::exp2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // EXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1() const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
+        // MEXPM1
+        UME_FORCE_INLINE SIMDVec_f expm1(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::expm1d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // LOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p() const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MLOG1P
+        UME_FORCE_INLINE SIMDVec_f log1p(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::log1pd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // SINH
+        UME_FORCE_INLINE SIMDVec_f sinh() const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MSINH
+        UME_FORCE_INLINE SIMDVec_f sinh(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::sinhd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // COSH
+        UME_FORCE_INLINE SIMDVec_f cosh() const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MCOSH
+        UME_FORCE_INLINE SIMDVec_f cosh(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::coshd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // TANH
+        UME_FORCE_INLINE SIMDVec_f tanh() const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MTANH
+        UME_FORCE_INLINE SIMDVec_f tanh(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::tanhd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // ERF
+        UME_FORCE_INLINE SIMDVec_f erf() const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MERF
+        UME_FORCE_INLINE SIMDVec_f erf(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::erfd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // ERFC
+        UME_FORCE_INLINE SIMDVec_f erfc() const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MERFC
+        UME_FORCE_INLINE SIMDVec_f erfc(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::erfcd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // NORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf() const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MNORMCDF
+        UME_FORCE_INLINE SIMDVec_f normcdf(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::normcdfd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // NORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv() const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this);
+        }
+        // MNORMINV
+        UME_FORCE_INLINE SIMDVec_f norminv(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::norminvd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // LOG
+        // MLOG
+        // LOG2
+        // MLOG2
+        // LOG10
+        // MLOG10
+        // SIN
+        // MSIN
+        // COS
+        // MCOS
+        // TAN
+        // MTAN
+        // CTAN
+        // MCTAN
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<double, 1> const & a, SIMDVec_f<double, 1> const & b) {
+            mVec = _mm_setr_pd(a[0], b[0]);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_f & packlo(SIMDVec_f<double, 1> const & a) {
+            mVec = _mm_move_sd(mVec, _mm_set_sd(a[0]));
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_f & packhi(SIMDVec_f<double, 1> const & b) {
+            mVec = _mm_unpacklo_pd(mVec, _mm_set_sd(b[0]));
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_f<double, 1> & a, SIMDVec_f<double, 1> & b) const {
+            a.insert(0, _mm_cvtsd_f64(mVec));
+            b.insert(0, _mm_cvtsd_f64(_mm_unpackhi_pd(mVec, mVec)));
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_f<double, 1> unpacklo() const {
+            return SIMDVec_f<double, 1>(_mm_cvtsd_f64(mVec));
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_f<double, 1> unpackhi() const {
+            return SIMDVec_f<double, 1>(_mm_cvtsd_f64(_mm_unpackhi_pd(mVec, mVec)));
+        }
+
+        // PROMOTE
+        // -
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_f<float, 2>() const;
+
+        // FTOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint64_t, 2>() const;
+        // FTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int64_t, 2>() const;
+    };
+UME_SIMD_END_PLUGIN_NAMESPACE
+}
+}
+
+#undef BLEND
+#undef EXPAND_MASK
+
+#endif
@@ -33,6 +33,8 @@
 
 #include "UMEUnitTestCommon.h"
 #include "UMEUnitTestMemory.h"
+#include "UMEUnitTestDispatch.h"
+#include "UMEUnitTestSort.h"
 #include "UMEUnitTestSimd.h"
 
 int main()
@@ -42,6 +44,10 @@ int main()
     
     total_failed += test_allocators(false);
     total_tests +=g_totalTests;
+    total_failed += test_dispatch(false);
+    total_tests +=g_totalTests;
+    total_failed += test_sort(false);
+    total_tests +=g_totalTests;
     total_failed += test_UMESimd(false);
     total_tests +=g_totalTests;
     std::cout << std::endl;
@@ -260,6 +260,36 @@ bool valuesInRange(double const *values, double const *expectedValues, unsigned
     return retval;
 }
 
+bool valuesInRangeOrNaN(float const *values, float const *expectedValues, unsigned int count, float errMargin)
+{
+    bool retval = true;
+    for(unsigned int i = 0; i < count; i++) {
+        bool match = std::isnan(expectedValues[i]) ? std::isnan(values[i])
+                                                   : valueInRange(values[i], expectedValues[i], errMargin);
+        if(!match)
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesInRangeOrNaN(double const *values, double const *expectedValues, unsigned int count, double errMargin)
+{
+    bool retval = true;
+    for(unsigned int i = 0; i < count; i++) {
+        bool match = std::isnan(expectedValues[i]) ? std::isnan(values[i])
+                                                   : valueInRange(values[i], expectedValues[i], errMargin);
+        if(!match)
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
 #include "../utilities/ignore_warnings_push.h"
 #include "../utilities/ignore_warnings_unused_parameter.h"
 
@@ -38,7 +38,10 @@
 #include "UMEUnitTestDataSets32.h"
 #include "UMEUnitTestDataSets64.h"
 
+#include <algorithm>
+#include <functional>
 #include <random>
+#include <limits>
 
 extern int g_totalTests;
 extern int g_totalFailed;
@@ -101,6 +104,9 @@ bool valuesExact(uint64_t const *values, uint64_t const *expectedValues, unsigne
 bool valuesExact(bool const *values, bool const *expectedValues, unsigned int count);
 bool valuesInRange(float const *values, float const *expectedValues, unsigned int count, float errMargin);
 bool valuesInRange(double const *values, double const *expectedValues, unsigned int count, double errMargin);
+// As valuesInRange(), but a NaN is also accepted where a NaN is expected.
+bool valuesInRangeOrNaN(float const *values, float const *expectedValues, unsigned int count, float errMargin);
+bool valuesInRangeOrNaN(double const *values, double const *expectedValues, unsigned int count, double errMargin);
 
 // This is a dirty hack to use the same testing function for both int and float types... 
 bool valuesInRange(uint8_t const *values, uint8_t const *expectedValues, unsigned int count, double errMargin);
@@ -639,6 +645,47 @@ void genericLORVTest_random()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericCONFLICTTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    // Draw from a small range so that every vector holds some duplicates.
+    std::uniform_int_distribution<int> dist(0, VEC_LEN / 2);
+    const int BIT_COUNT = int(8 * sizeof(SCALAR_TYPE));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE outputs[VEC_LEN];
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = SCALAR_TYPE(dist(gen));
+    }
+    for (int i = 0; i < VEC_LEN; i++) {
+        uint64_t bits = 0;
+        for (int j = 0; j < i && j < BIT_COUNT; j++) {
+            if (inputA[i] == inputA[j]) bits |= uint64_t(1) << j;
+        }
+        outputs[i] = SCALAR_TYPE(bits);
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.conflict();
+        vec1.store(values);
+        bool isExact = valuesExact(values, outputs, VEC_LEN);
+        vec0.store(values);
+        bool isUnmodified = valuesExact(values, inputA, VEC_LEN);
+        CHECK_CONDITION(isExact && isUnmodified, "CONFLICT gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::conflict(vec0);
+        vec1.store(values);
+        bool isExact = valuesExact(values, outputs, VEC_LEN);
+        CHECK_CONDITION(isExact, "CONFLICT(function) gen");
+    }
+}
+
 template<typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
 void genericLORSTest()
 {
@@ -1196,6 +1243,73 @@ void genericHLXORTest()
     CHECK_CONDITION(value == expected, "HLXOR");
 }
 
+template<typename MASK_TYPE, int VEC_LEN>
+void genericFIRSTNTest()
+{
+    bool values[VEC_LEN];
+    bool isCorrect = true;
+    for (int n = 0; n <= VEC_LEN + 1; n++) {
+        MASK_TYPE m0 = MASK_TYPE::firstN(n);
+        m0.store(values);
+        for (int i = 0; i < VEC_LEN; i++) {
+            if (values[i] != (i < n)) isCorrect = false;
+        }
+    }
+    CHECK_CONDITION(isCorrect, "FIRSTN");
+}
+
+template<typename MASK_TYPE, int VEC_LEN>
+void genericBITMASKTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    bool isCorrect = true;
+    bool inputs[VEC_LEN];
+    bool values[VEC_LEN];
+    // Random masks, followed by the all-false and all-true masks.
+    for (int n = 0; n < 12; n++) {
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputs[i] = (n < 10) ? randomValue<bool>(gen) : (n == 11);
+        }
+        uint64_t expectedBits = 0;
+        uint32_t expectedCount = 0;
+        uint32_t expectedFirst = VEC_LEN;
+        uint32_t expectedLast = VEC_LEN;
+        for (int i = 0; i < VEC_LEN; i++) {
+            if (inputs[i] == false) continue;
+            if (i < 64) expectedBits |= 1ULL << i;
+            expectedCount++;
+            if (expectedFirst == VEC_LEN) expectedFirst = i;
+            expectedLast = i;
+        }
+
+        MASK_TYPE m0(inputs);
+        if (m0.toBitmask() != expectedBits) isCorrect = false;
+        if (m0.count() != expectedCount) isCorrect = false;
+        if (m0.firstSet() != expectedFirst) isCorrect = false;
+        if (m0.lastSet() != expectedLast) isCorrect = false;
+
+        int next = 0;
+        for (uint32_t i : m0.activeLanes()) {
+            while (next < VEC_LEN && inputs[next] == false) next++;
+            if (int(i) != next) isCorrect = false;
+            next++;
+        }
+        while (next < VEC_LEN && inputs[next] == false) next++;
+        if (next != VEC_LEN) isCorrect = false;
+
+        uint64_t bits = (uint64_t(gen()) << 32) | uint64_t(gen());
+        MASK_TYPE m1 = MASK_TYPE::fromBitmask(bits);
+        m1.store(values);
+        for (int i = 0; i < VEC_LEN; i++) {
+            bool expected = (i < 64) ? (((bits >> i) & 1) != 0) : false;
+            if (values[i] != expected) isCorrect = false;
+        }
+    }
+    CHECK_CONDITION(isCorrect, "BITMASK");
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericEXTRACTTest()
 {
@@ -1448,6 +1562,22 @@ void genericLOAD_STORETest()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
+void genericPREFETCHTest()
+{
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE::prefetch0(DATA_SET::inputs::inputA);
+        VEC_TYPE::prefetch1(DATA_SET::inputs::inputA);
+        VEC_TYPE::prefetch2(DATA_SET::inputs::inputA);
+        VEC_TYPE vec0;
+        vec0.load(DATA_SET::inputs::inputA);
+        vec0.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange), "PREFETCH");
+    }
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
 void genericMLOADTest_random()
 {
@@ -1593,6 +1723,107 @@ void genericMSTOREATest_random()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
+void genericSSTORETest()
+{
+    {
+        alignas(VEC_TYPE::alignment()) SCALAR_TYPE values[VEC_LEN];
+
+        VEC_TYPE vec0;
+        vec0.load(DATA_SET::inputs::inputA);
+        vec0.sstore(values);
+        VEC_TYPE::streamFence();
+        bool inRange = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange), "SSTORE");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMSSTORETest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    alignas(VEC_TYPE::alignment()) SCALAR_TYPE inputA[VEC_LEN];
+    alignas(VEC_TYPE::alignment()) SCALAR_TYPE output[VEC_LEN];
+    alignas(MASK_TYPE::alignment()) bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputMask[i] = randomValue<bool>(gen);
+
+        output[i] = inputMask[i] ? inputA[i] : 0;
+    }
+
+    {
+        alignas(VEC_TYPE::alignment()) SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+
+        memset(values, 0, sizeof(SCALAR_TYPE)*VEC_LEN);
+
+        vec0.sstore(mask, values);
+        VEC_TYPE::streamFence();
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange), "MSSTORE");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericCOMPRESSTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    bool compressOk = true, compressStoreOk = true, expandLoadOk = true;
+
+    for (int test = 0; test < 100; test++) {
+        SCALAR_TYPE inputA[VEC_LEN];
+        SCALAR_TYPE inputB[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+        SCALAR_TYPE before[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        bool inputMask[VEC_LEN];
+        uint32_t count = 0;
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = randomValue<SCALAR_TYPE>(gen);
+            inputB[i] = randomValue<SCALAR_TYPE>(gen);
+            before[i] = randomValue<SCALAR_TYPE>(gen);
+            // The first runs use empty and full masks.
+            inputMask[i] = (test < 2) ? (test == 1) : randomValue<bool>(gen);
+            if (inputMask[i]) output[count++] = inputA[i];
+        }
+
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+
+        VEC_TYPE vec1 = vec0.compress(mask);
+        vec1.store(values);
+        for (int i = 0; i < VEC_LEN; i++) {
+            compressOk &= (values[i] == ((uint32_t(i) < count) ? output[i] : SCALAR_TYPE(0)));
+        }
+
+        // Elements past the stored ones have to stay untouched.
+        for (int i = 0; i < VEC_LEN; i++) values[i] = before[i];
+        uint32_t stored = vec0.compressStore(mask, values);
+        compressStoreOk &= (stored == count);
+        for (int i = 0; i < VEC_LEN; i++) {
+            compressStoreOk &= (values[i] == ((uint32_t(i) < count) ? output[i] : before[i]));
+        }
+
+        VEC_TYPE vec2(inputA);
+        uint32_t loaded = vec2.expandLoad(mask, inputB);
+        vec2.store(values);
+        expandLoadOk &= (loaded == count);
+        for (int i = 0, j = 0; i < VEC_LEN; i++) {
+            expandLoadOk &= (values[i] == (inputMask[i] ? inputB[j++] : inputA[i]));
+        }
+    }
+    CHECK_CONDITION(compressOk, "COMPRESS");
+    CHECK_CONDITION(compressStoreOk, "COMPRESSSTORE");
+    CHECK_CONDITION(expandLoadOk, "EXPANDLOAD");
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericADDVTest()
 {
@@ -4369,6 +4600,40 @@ void genericCMPESTest()
         CHECK_CONDITION(value == DATA_SET::outputs::CMPES, "CMPES(function - LHS scalar)");
     }
 }
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericUNIQUETest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = SCALAR_TYPE(i);
+    }
+    std::shuffle(inputA, inputA + VEC_LEN, gen);
+    {
+        VEC_TYPE vec0(inputA);
+        bool value = vec0.unique();
+        CHECK_CONDITION(value == true, "UNIQUE gen");
+    }
+    {
+        VEC_TYPE vec0(inputA);
+        bool value = UME::SIMD::FUNCTIONS::unique(vec0);
+        CHECK_CONDITION(value == true, "UNIQUE(function) gen");
+    }
+    if (VEC_LEN > 1) {
+        // Duplicate one element at a random distance.
+        std::uniform_int_distribution<int> dist(0, VEC_LEN - 1);
+        int i = dist(gen);
+        int j = dist(gen);
+        if (i == j) j = (i + 1) % VEC_LEN;
+        inputA[j] = inputA[i];
+        VEC_TYPE vec0(inputA);
+        bool value = vec0.unique();
+        CHECK_CONDITION(value == false, "UNIQUE(duplicate) gen");
+    }
+}
  
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericBANDVTest()
@@ -5217,6 +5482,223 @@ void genericMBNOTATest()
     CHECK_CONDITION(inRange, "MBNOTA");
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericBITCOUNTTest_random()
+{
+    typedef typename std::make_unsigned<SCALAR_TYPE>::type UINT_TYPE;
+    const int WIDTH = 8 * sizeof(SCALAR_TYPE);
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE outputPOPCNT[VEC_LEN];
+    SCALAR_TYPE outputLZCNT[VEC_LEN];
+    SCALAR_TYPE outputTZCNT[VEC_LEN];
+    SCALAR_TYPE outputBITREV[VEC_LEN];
+    SCALAR_TYPE values[VEC_LEN];
+
+    bool popcntCorrect = true, lzcntCorrect = true, tzcntCorrect = true, bitrevCorrect = true;
+    for (int n = 0; n < 8; n++) {
+        for (int i = 0; i < VEC_LEN; i++) {
+            // Cover zero, all ones, single bits and values of all magnitudes.
+            uint64_t t0 = (uint64_t(gen()) << 32) | uint64_t(gen());
+            switch ((i + n) % 5) {
+            case 0: t0 = 0; break;
+            case 1: t0 = ~0ULL; break;
+            case 2: t0 = 1ULL << (gen() % WIDTH); break;
+            default: t0 >>= gen() % 64; break;
+            }
+            UINT_TYPE x = UINT_TYPE(t0);
+            inputA[i] = SCALAR_TYPE(x);
+
+            int pop = 0, lz = 0, tz = 0;
+            UINT_TYPE rev = 0;
+            for (int b = 0; b < WIDTH; b++) {
+                if ((x >> b) & 1) {
+                    pop++;
+                    rev |= UINT_TYPE(UINT_TYPE(1) << (WIDTH - 1 - b));
+                }
+            }
+            while (lz < WIDTH && ((x >> (WIDTH - 1 - lz)) & 1) == 0) lz++;
+            while (tz < WIDTH && ((x >> tz) & 1) == 0) tz++;
+            outputPOPCNT[i] = SCALAR_TYPE(pop);
+            outputLZCNT[i] = SCALAR_TYPE(lz);
+            outputTZCNT[i] = SCALAR_TYPE(tz);
+            outputBITREV[i] = SCALAR_TYPE(rev);
+        }
+
+        VEC_TYPE vec0(inputA);
+        vec0.popcnt().store(values);
+        popcntCorrect &= valuesExact(values, outputPOPCNT, VEC_LEN);
+        vec0.lzcnt().store(values);
+        lzcntCorrect &= valuesExact(values, outputLZCNT, VEC_LEN);
+        vec0.tzcnt().store(values);
+        tzcntCorrect &= valuesExact(values, outputTZCNT, VEC_LEN);
+        vec0.bitrev().store(values);
+        bitrevCorrect &= valuesExact(values, outputBITREV, VEC_LEN);
+    }
+    CHECK_CONDITION(popcntCorrect, "POPCNT");
+    CHECK_CONDITION(lzcntCorrect, "LZCNT");
+    CHECK_CONDITION(tzcntCorrect, "TZCNT");
+    CHECK_CONDITION(bitrevCorrect, "BITREV");
+}
+
+
+// LOOKUP16 is only defined for 8-bit elements.
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericLOOKUP16Test_random(std::false_type) {}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericLOOKUP16Test_random(std::true_type)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE table[16];
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE values[VEC_LEN];
+
+    for (int i = 0; i < 16; i++) {
+        table[i] = randomValue<SCALAR_TYPE>(gen);
+    }
+    for (int i = 0; i < VEC_LEN; i++) {
+        // Mostly valid indices, plus out of range ones (16..255 as unsigned).
+        uint8_t t0 = (i % 4 == 3) ? uint8_t(16 + gen() % 240) : uint8_t(gen() % 16);
+        inputA[i] = SCALAR_TYPE(t0);
+        output[i] = t0 < 16 ? table[t0] : SCALAR_TYPE(0);
+    }
+
+    VEC_TYPE vec0(inputA);
+    vec0.lookup16(table).store(values);
+    CHECK_CONDITION(valuesExact(values, output, VEC_LEN), "LOOKUP16");
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericDIVINVTest_random()
+{
+    const int WIDTH = 8 * sizeof(SCALAR_TYPE);
+    const SCALAR_TYPE MIN = std::numeric_limits<SCALAR_TYPE>::min();
+    const SCALAR_TYPE MAX = std::numeric_limits<SCALAR_TYPE>::max();
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE values[VEC_LEN];
+
+    bool divCorrect = true, divaCorrect = true;
+    for (int n = 0; n < 32; n++) {
+        // Cover the special divisors (+-1, powers of two, extremes) and
+        // random divisors of all magnitudes.
+        uint64_t t0 = (uint64_t(gen()) << 32) | uint64_t(gen());
+        SCALAR_TYPE d;
+        switch (n % 8) {
+        case 0: d = SCALAR_TYPE(1); break;
+        case 1: d = SCALAR_TYPE(std::is_signed<SCALAR_TYPE>::value ? -1 : 3); break;
+        case 2: d = SCALAR_TYPE(1ULL << (gen() % (WIDTH - 1))); break;
+        case 3: d = (n & 8) ? MAX : MIN; break;
+        default: d = SCALAR_TYPE(t0 >> (gen() % 64)); break;
+        }
+        if (d == 0) d = SCALAR_TYPE(7);
+        UME::SIMD::SIMDDivider<SCALAR_TYPE> divider(d);
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            uint64_t t1 = (uint64_t(gen()) << 32) | uint64_t(gen());
+            SCALAR_TYPE x;
+            switch ((i + n) % 6) {
+            case 0: x = MIN; break;
+            case 1: x = MAX; break;
+            case 2: x = SCALAR_TYPE(0); break;
+            default: x = SCALAR_TYPE(t1 >> (gen() % 64)); break;
+            }
+            // MIN / -1 overflows.
+            if (std::is_signed<SCALAR_TYPE>::value && x == MIN && d == SCALAR_TYPE(-1)) x = MAX;
+            inputA[i] = x;
+            output[i] = SCALAR_TYPE(x / d);
+        }
+
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0 / divider;
+        vec1.store(values);
+        divCorrect &= valuesExact(values, output, VEC_LEN);
+        vec0 /= divider;
+        vec0.store(values);
+        divaCorrect &= valuesExact(values, output, VEC_LEN);
+    }
+    CHECK_CONDITION(divCorrect, "DIVINV");
+    CHECK_CONDITION(divaCorrect, "DIVINVA");
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericMULHITest_random()
+{
+    typedef typename std::make_unsigned<SCALAR_TYPE>::type UINT_TYPE;
+    const int WIDTH = 8 * sizeof(SCALAR_TYPE);
+    const SCALAR_TYPE MIN = std::numeric_limits<SCALAR_TYPE>::min();
+    const SCALAR_TYPE MAX = std::numeric_limits<SCALAR_TYPE>::max();
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE outputLO[VEC_LEN];
+    SCALAR_TYPE outputHI[VEC_LEN];
+    SCALAR_TYPE values[VEC_LEN];
+
+    bool mulhiCorrect = true, mulloCorrect = true, mulWideCorrect = true;
+    for (int n = 0; n < 8; n++) {
+        for (int i = 0; i < VEC_LEN; i++) {
+            SCALAR_TYPE x[2];
+            for (int k = 0; k < 2; k++) {
+                uint64_t t0 = (uint64_t(gen()) << 32) | uint64_t(gen());
+                switch ((i + n + 3 * k) % 6) {
+                case 0: x[k] = MIN; break;
+                case 1: x[k] = MAX; break;
+                default: x[k] = SCALAR_TYPE(t0 >> (gen() % 64)); break;
+                }
+            }
+            inputA[i] = x[0];
+            inputB[i] = x[1];
+
+            // Reference: 128-bit product of the magnitudes from 32-bit
+            // limbs, negated if the signs differ.
+            bool negA = std::is_signed<SCALAR_TYPE>::value && (UINT_TYPE(x[0]) >> (WIDTH - 1)) != 0;
+            bool negB = std::is_signed<SCALAR_TYPE>::value && (UINT_TYPE(x[1]) >> (WIDTH - 1)) != 0;
+            uint64_t a = negA ? uint64_t(0) - uint64_t(int64_t(x[0])) : uint64_t(UINT_TYPE(x[0]));
+            uint64_t b = negB ? uint64_t(0) - uint64_t(int64_t(x[1])) : uint64_t(UINT_TYPE(x[1]));
+            uint64_t p0 = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+            uint64_t p1 = (a >> 32) * (b & 0xFFFFFFFF);
+            uint64_t p2 = (a & 0xFFFFFFFF) * (b >> 32);
+            uint64_t p3 = (a >> 32) * (b >> 32);
+            uint64_t mid = (p0 >> 32) + (p1 & 0xFFFFFFFF) + (p2 & 0xFFFFFFFF);
+            uint64_t lo = (p0 & 0xFFFFFFFF) | (mid << 32);
+            uint64_t hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+            if (negA != negB) {
+                lo = ~lo + 1;
+                hi = ~hi + (lo == 0 ? 1 : 0);
+            }
+            outputLO[i] = SCALAR_TYPE(UINT_TYPE(lo));
+            outputHI[i] = SCALAR_TYPE(UINT_TYPE(WIDTH == 64 ? hi : (lo >> (WIDTH % 64))));
+        }
+
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2, vec3;
+        vec0.mulhi(vec1).store(values);
+        mulhiCorrect &= valuesExact(values, outputHI, VEC_LEN);
+        vec0.mullo(vec1).store(values);
+        mulloCorrect &= valuesExact(values, outputLO, VEC_LEN);
+        vec0.mulWide(vec1, vec2, vec3);
+        vec2.store(values);
+        mulWideCorrect &= valuesExact(values, outputLO, VEC_LEN);
+        vec3.store(values);
+        mulWideCorrect &= valuesExact(values, outputHI, VEC_LEN);
+    }
+    CHECK_CONDITION(mulhiCorrect, "MULHIV");
+    CHECK_CONDITION(mulloCorrect, "MULLOV");
+    CHECK_CONDITION(mulWideCorrect, "MULWIDEV");
+}
 
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
 void genericBANDNOTVTest_random()
@@ -6094,35 +6576,203 @@ void genericSORTDTest_random()
         CHECK_CONDITION(inRange, "SORTD");
     }
 }
-
-        //(Reduction to scalar operations)
-template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
-void genericHADDTest()
-{
-    {
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        SCALAR_TYPE value = vec0.hadd();
-        bool inRange = valueInRange(value, DATA_SET::outputs::HADD[VEC_LEN - 1], SCALAR_TYPE(SCALAR_TYPE(0.01f)));
-        CHECK_CONDITION(inRange, "HADD");
-    }
-    {
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        SCALAR_TYPE value = UME::SIMD::FUNCTIONS::hadd(vec0);
-        bool inRange = valueInRange(value, DATA_SET::outputs::HADD[VEC_LEN - 1], SCALAR_TYPE(SCALAR_TYPE(0.01f)));
-        CHECK_CONDITION(inRange, "HADD(function)");
-    }
-}
-
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
-void genericHADDTest_random()
+void genericSORTAKVTest_random()
 {
+    {
+        typedef typename UME::SIMD::SIMDTraits<VEC_TYPE>::UINT_VEC_T PAYLOAD_VEC_TYPE;
+        typedef typename UME::SIMD::SIMDTraits<VEC_TYPE>::SCALAR_UINT_T PAYLOAD_TYPE;
+        VEC_TYPE t0, t1;
+        PAYLOAD_VEC_TYPE t2;
+        SCALAR_TYPE input[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+        PAYLOAD_TYPE indices[VEC_LEN];
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        bool inRange = true;
 
-    {
-        SCALAR_TYPE inputA[VEC_LEN];
-        SCALAR_TYPE output = SCALAR_TYPE(0);
+        for (int test = 0; test < 100; test++)
+        {
+            // Every other run uses only a few distinct keys so that
+            // equal keys are exercised.
+            for (int i = 0; i < VEC_LEN; i++) {
+                input[i] = (test % 2 && i > 0) ? input[randomValue<uint32_t>(gen) % i] : randomValue<SCALAR_TYPE>(gen);
+                output[i] = input[i];
+                indices[i] = PAYLOAD_TYPE(i);
+            }
+            std::sort(output, output + VEC_LEN);
+
+            t0.load(input);
+            t2.load(indices);
+            t1 = t0.sorta(t2);
+            t1.store(values);
+            t2.store(indices);
+
+            // Keys have to be ordered and the payload has to hold
+            // a permutation that reproduces them from the input.
+            bool seen[VEC_LEN] = { false };
+            for (int i = 0; i < VEC_LEN; i++) {
+                inRange &= (values[i] == output[i]);
+                inRange &= (uint32_t(indices[i]) < uint32_t(VEC_LEN));
+                if (uint32_t(indices[i]) < uint32_t(VEC_LEN)) {
+                    inRange &= !seen[indices[i]];
+                    seen[indices[i]] = true;
+                    inRange &= (input[indices[i]] == values[i]);
+                }
+            }
+        }
+        CHECK_CONDITION(inRange, "SORTA (key-value)");
+    }
+}
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericSORTDKVTest_random()
+{
+    {
+        typedef typename UME::SIMD::SIMDTraits<VEC_TYPE>::UINT_VEC_T PAYLOAD_VEC_TYPE;
+        typedef typename UME::SIMD::SIMDTraits<VEC_TYPE>::SCALAR_UINT_T PAYLOAD_TYPE;
+        VEC_TYPE t0, t1;
+        PAYLOAD_VEC_TYPE t2;
+        SCALAR_TYPE input[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+        PAYLOAD_TYPE indices[VEC_LEN];
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        bool inRange = true;
+
+        for (int test = 0; test < 100; test++)
+        {
+            // Every other run uses only a few distinct keys so that
+            // equal keys are exercised.
+            for (int i = 0; i < VEC_LEN; i++) {
+                input[i] = (test % 2 && i > 0) ? input[randomValue<uint32_t>(gen) % i] : randomValue<SCALAR_TYPE>(gen);
+                output[i] = input[i];
+                indices[i] = PAYLOAD_TYPE(i);
+            }
+            std::sort(output, output + VEC_LEN, std::greater<SCALAR_TYPE>());
+
+            t0.load(input);
+            t2.load(indices);
+            t1 = t0.sortd(t2);
+            t1.store(values);
+            t2.store(indices);
+
+            // Keys have to be ordered and the payload has to hold
+            // a permutation that reproduces them from the input.
+            bool seen[VEC_LEN] = { false };
+            for (int i = 0; i < VEC_LEN; i++) {
+                inRange &= (values[i] == output[i]);
+                inRange &= (uint32_t(indices[i]) < uint32_t(VEC_LEN));
+                if (uint32_t(indices[i]) < uint32_t(VEC_LEN)) {
+                    inRange &= !seen[indices[i]];
+                    seen[indices[i]] = true;
+                    inRange &= (input[indices[i]] == values[i]);
+                }
+            }
+        }
+        CHECK_CONDITION(inRange, "SORTD (key-value)");
+    }
+}
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericBSORTTest_random()
+{
+    {
+        typedef typename UME::SIMD::SIMDTraits<VEC_TYPE>::UINT_VEC_T PAYLOAD_VEC_TYPE;
+        typedef typename UME::SIMD::SIMDTraits<VEC_TYPE>::SCALAR_UINT_T PAYLOAD_TYPE;
+        VEC_TYPE t0, t1, t2, t3;
+        PAYLOAD_VEC_TYPE t4, t5;
+        SCALAR_TYPE input[VEC_LEN];
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+        PAYLOAD_TYPE indices[VEC_LEN];
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        bool inRangeA = true, inRangeD = true, inRangeKV = true;
+
+        for (int test = 0; test < 100; test++)
+        {
+            // Bitonic input: ascending up to a random split point and
+            // descending after it, or the other way round.
+            for (int i = 0; i < VEC_LEN; i++) {
+                input[i] = (test % 4 > 1 && i > 0) ? input[randomValue<uint32_t>(gen) % i] : randomValue<SCALAR_TYPE>(gen);
+                indices[i] = PAYLOAD_TYPE(i);
+            }
+            int split = randomValue<uint32_t>(gen) % (VEC_LEN + 1);
+            if (test % 2) {
+                std::sort(input, input + split);
+                std::sort(input + split, input + VEC_LEN, std::greater<SCALAR_TYPE>());
+            }
+            else {
+                std::sort(input, input + split, std::greater<SCALAR_TYPE>());
+                std::sort(input + split, input + VEC_LEN);
+            }
+            std::copy(input, input + VEC_LEN, output);
+            std::sort(output, output + VEC_LEN);
+
+            t0.load(input);
+            t1 = t0.bsorta();
+            t1.store(values);
+            for (int i = 0; i < VEC_LEN; i++) inRangeA &= (values[i] == output[i]);
+
+            t2 = t0.bsortd();
+            t2.store(values);
+            for (int i = 0; i < VEC_LEN; i++) inRangeD &= (values[i] == output[VEC_LEN - 1 - i]);
+
+            t4.load(indices);
+            t5 = t4;
+            t1 = t0.bsorta(t4);
+            t3 = t0.bsortd(t5);
+            t1.store(values);
+            t4.store(indices);
+            for (int i = 0; i < VEC_LEN; i++) {
+                inRangeKV &= (values[i] == output[i]);
+                inRangeKV &= (uint32_t(indices[i]) < uint32_t(VEC_LEN)) && (input[indices[i] % VEC_LEN] == values[i]);
+            }
+            t3.store(values);
+            t5.store(indices);
+            for (int i = 0; i < VEC_LEN; i++) {
+                inRangeKV &= (values[i] == output[VEC_LEN - 1 - i]);
+                inRangeKV &= (uint32_t(indices[i]) < uint32_t(VEC_LEN)) && (input[indices[i] % VEC_LEN] == values[i]);
+            }
+        }
+        CHECK_CONDITION(inRangeA, "BSORTA");
+        CHECK_CONDITION(inRangeD, "BSORTD");
+        CHECK_CONDITION(inRangeKV, "BSORTA/BSORTD (key-value)");
+    }
+}
+
+        //(Reduction to scalar operations)
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
+void genericHADDTest()
+{
+    {
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        SCALAR_TYPE value = vec0.hadd();
+        bool inRange = valueInRange(value, DATA_SET::outputs::HADD[VEC_LEN - 1], SCALAR_TYPE(SCALAR_TYPE(0.01f)));
+        CHECK_CONDITION(inRange, "HADD");
+    }
+    {
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        SCALAR_TYPE value = UME::SIMD::FUNCTIONS::hadd(vec0);
+        bool inRange = valueInRange(value, DATA_SET::outputs::HADD[VEC_LEN - 1], SCALAR_TYPE(SCALAR_TYPE(0.01f)));
+        CHECK_CONDITION(inRange, "HADD(function)");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericHADDTest_random()
+{
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    {
+        SCALAR_TYPE inputA[VEC_LEN];
+        SCALAR_TYPE output = SCALAR_TYPE(0);
 
         for (int i = 0; i < VEC_LEN; i++) {
             inputA[i] = randomValue<SCALAR_TYPE>(gen);
@@ -6813,6 +7463,72 @@ void genericGATHERVTest_random()
 }
 // MGATHERV
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, typename SCALAR_UINT_TYPE, int VEC_LEN>
+void genericPERMUTEVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_UINT_TYPE indices[VEC_LEN];
+    SCALAR_TYPE outputPERMUTE[VEC_LEN];
+    SCALAR_TYPE outputPERMUTE2[VEC_LEN];
+    SCALAR_TYPE values[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputB[i] = randomValue<SCALAR_TYPE>(gen);
+    }
+    for (int i = 0; i < VEC_LEN; i++) {
+        // Indices beyond the vector length wrap around.
+        indices[i] = randomValue<SCALAR_UINT_TYPE>(gen);
+        uint32_t t0 = uint32_t(indices[i] % VEC_LEN);
+        uint32_t t1 = uint32_t(indices[i] % (2 * VEC_LEN));
+        outputPERMUTE[i] = inputA[t0];
+        outputPERMUTE2[i] = t1 < uint32_t(VEC_LEN) ? inputA[t1] : inputB[t1 - VEC_LEN];
+    }
+
+    VEC_TYPE vec0(inputA);
+    VEC_TYPE vec1(inputB);
+    UINT_VEC_TYPE vec2(indices);
+    vec0.permute(vec2).store(values);
+    CHECK_CONDITION(valuesInRange(values, outputPERMUTE, VEC_LEN, SCALAR_TYPE(0.01f)), "PERMUTEV");
+    vec0.permute2(vec1, vec2).store(values);
+    CHECK_CONDITION(valuesInRange(values, outputPERMUTE2, VEC_LEN, SCALAR_TYPE(0.01f)), "PERMUTE2V");
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, typename SCALAR_UINT_TYPE, int VEC_LEN>
+void genericPREFETCHGATHERTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    alignas(VEC_TYPE::alignment()) SCALAR_TYPE inputA[VEC_LEN * 100];
+    alignas(VEC_TYPE::alignment()) SCALAR_UINT_TYPE indices[VEC_LEN];
+    alignas(VEC_TYPE::alignment()) SCALAR_TYPE output[VEC_LEN];
+    alignas(VEC_TYPE::alignment()) SCALAR_TYPE values[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN * 100; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+    }
+    for (int i = 0; i < VEC_LEN;i++) {
+        indices[i] = randomValue<SCALAR_UINT_TYPE>(gen) % (VEC_LEN * 100);
+        output[i] = inputA[indices[i]];
+    }
+
+    VEC_TYPE vec0(SCALAR_TYPE(0));
+    UINT_VEC_TYPE vec1(&indices[0]);
+    VEC_TYPE::prefetchgather0(&inputA[0], vec1);
+    VEC_TYPE::prefetchgather1(&inputA[0], vec1);
+    VEC_TYPE::prefetchgather2(&inputA[0], vec1);
+    vec0.gather(&inputA[0], vec1);
+    vec0.store(values);
+
+    bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+    CHECK_CONDITION(inRange, "PREFETCHGATHER");
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, typename SCALAR_UINT_TYPE, typename MASK_TYPE, int VEC_LEN>
 void genericMGATHERVTest_random()
 {
@@ -10510,6 +11226,163 @@ void genericLOG10Test_random()
     }
 }
 
+// Zero, negative, infinite, NaN and subnormal arguments of LOG, LOG2 and LOG10.
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericLOGSPECIALTest()
+{
+    const SCALAR_TYPE special[] = {
+        SCALAR_TYPE(0.0f),
+        -SCALAR_TYPE(0.0f),
+        std::numeric_limits<SCALAR_TYPE>::quiet_NaN(),
+        std::numeric_limits<SCALAR_TYPE>::denorm_min(),
+        std::numeric_limits<SCALAR_TYPE>::min() / SCALAR_TYPE(3.0f),
+        std::numeric_limits<SCALAR_TYPE>::min(),
+        SCALAR_TYPE(-1.0f),
+        std::numeric_limits<SCALAR_TYPE>::infinity() };
+    const int SPECIAL_COUNT = int(sizeof(special) / sizeof(special[0]));
+
+    for (int k = 0; k < SPECIAL_COUNT; k++) {
+        SCALAR_TYPE inputA[VEC_LEN];
+        SCALAR_TYPE outputLog[VEC_LEN];
+        SCALAR_TYPE outputLog2[VEC_LEN];
+        SCALAR_TYPE outputLog10[VEC_LEN];
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = special[(k + i) % SPECIAL_COUNT];
+            outputLog[i] = std::log(inputA[i]);
+            outputLog2[i] = std::log2(inputA[i]);
+            outputLog10[i] = std::log10(inputA[i]);
+        }
+
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            VEC_TYPE vec1 = vec0.log();
+            vec1.store(values);
+            bool inRange = valuesInRangeOrNaN(values, outputLog, VEC_LEN, SCALAR_TYPE(0.01f));
+            vec0.store(values);
+            bool isUnmodified = valuesInRangeOrNaN(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION((inRange & isUnmodified), "LOG special");
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            VEC_TYPE vec1;
+            vec1 = UME::SIMD::FUNCTIONS::log<UME::SIMD::PRECISION_FAST>(vec0);
+            vec1.store(values);
+            bool inRange = valuesInRangeOrNaN(values, outputLog, VEC_LEN, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION(inRange, "LOG(function, fast) special");
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            VEC_TYPE vec1;
+            vec1 = UME::SIMD::FUNCTIONS::log<UME::SIMD::PRECISION_ACCURATE>(vec0);
+            vec1.store(values);
+            bool inRange = valuesInRangeOrNaN(values, outputLog, VEC_LEN, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION(inRange, "LOG(function, accurate) special");
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            VEC_TYPE vec1 = vec0.log2();
+            vec1.store(values);
+            bool inRange = valuesInRangeOrNaN(values, outputLog2, VEC_LEN, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION(inRange, "LOG2 special");
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            VEC_TYPE vec1 = vec0.log10();
+            vec1.store(values);
+            bool inRange = valuesInRangeOrNaN(values, outputLog10, VEC_LEN, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION(inRange, "LOG10 special");
+        }
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMLOG2Test_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::log2(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.log2(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MLOG2 gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::log2(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MLOG2(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMLOG10Test_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::log10(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.log10(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MLOG10 gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::log10(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MLOG10(function) gen");
+    }
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericSINTest()
 {
@@ -10750,19 +11623,60 @@ void genericTANTest_random()
     }
 }
 
-template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
-void genericMTANTest()
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMTANTest_random()
 {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::tan(inputA[i]) : inputA[i];
+    }
+
     {
         SCALAR_TYPE values[VEC_LEN];
-        VEC_TYPE vec0(DATA_SET::inputs::inputA);
-        MASK_TYPE mask(DATA_SET::inputs::maskA);
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
         VEC_TYPE vec1 = vec0.tan(mask);
         vec1.store(values);
-        bool inRange = valuesInRange(values, DATA_SET::outputs::MTAN, VEC_LEN, 0.1f);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
         vec0.store(values);
-        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
-        CHECK_CONDITION((inRange && isUnmodified), "MTAN");
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MTAN gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::tan(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MTAN(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
+void genericMTANTest()
+{
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(DATA_SET::inputs::inputA);
+        MASK_TYPE mask(DATA_SET::inputs::maskA);
+        VEC_TYPE vec1 = vec0.tan(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, DATA_SET::outputs::MTAN, VEC_LEN, 0.1f);
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, DATA_SET::inputs::inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange && isUnmodified), "MTAN");
     }
     {
         SCALAR_TYPE values[VEC_LEN];
@@ -10839,6 +11753,1898 @@ void genericCTANTest_random()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMCTANTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? SCALAR_TYPE(1.0f)/std::tan(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.ctan(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MCTAN gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::ctan(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MCTAN(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericATANTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        output[i] = std::atan(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.atan();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ATAN gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::atan(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ATAN(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMATANTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::atan(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.atan(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MATAN gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::atan(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MATAN(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericATAN2Test_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputB[i] = randomValue<SCALAR_TYPE>(gen);
+        output[i] = std::atan2(inputA[i], inputB[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec2(inputB);
+        VEC_TYPE vec1 = vec0.atan2(vec2);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ATAN2 gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec2(inputB);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::atan2(vec0, vec2);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ATAN2(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMATAN2Test_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputB[i] = randomValue<SCALAR_TYPE>(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::atan2(inputA[i], inputB[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec2(inputB);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.atan2(mask, vec2);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MATAN2 gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec2(inputB);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::atan2(mask, vec0, vec2);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MATAN2(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericASINTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-1.0f), SCALAR_TYPE(1.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::asin(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.asin();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ASIN gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::asin(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ASIN(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMASINTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-1.0f), SCALAR_TYPE(1.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::asin(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.asin(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MASIN gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::asin(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MASIN(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericACOSTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-1.0f), SCALAR_TYPE(1.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::acos(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.acos();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ACOS gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::acos(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ACOS(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMACOSTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-1.0f), SCALAR_TYPE(1.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::acos(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.acos(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MACOS gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::acos(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MACOS(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericEXP2Test_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-10.0f), SCALAR_TYPE(10.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::exp2(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.exp2();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "EXP2 gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::exp2(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "EXP2(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMEXP2Test_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-10.0f), SCALAR_TYPE(10.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::exp2(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.exp2(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MEXP2 gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::exp2(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MEXP2(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericEXPM1Test_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-2.0f), SCALAR_TYPE(2.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::expm1(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.expm1();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "EXPM1 gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::expm1(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "EXPM1(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMEXPM1Test_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-2.0f), SCALAR_TYPE(2.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::expm1(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.expm1(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MEXPM1 gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::expm1(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MEXPM1(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericLOG1PTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-0.9f), SCALAR_TYPE(10.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::log1p(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.log1p();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "LOG1P gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::log1p(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "LOG1P(function) gen");
+    }
+}
+
+// Pole, domain edges, NaN and subnormal arguments of LOG1P.
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericLOG1PSPECIALTest()
+{
+    const SCALAR_TYPE special[] = {
+        SCALAR_TYPE(-1.0f),
+        std::numeric_limits<SCALAR_TYPE>::quiet_NaN(),
+        SCALAR_TYPE(-2.0f),
+        SCALAR_TYPE(0.0f),
+        -SCALAR_TYPE(0.0f),
+        std::numeric_limits<SCALAR_TYPE>::denorm_min(),
+        -std::numeric_limits<SCALAR_TYPE>::infinity(),
+        std::numeric_limits<SCALAR_TYPE>::infinity() };
+    const int SPECIAL_COUNT = int(sizeof(special) / sizeof(special[0]));
+
+    for (int k = 0; k < SPECIAL_COUNT; k++) {
+        SCALAR_TYPE inputA[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = special[(k + i) % SPECIAL_COUNT];
+            output[i] = std::log1p(inputA[i]);
+        }
+
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            VEC_TYPE vec1 = vec0.log1p();
+            vec1.store(values);
+            bool inRange = valuesInRangeOrNaN(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+            vec0.store(values);
+            bool isUnmodified = valuesInRangeOrNaN(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION((inRange & isUnmodified), "LOG1P special");
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            VEC_TYPE vec1;
+            vec1 = UME::SIMD::FUNCTIONS::log1p(vec0);
+            vec1.store(values);
+            bool inRange = valuesInRangeOrNaN(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION(inRange, "LOG1P(function) special");
+        }
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMLOG1PTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-0.9f), SCALAR_TYPE(10.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::log1p(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.log1p(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MLOG1P gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::log1p(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MLOG1P(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericSINHTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-10.0f), SCALAR_TYPE(10.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::sinh(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.sinh();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "SINH gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::sinh(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "SINH(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMSINHTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-10.0f), SCALAR_TYPE(10.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::sinh(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.sinh(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MSINH gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::sinh(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MSINH(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericCOSHTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-10.0f), SCALAR_TYPE(10.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::cosh(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.cosh();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "COSH gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::cosh(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "COSH(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMCOSHTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-10.0f), SCALAR_TYPE(10.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::cosh(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.cosh(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MCOSH gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::cosh(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MCOSH(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericTANHTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-5.0f), SCALAR_TYPE(5.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::tanh(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.tanh();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "TANH gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::tanh(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "TANH(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMTANHTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-5.0f), SCALAR_TYPE(5.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::tanh(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.tanh(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MTANH gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::tanh(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MTANH(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericERFTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-3.0f), SCALAR_TYPE(3.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::erf(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.erf();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ERF gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::erf(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ERF(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMERFTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-3.0f), SCALAR_TYPE(3.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::erf(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.erf(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MERF gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::erf(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MERF(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericERFCTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-3.0f), SCALAR_TYPE(3.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::erfc(inputA[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.erfc();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ERFC gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::erfc(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "ERFC(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMERFCTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-3.0f), SCALAR_TYPE(3.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::erfc(inputA[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.erfc(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MERFC gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::erfc(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MERFC(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericNORMCDFTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-5.0f), SCALAR_TYPE(5.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = SCALAR_TYPE(0.5) * std::erfc(-inputA[i] * SCALAR_TYPE(0.70710678118654752440));
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.normcdf();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "NORMCDF gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::normcdf(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "NORMCDF(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMNORMCDFTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-5.0f), SCALAR_TYPE(5.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? SCALAR_TYPE(0.5) * std::erfc(-inputA[i] * SCALAR_TYPE(0.70710678118654752440)) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.normcdf(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MNORMCDF gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::normcdf(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MNORMCDF(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericNORMINVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(0.001f), SCALAR_TYPE(0.999f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = SCALAR_TYPE(UME::SIMD::SCALAR_EMULATION::MATH::norminvScalar(inputA[i]));
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.norminv();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "NORMINV gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::norminv(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "NORMINV(function) gen");
+    }
+}
+
+// NaN and the edges of the domain of NORMINV.
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericNORMINVSPECIALTest()
+{
+    const SCALAR_TYPE NAN_VALUE = std::numeric_limits<SCALAR_TYPE>::quiet_NaN();
+    const SCALAR_TYPE INF_VALUE = std::numeric_limits<SCALAR_TYPE>::infinity();
+    const SCALAR_TYPE special[] = {
+        NAN_VALUE, SCALAR_TYPE(0.0f), -SCALAR_TYPE(0.0f), SCALAR_TYPE(1.0f),
+        SCALAR_TYPE(-0.5f), SCALAR_TYPE(1.5f), -INF_VALUE, SCALAR_TYPE(0.5f) };
+    const SCALAR_TYPE expected[] = {
+        NAN_VALUE, -INF_VALUE, -INF_VALUE, INF_VALUE,
+        NAN_VALUE, NAN_VALUE, NAN_VALUE, SCALAR_TYPE(0.0f) };
+    const int SPECIAL_COUNT = int(sizeof(special) / sizeof(special[0]));
+
+    for (int k = 0; k < SPECIAL_COUNT; k++) {
+        SCALAR_TYPE inputA[VEC_LEN];
+        SCALAR_TYPE output[VEC_LEN];
+
+        for (int i = 0; i < VEC_LEN; i++) {
+            inputA[i] = special[(k + i) % SPECIAL_COUNT];
+            output[i] = expected[(k + i) % SPECIAL_COUNT];
+        }
+
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            VEC_TYPE vec1 = vec0.norminv();
+            vec1.store(values);
+            bool inRange = valuesInRangeOrNaN(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+            vec0.store(values);
+            bool isUnmodified = valuesInRangeOrNaN(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION((inRange & isUnmodified), "NORMINV special");
+        }
+        {
+            SCALAR_TYPE values[VEC_LEN];
+            VEC_TYPE vec0(inputA);
+            VEC_TYPE vec1;
+            vec1 = UME::SIMD::FUNCTIONS::norminv(vec0);
+            vec1.store(values);
+            bool inRange = valuesInRangeOrNaN(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+            CHECK_CONDITION(inRange, "NORMINV(function) special");
+        }
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMNORMINVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(0.001f), SCALAR_TYPE(0.999f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? SCALAR_TYPE(UME::SIMD::SCALAR_EMULATION::MATH::norminvScalar(inputA[i])) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.norminv(mask);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MNORMINV gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::norminv(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MNORMINV(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericEXPPRECISIONTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-20.0f), SCALAR_TYPE(20.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE outputMasked[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = std::exp(inputA[i]);
+        outputMasked[i] = inputMask[i] ? output[i] : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::exp<UME::SIMD::PRECISION_FAST>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "EXP(function, fast) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::exp<UME::SIMD::PRECISION_ACCURATE>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "EXP(function, accurate) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::exp<UME::SIMD::PRECISION_FAST>(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputMasked, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MEXP(function, fast) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericLOGPRECISIONTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(0.001f), SCALAR_TYPE(1000.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE outputMasked[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = std::log(inputA[i]);
+        outputMasked[i] = inputMask[i] ? output[i] : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::log<UME::SIMD::PRECISION_FAST>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "LOG(function, fast) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::log<UME::SIMD::PRECISION_ACCURATE>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "LOG(function, accurate) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::log<UME::SIMD::PRECISION_FAST>(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputMasked, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MLOG(function, fast) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericSINPRECISIONTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-100.0f), SCALAR_TYPE(100.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE outputMasked[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = std::sin(inputA[i]);
+        outputMasked[i] = inputMask[i] ? output[i] : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::sin<UME::SIMD::PRECISION_FAST>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "SIN(function, fast) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::sin<UME::SIMD::PRECISION_ACCURATE>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "SIN(function, accurate) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::sin<UME::SIMD::PRECISION_FAST>(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputMasked, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MSIN(function, fast) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericCOSPRECISIONTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> dist(SCALAR_TYPE(-100.0f), SCALAR_TYPE(100.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE outputMasked[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = dist(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = std::cos(inputA[i]);
+        outputMasked[i] = inputMask[i] ? output[i] : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::cos<UME::SIMD::PRECISION_FAST>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "COS(function, fast) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::cos<UME::SIMD::PRECISION_ACCURATE>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "COS(function, accurate) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::cos<UME::SIMD::PRECISION_FAST>(mask, vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputMasked, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MCOS(function, fast) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericPOWVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.1f), SCALAR_TYPE(10.0f));
+    std::uniform_real_distribution<SCALAR_TYPE> distB(SCALAR_TYPE(-5.0f), SCALAR_TYPE(5.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        inputB[i] = distB(gen);
+        output[i] = std::pow(inputA[i], inputB[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2 = vec0.pow(vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWV gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2;
+        vec2 = UME::SIMD::FUNCTIONS::pow(vec0, vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWV(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMPOWVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.1f), SCALAR_TYPE(10.0f));
+    std::uniform_real_distribution<SCALAR_TYPE> distB(SCALAR_TYPE(-5.0f), SCALAR_TYPE(5.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        inputB[i] = distB(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::pow(inputA[i], inputB[i]) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec2 = vec0.pow(mask, vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MPOWV gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec2;
+        vec2 = UME::SIMD::FUNCTIONS::pow(mask, vec0, vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MPOWV(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericPOWSTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.1f), SCALAR_TYPE(10.0f));
+    std::uniform_real_distribution<SCALAR_TYPE> distB(SCALAR_TYPE(-5.0f), SCALAR_TYPE(5.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB = distB(gen);
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        output[i] = std::pow(inputA[i], inputB);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.pow(inputB);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWS gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::pow(vec0, inputB);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWS(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericMPOWSTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.1f), SCALAR_TYPE(10.0f));
+    std::uniform_real_distribution<SCALAR_TYPE> distB(SCALAR_TYPE(-5.0f), SCALAR_TYPE(5.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB = distB(gen);
+    SCALAR_TYPE output[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = inputMask[i] ? std::pow(inputA[i], inputB) : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.pow(mask, inputB);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MPOWS gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::pow(mask, vec0, inputB);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MPOWS(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericPOWITest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(-2.0f), SCALAR_TYPE(2.0f));
+    std::uniform_int_distribution<int> distN(-6, 6);
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    int inputN = distN(gen);
+    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE outputMasked[VEC_LEN];
+    SCALAR_TYPE output5[VEC_LEN];
+    SCALAR_TYPE outputMinus3[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        if (std::abs(inputA[i]) < SCALAR_TYPE(0.5f)) inputA[i] += SCALAR_TYPE(1.0f);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = std::pow(inputA[i], inputN);
+        outputMasked[i] = inputMask[i] ? output[i] : inputA[i];
+        output5[i] = std::pow(inputA[i], 5);
+        outputMinus3[i] = std::pow(inputA[i], -3);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.powi(inputN);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWI gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::powi(vec0, inputN);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWI(function) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1 = vec0.powi(mask, inputN);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputMasked, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MPOWI gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::powi(mask, vec0, inputN);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputMasked, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MPOWI(function) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.template pow<5>();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output5, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWN gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1;
+        vec1 = UME::SIMD::FUNCTIONS::pow<-3>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputMinus3, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWN(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericPOWPRECISIONTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.1f), SCALAR_TYPE(10.0f));
+    std::uniform_real_distribution<SCALAR_TYPE> distB(SCALAR_TYPE(-5.0f), SCALAR_TYPE(5.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    SCALAR_TYPE outputMasked[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        inputB[i] = distB(gen);
+        inputMask[i] = randomValue<bool>(gen);
+        output[i] = std::pow(inputA[i], inputB[i]);
+        outputMasked[i] = inputMask[i] ? output[i] : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2;
+        vec2 = UME::SIMD::FUNCTIONS::pow<UME::SIMD::PRECISION_FAST>(vec0, vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWV(function, fast) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2;
+        vec2 = UME::SIMD::FUNCTIONS::pow<UME::SIMD::PRECISION_ACCURATE>(vec0, vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWV(function, accurate) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec2;
+        vec2 = UME::SIMD::FUNCTIONS::pow<UME::SIMD::PRECISION_FAST>(mask, vec0, vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, outputMasked, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MPOWV(function, fast) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericTRIGLARGETest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    // Arguments above the Cody-Waite range of the single precision kernels
+    const int maxExp = std::numeric_limits<SCALAR_TYPE>::digits > 24 ? 26 : 120;
+    std::uniform_real_distribution<SCALAR_TYPE> distM(SCALAR_TYPE(1.0f), SCALAR_TYPE(2.0f));
+    std::uniform_int_distribution<int> distE(13, maxExp);
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE outputSin[VEC_LEN];
+    SCALAR_TYPE outputCos[VEC_LEN];
+    SCALAR_TYPE outputTan[VEC_LEN];
+    SCALAR_TYPE outputSinMasked[VEC_LEN];
+    SCALAR_TYPE outputCosMasked[VEC_LEN];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = std::ldexp(distM(gen), distE(gen));
+        if (randomValue<bool>(gen)) inputA[i] = -inputA[i];
+        inputMask[i] = randomValue<bool>(gen);
+        outputSin[i] = std::sin(inputA[i]);
+        outputCos[i] = std::cos(inputA[i]);
+        outputTan[i] = std::tan(inputA[i]);
+        outputSinMasked[i] = inputMask[i] ? outputSin[i] : inputA[i];
+        outputCosMasked[i] = inputMask[i] ? outputCos[i] : inputA[i];
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.sin();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputSin, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "SIN(large) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.cos();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputCos, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "COS(large) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.tan();
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputTan, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "TAN(large) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1, vec2;
+        vec0.sincos(vec1, vec2);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputSin, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec2.store(values);
+        inRange &= valuesInRange(values, outputCos, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "SINCOS(large) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        MASK_TYPE mask(inputMask);
+        VEC_TYPE vec1, vec2;
+        vec0.sincos(mask, vec1, vec2);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputSinMasked, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec2.store(values);
+        inRange &= valuesInRange(values, outputCosMasked, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "MSINCOS(large) gen");
+    }
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
 void genericMCTANTest()
 {
@@ -11048,16 +13854,23 @@ void genericBaseInterfaceTest()
     // PREFETCH1
     // PREFETCH2
     genericLOAD_STORETest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
+    genericPREFETCHTest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericMLOADTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericMSTORETest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericLOADA_STOREATest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericMLOADATest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericMSTOREATest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericSSTORETest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
+    genericMSSTORETest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericCOMPRESSTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     // SWIZZLE
     genericSWIZZLETest_random<VEC_TYPE, SCALAR_TYPE, SWIZZLE_TYPE, VEC_LEN>();
     // SWIZZLEA
     genericSORTATest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericSORTDTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericSORTAKVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericSORTDKVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericBSORTTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericBLENDVTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericADDVTest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericADDVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
@@ -11155,6 +13968,7 @@ void genericBaseInterfaceTest()
     genericCMPLESTest<VEC_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
     genericCMPEVTest<VEC_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
     genericCMPESTest<VEC_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
+    genericUNIQUETest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
 
     // BLENDV
     // BLENDS
@@ -11220,6 +14034,7 @@ void genericIntegerInterfaceTest()
 
     genericLANDVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericLORVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericCONFLICTTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
 
     // Bitwise interface tests
     genericBANDVTest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
@@ -11259,6 +14074,10 @@ void genericIntegerInterfaceTest()
     genericMBANDNOTVATest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericBANDNOTSATest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericMBANDNOTSATest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericBITCOUNTTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericLOOKUP16Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>(std::integral_constant<bool, sizeof(SCALAR_TYPE) == 1>());
+    genericDIVINVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMULHITest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
 
     genericHBANDTest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericMHBANDTest<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
@@ -11282,7 +14101,9 @@ void genericGatherScatterInterfaceTest()
     genericGATHERSTest_random<VEC_TYPE, SCALAR_TYPE, SCALAR_UINT_TYPE, VEC_LEN>();
     genericMGATHERSTest_random<VEC_TYPE, SCALAR_TYPE, SCALAR_UINT_TYPE, MASK_TYPE, VEC_LEN>();
     genericGATHERVTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, VEC_LEN>();
+    genericPREFETCHGATHERTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, VEC_LEN>();
     genericMGATHERVTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, MASK_TYPE, VEC_LEN>();
+    genericPERMUTEVTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, VEC_LEN>();
     genericSCATTERUTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericMSCATTERUTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericSCATTERSTest_random<VEC_TYPE, SCALAR_TYPE, SCALAR_UINT_TYPE, VEC_LEN>();
@@ -11376,15 +14197,59 @@ void genericFloatInterfaceTest()
     genericLOGTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericLOG2Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericLOG10Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMLOG2Test_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericMLOG10Test_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericLOGSPECIALTest<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
 
     genericSINTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     // MSIN
     genericCOSTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     // MCOS
     genericTANTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
-    // MTAN
+    genericMTANTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericCTANTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
-    // CTAN
+    genericMCTANTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericATANTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMATANTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericATAN2Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMATAN2Test_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericASINTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMASINTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericACOSTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMACOSTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericEXP2Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMEXP2Test_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericEXPM1Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMEXPM1Test_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericLOG1PTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMLOG1PTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericLOG1PSPECIALTest<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericSINHTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMSINHTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericCOSHTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMCOSHTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericTANHTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMTANHTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericERFTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMERFTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericERFCTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMERFCTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericNORMCDFTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMNORMCDFTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericNORMINVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMNORMINVTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericNORMINVSPECIALTest<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericEXPPRECISIONTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericLOGPRECISIONTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericSINPRECISIONTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericCOSPRECISIONTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericPOWVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMPOWVTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericPOWSTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericMPOWSTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericPOWITest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericPOWPRECISIONTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericTRIGLARGETest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
 }
 
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
@@ -11423,6 +14288,8 @@ void genericMaskTest() {
     genericHLANDTest<MASK_TYPE, VEC_LEN, DATA_SET> ();
     genericHLORTest<MASK_TYPE, VEC_LEN, DATA_SET> ();
     genericHLXORTest<MASK_TYPE, VEC_LEN, DATA_SET> ();
+    genericFIRSTNTest<MASK_TYPE, VEC_LEN> ();
+    genericBITMASKTest_random<MASK_TYPE, VEC_LEN> ();
 }
 
 template<
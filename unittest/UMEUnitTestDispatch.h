@@ -0,0 +1,89 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_UNIT_TEST_DISPATCH_H_
+#define UME_UNIT_TEST_DISPATCH_H_
+
+#include "UMEUnitTestCommon.h"
+#include "../UMESimdDispatch.h"
+
+namespace {
+    int dispatch_scalar(int x) { return x + int(UME::SIMD::DISPATCH_SCALAR); }
+    int dispatch_sse(int x)    { return x + int(UME::SIMD::DISPATCH_SSE); }
+    int dispatch_avx(int x)    { return x + int(UME::SIMD::DISPATCH_AVX); }
+    int dispatch_avx2(int x)   { return x + int(UME::SIMD::DISPATCH_AVX2); }
+    int dispatch_avx512(int x) { return x + int(UME::SIMD::DISPATCH_AVX512); }
+}
+
+int test_dispatch(bool supressMessages)
+{
+    char header[] = "UME::SIMD::Dispatcher test";
+    INIT_TEST(header, supressMessages);
+
+    UME::SIMD::DispatchISA host = UME::SIMD::hostISA();
+
+    // This binary runs, so the host supports at least the ISA it was built for.
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__) && defined(__AVX512DQ__) && defined(__AVX512CD__)
+    check_condition(host >= UME::SIMD::DISPATCH_AVX512, "hostISA() >= DISPATCH_AVX512");
+#elif defined(__AVX2__) && defined(__FMA__)
+    check_condition(host >= UME::SIMD::DISPATCH_AVX2, "hostISA() >= DISPATCH_AVX2");
+#elif defined(__AVX__)
+    check_condition(host >= UME::SIMD::DISPATCH_AVX, "hostISA() >= DISPATCH_AVX");
+#elif defined(__SSE4_2__)
+    check_condition(host >= UME::SIMD::DISPATCH_SSE, "hostISA() >= DISPATCH_SSE");
+#endif
+    check_condition(host == UME::SIMD::hostISA(), "hostISA() cached");
+
+    {
+        UME::SIMD::Dispatcher<int(*)(int)> d(
+            dispatch_scalar, dispatch_sse, dispatch_avx, dispatch_avx2, dispatch_avx512);
+        check_condition(d.isa() == host, "Dispatcher full table");
+        check_condition(d(10) == 10 + int(host), "Dispatcher full table call");
+    }
+    {
+        UME::SIMD::Dispatcher<int(*)(int)> d(
+            dispatch_scalar, nullptr, nullptr, nullptr, nullptr);
+        check_condition(d.isa() == UME::SIMD::DISPATCH_SCALAR, "Dispatcher baseline only");
+        check_condition(d.get() == &dispatch_scalar, "Dispatcher baseline only call");
+    }
+    {
+        UME::SIMD::Dispatcher<int(*)(int)> d(
+            dispatch_scalar, dispatch_sse, nullptr, dispatch_avx2, nullptr);
+        UME::SIMD::DispatchISA expected = UME::SIMD::DISPATCH_SCALAR;
+        if (host >= UME::SIMD::DISPATCH_SSE) expected = UME::SIMD::DISPATCH_SSE;
+        if (host >= UME::SIMD::DISPATCH_AVX2) expected = UME::SIMD::DISPATCH_AVX2;
+        check_condition(d.isa() == expected, "Dispatcher fallback");
+        check_condition(d(10) == 10 + int(expected), "Dispatcher fallback call");
+    }
+
+    return g_failCount;
+}
+
+#endif
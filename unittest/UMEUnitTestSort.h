@@ -0,0 +1,109 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_UNIT_TEST_SORT_H_
+#define UME_UNIT_TEST_SORT_H_
+
+#include "UMEUnitTestCommon.h"
+#include "../UMESimdSort.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+template<typename SCALAR_T, typename PAYLOAD_T>
+void genericSortTest(std::string const & scalar_type) {
+    // Sizes below, around and above the register, block and chunk lengths.
+    const int sizes[] = { 0, 1, 7, 64, 100, 1000, 8191, 20000, 70001 };
+    std::mt19937 gen;
+
+    for (int size : sizes) {
+        for (int duplicates = 0; duplicates < 2; duplicates++) {
+            std::vector<SCALAR_T> keys(size);
+            for (int i = 0; i < size; i++) {
+                keys[i] = (duplicates && i > 0) ? keys[randomValue<uint32_t>(gen) % i] : randomValue<SCALAR_T>(gen);
+            }
+            std::vector<SCALAR_T> expected(keys);
+            std::sort(expected.begin(), expected.end());
+
+            std::vector<SCALAR_T> sorted(keys);
+            UME::SIMD::sort(sorted.data(), sorted.data() + size);
+
+            std::string msg = "SORT <" + scalar_type + "> n=" + std::to_string(size);
+            if (duplicates) msg.append(" duplicates");
+            check_condition(sorted == expected, msg);
+
+            std::vector<SCALAR_T> sortedKV(keys);
+            std::vector<PAYLOAD_T> payload(size);
+            for (int i = 0; i < size; i++) payload[i] = PAYLOAD_T(i);
+            UME::SIMD::sort(sortedKV.data(), sortedKV.data() + size, payload.data());
+
+            bool payloadMatches = true;
+            std::vector<bool> seen(size, false);
+            for (int i = 0; i < size; i++) {
+                if (payload[i] >= PAYLOAD_T(size) || seen[payload[i]] || keys[payload[i]] != sortedKV[i]) {
+                    payloadMatches = false;
+                    break;
+                }
+                seen[payload[i]] = true;
+            }
+            check_condition(sortedKV == expected && payloadMatches, msg + " (payload)");
+        }
+    }
+
+    {
+        // Reversed input is the worst case for the merge passes.
+        const int size = 50000;
+        std::vector<SCALAR_T> keys(size);
+        for (int i = 0; i < size; i++) keys[i] = randomValue<SCALAR_T>(gen);
+        std::sort(keys.begin(), keys.end());
+        std::vector<SCALAR_T> expected(keys);
+        std::reverse(keys.begin(), keys.end());
+        UME::SIMD::sort(keys.data(), keys.data() + size);
+        check_condition(keys == expected, "SORT <" + scalar_type + "> reversed");
+    }
+}
+
+int test_sort(bool supressMessages)
+{
+    char header[] = "UME::SIMD::sort test";
+    INIT_TEST(header, supressMessages);
+
+    genericSortTest<uint32_t, uint32_t>(std::string("uint32_t"));
+    genericSortTest<int32_t, uint32_t>(std::string("int32_t"));
+    genericSortTest<float, uint32_t>(std::string("float"));
+    genericSortTest<uint64_t, uint64_t>(std::string("uint64_t"));
+    genericSortTest<int64_t, uint64_t>(std::string("int64_t"));
+    genericSortTest<double, uint64_t>(std::string("double"));
+
+    return g_failCount;
+}
+
+#endif